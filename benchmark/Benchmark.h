@@ -0,0 +1,86 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Libraries
+#include <string>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class Benchmark
+/**
+ * This is the base class of the benchmarks. A benchmark measures the performance of a
+ * part of the library and reports its results on the standard output.
+ */
+class Benchmark {
+
+    private:
+
+        // ---------- Attributes ---------- //
+
+        /// Name of the benchmark
+        std::string mName;
+
+    protected:
+
+        // ---------- Methods ---------- //
+
+        /// Return the current time in seconds
+        static double getTime() {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /// Report a result of the benchmark
+        void report(const std::string& label, double value, const std::string& unit) const {
+            std::cout << std::left << std::setw(24) << mName << std::setw(48) << label
+                      << std::right << std::setw(16) << std::fixed << std::setprecision(2) << value << " " << unit << std::endl;
+        }
+
+    public:
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        Benchmark(const std::string& name) : mName(name) {}
+
+        /// Destructor
+        virtual ~Benchmark() = default;
+
+        /// Return the name of the benchmark
+        const std::string& getName() const { return mName; }
+
+        /// Run the benchmark
+        virtual void run()=0;
+};
+
+}
+
+#endif
@@ -0,0 +1,149 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef BOX_VS_BOX_BENCHMARK_H
+#define BOX_VS_BOX_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class BoxVsBoxBenchmark
+/**
+ * Compare the box vs box narrow-phase algorithm with the convex polyhedron vs
+ * convex polyhedron algorithm on many pairs of overlapping boxes
+ */
+class BoxVsBoxBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Types ---------- //
+
+        /// Contact callback that counts the contact points
+        class ContactCounter : public CollisionCallback {
+
+            public:
+
+                uint32 nbContactPoints = 0;
+
+                virtual void onContact(const CallbackData& callbackData) override {
+                    for (uint32 p=0; p < callbackData.getNbContactPairs(); p++) {
+                        nbContactPoints += callbackData.getContactPair(p).getNbContactPoints();
+                    }
+                }
+        };
+
+        // ---------- Constants ---------- //
+
+        /// Number of pairs of boxes along the x and z axis of the scene
+        static constexpr int NB_PAIRS_XZ = 32;
+
+        /// Number of times the collisions are tested
+        static constexpr int NB_ITERATIONS = 50;
+
+        // ---------- Attributes ---------- //
+
+        /// Physics common
+        PhysicsCommon mPhysicsCommon;
+
+        /// Box collision shape
+        BoxShape* mBoxShape = nullptr;
+
+        // ---------- Methods ---------- //
+
+        /// Create the scene with pairs of overlapping boxes (resting, rotated and edge vs edge contacts)
+        void createScene(PhysicsWorld* world) {
+
+            for (int x=0; x < NB_PAIRS_XZ; x++) {
+                for (int z=0; z < NB_PAIRS_XZ; z++) {
+
+                    const Vector3 position(decimal(x) * decimal(4.0), 0, decimal(z) * decimal(4.0));
+                    const decimal angle = decimal(x * NB_PAIRS_XZ + z) * decimal(0.37);
+
+                    Quaternion orientation = Quaternion::identity();
+                    switch ((x + z) % 3) {
+                        case 0: orientation = Quaternion::fromEulerAngles(0, angle, 0); break;
+                        case 1: orientation = Quaternion::fromEulerAngles(decimal(0.2) * std::sin(angle), angle, decimal(0.2) * std::cos(angle)); break;
+                        case 2: orientation = Quaternion::fromEulerAngles(decimal(0.785), angle, decimal(0.615)); break;
+                    }
+
+                    RigidBody* body1 = world->createRigidBody(Transform(position, Quaternion::identity()));
+                    body1->addCollider(mBoxShape, Transform::identity());
+                    RigidBody* body2 = world->createRigidBody(Transform(position + Vector3(0, decimal(0.95), 0), orientation));
+                    body2->addCollider(mBoxShape, Transform::identity());
+                }
+            }
+        }
+
+        /// Test the collisions of the scene with or without the box vs box algorithm and report the time
+        void runScene(bool isBoxVsBoxAlgorithmEnabled) {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            world->getCollisionDispatch().setIsBoxVsBoxAlgorithmEnabled(isBoxVsBoxAlgorithmEnabled);
+            createScene(world);
+
+            ContactCounter warmupCounter;
+            world->testCollision(warmupCounter);
+
+            ContactCounter counter;
+            const double startTime = getTime();
+            for (int i=0; i < NB_ITERATIONS; i++) {
+                world->testCollision(counter);
+            }
+            const double totalTime = getTime() - startTime;
+
+            const std::string algorithmName = isBoxVsBoxAlgorithmEnabled ? "Box vs box" : "Convex polyhedron vs convex polyhedron";
+            report(algorithmName + " time", totalTime * 1000.0 / NB_ITERATIONS, "ms");
+            report(algorithmName + " contact points", double(counter.nbContactPoints / NB_ITERATIONS), "points");
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        BoxVsBoxBenchmark(const std::string& name) : Benchmark(name) {}
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            mBoxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            runScene(false);
+            runScene(true);
+
+            mPhysicsCommon.destroyBoxShape(mBoxShape);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,156 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef BROAD_PHASE_BENCHMARK_H
+#define BROAD_PHASE_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class BroadPhaseBenchmark
+/**
+ * Compare the broad-phase algorithms on scenes similar to the scenes of the testbed
+ */
+class BroadPhaseBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of frames simulated before the measure
+        static constexpr int NB_WARMUP_FRAMES = 30;
+
+        /// Number of measured frames
+        static constexpr int NB_FRAMES = 200;
+
+        // ---------- Attributes ---------- //
+
+        /// Physics common
+        PhysicsCommon mPhysicsCommon;
+
+        // ---------- Methods ---------- //
+
+        /// Create a static floor
+        void createFloor(PhysicsWorld* world, decimal halfSize) {
+
+            RigidBody* floor = world->createRigidBody(Transform::identity());
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(halfSize, 1, halfSize)), Transform::identity());
+        }
+
+        /// Create the scene with many boxes of the same size on a flat ground (like the cubes scene)
+        void createFlatScene(PhysicsWorld* world) {
+
+            createFloor(world, 100);
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            for (int x=0; x < 40; x++) {
+                for (int z=0; z < 40; z++) {
+
+                    // The rows are shifted so that the boxes are not aligned on the axes
+                    const Vector3 position(decimal(x) * decimal(2.5) + decimal(z) * decimal(0.37) - 50, decimal(2.0) + decimal((x + z) % 3),
+                                           decimal(z) * decimal(2.5) + decimal(x) * decimal(0.61) - 50);
+                    RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                    body->addCollider(boxShape, Transform::identity());
+                }
+            }
+        }
+
+        /// Create the scene with a pile of boxes, spheres and capsules of different sizes (like the pile scene)
+        void createPileScene(PhysicsWorld* world) {
+
+            createFloor(world, 30);
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(1.5));
+            CapsuleShape* capsuleShape = mPhysicsCommon.createCapsuleShape(decimal(0.8), decimal(2.0));
+            for (int i=0; i < 600; i++) {
+
+                const decimal angle = decimal(i) * decimal(0.5);
+                const decimal radius = decimal(3.0) + decimal(i % 20);
+                const Vector3 position(radius * std::cos(angle), decimal(3.0) + decimal(i / 20) * decimal(2.0), radius * std::sin(angle));
+                RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+
+                CollisionShape* shape = i % 3 == 0 ? static_cast<CollisionShape*>(boxShape) :
+                                        (i % 3 == 1 ? static_cast<CollisionShape*>(sphereShape) : capsuleShape);
+                body->addCollider(shape, Transform::identity());
+            }
+        }
+
+        /// Simulate a scene with a broad-phase algorithm and report the frame time
+        void runScene(const std::string& sceneName, void (BroadPhaseBenchmark::*createScene)(PhysicsWorld*),
+                      BroadPhaseAlgorithmType algorithmType) {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.broadPhaseAlgorithmType = algorithmType;
+            settings.broadPhaseGridCellSize = decimal(2.0);
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+            (this->*createScene)(world);
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+            for (int i=0; i < NB_WARMUP_FRAMES; i++) {
+                world->update(timeStep);
+            }
+
+            const double startTime = getTime();
+            for (int i=0; i < NB_FRAMES; i++) {
+                world->update(timeStep);
+            }
+            const double totalTime = getTime() - startTime;
+
+            const std::string algorithmName = algorithmType == BroadPhaseAlgorithmType::SWEEP_AND_PRUNE ? "Sweep-and-prune" :
+                                              (algorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID ? "Spatial hash grid" : "AABB tree");
+            report(sceneName + " " + algorithmName + " frame time", totalTime * 1000.0 / NB_FRAMES, "ms");
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        BroadPhaseBenchmark(const std::string& name) : Benchmark(name) {}
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            runScene("Flat", &BroadPhaseBenchmark::createFlatScene, BroadPhaseAlgorithmType::DYNAMIC_AABB_TREE);
+            runScene("Flat", &BroadPhaseBenchmark::createFlatScene, BroadPhaseAlgorithmType::SWEEP_AND_PRUNE);
+            runScene("Flat", &BroadPhaseBenchmark::createFlatScene, BroadPhaseAlgorithmType::SPATIAL_HASH_GRID);
+            runScene("Pile", &BroadPhaseBenchmark::createPileScene, BroadPhaseAlgorithmType::DYNAMIC_AABB_TREE);
+            runScene("Pile", &BroadPhaseBenchmark::createPileScene, BroadPhaseAlgorithmType::SWEEP_AND_PRUNE);
+            runScene("Pile", &BroadPhaseBenchmark::createPileScene, BroadPhaseAlgorithmType::SPATIAL_HASH_GRID);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,170 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef CONTACT_SOLVER_BENCHMARK_H
+#define CONTACT_SOLVER_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class ContactPointsCounter
+/**
+ * Event listener that counts the contact points of a frame
+ */
+class ContactPointsCounter : public EventListener {
+
+    public:
+
+        /// Number of contact points reported during the last frame
+        uint32 nbContactPoints = 0;
+
+        /// Called when some contacts occur
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+
+            nbContactPoints = 0;
+            for (uint32 i=0; i < callbackData.getNbContactPairs(); i++) {
+                nbContactPoints += callbackData.getContactPair(i).getNbContactPoints();
+            }
+        }
+};
+
+// Class ContactSolverBenchmark
+/**
+ * Benchmark of the graph-colored contact solver with the scalar and the wide (SIMD)
+ * contact solvers. The scene is a single large island made of a wall of boxes on a
+ * static floor. The result is the number of contact points solved per second (number
+ * of contact points times the number of velocity iterations per frame, divided by the
+ * time of the whole world update).
+ */
+class ContactSolverBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of boxes along the x and z axis of the wall
+        static constexpr int NB_BOXES_XZ = 16;
+
+        /// Number of boxes along the y axis of the wall
+        static constexpr int NB_BOXES_Y = 6;
+
+        /// Number of frames simulated before the measure
+        static constexpr int NB_WARMUP_FRAMES = 30;
+
+        /// Number of measured frames
+        static constexpr int NB_FRAMES = 200;
+
+        // ---------- Attributes ---------- //
+
+        /// Physics common
+        PhysicsCommon mPhysicsCommon;
+
+        // ---------- Methods ---------- //
+
+        /// Create the large island of the benchmark
+        void createWall(PhysicsWorld* world) {
+
+            RigidBody* floor = world->createRigidBody(Transform::identity());
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            // The boxes touch each other and form a single island
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            for (int x=0; x < NB_BOXES_XZ; x++) {
+                for (int z=0; z < NB_BOXES_XZ; z++) {
+                    for (int y=0; y < NB_BOXES_Y; y++) {
+
+                        const Vector3 position(decimal(x) * decimal(1.01), decimal(1.5) + decimal(y), decimal(z) * decimal(1.01));
+                        RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                        body->addCollider(boxShape, Transform::identity());
+                    }
+                }
+            }
+        }
+
+        /// Simulate the scene and report the results of a contact solver
+        void runSolver(TaskScheduler* scheduler, bool isWideContactSolverEnabled) {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            settings.graphColoringNbConstraintsThreshold = 1;
+            settings.isWideContactSolverEnabled = isWideContactSolverEnabled;
+            settings.isSleepingEnabled = false;
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+            ContactPointsCounter counter;
+            world->setEventListener(&counter);
+            createWall(world);
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+            for (int i=0; i < NB_WARMUP_FRAMES; i++) {
+                world->update(timeStep);
+            }
+
+            double nbSolvedContactPoints = 0;
+            double totalTime = 0;
+            for (int i=0; i < NB_FRAMES; i++) {
+
+                const double startTime = getTime();
+                world->update(timeStep);
+                totalTime += getTime() - startTime;
+
+                nbSolvedContactPoints += double(counter.nbContactPoints) * world->getNbIterationsVelocitySolver();
+            }
+
+            const std::string solverName = isWideContactSolverEnabled ? "Wide (" + std::to_string(RP3D_SIMD_WIDTH) + " lanes)" : "Scalar";
+            report(solverName + " frame time", totalTime * 1000.0 / NB_FRAMES, "ms");
+            report(solverName + " contact points solved", nbSolvedContactPoints / totalTime, "contacts/s");
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        ContactSolverBenchmark(const std::string& name) : Benchmark(name) {}
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            // The graph-colored solver is only used with a task scheduler that has several threads
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(2);
+
+            runSolver(scheduler, false);
+            runSolver(scheduler, true);
+
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,147 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef RAYCAST_BENCHMARK_H
+#define RAYCAST_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class RaycastBenchmark
+class RaycastBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of boxes along the x and z axis of the scene
+        static constexpr int NB_BOXES_XZ = 40;
+
+        /// Number of rays along the x and z axis of the grid of rays
+        static constexpr int NB_RAYS_XZ = 256;
+
+        /// Number of times the rays are cast
+        static constexpr int NB_ITERATIONS = 20;
+
+        // ---------- Attributes ---------- //
+
+        /// Physics common
+        PhysicsCommon mPhysicsCommon;
+
+        // ---------- Methods ---------- //
+
+        /// Create the scene of static and dynamic boxes at different heights
+        void createScene(PhysicsWorld* world) {
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.4), decimal(0.4), decimal(0.4)));
+            for (int x=0; x < NB_BOXES_XZ; x++) {
+                for (int z=0; z < NB_BOXES_XZ; z++) {
+
+                    const Vector3 position(decimal(x), decimal((x * 7 + z * 3) % 5), decimal(z));
+                    RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                    body->setType((x + z) % 3 == 0 ? BodyType::DYNAMIC : BodyType::STATIC);
+                    body->addCollider(boxShape, Transform::identity());
+                }
+            }
+        }
+
+        /// Report the time and the number of rays per second of a raycast method
+        void reportRaycast(const std::string& name, double totalTime, uint32 nbRays, uint32 nbHits) {
+            report(name + " time", totalTime * 1000.0 / NB_ITERATIONS, "ms");
+            report(name + " rays", double(nbRays) * NB_ITERATIONS / totalTime, "rays/s");
+            report(name + " hits", double(nbHits), "hits");
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        RaycastBenchmark(const std::string& name) : Benchmark(name) {}
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler();
+
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+            createScene(world);
+            world->update(decimal(1.0) / decimal(60.0));
+
+            // Grid of coherent downward rays over the scene
+            std::vector<Ray> rays;
+            const decimal spacing = decimal(NB_BOXES_XZ) / decimal(NB_RAYS_XZ);
+            for (int x=0; x < NB_RAYS_XZ; x++) {
+                for (int z=0; z < NB_RAYS_XZ; z++) {
+                    const Vector3 origin(decimal(x) * spacing, 20, decimal(z) * spacing);
+                    rays.push_back(Ray(origin, origin + Vector3(decimal(0.5), -40, decimal(0.5))));
+                }
+            }
+            const uint32 nbRays = static_cast<uint32>(rays.size());
+            std::vector<RaycastInfo> raycastInfos(nbRays);
+
+            // Cast the rays one at a time
+            uint32 nbHits = 0;
+            double startTime = getTime();
+            for (int i=0; i < NB_ITERATIONS; i++) {
+                nbHits = 0;
+                for (uint32 r=0; r < nbRays; r++) {
+                    nbHits += world->raycast(rays[r], raycastInfos[r]) ? 1 : 0;
+                }
+            }
+            reportRaycast("Single rays", getTime() - startTime, nbRays, nbHits);
+
+            // Cast the rays by packets
+            startTime = getTime();
+            for (int i=0; i < NB_ITERATIONS; i++) {
+                nbHits = world->raycastBatch(rays.data(), nbRays, raycastInfos.data());
+            }
+            reportRaycast("Batch (" + std::to_string(DynamicAABBTree::RAYCAST_PACKET_SIZE) + " rays/packet)",
+                          getTime() - startTime, nbRays, nbHits);
+
+            // Cast the rays by packets on the threads of the task scheduler
+            startTime = getTime();
+            for (int i=0; i < NB_ITERATIONS; i++) {
+                nbHits = world->raycastBatch(rays.data(), nbRays, raycastInfos.data(), 0xFFFF, true);
+            }
+            reportRaycast("Parallel batch (" + std::to_string(scheduler->getNbThreads()) + " threads)",
+                          getTime() - startTime, nbRays, nbHits);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+};
+
+}
+
+#endif
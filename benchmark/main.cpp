@@ -0,0 +1,59 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include "Benchmark.h"
+#include "benchmarks/ContactSolverBenchmark.h"
+#include "benchmarks/RaycastBenchmark.h"
+#include "benchmarks/BroadPhaseBenchmark.h"
+#include "benchmarks/BoxVsBoxBenchmark.h"
+#include <vector>
+#include <memory>
+
+using namespace reactphysics3d;
+
+// Run all the benchmarks or only the ones whose name is given as argument
+int main(int argc, char** argv) {
+
+    std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    benchmarks.emplace_back(new ContactSolverBenchmark("ContactSolver"));
+    benchmarks.emplace_back(new RaycastBenchmark("Raycast"));
+    benchmarks.emplace_back(new BroadPhaseBenchmark("BroadPhase"));
+    benchmarks.emplace_back(new BoxVsBoxBenchmark("BoxVsBox"));
+
+    for (const std::unique_ptr<Benchmark>& benchmark : benchmarks) {
+
+        bool isSelected = argc < 2;
+        for (int i=1; i < argc; i++) {
+            isSelected |= benchmark->getName() == argv[i];
+        }
+
+        if (isSelected) {
+            benchmark->run();
+        }
+    }
+
+    return 0;
+}
@@ -75,6 +75,9 @@ class Collider {
         /// changed by the user
         void setHasCollisionShapeChangedSize(bool hasCollisionShapeChangedSize);
 
+        /// Raycast method with feedback information (with an allocator for the temporary memory)
+        bool raycast(const Ray& ray, RaycastInfo& raycastInfo, MemoryAllocator& allocator);
+
     public:
 
         // -------------------- Methods -------------------- //
@@ -190,6 +193,7 @@ class Collider {
         friend class CollisionShape;
         friend class ContactManifoldSet;
 		friend class MiddlePhaseTriangleCallback;
+        friend struct RaycastTest;
 
 };
 
@@ -59,6 +59,19 @@ class ConvexMesh {
         /// All the vertices of the mesh
         Array<Vector3> mVertices;
 
+        /// Coordinates of the vertices in structure-of-arrays layout. The arrays are padded with the
+        /// first vertex to a multiple of the number of SIMD lanes
+        Array<decimal> mVerticesX;
+        Array<decimal> mVerticesY;
+        Array<decimal> mVerticesZ;
+
+        /// Start index of the neighbors of each vertex in the mVerticesNeighbors array
+        /// (the neighbors of vertex i are in the range [mVerticesNeighborsStartIndex[i], mVerticesNeighborsStartIndex[i+1]))
+        Array<uint32> mVerticesNeighborsStartIndex;
+
+        /// Indices of the neighbor vertices (vertices connected with an edge) of each vertex
+        Array<uint32> mVerticesNeighbors;
+
         /// Array with the face normals
         Array<Vector3> mFacesNormals;
 
@@ -94,6 +107,9 @@ class ConvexMesh {
         /// Compute the volume of the mesh
         void computeVolume();
 
+        /// Compute the vertices neighbors and the structure-of-arrays vertices used to compute support vertices
+        void computeSupportVerticesData();
+
     public:
 
         // -------------------- Methods -------------------- //
@@ -113,6 +129,12 @@ class ConvexMesh {
         /// Return the half-edge structure of the mesh
         const HalfEdgeStructure& getHalfEdgeStructure() const;
 
+        /// Return the index of the vertex with the largest dot product with a direction by testing all the vertices
+        uint32 computeSupportVertexBruteForce(const Vector3& direction) const;
+
+        /// Return the index of the vertex with the largest dot product with a direction using hill-climbing
+        uint32 computeSupportVertexHillClimbing(const Vector3& direction, uint32 startVertexIndex) const;
+
         /// Return the centroid of the mesh
         const Vector3& getCentroid() const;
 
@@ -184,6 +184,27 @@ class OverlapCallback {
         virtual void onOverlap(CallbackData& callbackData)=0;
 };
 
+// Class AABBQueryCallback
+/**
+ * This class can be used to register a callback for the AABB queries of the world. You should implement
+ * your own class inherited from this one and implement the notifyOverlappingCollider() method. This method
+ * will be called for each collider with a world-space AABB overlapping with the queried AABB. Note that during
+ * a query snapshot, this method can be called concurrently by multiple threads if the queries are
+ * executed on multiple threads.
+ */
+class AABBQueryCallback {
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Destructor
+        virtual ~AABBQueryCallback() = default;
+
+        /// This method will be called for each collider overlapping with the queried AABB
+        virtual void notifyOverlappingCollider(Collider* collider)=0;
+};
+
 // Return the number of overlapping pairs of bodies
 RP3D_FORCE_INLINE uint32 OverlapCallback::CallbackData::getNbOverlappingPairs() const {
     return static_cast<uint32>(mContactPairsIndices.size() + mLostContactPairsIndices.size());
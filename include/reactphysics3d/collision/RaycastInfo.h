@@ -36,6 +36,7 @@ namespace reactphysics3d {
 class Body;
 class Collider;
 class CollisionShape;
+class MemoryAllocator;
 struct Ray;
 
 // Structure RaycastInfo
@@ -128,15 +129,27 @@ struct RaycastTest {
 
     public:
 
-        /// User callback class
+        /// User callback class (nullptr if only the closest hit is computed)
         RaycastCallback* userCallback;
 
+        /// Information about the closest hit (only used if there is no user callback)
+        RaycastInfo* closestHitInfo;
+
+        /// Allocator used for the temporary memory of the raycast
+        MemoryAllocator& allocator;
+
         /// Constructor
-        RaycastTest(RaycastCallback* callback) {
+        RaycastTest(RaycastCallback* callback, MemoryAllocator& allocator) : closestHitInfo(nullptr), allocator(allocator) {
             userCallback = callback;
 
         }
 
+        /// Constructor for a raycast that only computes the closest hit
+        RaycastTest(RaycastInfo& closestHitInfo, MemoryAllocator& allocator)
+            : userCallback(nullptr), closestHitInfo(&closestHitInfo), allocator(allocator) {
+
+        }
+
         /// Ray cast test against a collider
         decimal raycastAgainstShape(Collider* shape, const Ray& ray);
 };
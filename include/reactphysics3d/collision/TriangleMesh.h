@@ -30,7 +30,7 @@
 #include <cassert>
 #include <reactphysics3d/containers/Array.h>
 #include <reactphysics3d/memory/MemoryAllocator.h>
-#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
 #include <reactphysics3d/containers/Map.h>
 
 namespace reactphysics3d {
@@ -61,8 +61,8 @@ class TriangleMesh {
         /// The normal vector at each vertex of the mesh
         Array<Vector3> mVerticesNormals;
 
-        /// Dynamic AABB tree to accelerate collision with the triangles
-        DynamicAABBTree mDynamicAABBTree;
+        /// Static AABB tree to accelerate collision with the triangles
+        StaticAABBTree mAABBTree;
 
         /// Epsilon value for this mesh
         decimal mEpsilon;
@@ -82,23 +82,21 @@ class TriangleMesh {
         /// Copy the triangles into the mesh
         bool copyData(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& errors);
 
-        /// Insert all the triangles into the dynamic AABB tree
-        void initBVHTree();
+        /// Build the static AABB tree with all the triangles of the mesh
+        void initBVHTree(bool isAABBTreeQuantized);
 
         /// Initialize the mesh using a TriangleVertexArray
-        bool init(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages);
+        bool init(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages,
+                  bool isAABBTreeQuantized = false);
 
-        /// Report all shapes overlapping with the AABB given in parameter.
-        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes);
+        /// Report the indices of all the triangles overlapping with the AABB given in parameter.
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingTriangles, MemoryAllocator& allocator) const;
 
         /// Remove the ununsed vertices (because they are not used in any triangles or are part of discarded triangles)
         void removeUnusedVertices(Array<bool>& areUsedVertices);
 
-        /// Return the integer data of leaf node of the dynamic AABB tree
-        int32 getDynamicAABBTreeNodeDataInt(int32 nodeID) const;
-
-        /// Ray casting method
-        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const;
+        /// Ray casting method (the index of a triangle is given as node ID to the callback)
+        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const;
 
     public:
 
@@ -111,6 +109,12 @@ class TriangleMesh {
         /// Return the bounds of the mesh in the x,y,z direction
         const AABB& getBounds() const;
 
+        /// Return true if the bounds of the nodes of the AABB tree are quantized
+        bool getIsAABBTreeQuantized() const;
+
+        /// Return the memory used by the AABB tree of the mesh (in bytes)
+        size_t getAABBTreeMemoryUsage() const;
+
         /// Return the three vertex indices of a given triangle face
         void getTriangleVerticesIndices(uint32 triangleIndex, uint32& outV1Index, uint32& outV2Index,
                                       uint32& outV3Index) const;
@@ -151,6 +155,17 @@ RP3D_FORCE_INLINE uint32 TriangleMesh::getNbTriangles() const {
     return mTriangles.size() / 3;
 }
 
+// Return true if the bounds of the nodes of the AABB tree are quantized
+RP3D_FORCE_INLINE bool TriangleMesh::getIsAABBTreeQuantized() const {
+    return mAABBTree.getIsQuantized();
+}
+
+// Return the memory used by the AABB tree of the mesh (in bytes)
+/// This can be used to compare the memory used by a quantized and a non-quantized tree
+RP3D_FORCE_INLINE size_t TriangleMesh::getAABBTreeMemoryUsage() const {
+    return mAABBTree.getMemoryUsage();
+}
+
 // Return the three vertex indices of a given triangle face
 RP3D_FORCE_INLINE void TriangleMesh::getTriangleVerticesIndices(uint32 triangleIndex, uint32& outV1Index,
                                                                 uint32& outV2Index, uint32& outV3Index) const {
@@ -197,7 +212,7 @@ RP3D_FORCE_INLINE const Vector3& TriangleMesh::getVertexNormal(uint32 vertexInde
 
 // Set the profiler
 RP3D_FORCE_INLINE void TriangleMesh::setProfiler(Profiler* profiler) {
-    mDynamicAABBTree.setProfiler(profiler);
+    mAABBTree.setProfiler(profiler);
 }
 
 #endif
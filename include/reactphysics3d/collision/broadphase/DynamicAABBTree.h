@@ -29,7 +29,9 @@
 // Libraries
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/mathematics/DecimalW.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/Stack.h>
 
 /// Namespace ReactPhysics3D
 namespace reactphysics3d {
@@ -132,6 +134,22 @@ class DynamicAABBTreeRaycastCallback {
 
 };
 
+// Class DynamicAABBTreeRaycastPacketCallback
+/**
+ * Raycast callback in the Dynamic AABB Tree called when the AABB of a leaf
+ * node is hit by one of the rays of a packet.
+ */
+class DynamicAABBTreeRaycastPacketCallback {
+
+    public:
+
+        // Called when the AABB of a leaf node is hit by the ray with a given index in the packet
+        virtual decimal raycastBroadPhaseShape(int32 nodeId, uint32 rayIndex, const Ray& ray)=0;
+
+        virtual ~DynamicAABBTreeRaycastPacketCallback() = default;
+
+};
+
 // Class DynamicAABBTree
 /**
  * This class implements a dynamic AABB tree that is used for broad-phase
@@ -141,6 +159,14 @@ class DynamicAABBTreeRaycastCallback {
  */
 class DynamicAABBTree {
 
+    public:
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of rays in a packet of rays (one ray per SIMD lane). It is given by the SIMD
+        /// width chosen when the library is configured and is the same for the library and the application
+        static constexpr uint32 RAYCAST_PACKET_SIZE = DecimalW::NB_LANES;
+
     private:
 
         // -------------------- Attributes -------------------- //
@@ -166,6 +192,9 @@ class DynamicAABBTree {
         /// The fat AABB is the initial AABB inflated by a given percentage of its size.
         decimal mFatAABBInflatePercentage;
 
+        /// ID of the next node to visit in the incremental optimization of the tree
+        int32 mOptimizeNodeID;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -247,12 +276,37 @@ class DynamicAABBTree {
         /// Report all shapes overlapping with the AABB given in parameter.
         void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int>& overlappingNodes) const;
 
+        /// Report all shapes overlapping with the AABB given in parameter (with an allocator for the temporary memory)
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int>& overlappingNodes, MemoryAllocator& allocator) const;
+
+        /// Report all shapes overlapping with the AABB given in parameter (with the stack used for the traversal)
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int>& overlappingNodes, Stack<int32>& stack) const;
+
         /// Ray casting method
         void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const;
 
+        /// Ray casting method (with an allocator for the temporary memory)
+        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const;
+
+        /// Ray casting method for a packet of rays
+        void raycastPacket(const Ray* rays, uint32 nbRays, decimal* maxFractions, DynamicAABBTreeRaycastPacketCallback& callback,
+                           MemoryAllocator& allocator) const;
+
         /// Compute the height of the tree
         int computeHeight();
 
+        /// Return the height of the tree
+        int getHeight() const;
+
+        /// Return the SAH cost of the tree (the quality of the tree, lower is better)
+        decimal computeSAHCost() const;
+
+        /// Rebuild the whole tree top-down with the Surface Area Heuristic
+        void rebuild();
+
+        /// Incrementally improve the tree by reinserting a given maximum number of leaves
+        uint32 optimize(uint32 maxNbReinsertedLeaves);
+
         /// Return the root AABB of the tree
         const AABB& getRootAABB() const;
 
@@ -298,6 +352,13 @@ RP3D_FORCE_INLINE const AABB& DynamicAABBTree::getRootAABB() const {
     return getFatAABB(mRootNodeID);
 }
 
+// Return the height of the tree
+/// This is the number of internal nodes on the longest path from the root to a leaf (zero for an
+/// empty tree or a tree with a single leaf).
+RP3D_FORCE_INLINE int DynamicAABBTree::getHeight() const {
+    return mRootNodeID == TreeNode::NULL_TREE_NODE ? 0 : mNodes[mRootNodeID].height;
+}
+
 // Add an object into the tree. This method creates a new leaf node in the tree and
 // returns the ID of the corresponding node.
 RP3D_FORCE_INLINE int32 DynamicAABBTree::addObject(const AABB& aabb, uint32 data) {
@@ -320,6 +381,16 @@ RP3D_FORCE_INLINE int32 DynamicAABBTree::addObject(const AABB& aabb, void* data)
     return nodeId;
 }
 
+// Report all shapes overlapping with the AABB given in parameter.
+RP3D_FORCE_INLINE void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int>& overlappingNodes) const {
+    reportAllShapesOverlappingWithAABB(aabb, overlappingNodes, mAllocator);
+}
+
+// Ray casting method
+RP3D_FORCE_INLINE void DynamicAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
+    raycast(ray, callback, mAllocator);
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
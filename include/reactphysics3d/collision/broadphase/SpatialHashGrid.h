@@ -0,0 +1,346 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef REACTPHYSICS3D_SPATIAL_HASH_GRID_H
+#define REACTPHYSICS3D_SPATIAL_HASH_GRID_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/containers/Pair.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class MemoryAllocator;
+class Profiler;
+struct Ray;
+
+// Structure SpatialHashGridObject
+/**
+ * This structure represents an object of the spatial hash grid. The objects are indexed by
+ * their IDs. An object is either stored in all the cells overlapped by its AABB or in the
+ * tree of the large objects if it overlaps too many cells.
+ */
+struct SpatialHashGridObject {
+
+    // -------------------- Attributes -------------------- //
+
+    /// AABB of the object
+    AABB aabb;
+
+    /// Coordinates of the first cell overlapped by the AABB
+    int32 minCell[3];
+
+    /// Coordinates of the last cell overlapped by the AABB
+    int32 maxCell[3];
+
+    /// ID of the node of the object in the tree of the large objects (-1 if the object is in the cells)
+    int32 largeObjectNodeId;
+
+    /// Pointer to the data of the object (the collider of a broad-phase shape for instance)
+    void* data;
+
+    /// True if the ID is used by an object
+    bool isUsed;
+
+    /// True if the object is static (two static objects are never reported as a pair)
+    bool isStatic;
+
+    /// True if the object is in the array of moved objects of the current computation of the pairs
+    bool isMoved;
+};
+
+// Structure SpatialHashGridEntry
+/**
+ * This structure represents an object in a cell of the grid. The entries of the cells that
+ * have the same hash are linked together in a bucket of the hash table.
+ */
+struct SpatialHashGridEntry {
+
+    // -------------------- Attributes -------------------- //
+
+    /// Key with the coordinates of the cell
+    uint64 cellKey;
+
+    /// ID of the object
+    int32 objectId;
+
+    /// Index of the next entry of the bucket (or of the next free entry)
+    int32 nextEntry;
+};
+
+// Class SpatialHashGrid
+/**
+ * This class implements a uniform grid whose cells are stored in a hash table keyed on the
+ * coordinates of the cells. Therefore, the grid is not bounded and only the cells that contain
+ * objects use memory. An object is added into all the cells overlapped by its AABB. Adding,
+ * moving or removing an object takes constant time and the grid never needs to be rebalanced.
+ * The objects that overlap more than MAX_NB_CELLS_PER_AXIS cells along an axis are stored in a
+ * DynamicAABBTree instead. The grid is efficient when most of the objects have a size close to
+ * the size of a cell. The IDs of the objects are given by the user and must be small non-negative
+ * integers because they are used as indices in an array.
+ */
+class SpatialHashGrid {
+
+    private:
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of cells overlapped by an object along an axis (larger objects are stored in the tree)
+        static constexpr int32 MAX_NB_CELLS_PER_AXIS = 4;
+
+        /// Initial number of buckets of the hash table (power of two)
+        static constexpr uint32 INITIAL_NB_BUCKETS = 256;
+
+        /// Number of bits of a coordinate of a cell in a key
+        static constexpr uint32 NB_CELL_COORDINATE_BITS = 21;
+
+        /// Maximum absolute value of a coordinate of a cell
+        static constexpr int32 MAX_CELL_COORDINATE = (1 << (NB_CELL_COORDINATE_BITS - 1)) - 1;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Size of a cell
+        decimal mCellSize;
+
+        /// Inverse of the size of a cell
+        decimal mInverseCellSize;
+
+        /// Objects of the grid (indexed by the IDs of the objects)
+        Array<SpatialHashGridObject> mObjects;
+
+        /// Entries of the objects in the cells
+        Array<SpatialHashGridEntry> mEntries;
+
+        /// Index of the first free entry (-1 if none)
+        int32 mFreeEntry;
+
+        /// Number of used entries
+        uint32 mNbEntries;
+
+        /// Index of the first entry of each bucket of the hash table (-1 if the bucket is empty)
+        Array<int32> mBuckets;
+
+        /// Tree with the objects that overlap too many cells
+        DynamicAABBTree mLargeObjectsTree;
+
+        /// AABB that contains the objects stored in the cells (it never shrinks)
+        AABB mCellsObjectsBounds;
+
+        /// Number of objects
+        uint32 mNbObjects;
+
+        /// Number of objects stored in the cells
+        uint32 mNbCellsObjects;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the coordinate of the cell that contains a coordinate
+        int32 computeCellCoordinate(decimal coordinate) const;
+
+        /// Return the key of a cell
+        static uint64 computeCellKey(int32 x, int32 y, int32 z);
+
+        /// Return the index of the bucket of a cell
+        uint32 computeBucketIndex(uint64 cellKey) const;
+
+        /// Return true if a cell is in the range of cells of an object
+        static bool isCellInRange(const SpatialHashGridObject& object, const int32* cell);
+
+        /// Compute the range of cells overlapped by an AABB and return true if the range is not too large
+        bool computeCellsRange(const AABB& aabb, int32* minCell, int32* maxCell) const;
+
+        /// Add an object into its cells or into the tree of the large objects
+        void insertObject(int32 objectId);
+
+        /// Remove an object from its cells or from the tree of the large objects
+        void extractObject(int32 objectId);
+
+        /// Add an entry of an object in a cell
+        void addEntry(uint64 cellKey, int32 objectId);
+
+        /// Remove the entry of an object in a cell
+        void removeEntry(uint64 cellKey, int32 objectId);
+
+        /// Double the number of buckets of the hash table
+        void growBuckets();
+
+        /// Return true if the pair of two objects must be reported by the first object
+        static bool isPairReportedByObject(const SpatialHashGridObject& object, int32 objectId,
+                                           const SpatialHashGridObject& otherObject, int32 otherObjectId);
+
+        /// Report the objects of the cells that overlap with a moved object
+        void reportCellsObjectsOverlappingWithObject(int32 objectId, Array<Pair<int32, int32>>& overlappingPairs) const;
+
+        /// Report the large objects that overlap with a moved object
+        void reportLargeObjectsOverlappingWithObject(int32 objectId, Array<int32>& nodes, Stack<int32>& stack,
+                                                     Array<Pair<int32, int32>>& overlappingPairs) const;
+
+        /// Report the objects of the cells that overlap with an AABB
+        void reportCellsObjectsOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingObjects) const;
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        SpatialHashGrid(MemoryAllocator& allocator, decimal cellSize);
+
+        /// Add an object with a given ID
+        void addObject(int32 objectId, const AABB& aabb, bool isStatic, void* data = nullptr);
+
+        /// Update the AABB of an object
+        void updateObject(int32 objectId, const AABB& aabb);
+
+        /// Remove an object
+        void removeObject(int32 objectId);
+
+        /// Return true if an object with a given ID exists
+        bool hasObject(int32 objectId) const;
+
+        /// Return true if an object is stored in the tree of the large objects
+        bool isLargeObject(int32 objectId) const;
+
+        /// Return the AABB of an object
+        const AABB& getAABB(int32 objectId) const;
+
+        /// Return the data pointer of an object
+        void* getObjectData(int32 objectId) const;
+
+        /// Return the size of a cell
+        decimal getCellSize() const;
+
+        /// Return the number of objects
+        uint32 getNbObjects() const;
+
+        /// Report the overlapping pairs of objects where at least one object has moved
+        void reportAllOverlappingPairs(const Array<int32>& movedObjects, Array<Pair<int32, int32>>& overlappingPairs,
+                                       MemoryAllocator& allocator);
+
+        /// Report the IDs of all the objects overlapping with the AABB given in parameter
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingObjects, MemoryAllocator& allocator) const;
+
+        /// Ray casting method (the ID of an object is given as node ID to the callback)
+        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Set the profiler
+		void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+// Return true if an object with a given ID exists
+RP3D_FORCE_INLINE bool SpatialHashGrid::hasObject(int32 objectId) const {
+    return objectId >= 0 && static_cast<uint64>(objectId) < mObjects.size() && mObjects[objectId].isUsed;
+}
+
+// Return true if an object is stored in the tree of the large objects
+RP3D_FORCE_INLINE bool SpatialHashGrid::isLargeObject(int32 objectId) const {
+    assert(hasObject(objectId));
+    return mObjects[objectId].largeObjectNodeId != -1;
+}
+
+// Return the AABB of an object
+RP3D_FORCE_INLINE const AABB& SpatialHashGrid::getAABB(int32 objectId) const {
+    assert(hasObject(objectId));
+    return mObjects[objectId].aabb;
+}
+
+// Return the data pointer of an object
+RP3D_FORCE_INLINE void* SpatialHashGrid::getObjectData(int32 objectId) const {
+    assert(hasObject(objectId));
+    return mObjects[objectId].data;
+}
+
+// Return the size of a cell
+RP3D_FORCE_INLINE decimal SpatialHashGrid::getCellSize() const {
+    return mCellSize;
+}
+
+// Return the number of objects
+RP3D_FORCE_INLINE uint32 SpatialHashGrid::getNbObjects() const {
+    return mNbObjects;
+}
+
+// Return the coordinate of the cell that contains a coordinate
+RP3D_FORCE_INLINE int32 SpatialHashGrid::computeCellCoordinate(decimal coordinate) const {
+    const decimal cell = std::floor(coordinate * mInverseCellSize);
+    return static_cast<int32>(clamp(cell, decimal(-MAX_CELL_COORDINATE), decimal(MAX_CELL_COORDINATE)));
+}
+
+// Return the key of a cell
+RP3D_FORCE_INLINE uint64 SpatialHashGrid::computeCellKey(int32 x, int32 y, int32 z) {
+    const uint64 mask = (uint64(1) << NB_CELL_COORDINATE_BITS) - 1;
+    return (uint64(x + MAX_CELL_COORDINATE) & mask) | ((uint64(y + MAX_CELL_COORDINATE) & mask) << NB_CELL_COORDINATE_BITS) |
+           ((uint64(z + MAX_CELL_COORDINATE) & mask) << (2 * NB_CELL_COORDINATE_BITS));
+}
+
+// Return the index of the bucket of a cell
+RP3D_FORCE_INLINE uint32 SpatialHashGrid::computeBucketIndex(uint64 cellKey) const {
+
+    // Mix the bits of the key (the number of buckets is a power of two)
+    uint64 hash = cellKey * uint64(0x9E3779B97F4A7C15);
+    hash ^= hash >> 32;
+    return static_cast<uint32>(hash & (mBuckets.size() - 1));
+}
+
+// Return true if a cell is in the range of cells of an object
+RP3D_FORCE_INLINE bool SpatialHashGrid::isCellInRange(const SpatialHashGridObject& object, const int32* cell) {
+    return cell[0] >= object.minCell[0] && cell[0] <= object.maxCell[0] &&
+           cell[1] >= object.minCell[1] && cell[1] <= object.maxCell[1] &&
+           cell[2] >= object.minCell[2] && cell[2] <= object.maxCell[2];
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void SpatialHashGrid::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+    mLargeObjectsTree.setProfiler(profiler);
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,341 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_STATIC_AABB_TREE_H
+#define REACTPHYSICS3D_STATIC_AABB_TREE_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/mathematics/DecimalW.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/containers/Stack.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class DynamicAABBTreeRaycastCallback;
+class MemoryAllocator;
+class Profiler;
+
+// Structure StaticAABBTreeNode
+/**
+ * This structure represents a node of the binary static AABB tree. The nodes are stored in
+ * depth-first order. The left child of an internal node is the next node in the array
+ * and the node stores the index of its right child. A leaf node stores a range of items.
+ */
+struct StaticAABBTreeNode {
+
+    // -------------------- Attributes -------------------- //
+
+    /// Axis aligned bounding box of the node
+    AABB aabb;
+
+    /// Index of the right child (internal node) or of the first item (leaf node)
+    uint32 index;
+
+    /// Number of items of a leaf node (zero for an internal node)
+    uint32 nbItems;
+
+    // -------------------- Methods -------------------- //
+
+    /// Return true if the node is a leaf of the tree
+    bool isLeaf() const {
+        return nbItems > 0;
+    }
+};
+
+// Structure StaticAABBTreeQuantizedNode
+/**
+ * This structure represents a node of a static AABB tree with compressed bounds. The
+ * bounds of the node are quantized on 16 bits relative to the AABB of the root node.
+ * The minimum is rounded down and the maximum is rounded up so that the dequantized
+ * AABB always contains the original one. The index and the number of items of the
+ * node are packed into a single integer.
+ */
+struct StaticAABBTreeQuantizedNode {
+
+    // -------------------- Attributes -------------------- //
+
+    /// Quantized minimum bounds of the node AABB
+    uint16 min[3];
+
+    /// Quantized maximum bounds of the node AABB
+    uint16 max[3];
+
+    /// Index of the right child or first item (upper bits) and number of items (lower bits)
+    uint32 indexAndNbItems;
+};
+
+// Structure StaticAABBTreeWideNode
+/**
+ * This structure represents a node of the wide static AABB tree. A node has up to
+ * RP3D_SIMD_WIDTH children and the bounds of the children are stored in structure-of-arrays
+ * layout so that a single SIMD test is needed to test all the children of the node. A child
+ * is either another wide node or a leaf with a range of items.
+ */
+struct StaticAABBTreeWideNode {
+
+    // -------------------- Attributes -------------------- //
+
+    /// Minimum bounds of the AABBs of the children
+    Vector3Lanes childrenMin;
+
+    /// Maximum bounds of the AABBs of the children
+    Vector3Lanes childrenMax;
+
+    /// Index of the wide node or of the first item (upper bits) and number of items (lower bits) of each child
+    uint32 children[RP3D_SIMD_WIDTH];
+
+    /// Number of children of the node
+    uint32 nbChildren;
+};
+
+// Class StaticAABBTree
+/**
+ * This class implements a read-only AABB tree for a set of items that never move (the triangles
+ * of a TriangleMesh for instance). The tree is built top-down with the Surface Area Heuristic (SAH)
+ * evaluated on bins of the centroids of the items. The nodes are stored in a single array in
+ * depth-first order. This binary tree is then collapsed into a wide tree where each node has up
+ * to RP3D_SIMD_WIDTH children (see the RP3D_SIMD_WIDTH CMake option) whose bounds are tested with a single SIMD
+ * instruction. The wide tree is half as deep as the binary tree and its traversal is more cache
+ * friendly. Contrary to the DynamicAABBTree, the items cannot be added, moved or removed once the tree
+ * is built. Optionally, the bounds of the nodes of the binary tree can be quantized on 16 bits
+ * instead to reduce the memory used by the tree.
+ */
+class StaticAABBTree {
+
+    private:
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of bins used to evaluate the SAH on an axis
+        static constexpr uint32 NB_BINS = 16;
+
+        /// Default maximum number of items in a leaf node
+        static constexpr uint32 DEFAULT_MAX_NB_ITEMS_PER_LEAF = 4;
+
+        /// Number of bits used to store the number of items of a quantized node or of a child of a wide node
+        static constexpr uint32 NB_ITEMS_BITS = 3;
+
+        /// Maximum value of a quantized coordinate
+        static constexpr uint32 MAX_QUANTIZED_VALUE = 65535;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Maximum number of items in a leaf node
+        uint32 mMaxNbItemsPerLeaf;
+
+        /// Wide nodes of the tree if the tree is not quantized
+        Array<StaticAABBTreeWideNode> mWideNodes;
+
+        /// Quantized nodes of the binary tree (in depth-first order) if the tree is quantized
+        Array<StaticAABBTreeQuantizedNode> mQuantizedNodes;
+
+        /// Data of the items sorted in the order of the leaves
+        Array<int32> mItemsData;
+
+        /// True if the bounds of the nodes are quantized
+        bool mIsQuantized;
+
+        /// AABB of the root node
+        AABB mRootAABB;
+
+        /// Scale factor to convert a coordinate into a quantized value
+        Vector3 mQuantizationScale;
+
+        /// Scale factor to convert a quantized value into a coordinate
+        Vector3 mDequantizationScale;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Create the wide nodes from the nodes of the binary tree
+        void collapseNodes(const Array<StaticAABBTreeNode>& nodes);
+
+        /// Create the quantized nodes from the nodes of the binary tree
+        void quantizeNodes(const Array<StaticAABBTreeNode>& nodes);
+
+        /// Convert a quantized value into a coordinate
+        decimal dequantize(uint32 quantizedValue, int axis) const;
+
+        /// Quantize a minimum coordinate (rounded down)
+        uint16 quantizeMin(decimal value, int axis) const;
+
+        /// Quantize a maximum coordinate (rounded up)
+        uint16 quantizeMax(decimal value, int axis) const;
+
+        /// Return the AABB of a quantized node
+        AABB getQuantizedNodeAABB(uint32 nodeIndex) const;
+
+        /// Report the data of the items of the leaves overlapping with an AABB in the quantized tree
+        void reportQuantizedShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingItems, Stack<uint32>& stack) const;
+
+        /// Ray casting method for the quantized tree
+        void raycastQuantized(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const;
+
+        /// Call the raycast callback for the items of a leaf
+        bool raycastItems(const Ray& ray, uint32 index, uint32 nbItems, DynamicAABBTreeRaycastCallback& callback,
+                          decimal& maxFraction) const;
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        StaticAABBTree(MemoryAllocator& allocator, uint32 maxNbItemsPerLeaf = DEFAULT_MAX_NB_ITEMS_PER_LEAF);
+
+        /// Build the tree with the AABBs and the data of the items
+        void build(const Array<AABB>& itemsAABBs, const Array<int32>& itemsData, bool isQuantized = false);
+
+        /// Compute the best split of a range of items with the binned SAH (also used to rebuild a DynamicAABBTree)
+        static bool computeSAHSplit(const Array<AABB>& itemsAABBs, const Array<Vector3>& centroids, Array<uint32>& items,
+                                    uint32 startIndex, uint32 endIndex, const AABB& nodeAABB, uint32& splitIndex,
+                                    decimal& splitCost);
+
+        /// Return true if the bounds of the nodes are quantized
+        bool getIsQuantized() const;
+
+        /// Return the number of nodes of the tree
+        uint32 getNbNodes() const;
+
+        /// Return the number of items in the tree
+        uint32 getNbItems() const;
+
+        /// Return the AABB of the root node of the tree
+        const AABB& getRootAABB() const;
+
+        /// Report the data of all the items of the leaves overlapping with the AABB given in parameter
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingItems, MemoryAllocator& allocator) const;
+
+        /// Report the data of all the items of the leaves overlapping with the AABB given in parameter (with a stack for the traversal)
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingItems, Stack<uint32>& stack) const;
+
+        /// Ray casting method (the data of an item is given as node ID to the callback)
+        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const;
+
+        /// Compute the height of the tree
+        uint32 computeHeight() const;
+
+        /// Return the memory used by the tree (in bytes)
+        size_t getMemoryUsage() const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Set the profiler
+		void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+// Return the number of nodes of the tree
+RP3D_FORCE_INLINE uint32 StaticAABBTree::getNbNodes() const {
+    return static_cast<uint32>(mIsQuantized ? mQuantizedNodes.size() : mWideNodes.size());
+}
+
+// Return true if the bounds of the nodes are quantized
+RP3D_FORCE_INLINE bool StaticAABBTree::getIsQuantized() const {
+    return mIsQuantized;
+}
+
+// Return the number of items in the tree
+RP3D_FORCE_INLINE uint32 StaticAABBTree::getNbItems() const {
+    return static_cast<uint32>(mItemsData.size());
+}
+
+// Return the AABB of the root node of the tree
+RP3D_FORCE_INLINE const AABB& StaticAABBTree::getRootAABB() const {
+    assert(getNbNodes() > 0);
+    return mRootAABB;
+}
+
+// Return the memory used by the tree (in bytes)
+RP3D_FORCE_INLINE size_t StaticAABBTree::getMemoryUsage() const {
+    return mWideNodes.capacity() * sizeof(StaticAABBTreeWideNode) + mQuantizedNodes.capacity() * sizeof(StaticAABBTreeQuantizedNode) +
+           mItemsData.capacity() * sizeof(int32);
+}
+
+// Convert a quantized value into a coordinate
+RP3D_FORCE_INLINE decimal StaticAABBTree::dequantize(uint32 quantizedValue, int axis) const {
+
+    // The maximum value is mapped exactly on the bounds of the root to avoid rounding errors
+    if (quantizedValue == MAX_QUANTIZED_VALUE) return mRootAABB.getMax()[axis];
+
+    return mRootAABB.getMin()[axis] + decimal(quantizedValue) * mDequantizationScale[axis];
+}
+
+// Quantize a minimum coordinate (rounded down)
+RP3D_FORCE_INLINE uint16 StaticAABBTree::quantizeMin(decimal value, int axis) const {
+
+    const decimal scaledValue = (value - mRootAABB.getMin()[axis]) * mQuantizationScale[axis];
+    if (scaledValue <= decimal(0.0)) return 0;
+
+    // Make sure that the dequantized value is not larger than the value
+    uint32 quantizedValue = std::min(static_cast<uint32>(scaledValue), MAX_QUANTIZED_VALUE);
+    while (quantizedValue > 0 && dequantize(quantizedValue, axis) > value) {
+        quantizedValue--;
+    }
+
+    return static_cast<uint16>(quantizedValue);
+}
+
+// Quantize a maximum coordinate (rounded up)
+RP3D_FORCE_INLINE uint16 StaticAABBTree::quantizeMax(decimal value, int axis) const {
+
+    const decimal scaledValue = (value - mRootAABB.getMin()[axis]) * mQuantizationScale[axis];
+    if (scaledValue >= decimal(MAX_QUANTIZED_VALUE)) return MAX_QUANTIZED_VALUE;
+
+    // Make sure that the dequantized value is not smaller than the value
+    uint32 quantizedValue = scaledValue > decimal(0.0) ? static_cast<uint32>(std::ceil(scaledValue)) : 0;
+    while (quantizedValue < MAX_QUANTIZED_VALUE && dequantize(quantizedValue, axis) < value) {
+        quantizedValue++;
+    }
+
+    return static_cast<uint16>(quantizedValue);
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void StaticAABBTree::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,222 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef REACTPHYSICS3D_SWEEP_AND_PRUNE_H
+#define REACTPHYSICS3D_SWEEP_AND_PRUNE_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/containers/Pair.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class MemoryAllocator;
+class Profiler;
+
+// Structure SweepAndPruneProxy
+/**
+ * This structure represents an object of the sweep-and-prune. The proxies are indexed
+ * by the IDs of the objects.
+ */
+struct SweepAndPruneProxy {
+
+    // -------------------- Attributes -------------------- //
+
+    /// AABB of the object
+    AABB aabb;
+
+    /// True if the ID is used by an object
+    bool isUsed;
+
+    /// True if the object is static (two static objects are never reported as a pair)
+    bool isStatic;
+
+    /// True if the object has moved since the last computation of the overlapping pairs
+    bool isMoved;
+
+    /// True if the object has a box in the array of sorted boxes
+    bool isSorted;
+};
+
+// Structure SweepAndPruneBox
+/**
+ * This structure represents the interval of an object on the sweep axis. The boxes are
+ * sorted by their minimum.
+ */
+struct SweepAndPruneBox {
+
+    // -------------------- Attributes -------------------- //
+
+    /// Minimum of the AABB of the object on the sweep axis
+    decimal min;
+
+    /// Maximum of the AABB of the object on the sweep axis
+    decimal max;
+
+    /// ID of the object
+    int32 objectId;
+};
+
+// Class SweepAndPrune
+/**
+ * This class implements the incremental sort-and-sweep algorithm to compute the pairs of
+ * objects with overlapping AABBs. The intervals of the AABBs on a sweep axis are kept sorted
+ * in an array. Because the objects move little from one frame to the next, the array is sorted
+ * again with an insertion sort in nearly linear time. The array is then swept to find the pairs
+ * of overlapping intervals and the AABBs of those pairs are tested on the two other axes. The
+ * sweep axis is the axis with the largest variance of the centers of the AABBs. This is faster
+ * than the DynamicAABBTree when most of the objects move and have similar sizes (many bodies on
+ * a flat ground for instance). The IDs of the objects are given by the user and must be small
+ * non-negative integers because they are used as indices in an array.
+ */
+class SweepAndPrune {
+
+    private:
+
+        // -------------------- Constants -------------------- //
+
+        /// Ratio between the variance of the centers on an axis and on the current sweep axis
+        /// above which the sweep axis is changed
+        static constexpr decimal SWEEP_AXIS_CHANGE_RATIO = decimal(2.0);
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Proxies of the objects (indexed by the IDs of the objects)
+        Array<SweepAndPruneProxy> mProxies;
+
+        /// Intervals of the objects on the sweep axis (sorted by their minimum after a sort)
+        Array<SweepAndPruneBox> mSortedBoxes;
+
+        /// Number of boxes added at the end of the array since the last sort
+        uint32 mNbUnsortedBoxes;
+
+        /// Index of the sweep axis (0 for x, 1 for y and 2 for z)
+        int mSweepAxis;
+
+        /// Number of objects
+        uint32 mNbObjects;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Update the intervals of the sorted boxes, choose the sweep axis and sort the boxes
+        void sortBoxes();
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        SweepAndPrune(MemoryAllocator& allocator);
+
+        /// Add an object with a given ID
+        void addObject(int32 objectId, const AABB& aabb, bool isStatic);
+
+        /// Update the AABB of an object
+        void updateObject(int32 objectId, const AABB& aabb);
+
+        /// Remove an object
+        void removeObject(int32 objectId);
+
+        /// Mark an object as moved for the next computation of the overlapping pairs
+        void setIsObjectMoved(int32 objectId);
+
+        /// Return true if an object with a given ID exists
+        bool hasObject(int32 objectId) const;
+
+        /// Return the AABB of an object
+        const AABB& getAABB(int32 objectId) const;
+
+        /// Return the number of objects
+        uint32 getNbObjects() const;
+
+        /// Return the index of the current sweep axis
+        int getSweepAxis() const;
+
+        /// Report the overlapping pairs of objects where at least one object has moved
+        void reportAllOverlappingPairs(Array<Pair<int32, int32>>& overlappingPairs);
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Set the profiler
+		void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+// Return true if an object with a given ID exists
+RP3D_FORCE_INLINE bool SweepAndPrune::hasObject(int32 objectId) const {
+    return objectId >= 0 && static_cast<uint64>(objectId) < mProxies.size() && mProxies[objectId].isUsed;
+}
+
+// Return the AABB of an object
+RP3D_FORCE_INLINE const AABB& SweepAndPrune::getAABB(int32 objectId) const {
+    assert(hasObject(objectId));
+    return mProxies[objectId].aabb;
+}
+
+// Mark an object as moved for the next computation of the overlapping pairs
+RP3D_FORCE_INLINE void SweepAndPrune::setIsObjectMoved(int32 objectId) {
+    assert(hasObject(objectId));
+    mProxies[objectId].isMoved = true;
+}
+
+// Return the number of objects
+RP3D_FORCE_INLINE uint32 SweepAndPrune::getNbObjects() const {
+    return mNbObjects;
+}
+
+// Return the index of the current sweep axis
+RP3D_FORCE_INLINE int SweepAndPrune::getSweepAxis() const {
+    return mSweepAxis;
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void SweepAndPrune::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
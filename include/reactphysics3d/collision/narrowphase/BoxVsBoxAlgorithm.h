@@ -0,0 +1,112 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_BOX_VS_BOX_ALGORITHM_H
+#define	REACTPHYSICS3D_BOX_VS_BOX_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class Transform;
+struct NarrowPhaseInfoBatch;
+
+// Class BoxVsBoxAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection between
+ * two box collision shapes. It runs a closed-form separating axis test on the
+ * 15 candidate axes (the three face normals of each box and the nine cross
+ * products of their edges) without the half-edge structure of the boxes. The
+ * items of the batch are tested by groups of DecimalW::NB_LANES items with SIMD
+ * instructions. The contact points are then computed by clipping the incident
+ * face of a box directly against the reference face of the other box (or with
+ * the closest points of two edges for an edge vs edge contact). The contacts
+ * are the same as with the ConvexPolyhedronVsConvexPolyhedronAlgorithm.
+ */
+class BoxVsBoxAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of candidate separating axes (3 face normals of each box and 9 edges cross products)
+        static constexpr uint32 NB_AXES = 15;
+
+        /// Index of the first edge vs edge axis (the axes 0 to 2 are the face normals of box 1
+        /// and the axes 3 to 5 are the face normals of box 2)
+        static constexpr uint32 FIRST_EDGE_AXIS = 6;
+
+        /// Maximum number of vertices of the incident face after the clipping
+        static constexpr uint32 NB_MAX_CLIPPED_VERTICES = 8;
+
+        // Relative and absolute bias used to make sure the SAT algorithm returns the same penetration axis between frames
+        static const decimal SEPARATING_AXIS_RELATIVE_TOLERANCE;
+        static const decimal SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the penetration depths along the 15 axes of a group of items with SIMD instructions
+        uint32 computePenetrationDepths(const Transform* box2ToBox1Transforms, const Vector3* halfExtents1,
+                                        const Vector3* halfExtents2, uint32 nbLanes, decimal penetrationDepths[][NB_AXES]) const;
+
+        /// Compute the contact points between the reference face of a box and the incident face of the other box
+        bool computeFaceContactPoints(uint32 faceAxisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                      const Transform& box1ToBox2Transform, const Transform& box2ToBox1Transform,
+                                      NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
+        /// Compute the contact point between an edge of each box
+        void computeEdgeContactPoint(uint32 edgeAxisIndex, decimal penetrationDepth, const Vector3& halfExtents1,
+                                     const Vector3& halfExtents2, const Transform& box1ToBox2Transform,
+                                     const Transform& box2ToBox1Transform, NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                     uint32 batchIndex) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        BoxVsBoxAlgorithm() = default;
+
+        /// Destructor
+        virtual ~BoxVsBoxAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        BoxVsBoxAlgorithm(const BoxVsBoxAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        BoxVsBoxAlgorithm& operator=(const BoxVsBoxAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between two boxes
+        bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                           bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
@@ -33,6 +33,7 @@
 #include <reactphysics3d/collision/narrowphase/CapsuleVsCapsuleAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/CapsuleVsConvexPolyhedronAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/ConvexPolyhedronVsConvexPolyhedronAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxAlgorithm.h>
 #include <reactphysics3d/collision/shapes/CollisionShape.h>
 
 namespace reactphysics3d {
@@ -46,7 +47,8 @@ enum class NarrowPhaseAlgorithmType {
     CapsuleVsCapsule,
     SphereVsConvexPolyhedron,
     CapsuleVsConvexPolyhedron,
-    ConvexPolyhedronVsConvexPolyhedron
+    ConvexPolyhedronVsConvexPolyhedron,
+    BoxVsBox
 };
 
 // Class CollisionDispatch
@@ -69,6 +71,7 @@ class CollisionDispatch {
         size_t mSphereVsConvexPolyAllocatedSize;
         size_t mCapsuleVsConvexPolyAllocatedSize;
         size_t mConvexPolyVsConvexPolyAllocatedSize;
+        size_t mBoxVsBoxAllocatedSize;
 
         /// True if the sphere vs sphere algorithm is the default one
         bool mIsSphereVsSphereDefault = true;
@@ -88,6 +91,13 @@ class CollisionDispatch {
         /// True if the convex polyhedron vs convex polyhedron algorithm is the default one
         bool mIsConvexPolyhedronVsConvexPolyhedronDefault = true;
 
+        /// True if the box vs box algorithm is the default one
+        bool mIsBoxVsBoxDefault = true;
+
+        /// True if the box vs box algorithm is used for the pairs of boxes (instead of
+        /// the convex polyhedron vs convex polyhedron algorithm)
+        bool mIsBoxVsBoxAlgorithmEnabled = true;
+
         /// Sphere vs Sphere collision algorithm
         SphereVsSphereAlgorithm* mSphereVsSphereAlgorithm;
 
@@ -106,6 +116,9 @@ class CollisionDispatch {
         /// Convex Polyhedron vs Convex Polyhedron collision algorithm
         ConvexPolyhedronVsConvexPolyhedronAlgorithm* mConvexPolyhedronVsConvexPolyhedronAlgorithm;
 
+        /// Box vs Box collision algorithm
+        BoxVsBoxAlgorithm* mBoxVsBoxAlgorithm;
+
         /// Collision detection matrix (algorithms to use)
         NarrowPhaseAlgorithmType mCollisionMatrix[NB_COLLISION_SHAPE_TYPES][NB_COLLISION_SHAPE_TYPES];
 
@@ -164,6 +177,18 @@ class CollisionDispatch {
         /// Get the Convex Polyhedron vs Convex Polyhedron narrow-phase collision detection algorithm
         ConvexPolyhedronVsConvexPolyhedronAlgorithm* getConvexPolyhedronVsConvexPolyhedronAlgorithm();
 
+        /// Set the Box vs Box narrow-phase collision detection algorithm
+        void setBoxVsBoxAlgorithm(BoxVsBoxAlgorithm* algorithm);
+
+        /// Get the Box vs Box narrow-phase collision detection algorithm
+        BoxVsBoxAlgorithm* getBoxVsBoxAlgorithm();
+
+        /// Return true if the box vs box algorithm is used for the pairs of boxes
+        bool isBoxVsBoxAlgorithmEnabled() const;
+
+        /// Enable/Disable the box vs box algorithm for the pairs of boxes
+        void setIsBoxVsBoxAlgorithmEnabled(bool isEnabled);
+
         /// Fill-in the collision detection matrix
         void fillInCollisionMatrix();
 
@@ -171,6 +196,9 @@ class CollisionDispatch {
         NarrowPhaseAlgorithmType selectNarrowPhaseAlgorithm(const CollisionShapeType& shape1Type,
                                                             const CollisionShapeType& shape2Type) const;
 
+        /// Return the narrow-phase algorithm type to use between two convex collision shapes
+        NarrowPhaseAlgorithmType selectNarrowPhaseAlgorithm(const CollisionShape* shape1, const CollisionShape* shape2) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -210,6 +238,24 @@ RP3D_FORCE_INLINE ConvexPolyhedronVsConvexPolyhedronAlgorithm* CollisionDispatch
     return mConvexPolyhedronVsConvexPolyhedronAlgorithm;
 }
 
+// Get the Box vs Box narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE BoxVsBoxAlgorithm* CollisionDispatch::getBoxVsBoxAlgorithm() {
+    return mBoxVsBoxAlgorithm;
+}
+
+// Return true if the box vs box algorithm is used for the pairs of boxes
+RP3D_FORCE_INLINE bool CollisionDispatch::isBoxVsBoxAlgorithmEnabled() const {
+    return mIsBoxVsBoxAlgorithmEnabled;
+}
+
+// Enable/Disable the box vs box algorithm for the pairs of boxes
+/// When it is disabled, the pairs of boxes are handled by the convex polyhedron
+/// vs convex polyhedron algorithm. The algorithm of an overlapping pair is selected
+/// when the pair is created. Therefore, this only affects the pairs created afterwards.
+RP3D_FORCE_INLINE void CollisionDispatch::setIsBoxVsBoxAlgorithmEnabled(bool isEnabled) {
+    mIsBoxVsBoxAlgorithmEnabled = isEnabled;
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -222,6 +268,7 @@ RP3D_FORCE_INLINE void CollisionDispatch::setProfiler(Profiler* profiler) {
     mSphereVsConvexPolyhedronAlgorithm->setProfiler(profiler);
     mCapsuleVsConvexPolyhedronAlgorithm->setProfiler(profiler);
     mConvexPolyhedronVsConvexPolyhedronAlgorithm->setProfiler(profiler);
+    mBoxVsBoxAlgorithm->setProfiler(profiler);
 }
 
 #endif
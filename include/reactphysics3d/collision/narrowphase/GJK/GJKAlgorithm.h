@@ -74,6 +74,9 @@ class GJKAlgorithm {
 
         // -------------------- Methods -------------------- //
 
+        /// Test with SIMD instructions if the two shapes of a group of items are separated along their cached axis
+        uint32 testCachedSeparatingAxes(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 groupStartIndex, uint32 nbLanes);
+
     public :
 
         enum class GJKResult {
@@ -100,6 +103,9 @@ class GJKAlgorithm {
         void testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
                            uint32 batchNbItems, Array<GJKResult>& gjkResults);
 
+        /// Compute a contact info if the two bounding volumes of an item of the batch collide.
+        GJKResult testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex);
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
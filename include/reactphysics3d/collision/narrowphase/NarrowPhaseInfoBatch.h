@@ -30,6 +30,7 @@
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/collision/ContactPointInfo.h>
 #include <reactphysics3d/configuration.h>
+#include <atomic>
 
 /// Namespace ReactPhysics3D
 namespace reactphysics3d {
@@ -43,81 +44,84 @@ struct ContactPointInfo;
 // Struct NarrowPhaseInfoBatch
 /**
  * This structure collects all the potential collisions from the middle-phase algorithm
- * that have to be tested during narrow-phase collision detection.
+ * that have to be tested during narrow-phase collision detection. The data of the tests
+ * is stored as a structure of arrays so that the narrow-phase algorithms only touch the
+ * arrays they need. The contact points are written into a separate output buffer where
+ * a block of contact points is only reserved for the tests that actually generate contacts.
  */
 struct NarrowPhaseInfoBatch {
 
-    struct NarrowPhaseInfo {
+    protected:
 
-        /// Broadphase overlapping pairs ids
-        uint64 overlappingPairId;
+        /// Reference to the memory allocator
+        MemoryAllocator& mMemoryAllocator;
 
-        /// Entity of the first collider to test collision with
-        Entity colliderEntity1;
+        /// Reference to all the broad-phase overlapping pairs
+        OverlappingPairs& mOverlappingPairs;
 
-        /// Entity of the second collider to test collision with
-        Entity colliderEntity2;
+        /// Cached capacity
+        uint32 mCachedCapacity = 0;
 
-        /// Collision info of the previous frame
-        LastFrameCollisionInfo* lastFrameCollisionInfo;
+        /// Number of contact points of the output buffer already reserved by the tests
+        /// (the narrow-phase tests of a batch might be computed by several threads)
+        std::atomic<uint32> mNbReservedContactPoints;
 
-        /// Memory allocator for the collision shape (Used to release TriangleShape memory in destructor)
-        MemoryAllocator* collisionShapeAllocator;
+        /// TriangleShape allocated size
+        static const size_t mTriangleShapeAllocatedSize;
 
-        /// Shape local to world transform of sphere 1
-        Transform shape1ToWorldTransform;
+        /// Reserve a block of contact points in the output buffer for a given test
+        void reserveContactPointsBlock(uint32 index);
 
-        /// Shape local to world transform of sphere 2
-        Transform shape2ToWorldTransform;
+    public:
 
-        /// Pointer to the first collision shapes to test collision with
-        CollisionShape* collisionShape1;
+        /// Index of the contact points block of a test that has no contact points block
+        static constexpr uint32 INVALID_INDEX = -1;
 
-        /// Pointer to the second collision shapes to test collision with
-        CollisionShape* collisionShape2;
+        /// Broadphase overlapping pairs ids
+        Array<uint64> overlappingPairIds;
 
-        /// True if we need to report contacts (false for triggers for instance)
-        bool reportContacts;
+        /// Entities of the first colliders to test collision with
+        Array<Entity> colliderEntities1;
 
-        /// Result of the narrow-phase collision detection test
-        bool isColliding;
+        /// Entities of the second colliders to test collision with
+        Array<Entity> colliderEntities2;
 
-        /// Number of contact points
-        uint8 nbContactPoints;
+        /// Collision infos of the previous frame
+        Array<LastFrameCollisionInfo*> lastFrameCollisionInfos;
 
-        /// Array of contact points created during the narrow-phase
-        ContactPointInfo contactPoints[NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO];
+        /// Memory allocators for the collision shapes (Used to release TriangleShape memory in destructor)
+        Array<MemoryAllocator*> collisionShapeAllocators;
 
-        /// Constructor
-        NarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator,
-                             const Transform& shape1ToWorldTransform, const Transform& shape2ToWorldTransform, CollisionShape* shape1,
-                             CollisionShape* shape2, bool needToReportContacts)
-                      : overlappingPairId(pairId), colliderEntity1(collider1), colliderEntity2(collider2), lastFrameCollisionInfo(lastFrameInfo),
-                         collisionShapeAllocator(&shapeAllocator), shape1ToWorldTransform(shape1ToWorldTransform),
-                         shape2ToWorldTransform(shape2ToWorldTransform), collisionShape1(shape1),
-                        collisionShape2(shape2), reportContacts(needToReportContacts), isColliding(false), nbContactPoints(0) {
+        /// Local to world transforms of the first shapes
+        Array<Transform> shape1ToWorldTransforms;
 
-        }
-    };
+        /// Local to world transforms of the second shapes
+        Array<Transform> shape2ToWorldTransforms;
 
-    protected:
+        /// Pointers to the first collision shapes to test collision with
+        Array<CollisionShape*> collisionShapes1;
 
-        /// Reference to the memory allocator
-        MemoryAllocator& mMemoryAllocator;
+        /// Pointers to the second collision shapes to test collision with
+        Array<CollisionShape*> collisionShapes2;
 
-        /// Reference to all the broad-phase overlapping pairs
-        OverlappingPairs& mOverlappingPairs;
+        /// True if we need to report contacts (false for triggers for instance)
+        Array<bool> reportContacts;
 
-        /// Cached capacity
-        uint32 mCachedCapacity = 0;
+        /// Results of the narrow-phase collision detection tests
+        Array<bool> isColliding;
 
-        /// TriangleShape allocated size
-        static const size_t mTriangleShapeAllocatedSize;
+        /// Number of contact points of each test
+        Array<uint8> nbContactPoints;
 
-    public:
+        /// Index of the first contact point of each test in the contact points buffer
+        /// (INVALID_INDEX if no contact point has been created for this test)
+        Array<uint32> contactPointsIndices;
 
-        /// For each collision test, we keep some meta data
-        Array<NarrowPhaseInfo> narrowPhaseInfos;
+        /// Output buffer with the contact points created during the narrow-phase. A block of
+        /// NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO contact points is reserved by a test when
+        /// its first contact point is added. Therefore, the blocks of the colliding tests are
+        /// packed at the beginning of the buffer and the remaining memory is never touched.
+        Array<ContactPointInfo> contactPoints;
 
         /// Constructor
         NarrowPhaseInfoBatch(OverlappingPairs& overlappingPairs, MemoryAllocator& allocator);
@@ -137,19 +141,25 @@ struct NarrowPhaseInfoBatch {
         void addContactPoint(uint32 index, const Vector3& contactNormal, decimal penDepth,
                              const Vector3& localPt1, const Vector3& localPt2);
 
+        /// Return a contact point of a given test
+        ContactPointInfo& getContactPoint(uint32 index, uint32 contactPointIndex);
+
         /// Reset the remaining contact points
         void resetContactPoints(uint32 index);
 
         // Initialize the containers using cached capacity
         void reserveMemory();
 
+        /// Allocate the output buffer of contact points before the narrow-phase tests
+        void allocateContactPoints();
+
         /// Clear all the objects in the batch
         void clear();
 };
 
 /// Return the number of objects in the batch
 RP3D_FORCE_INLINE uint32 NarrowPhaseInfoBatch::getNbObjects() const {
-    return static_cast<uint32>(narrowPhaseInfos.size());
+    return static_cast<uint32>(overlappingPairIds.size());
 }
 
 // Add shapes to be tested during narrow-phase collision detection into the batch
@@ -157,8 +167,19 @@ RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, E
                                               CollisionShape* shape2, const Transform& shape1Transform, const Transform& shape2Transform,
                                               bool needToReportContacts, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator) {
 
-    // Create a meta data object
-    narrowPhaseInfos.emplace(pairId, collider1, collider2, lastFrameInfo, shapeAllocator, shape1Transform, shape2Transform, shape1, shape2, needToReportContacts);
+    overlappingPairIds.add(pairId);
+    colliderEntities1.add(collider1);
+    colliderEntities2.add(collider2);
+    lastFrameCollisionInfos.add(lastFrameInfo);
+    collisionShapeAllocators.add(&shapeAllocator);
+    shape1ToWorldTransforms.add(shape1Transform);
+    shape2ToWorldTransforms.add(shape2Transform);
+    collisionShapes1.add(shape1);
+    collisionShapes2.add(shape2);
+    reportContacts.add(needToReportContacts);
+    isColliding.add(false);
+    nbContactPoints.add(0);
+    contactPointsIndices.add(INVALID_INDEX);
 }
 
 // Add a new contact point
@@ -166,22 +187,37 @@ RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::addContactPoint(uint32 index, const
 
     assert(penDepth > decimal(0.0));
 
-    if (narrowPhaseInfos[index].nbContactPoints < NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO) {
+    if (nbContactPoints[index] < NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO) {
 
         assert(contactNormal.length() > 0.8f);
 
+        // If this is the first contact point of the test, we reserve its block of contact points
+        if (contactPointsIndices[index] == INVALID_INDEX) {
+            reserveContactPointsBlock(index);
+        }
+
         // Add it into the array of contact points
-        narrowPhaseInfos[index].contactPoints[narrowPhaseInfos[index].nbContactPoints].normal = contactNormal;
-        narrowPhaseInfos[index].contactPoints[narrowPhaseInfos[index].nbContactPoints].penetrationDepth = penDepth;
-        narrowPhaseInfos[index].contactPoints[narrowPhaseInfos[index].nbContactPoints].localPoint1 = localPt1;
-        narrowPhaseInfos[index].contactPoints[narrowPhaseInfos[index].nbContactPoints].localPoint2 = localPt2;
-        narrowPhaseInfos[index].nbContactPoints++;
+        ContactPointInfo& contactPoint = contactPoints[contactPointsIndices[index] + nbContactPoints[index]];
+        contactPoint.normal = contactNormal;
+        contactPoint.penetrationDepth = penDepth;
+        contactPoint.localPoint1 = localPt1;
+        contactPoint.localPoint2 = localPt2;
+        nbContactPoints[index]++;
     }
 }
 
+// Return a contact point of a given test
+RP3D_FORCE_INLINE ContactPointInfo& NarrowPhaseInfoBatch::getContactPoint(uint32 index, uint32 contactPointIndex) {
+    assert(contactPointIndex < nbContactPoints[index]);
+    assert(contactPointsIndices[index] != INVALID_INDEX);
+    return contactPoints[contactPointsIndices[index] + contactPointIndex];
+}
+
 // Reset the remaining contact points
 RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::resetContactPoints(uint32 index) {
-    narrowPhaseInfos[index].nbContactPoints = 0;
+
+    // Note that the block of contact points of the test is kept in case new contact points are added later
+    nbContactPoints[index] = 0;
 }
 
 }
@@ -59,6 +59,7 @@ class NarrowPhaseInput {
         NarrowPhaseInfoBatch mSphereVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mCapsuleVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mConvexPolyhedronVsConvexPolyhedronBatch;
+        NarrowPhaseInfoBatch mBoxVsBoxBatch;
 
     public:
 
@@ -89,9 +90,18 @@ class NarrowPhaseInput {
         /// Get a reference to the convex polyhedron vs convex polyhedron batch
         NarrowPhaseInfoBatch& getConvexPolyhedronVsConvexPolyhedronBatch();
 
+        /// Get a reference to the box vs box batch
+        NarrowPhaseInfoBatch& getBoxVsBoxBatch();
+
+        /// Return the total number of narrow-phase tests in all the batches
+        uint32 getNbObjects() const;
+
         /// Reserve memory for the containers with cached capacity
         void reserveMemory();
 
+        /// Allocate the output buffers of contact points of the batches before the narrow-phase tests
+        void allocateContactPoints();
+
         /// Clear
         void clear();
 };
@@ -127,6 +137,18 @@ RP3D_FORCE_INLINE NarrowPhaseInfoBatch &NarrowPhaseInput::getConvexPolyhedronVsC
    return mConvexPolyhedronVsConvexPolyhedronBatch;
 }
 
+// Get a reference to the box vs box batch contacts
+RP3D_FORCE_INLINE NarrowPhaseInfoBatch& NarrowPhaseInput::getBoxVsBoxBatch() {
+   return mBoxVsBoxBatch;
+}
+
+// Return the total number of narrow-phase tests in all the batches
+RP3D_FORCE_INLINE uint32 NarrowPhaseInput::getNbObjects() const {
+    return mSphereVsSphereBatch.getNbObjects() + mSphereVsCapsuleBatch.getNbObjects() + mCapsuleVsCapsuleBatch.getNbObjects() +
+           mSphereVsConvexPolyhedronBatch.getNbObjects() + mCapsuleVsConvexPolyhedronBatch.getNbObjects() +
+           mConvexPolyhedronVsConvexPolyhedronBatch.getNbObjects() + mBoxVsBoxBatch.getNbObjects();
+}
+
 // Add shapes to be tested during narrow-phase collision detection into the batch
 RP3D_FORCE_INLINE void NarrowPhaseInput::addNarrowPhaseTest(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1, CollisionShape* shape2,
                                           const Transform& shape1Transform, const Transform& shape2Transform,
@@ -152,6 +174,9 @@ RP3D_FORCE_INLINE void NarrowPhaseInput::addNarrowPhaseTest(uint64 pairId, Entit
         case NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron:
             mConvexPolyhedronVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
             break;
+        case NarrowPhaseAlgorithmType::BoxVsBox:
+            mBoxVsBoxBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            break;
         case NarrowPhaseAlgorithmType::NoCollisionTest:
             // Must never happen
             assert(false);
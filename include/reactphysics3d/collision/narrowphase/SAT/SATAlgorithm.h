@@ -38,6 +38,7 @@ class CapsuleShape;
 class SphereShape;
 struct ContactManifoldInfo;
 struct NarrowPhaseInfoBatch;
+struct LastFrameCollisionInfo;
 class ConvexPolyhedronShape;
 class MemoryAllocator;
 class Profiler;
@@ -61,6 +62,11 @@ class SATAlgorithm {
         static const decimal SEPARATING_AXIS_RELATIVE_TOLERANCE;
         static const decimal SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
 
+        /// Maximum relative displacement and rotation angle (in radians) of two colliding polyhedra since their
+        /// contact features (incident face or edges) were computed to reuse these features (temporal coherence)
+        static const decimal TEMPORAL_COHERENCE_LINEAR_THRESHOLD;
+        static const decimal TEMPORAL_COHERENCE_ANGULAR_THRESHOLD;
+
         /// True means that if two shapes were colliding last time (previous frame) and are still colliding
         /// we use the previous (minimum penetration depth) axis to clip the colliding features and we don't
         /// recompute a new (minimum penetration depth) axis. This value must be true for a dynamic simulation
@@ -133,8 +139,13 @@ class SATAlgorithm {
         bool computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
                                                             const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
                                                             const Transform& polyhedron2ToPolyhedron1, uint32 minFaceIndex,
+                                                            LastFrameCollisionInfo* lastFrameCollisionInfo, bool reuseIncidentFace,
                                                             NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
 
+        /// Return true if two polyhedra have almost not moved relative to each other since their contact features were computed
+        bool isRelativeMotionBelowCoherenceThreshold(const LastFrameCollisionInfo* lastFrameCollisionInfo,
+                                                     const Transform& polyhedron1ToPolyhedron2) const;
+
 
     public :
 
@@ -109,6 +109,10 @@ class AABB {
         /// Return true if the ray intersects the AABB
         bool testRayIntersect(const Vector3& rayOrigin, const Vector3& rayDirectionInv, decimal rayMaxFraction) const;
 
+        /// Return true if the ray intersects the AABB and compute the fraction where the ray enters the AABB
+        bool testRayIntersect(const Vector3& rayOrigin, const Vector3& rayDirectionInv, decimal rayMaxFraction,
+                              decimal& rayEntryFraction) const;
+
         /// Compute the intersection of a ray and the AABB
         bool raycast(const Ray& ray, Vector3& hitPoint) const;
 
@@ -283,6 +287,23 @@ RP3D_FORCE_INLINE AABB AABB::createAABBForTriangle(const Vector3* trianglePoints
 // Return true if the ray intersects the AABB
 RP3D_FORCE_INLINE bool AABB::testRayIntersect(const Vector3& rayOrigin, const Vector3& rayDirectionInverse, decimal rayMaxFraction) const {
 
+    decimal rayEntryFraction;
+    return testRayIntersect(rayOrigin, rayDirectionInverse, rayMaxFraction, rayEntryFraction);
+}
+
+// Return true if the ray intersects the AABB and compute the fraction where the ray enters the AABB
+/// The entry fraction is zero if the origin of the ray is inside the AABB. It is used by the
+/// trees to visit the nodes in the order of the ray.
+/**
+ * @param rayOrigin Origin of the ray
+ * @param rayDirectionInverse Inverse of the direction (point2 - point1) of the ray
+ * @param rayMaxFraction Maximum fraction of the ray
+ * @param[out] rayEntryFraction Fraction of the ray where it enters the AABB (only valid if the method returns true)
+ * @return True if the ray intersects the AABB
+ */
+RP3D_FORCE_INLINE bool AABB::testRayIntersect(const Vector3& rayOrigin, const Vector3& rayDirectionInverse, decimal rayMaxFraction,
+                                              decimal& rayEntryFraction) const {
+
     // This algorithm relies on the IEE floating point properties (division by zero). If the rayDirection is zero, rayDirectionInverse and
     // therfore t1 and t2 will be +-INFINITY. If the i coordinate of the ray's origin is inside the AABB (mMinCoordinates[i] < rayOrigin[i] < mMaxCordinates[i)), we have
     // t1 = -t2 = +- INFINITY. Since max(n, -INFINITY) = min(n, INFINITY) = n for all n, tMin and tMax will stay unchanged. Secondly, if the i
@@ -310,7 +331,9 @@ RP3D_FORCE_INLINE bool AABB::testRayIntersect(const Vector3& rayOrigin, const Ve
         tMax = std::min(tMax, std::max(t1, t2));
     }
 
-    return tMax >= std::max(tMin, decimal(0.0));
+    rayEntryFraction = std::max(tMin, decimal(0.0));
+
+    return tMax >= rayEntryFraction;
 }
 
 // Compute the intersection of a ray and the AABB
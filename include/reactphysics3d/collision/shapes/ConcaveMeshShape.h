@@ -68,11 +68,9 @@ class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
     private :
 
-        Array<int32> mHitAABBNodes;
         const ConcaveMeshShape& mConcaveMeshShape;
         Collider* mCollider;
         RaycastInfo& mRaycastInfo;
-        const Ray& mRay;
         bool mIsHit;
         MemoryAllocator& mAllocator;
         const Vector3& mMeshScale;
@@ -88,18 +86,15 @@ class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
         // Constructor
         ConcaveMeshRaycastCallback(const ConcaveMeshShape& concaveMeshShape,
-                                   Collider* collider, RaycastInfo& raycastInfo, const Ray& ray, const Vector3& meshScale, MemoryAllocator& allocator)
-            : mHitAABBNodes(allocator), mConcaveMeshShape(concaveMeshShape), mCollider(collider),
-              mRaycastInfo(raycastInfo), mRay(ray), mIsHit(false), mAllocator(allocator), mMeshScale(meshScale) {
+                                   Collider* collider, RaycastInfo& raycastInfo, const Vector3& meshScale, MemoryAllocator& allocator)
+            : mConcaveMeshShape(concaveMeshShape), mCollider(collider),
+              mRaycastInfo(raycastInfo), mIsHit(false), mAllocator(allocator), mMeshScale(meshScale) {
 
         }
 
-        /// Collect all the AABB nodes that are hit by the ray in the Dynamic AABB Tree
+        /// Raycast the triangle of a leaf hit by the ray in the AABB tree of the mesh
         virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
 
-        /// Raycast all collision shapes that have been collected
-        void raycastTriangles();
-
         /// Return true if a raycast hit has been found
         bool getIsHit() const {
             return mIsHit;
@@ -161,9 +156,6 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Destructor
         virtual ~ConcaveMeshShape() override = default;
 
-        // Return the integer data of leaf node of the dynamic AABB tree
-        int32 getDynamicAABBTreeNodeDataInt(int32 nodeID) const;
-
         /// Compute the scaled faces normals
         void computeScaledVerticesNormals();
 
@@ -231,8 +223,8 @@ RP3D_FORCE_INLINE size_t ConcaveMeshShape::getSizeInBytes() const {
 // DynamicAABBTree:reportAllShapesOverlappingWithAABB()
 RP3D_FORCE_INLINE void ConvexTriangleAABBOverlapCallback::notifyOverlappingNode(int nodeId) {
 
-    // Get the node data (triangle index and mesh subpart index)
-    int32 data = mConcaveMeshShape.getDynamicAABBTreeNodeDataInt(nodeId);
+    // The node ID is the index of the triangle
+    int32 data = nodeId;
 
     // Get the triangle vertices for this node from the concave mesh shape
     Vector3 trianglePoints[3];
@@ -68,6 +68,10 @@ class ConvexMeshShape : public ConvexPolyhedronShape {
         /// Return a local support point in a given direction without the object margin.
         virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
 
+        /// Return a local support point in a given direction without the object margin starting
+        /// the search from the support vertex of a previous call
+        virtual Vector3 getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction, uint32& supportVertexIndex) const override;
+
         /// Return true if a point is inside the collision shape
         virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
 
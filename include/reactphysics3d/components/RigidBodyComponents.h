@@ -380,6 +380,12 @@ class RigidBodyComponents : public Components {
         /// Remove all the contact pairs of a body
         void removeAllContacPairs(Entity bodyEntity);
 
+        /// Update the constrained velocities of a body with the velocities computed by a solver
+        void updateConstrainedVelocities(uint32 index, const Vector3& linearVelocity, const Vector3& angularVelocity);
+
+        /// Update the split velocities of a body with the velocities computed by the contact solver
+        void updateSplitVelocities(uint32 index, const Vector3& linearVelocity, const Vector3& angularVelocity);
+
         // -------------------- Friendship -------------------- //
 
         friend class PhysicsWorld;
@@ -869,6 +875,33 @@ RP3D_FORCE_INLINE void RigidBodyComponents::removeAllContacPairs(Entity bodyEnti
     mContactPairs[mMapEntityToComponentIndex[bodyEntity]].clear();
 }
 
+// Update the constrained velocities of a body with the velocities computed by a solver
+/// The velocities of a static body are never modified by the impulses of the solvers. A static
+/// body can be shared by several islands solved concurrently and it is therefore not written here.
+RP3D_FORCE_INLINE void RigidBodyComponents::updateConstrainedVelocities(uint32 index, const Vector3& linearVelocity,
+                                                                      const Vector3& angularVelocity) {
+
+    assert(index < mNbComponents);
+
+    if (mBodyTypes[index] != BodyType::STATIC) {
+        mConstrainedLinearVelocities[index] = linearVelocity;
+        mConstrainedAngularVelocities[index] = angularVelocity;
+    }
+}
+
+// Update the split velocities of a body with the velocities computed by the contact solver
+/// As for the constrained velocities, the split velocities of a static body are not written.
+RP3D_FORCE_INLINE void RigidBodyComponents::updateSplitVelocities(uint32 index, const Vector3& linearVelocity,
+                                                                const Vector3& angularVelocity) {
+
+    assert(index < mNbComponents);
+
+    if (mBodyTypes[index] != BodyType::STATIC) {
+        mSplitLinearVelocities[index] = linearVelocity;
+        mSplitAngularVelocities[index] = angularVelocity;
+    }
+}
+
 }
 
 #endif
@@ -130,6 +130,15 @@ constexpr decimal PI_TIMES_2 = decimal(6.28318530);
 /// without triggering a large modification of the tree each frame which can be costly
 constexpr decimal DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE = decimal(0.08);
 
+/// In the middle-phase collision detection, the triangles of a concave shape that overlap with the AABB
+/// of a convex shape inflated by a constant percentage of its size are cached in the overlapping pair. The
+/// triangles are only computed again when the convex shape moves out of this inflated AABB
+constexpr decimal CONCAVE_TRIANGLES_CACHE_AABB_INFLATE_PERCENTAGE = decimal(0.5);
+
+/// Minimum number of vertices of a convex mesh to compute its support points with hill-climbing
+/// over the mesh edges. For smaller meshes, all the vertices are tested with SIMD instructions
+constexpr uint32 CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES = 32;
+
 /// Maximum number of contact points in a narrow phase info object
 constexpr uint8 NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO = 16;
 
@@ -0,0 +1,140 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CONSTRAINT_GRAPH_COLORING_H
+#define REACTPHYSICS3D_CONSTRAINT_GRAPH_COLORING_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/containers/Array.h>
+
+namespace reactphysics3d {
+
+// Class ConstraintGraphColoring
+/**
+ * This class splits the constraints (contact manifolds or joints) of an island into colors.
+ * Two constraints with the same color never share a non-static body and the constraints of
+ * a given color can therefore be solved concurrently with the Sequential Impulse technique.
+ * The colors are computed greedily in the order the constraints are added so that the result
+ * does not depend on the number of threads. The constraints that cannot get one of the
+ * NB_MAX_COLORS colors are put into an overflow color that must be solved serially.
+ */
+class ConstraintGraphColoring {
+
+    public:
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of colors (without the overflow color)
+        static const uint32 NB_MAX_COLORS = 24;
+
+        /// Body index used for a static body (static bodies are not written by the solvers)
+        static const uint32 NO_BODY = 0xFFFFFFFF;
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Bit mask of the colors already used by each body (indexed by rigid body component index)
+        Array<uint32> mBodiesColorMasks;
+
+        /// Constraint index of each added constraint
+        Array<uint32> mConstraints;
+
+        /// Color of each added constraint
+        Array<uint32> mConstraintsColors;
+
+        /// The two bodies of each added constraint (used to reset the color masks)
+        Array<uint32> mConstraintsBodies;
+
+        /// Constraint indices sorted by color
+        Array<uint32> mColoredConstraints;
+
+        /// Start index in mColoredConstraints of each color (plus the end of the last color)
+        Array<uint32> mColorsStartIndices;
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ConstraintGraphColoring(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~ConstraintGraphColoring() = default;
+
+        /// Deleted copy-constructor
+        ConstraintGraphColoring(const ConstraintGraphColoring& coloring) = delete;
+
+        /// Deleted assignment operator
+        ConstraintGraphColoring& operator=(const ConstraintGraphColoring& coloring) = delete;
+
+        /// Remove all the constraints and make sure the color masks can be used for a number of bodies
+        void reset(uint32 nbBodies);
+
+        /// Add a constraint between two bodies and give it a color
+        void addConstraint(uint32 constraintIndex, uint32 body1Index, uint32 body2Index);
+
+        /// Sort the added constraints by color
+        void computeColors();
+
+        /// Return the number of colors (including the overflow color)
+        uint32 getNbColors() const;
+
+        /// Return true if a color is the overflow color (its constraints must be solved serially)
+        bool isOverflowColor(uint32 color) const;
+
+        /// Return the number of constraints of a color
+        uint32 getNbConstraintsInColor(uint32 color) const;
+
+        /// Return a pointer to the constraint indices of a color
+        const uint32* getColorConstraints(uint32 color) const;
+};
+
+// Return the number of colors (including the overflow color)
+RP3D_FORCE_INLINE uint32 ConstraintGraphColoring::getNbColors() const {
+    return NB_MAX_COLORS + 1;
+}
+
+// Return true if a color is the overflow color (its constraints must be solved serially)
+RP3D_FORCE_INLINE bool ConstraintGraphColoring::isOverflowColor(uint32 color) const {
+    return color == NB_MAX_COLORS;
+}
+
+// Return the number of constraints of a color
+RP3D_FORCE_INLINE uint32 ConstraintGraphColoring::getNbConstraintsInColor(uint32 color) const {
+    assert(color + 1 < mColorsStartIndices.size());
+    return mColorsStartIndices[color + 1] - mColorsStartIndices[color];
+}
+
+// Return a pointer to the constraint indices of a color
+RP3D_FORCE_INLINE const uint32* ConstraintGraphColoring::getColorConstraints(uint32 color) const {
+    assert(color + 1 < mColorsStartIndices.size());
+    return &(mColoredConstraints[mColorsStartIndices[color]]);
+}
+
+}
+
+#endif
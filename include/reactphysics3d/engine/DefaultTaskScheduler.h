@@ -0,0 +1,152 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_DEFAULT_TASK_SCHEDULER_H
+#define REACTPHYSICS3D_DEFAULT_TASK_SCHEDULER_H
+
+// Libraries
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <reactphysics3d/containers/Array.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class DefaultTaskScheduler
+/**
+ * This class is the default task scheduler of the library. It is a pool of worker threads
+ * that use work-stealing to balance the load. When a task is executed with parallelFor(),
+ * the items are split into batches and each thread (the calling thread included) receives
+ * a contiguous range of batches in its own queue. A thread first processes the batches of its
+ * own queue from the front and then steals batches from the back of the other queues.
+ * Only one task can be executed at a time. If parallelFor() is called from inside a task,
+ * the nested task is executed serially by the calling thread.
+ */
+class DefaultTaskScheduler : public TaskScheduler {
+
+    private:
+
+        // Structure WorkQueue
+        /**
+         * Queue of batches of a thread for the current task
+         */
+        struct WorkQueue {
+
+            /// Mutex to protect the queue
+            std::mutex mutex;
+
+            /// Index of the next batch to process by the owner thread
+            uint32 frontBatchIndex = 0;
+
+            /// Index after the last batch of the queue (where the thieves steal from)
+            uint32 endBatchIndex = 0;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Total number of threads (including the calling thread)
+        uint32 mNbThreads;
+
+        /// Worker threads (the thread at index i has the thread index i+1)
+        Array<std::thread*> mWorkerThreads;
+
+        /// Work queue of each thread
+        WorkQueue* mQueues;
+
+        /// Task that is currently executed
+        ParallelTask* mTask;
+
+        /// Number of items of the current task
+        uint32 mNbItems;
+
+        /// Number of items in a batch of the current task
+        uint32 mBatchSize;
+
+        /// Number of batches of the current task that have not been completed yet
+        std::atomic<uint32> mNbRemainingBatches;
+
+        /// Number of times a task has been submitted to the workers
+        uint64 mTaskCounter;
+
+        /// True if the worker threads must exit
+        bool mIsQuitting;
+
+        /// Mutex used to wake up the workers
+        std::mutex mWorkersMutex;
+
+        /// Condition variable used to wake up the workers
+        std::condition_variable mWorkersCondition;
+
+        /// Mutex to make sure a single task is executed at a time
+        std::mutex mParallelForMutex;
+
+        // -------------------- Methods -------------------- //
+
+        /// Main loop of a worker thread
+        void workerMain(uint32 threadIndex);
+
+        /// Pop a batch from the front of the queue of a thread or steal one from the back of another queue
+        bool getNextBatch(uint32 threadIndex, uint32& batchIndex);
+
+        /// Execute the batches until there are no batches left in any queue
+        void executeBatches(uint32 threadIndex);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        DefaultTaskScheduler(MemoryAllocator& allocator, uint32 nbThreads = 0);
+
+        /// Destructor
+        virtual ~DefaultTaskScheduler() override;
+
+        /// Deleted copy-constructor
+        DefaultTaskScheduler(const DefaultTaskScheduler& scheduler) = delete;
+
+        /// Deleted assignment operator
+        DefaultTaskScheduler& operator=(const DefaultTaskScheduler& scheduler) = delete;
+
+        /// Return the maximum number of threads (including the calling thread) that can execute a task
+        virtual uint32 getNbThreads() const override;
+
+        /// Execute the task over the items [0, nbItems) and return when all the items have been processed
+        virtual void parallelFor(ParallelTask& task, uint32 nbItems, uint32 minBatchSize) override;
+};
+
+// Return the maximum number of threads (including the calling thread) that can execute a task
+RP3D_FORCE_INLINE uint32 DefaultTaskScheduler::getNbThreads() const {
+    return mNbThreads;
+}
+
+}
+
+#endif
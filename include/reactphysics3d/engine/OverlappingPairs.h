@@ -32,6 +32,7 @@
 #include <reactphysics3d/containers/Pair.h>
 #include <reactphysics3d/containers/Set.h>
 #include <reactphysics3d/containers/containers_common.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/BodyComponents.h>
@@ -76,6 +77,14 @@ struct LastFrameCollisionInfo {
     /// Previous separating axis
     Vector3 gjkSeparatingAxis;
 
+    /// Previous support vertices of the two shapes (used as a start to compute the next support points)
+    uint32 gjkSupportVertexIndex1;
+    uint32 gjkSupportVertexIndex2;
+
+    /// True if the shapes were found separated along the cached separating axis (without running
+    /// the GJK iterations) during the last test
+    bool gjkWasSeparatedAlongCachedAxis;
+
     // SAT Algorithm
     bool satIsAxisFacePolyhedron1;
     bool satIsAxisFacePolyhedron2;
@@ -83,11 +92,22 @@ struct LastFrameCollisionInfo {
     uint8 satMinEdge1Index;
     uint8 satMinEdge2Index;
 
+    /// Index of the incident face of the previous face vs face contact of the SAT algorithm
+    uint32 satIncidentFaceIndex;
+
+    /// Relative transform (from polyhedron 1 to polyhedron 2) of the shapes when the contact features
+    /// (incident face or edges) of the SAT algorithm were computed
+    Transform satFeaturesRelativeTransform;
+
+    /// Index of the previous minimum penetration axis of the BoxVsBoxAlgorithm (between 0 and 14)
+    uint8 satBoxAxisIndex;
+
     /// Constructor
     LastFrameCollisionInfo()
         :isValid(false), isObsolete(false), wasColliding(false), wasUsingGJK(false), wasUsingSAT(false), gjkSeparatingAxis(Vector3(0, 1, 0)),
-         satIsAxisFacePolyhedron1(false), satIsAxisFacePolyhedron2(false), satMinAxisFaceIndex(0),
-         satMinEdge1Index(0), satMinEdge2Index(0) {
+         gjkSupportVertexIndex1(0), gjkSupportVertexIndex2(0), gjkWasSeparatedAlongCachedAxis(false), satIsAxisFacePolyhedron1(false), satIsAxisFacePolyhedron2(false), satMinAxisFaceIndex(0),
+         satMinEdge1Index(0), satMinEdge2Index(0), satIncidentFaceIndex(0), satFeaturesRelativeTransform(Transform::identity()),
+         satBoxAxisIndex(0) {
 
     }
 };
@@ -192,13 +212,33 @@ class OverlappingPairs {
                 /// shape Ids of the two collision shapes.
                 Map<uint64, LastFrameCollisionInfo*> lastFrameCollisionInfos;
 
+                /// True if the cached triangles of the concave shape are valid
+                bool isTrianglesCacheValid;
+
+                /// Inflated AABB of the convex shape (in the local-space of the concave shape) used to compute the cached triangles
+                AABB cachedTrianglesAABB;
+
+                /// Scale of the concave shape when the cached triangles have been computed
+                Vector3 cachedTrianglesConcaveScale;
+
+                /// Vertices (in the local-space of the concave shape) of the cached triangles
+                Array<Vector3> cachedTrianglesVertices;
+
+                /// Vertices normals of the cached triangles
+                Array<Vector3> cachedTrianglesVerticesNormals;
+
+                /// Shape IDs of the cached triangles
+                Array<uint32> cachedTrianglesShapeIds;
+
                 /// Constructor
                 ConcaveOverlappingPair(uint64 pairId, int32 broadPhaseId1, int32 broadPhaseId2, Entity collider1, Entity collider2,
                                 NarrowPhaseAlgorithmType narrowPhaseAlgorithmType,
                                 bool isShape1Convex, MemoryAllocator& poolAllocator, MemoryAllocator& heapAllocator, bool isEnabled,
                                 bool allocateLastFrameCollisionInfos = true)
                   : OverlappingPair(pairId, broadPhaseId1, broadPhaseId2, collider1, collider2, narrowPhaseAlgorithmType, isEnabled), mPoolAllocator(&poolAllocator),
-                    isShape1Convex(isShape1Convex), lastFrameCollisionInfos(heapAllocator, allocateLastFrameCollisionInfos ? 16 : 0) {
+                    isShape1Convex(isShape1Convex), lastFrameCollisionInfos(heapAllocator, allocateLastFrameCollisionInfos ? 16 : 0),
+                    isTrianglesCacheValid(false), cachedTrianglesVertices(poolAllocator), cachedTrianglesVerticesNormals(poolAllocator),
+                    cachedTrianglesShapeIds(poolAllocator) {
 
                 }
 
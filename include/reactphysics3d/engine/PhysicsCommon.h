@@ -39,6 +39,7 @@
 #include <reactphysics3d/collision/ConvexMesh.h>
 #include <reactphysics3d/collision/HeightField.h>
 #include <reactphysics3d/utils/DefaultLogger.h>
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
 #include <reactphysics3d/collision/PolygonVertexArray.h>
 #include <reactphysics3d/collision/VertexArray.h>
 
@@ -101,6 +102,9 @@ class PhysicsCommon {
         /// Set of default loggers
         Set<DefaultLogger*> mDefaultLoggers;
 
+        /// Set of default task schedulers
+        Set<DefaultTaskScheduler*> mDefaultTaskSchedulers;
+
         /// Half-edge structure of a box polyhedron
         HalfEdgeStructure mBoxShapeHalfEdgeStructure;
 
@@ -148,6 +152,9 @@ class PhysicsCommon {
         /// Delete a default logger
         void deleteDefaultLogger(DefaultLogger* logger);
 
+        /// Delete a default task scheduler
+        void deleteDefaultTaskScheduler(DefaultTaskScheduler* taskScheduler);
+
         /// Initialize the half-edge structure of a BoxShape
         void initBoxShapeHalfEdgeStructure();
 
@@ -236,7 +243,8 @@ class PhysicsCommon {
         void destroyConvexMesh(ConvexMesh* convexMesh);
 
         /// Create a triangle mesh
-        TriangleMesh* createTriangleMesh(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages);
+        TriangleMesh* createTriangleMesh(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages,
+                                         bool isAABBTreeQuantized = false);
 
         /// Destroy a triangle mesh
         void destroyTriangleMesh(TriangleMesh* triangleMesh);
@@ -250,6 +258,12 @@ class PhysicsCommon {
         /// Destroy a default logger
         void destroyDefaultLogger(DefaultLogger* logger);
 
+        /// Create and return a new default task scheduler (thread pool)
+        DefaultTaskScheduler* createDefaultTaskScheduler(uint32 nbThreads = 0);
+
+        /// Destroy a default task scheduler
+        void destroyDefaultTaskScheduler(DefaultTaskScheduler* taskScheduler);
+
         /// Return the current logger
         static Logger* getLogger();
 
@@ -50,6 +50,7 @@
 #include <reactphysics3d/systems/ContactSolverSystem.h>
 #include <reactphysics3d/systems/DynamicsSystem.h>
 #include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
 #include <reactphysics3d/utils/DebugRenderer.h>
 #include <sstream>
 
@@ -119,6 +120,44 @@ class PhysicsWorld {
             /// than the value bellow, the manifold are considered to be similar.
             decimal cosAngleSimilarContactManifold;
 
+            /// Task scheduler used to execute some parts of the simulation on multiple threads. If this
+            /// is nullptr, the whole simulation is executed on the thread that calls PhysicsWorld::update().
+            /// The scheduler is not owned by the world and must stay alive as long as the world uses it.
+            TaskScheduler* taskScheduler;
+
+            /// Minimum number of constraints (contact manifolds and joints) of an island to solve it
+            /// with the graph-colored solver when a task scheduler is used. The constraints of such an
+            /// island are split into colors that do not share any body and each color is solved on
+            /// multiple threads. The result is deterministic but not identical to the serial solver
+            /// because the constraints are not solved in the same order. The graph-colored solver is
+            /// disabled by default (the threshold is the maximum uint32 value) and the islands are then
+            /// solved in parallel with the same result as the serial solver. A threshold of a few
+            /// hundreds constraints is a good value to solve large piles of bodies on multiple threads.
+            uint32 graphColoringNbConstraintsThreshold;
+
+            /// True if the contacts of the islands solved with the graph-colored solver are solved with
+            /// the wide contact solver. This solver packs the contact manifolds of a color into groups of
+            /// RP3D_SIMD_WIDTH manifolds that are solved with SIMD instructions (SSE, AVX or NEON
+            /// depending on the target). It gives the same result as the scalar solver. Note that this
+            /// solver is only used for the islands solved with the graph-colored solver. Therefore, it is
+            /// only used if a task scheduler is set and if the graphColoringNbConstraintsThreshold value
+            /// is lowered (the graph-colored solver is disabled by default).
+            bool isWideContactSolverEnabled;
+
+            /// Algorithm used by the broad-phase to compute the pairs of colliders with overlapping AABBs.
+            /// The dynamic AABB tree only tests the colliders that have moved. The sweep-and-prune sorts all
+            /// the colliders along an axis and is usually faster when most of the bodies move and have
+            /// similar sizes (many bodies on a flat ground for instance). The spatial hash grid stores the
+            /// colliders in uniform cells and is usually faster with many small colliders of similar sizes
+            /// that are spread in a large area. The algorithm cannot be changed once the world is created.
+            BroadPhaseAlgorithmType broadPhaseAlgorithmType;
+
+            /// Size of the cells of the grid with the SPATIAL_HASH_GRID broad-phase algorithm. It should be
+            /// close to the size of the AABB of most of the colliders. The colliders that overlap more than
+            /// four cells along an axis are stored in a dynamic AABB tree of the grid instead. The world
+            /// queries also use the grid and the broad-phase AABB trees of the world stay empty.
+            decimal broadPhaseGridCellSize;
+
             WorldSettings() {
 
                 worldName = "";
@@ -134,6 +173,11 @@ class PhysicsWorld {
                 defaultSleepLinearVelocity = decimal(0.02);
                 defaultSleepAngularVelocity = decimal(3.0) * (PI_RP3D / decimal(180.0));
                 cosAngleSimilarContactManifold = decimal(0.95);
+                taskScheduler = nullptr;
+                graphColoringNbConstraintsThreshold = std::numeric_limits<uint32>::max();
+                isWideContactSolverEnabled = true;
+                broadPhaseAlgorithmType = BroadPhaseAlgorithmType::DYNAMIC_AABB_TREE;
+                broadPhaseGridCellSize = decimal(4.0);
             }
 
             ~WorldSettings() = default;
@@ -156,6 +200,13 @@ class PhysicsWorld {
                 ss << "defaultSleepLinearVelocity=" << defaultSleepLinearVelocity << std::endl;
                 ss << "defaultSleepAngularVelocity=" << defaultSleepAngularVelocity << std::endl;
                 ss << "cosAngleSimilarContactManifold=" << cosAngleSimilarContactManifold << std::endl;
+                ss << "taskSchedulerNbThreads=" << (taskScheduler != nullptr ? taskScheduler->getNbThreads() : 1) << std::endl;
+                ss << "graphColoringNbConstraintsThreshold=" << graphColoringNbConstraintsThreshold << std::endl;
+                ss << "isWideContactSolverEnabled=" << isWideContactSolverEnabled << std::endl;
+                ss << "broadPhaseAlgorithmType=" << (broadPhaseAlgorithmType == BroadPhaseAlgorithmType::SWEEP_AND_PRUNE ? "SWEEP_AND_PRUNE" :
+                                                     broadPhaseAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID ? "SPATIAL_HASH_GRID" :
+                                                     "DYNAMIC_AABB_TREE") << std::endl;
+                ss << "broadPhaseGridCellSize=" << broadPhaseGridCellSize << std::endl;
 
                 return ss.str();
             }
@@ -163,6 +214,94 @@ class PhysicsWorld {
 
     protected :
 
+        // -------------------- Class SolveIslandsTask -------------------- //
+
+        /**
+         * Parallel task that solves the velocity constraints (contacts and joints) of a range of
+         * islands. The islands do not share any non-static body and the solvers never write the
+         * velocities of static bodies. Therefore, the islands can be solved concurrently and each
+         * body receives the same sequence of impulses as with the serial solver. The island index
+         * equal to the number of islands is used for the joints that are not in any island.
+         */
+        class SolveIslandsTask : public TaskScheduler::ParallelTask {
+
+            private:
+
+                /// Reference to the physics world
+                PhysicsWorld& mWorld;
+
+                /// Indices of the islands to solve
+                const Array<uint32>& mIslandsIndices;
+
+            public:
+
+                /// Constructor
+                SolveIslandsTask(PhysicsWorld& world, const Array<uint32>& islandsIndices)
+                    : mWorld(world), mIslandsIndices(islandsIndices) {
+
+                }
+
+                /// Solve the islands in the range [startIndex, endIndex) of the islands indices
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+        };
+
+        // -------------------- Class SolveIslandColorTask -------------------- //
+
+        /**
+         * Parallel task that executes one stage of the graph-colored solver of a large island.
+         * The stages that modify the velocities of the bodies are executed on the constraints
+         * of a single color. Those constraints do not share any non-static body.
+         */
+        class SolveIslandColorTask : public TaskScheduler::ParallelTask {
+
+            public:
+
+                /// Stage of the graph-colored solver
+                enum class Stage {InitializeContacts, WarmStartContacts, SolveContacts, SolveWideContacts,
+                                  StoreImpulses, InitializeJoints, WarmStartJoints, SolveJoints};
+
+            private:
+
+                /// Reference to the physics world
+                PhysicsWorld& mWorld;
+
+                /// Index of the island
+                uint32 mIslandIndex;
+
+                /// Current stage
+                Stage mStage;
+
+                /// Constraints of the current color (nullptr for the stages without color)
+                const uint32* mColorConstraints;
+
+                /// Index of the current color (for the wide contact solver)
+                uint32 mColorIndex;
+
+            public:
+
+                /// Constructor
+                SolveIslandColorTask(PhysicsWorld& world, uint32 islandIndex)
+                    : mWorld(world), mIslandIndex(islandIndex), mStage(Stage::InitializeContacts), mColorConstraints(nullptr),
+                      mColorIndex(0) {
+
+                }
+
+                /// Set the stage to execute and the constraints of the color (if any)
+                void setStage(Stage stage, const uint32* colorConstraints, uint32 colorIndex = 0) {
+                    mStage = stage;
+                    mColorConstraints = colorConstraints;
+                    mColorIndex = colorIndex;
+                }
+
+                /// Execute the current stage for the items in the range [startIndex, endIndex)
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Minimum number of constraints given to a thread by the graph-colored solver
+        static const uint32 GRAPH_COLORING_MIN_BATCH_SIZE = 16;
+
         // -------------------- Attributes -------------------- //
 
         /// Memory manager
@@ -266,10 +405,16 @@ class PhysicsWorld {
         /// Sleep angular velocity threshold
         decimal mSleepAngularVelocity;
 
+        /// True if a query snapshot of the world is active
+        bool mIsQuerySnapshotActive;
+
         /// Time (in seconds) before a body is put to sleep if its velocity
         /// becomes smaller than the sleep velocity.
         decimal mTimeBeforeSleep;
 
+        /// Task scheduler used to execute some parts of the simulation in parallel (nullptr if none)
+        TaskScheduler* mTaskScheduler;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
@@ -284,6 +429,18 @@ class PhysicsWorld {
         /// Solve the contacts and constraints
         void solveContactsAndConstraints(decimal timeStep);
 
+        /// Solve the contacts and constraints of the islands on the threads of the task scheduler
+        void solveContactsAndConstraintsParallel(decimal timeStep);
+
+        /// Solve the contacts and constraints of a large island with the graph-colored solver
+        void solveIslandGraphColoring(uint32 islandIndex);
+
+        /// Execute a stage of the graph-colored solver on each color
+        void executeColors(SolveIslandColorTask& task, SolveIslandColorTask::Stage stage, const ConstraintGraphColoring& coloring);
+
+        /// Solve the contacts of each color of a large island with the wide contact solver
+        void executeWideContactColors(SolveIslandColorTask& task);
+
         /// Solve the position error correction of the constraints
         void solvePositionCorrection();
 
@@ -315,6 +472,13 @@ class PhysicsWorld {
         /// Ray cast method
         void raycast(const Ray& ray, RaycastCallback* raycastCallback, unsigned short raycastWithCategoryMaskBits = 0xFFFF) const;
 
+        /// Ray cast method that only computes the closest hit
+        bool raycast(const Ray& ray, RaycastInfo& raycastInfo, unsigned short raycastWithCategoryMaskBits = 0xFFFF) const;
+
+        /// Ray cast method for a batch of rays that only computes the closest hit of each ray
+        uint32 raycastBatch(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, unsigned short raycastWithCategoryMaskBits = 0xFFFF,
+                            bool isParallel = false) const;
+
         /// Return true if two bodies overlap (collide)
         bool testOverlap(Body* body1, Body* body2);
 
@@ -324,6 +488,30 @@ class PhysicsWorld {
         /// Report all the bodies that overlap (collide) in the world
         void testOverlap(OverlapCallback& overlapCallback);
 
+        /// Report all the colliders with a world-space AABB overlapping with a given AABB
+        void testOverlap(const AABB& worldAABB, AABBQueryCallback& callback, unsigned short collideWithMaskBits = 0xFFFF) const;
+
+        /// Begin a query snapshot of the world
+        void beginQuerySnapshot();
+
+        /// End the current query snapshot of the world
+        void endQuerySnapshot();
+
+        /// Return true if a query snapshot of the world is active
+        bool isQuerySnapshotActive() const;
+
+        /// Rebuild the broad-phase AABB trees of the colliders
+        void rebuildBroadPhase();
+
+        /// Incrementally improve the broad-phase AABB trees by reinserting a maximum number of colliders
+        uint32 optimizeBroadPhase(uint32 maxNbReinsertedColliders);
+
+        /// Return the SAH cost of the broad-phase AABB trees (the quality of the trees, lower is better)
+        decimal getBroadPhaseSAHCost() const;
+
+        /// Return the height of the broad-phase AABB trees
+        int getBroadPhaseHeight() const;
+
         /// Test collision and report contacts between two bodies.
         void testCollision(Body* body1, Body* body2, CollisionCallback& callback);
 
@@ -420,6 +608,12 @@ class PhysicsWorld {
         /// Set an event listener object to receive events callbacks.
         void setEventListener(EventListener* eventListener);
 
+        /// Return the task scheduler used by the world (nullptr if none)
+        TaskScheduler* getTaskScheduler() const;
+
+        /// Set the task scheduler used to execute some parts of the simulation in parallel
+        void setTaskScheduler(TaskScheduler* taskScheduler);
+
         /// Return the number of RigidBody in the physics world
         uint32 getNbRigidBodies() const;
 
@@ -489,6 +683,43 @@ RP3D_FORCE_INLINE void PhysicsWorld::raycast(const Ray& ray,
     mCollisionDetection.raycast(raycastCallback, ray, raycastWithCategoryMaskBits);
 }
 
+// Ray cast method that only computes the closest hit
+/// This is faster than using a RaycastCallback that returns the hit fraction because the
+/// colliders behind the closest hit found so far are not tested.
+/**
+ * @param ray Ray to use for raycasting
+ * @param raycastInfo Information about the closest hit (only valid if the method returns true)
+ * @param raycastWithCategoryMaskBits Bits mask corresponding to the category of
+ *                                    bodies to be raycasted
+ * @return True if the ray hits a collider
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::raycast(const Ray& ray, RaycastInfo& raycastInfo,
+                                             unsigned short raycastWithCategoryMaskBits) const {
+    return mCollisionDetection.raycast(ray, raycastInfo, raycastWithCategoryMaskBits);
+}
+
+// Ray cast method for a batch of rays that only computes the closest hit of each ray
+/// The rays are cast by packets of consecutive rays that traverse the AABB trees of the world together.
+/// This is faster than casting the rays one at a time, especially if the consecutive rays are coherent
+/// (close origins and directions). The rays can be split over the threads of the task scheduler of the
+/// world. Note that the task scheduler must not be used by another thread at the same time (the parallel
+/// batch raycast cannot be called concurrently by multiple threads during a query snapshot for instance).
+/**
+ * @param rays Array with the rays to cast
+ * @param nbRays Number of rays
+ * @param raycastInfos Array of nbRays objects where the closest hit of each ray is stored. The collider
+ *                     of a RaycastInfo is nullptr if the corresponding ray does not hit any collider.
+ * @param raycastWithCategoryMaskBits Bits mask corresponding to the category of
+ *                                    bodies to be raycasted
+ * @param isParallel True if the rays are cast on the threads of the task scheduler of the world
+ * @return The number of rays that hit a collider
+ */
+RP3D_FORCE_INLINE uint32 PhysicsWorld::raycastBatch(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos,
+                                                    unsigned short raycastWithCategoryMaskBits, bool isParallel) const {
+    return mCollisionDetection.raycastBatch(rays, nbRays, raycastInfos, raycastWithCategoryMaskBits,
+                                            isParallel ? mTaskScheduler : nullptr);
+}
+
 // Test collision and report contacts between two bodies.
 /// Use this method if you only want to get all the contacts between two bodies.
 /// All the contacts will be reported using the callback object in paramater.
@@ -537,9 +768,55 @@ RP3D_FORCE_INLINE void PhysicsWorld::testCollision(CollisionCallback& callback)
  * @param overlapCallback Pointer to the callback class to report overlap
  */
 RP3D_FORCE_INLINE void PhysicsWorld::testOverlap(Body* body, OverlapCallback& overlapCallback) {
+
+    // During a query snapshot, the state of the collision detection must not be modified
+    if (mIsQuerySnapshotActive) {
+        mCollisionDetection.testOverlapQuery(body, nullptr, &overlapCallback);
+        return;
+    }
+
     mCollisionDetection.testOverlap(body, overlapCallback);
 }
 
+// Report all the colliders with a world-space AABB overlapping with a given AABB
+/// This method only reads the broad-phase of the world and can therefore be called concurrently
+/// by multiple threads during a query snapshot of the world.
+/**
+ * @param worldAABB The AABB (in world-space) to test
+ * @param callback Reference to the callback object called for each collider overlapping with the AABB
+ * @param collideWithMaskBits Bits mask corresponding to the category of colliders to report
+ */
+RP3D_FORCE_INLINE void PhysicsWorld::testOverlap(const AABB& worldAABB, AABBQueryCallback& callback, unsigned short collideWithMaskBits) const {
+    mCollisionDetection.testOverlapAABB(worldAABB, callback, collideWithMaskBits);
+}
+
+// Return true if a query snapshot of the world is active
+/**
+ * @return True if the beginQuerySnapshot() method has been called and not the endQuerySnapshot() method yet
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::isQuerySnapshotActive() const {
+    return mIsQuerySnapshotActive;
+}
+
+// Return the SAH cost of the broad-phase AABB trees (the quality of the trees, lower is better)
+/// The cost is proportional to the expected number of nodes visited by a query in the trees. It
+/// increases when many colliders are added, moved and removed. It can be compared with the cost right
+/// after a call to rebuildBroadPhase() to decide when the trees must be rebuilt or optimized.
+/**
+ * @return The sum of the SAH costs of the trees of the moving and static colliders
+ */
+RP3D_FORCE_INLINE decimal PhysicsWorld::getBroadPhaseSAHCost() const {
+    return mCollisionDetection.mBroadPhaseSystem.computeTreesSAHCost();
+}
+
+// Return the height of the broad-phase AABB trees
+/**
+ * @return The largest height of the trees of the moving and static colliders
+ */
+RP3D_FORCE_INLINE int PhysicsWorld::getBroadPhaseHeight() const {
+    return mCollisionDetection.mBroadPhaseSystem.getTreesHeight();
+}
+
 // Report all the bodies that overlap (collide) in the world
 /// Use this method if you are not interested in contacts but if you simply want to know
 /// which bodies overlap. If you want to get the contacts, you need to use the
@@ -664,6 +941,24 @@ RP3D_FORCE_INLINE void PhysicsWorld::setEventListener(EventListener* eventListen
     mEventListener = eventListener;
 }
 
+// Return the task scheduler used by the world
+/**
+ * @return A pointer to the task scheduler or nullptr if the simulation is executed serially
+ */
+RP3D_FORCE_INLINE TaskScheduler* PhysicsWorld::getTaskScheduler() const {
+    return mTaskScheduler;
+}
+
+// Set the task scheduler used to execute some parts of the simulation in parallel
+/// If you use "nullptr" as an argument, the simulation will be executed serially on the
+/// thread calling the update() method. This method must not be called during an update().
+/**
+ * @param taskScheduler Pointer to the task scheduler to use (not owned by the world)
+ */
+RP3D_FORCE_INLINE void PhysicsWorld::setTaskScheduler(TaskScheduler* taskScheduler) {
+    mTaskScheduler = taskScheduler;
+}
+
 // Return the number of RigidBody in the physics world
 /**
  * @return The number of rigid bodies in the physics world
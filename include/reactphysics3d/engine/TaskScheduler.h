@@ -0,0 +1,101 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_TASK_SCHEDULER_H
+#define REACTPHYSICS3D_TASK_SCHEDULER_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class TaskScheduler
+/**
+ * This abstract class is the interface used by the physics world to distribute some of the
+ * work of a simulation step over multiple threads. You can implement this interface to plug
+ * the library into your own job system. The DefaultTaskScheduler class is a thread pool that
+ * can be used if you do not have a job system. If no task scheduler is given to a physics
+ * world, all the work is executed serially on the thread calling PhysicsWorld::update().
+ */
+class TaskScheduler {
+
+    public:
+
+        // Class ParallelTask
+        /**
+         * This abstract class represents some work that can be split into independent
+         * ranges of items. The ranges might be executed concurrently by different threads.
+         */
+        class ParallelTask {
+
+            public:
+
+                /// Destructor
+                virtual ~ParallelTask() = default;
+
+                /// Execute the task for the items in the range [startIndex, endIndex). The thread
+                /// index is in the range [0, TaskScheduler::getNbThreads()) and is unique among the
+                /// threads that are running this task at the same time.
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex)=0;
+        };
+
+        /// Destructor
+        virtual ~TaskScheduler() = default;
+
+        /// Return the maximum number of threads (including the calling thread) that can execute a task
+        virtual uint32 getNbThreads() const=0;
+
+        /// Execute the task over the items [0, nbItems) and return when all the items have been processed.
+        /// The items are split into ranges of at least minBatchSize items (except the last one).
+        virtual void parallelFor(ParallelTask& task, uint32 nbItems, uint32 minBatchSize)=0;
+
+        /// Execute a task with a given scheduler or serially on the calling thread if there is no scheduler
+        static void run(TaskScheduler* scheduler, ParallelTask& task, uint32 nbItems, uint32 minBatchSize);
+};
+
+// Execute a task with a given scheduler or serially on the calling thread if there is no scheduler
+/**
+ * @param scheduler Pointer to a task scheduler (can be nullptr)
+ * @param task The task to execute
+ * @param nbItems Number of items to process
+ * @param minBatchSize Minimum number of items in a range given to a thread
+ */
+RP3D_FORCE_INLINE void TaskScheduler::run(TaskScheduler* scheduler, ParallelTask& task, uint32 nbItems, uint32 minBatchSize) {
+
+    if (nbItems == 0) return;
+
+    // If there is no scheduler or not enough work to split it, we run the task on the calling thread
+    if (scheduler == nullptr || scheduler->getNbThreads() < 2 || nbItems <= minBatchSize) {
+        task.execute(0, nbItems, 0);
+    }
+    else {
+        scheduler->parallelFor(task, nbItems, minBatchSize);
+    }
+}
+
+}
+
+#endif
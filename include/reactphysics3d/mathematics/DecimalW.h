@@ -0,0 +1,416 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_DECIMAL_W_H
+#define REACTPHYSICS3D_DECIMAL_W_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+#include <algorithm>
+
+// Number of lanes of the DecimalW type. The width is part of the layout of some classes of the library
+// (wide tree nodes, raycast packets, wide contact solver data) and is therefore fixed when the library is
+// configured (RP3D_SIMD_WIDTH CMake option exported as a public compile definition). It must not depend
+// on the instruction sets enabled by the compiler flags of the application.
+#ifndef RP3D_SIMD_WIDTH
+    #define RP3D_SIMD_WIDTH 4
+#endif
+#if RP3D_SIMD_WIDTH != 4 && RP3D_SIMD_WIDTH != 8
+    #error "RP3D_SIMD_WIDTH must be 4 or 8"
+#endif
+
+// The SIMD instruction set for this width is selected at compile-time. The SIMD code is only used
+// for single precision and can be disabled with the RP3D_SIMD_ENABLED CMake option. The lanes
+// are processed one after the other if the instruction set is not available.
+#if defined(IS_RP3D_SIMD_ENABLED) && !defined(IS_RP3D_DOUBLE_PRECISION_ENABLED)
+    #if RP3D_SIMD_WIDTH == 8
+        #if defined(__AVX__)
+            #define RP3D_SIMD_AVX
+            #include <immintrin.h>
+        #endif
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RP3D_SIMD_SSE
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RP3D_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class DecimalW
+/**
+ * This class represents RP3D_SIMD_WIDTH decimal values (lanes) that are processed with
+ * a single SIMD instruction (AVX with 8 lanes, SSE or NEON with 4 lanes). When no
+ * instruction set is available, the lanes are processed one after the other. Each lane
+ * gives exactly the same result as the corresponding scalar operation. The min() and
+ * max() functions return the same lane as std::min() and std::max().
+ */
+class DecimalW {
+
+    public:
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of lanes
+        static constexpr uint32 NB_LANES = RP3D_SIMD_WIDTH;
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+#if defined(RP3D_SIMD_AVX)
+        __m256 mValues;
+#elif defined(RP3D_SIMD_SSE)
+        __m128 mValues;
+#elif defined(RP3D_SIMD_NEON)
+        float32x4_t mValues;
+#else
+        // Same alignment as the SIMD registers so that the layout does not depend on the instruction set
+        alignas(sizeof(decimal) * NB_LANES) decimal mValues[NB_LANES];
+#endif
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor (the lanes are not initialized)
+        DecimalW() = default;
+
+        /// Constructor with the same value in all the lanes
+        explicit DecimalW(decimal value);
+
+        /// Load the lanes from an array of NB_LANES values (no alignment required)
+        static DecimalW load(const decimal* values);
+
+        /// Store the lanes into an array of NB_LANES values (no alignment required)
+        void store(decimal* values) const;
+
+        /// Overloaded operators
+        friend DecimalW operator+(const DecimalW& a, const DecimalW& b);
+        friend DecimalW operator-(const DecimalW& a, const DecimalW& b);
+        friend DecimalW operator*(const DecimalW& a, const DecimalW& b);
+        friend DecimalW operator-(const DecimalW& a);
+
+        /// Return the lanes of std::min(a, b)
+        friend DecimalW min(const DecimalW& a, const DecimalW& b);
+
+        /// Return the lanes of std::max(a, b)
+        friend DecimalW max(const DecimalW& a, const DecimalW& b);
+
+        /// Return a bit mask where the bit i is set if a <= b in the lane i (false for NaN)
+        friend uint32 lessOrEqualMask(const DecimalW& a, const DecimalW& b);
+};
+
+// Structure Vector3W
+/**
+ * This structure represents RP3D_SIMD_WIDTH 3D vectors in structure-of-arrays layout.
+ */
+struct Vector3W {
+
+    /// Components of the vectors
+    DecimalW x, y, z;
+
+    /// Constructor (the lanes are not initialized)
+    Vector3W() = default;
+
+    /// Constructor with the components
+    Vector3W(const DecimalW& newX, const DecimalW& newY, const DecimalW& newZ) : x(newX), y(newY), z(newZ) {}
+};
+
+// Structure Vector3Lanes
+/**
+ * This structure stores RP3D_SIMD_WIDTH 3D vectors in structure-of-arrays layout
+ * in memory. It is used to pack the data processed with the Vector3W type.
+ */
+struct Vector3Lanes {
+
+    /// Components of the vectors
+    decimal x[RP3D_SIMD_WIDTH];
+    decimal y[RP3D_SIMD_WIDTH];
+    decimal z[RP3D_SIMD_WIDTH];
+
+    /// Set the vector of a lane
+    void set(uint32 lane, const Vector3& vector) {
+        x[lane] = vector.x;
+        y[lane] = vector.y;
+        z[lane] = vector.z;
+    }
+
+    /// Return the vector of a lane
+    Vector3 get(uint32 lane) const {
+        return Vector3(x[lane], y[lane], z[lane]);
+    }
+
+    /// Load the vectors of all the lanes
+    Vector3W load() const {
+        return Vector3W(DecimalW::load(x), DecimalW::load(y), DecimalW::load(z));
+    }
+
+    /// Store the vectors of all the lanes
+    void store(const Vector3W& vector) {
+        vector.x.store(x);
+        vector.y.store(y);
+        vector.z.store(z);
+    }
+};
+
+#if defined(RP3D_SIMD_AVX)
+
+RP3D_FORCE_INLINE DecimalW::DecimalW(decimal value) : mValues(_mm256_set1_ps(value)) {}
+
+RP3D_FORCE_INLINE DecimalW DecimalW::load(const decimal* values) {
+    DecimalW result;
+    result.mValues = _mm256_loadu_ps(values);
+    return result;
+}
+
+RP3D_FORCE_INLINE void DecimalW::store(decimal* values) const {
+    _mm256_storeu_ps(values, mValues);
+}
+
+RP3D_FORCE_INLINE DecimalW operator+(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm256_add_ps(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm256_sub_ps(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator*(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm256_mul_ps(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a) {
+    DecimalW result;
+    result.mValues = _mm256_xor_ps(a.mValues, _mm256_set1_ps(-0.0f));
+    return result;
+}
+
+// The operands are swapped because _mm256_min_ps(a, b) returns b when the values are equal
+RP3D_FORCE_INLINE DecimalW min(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm256_min_ps(b.mValues, a.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW max(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm256_max_ps(b.mValues, a.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE uint32 lessOrEqualMask(const DecimalW& a, const DecimalW& b) {
+    return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(a.mValues, b.mValues, _CMP_LE_OQ)));
+}
+
+#elif defined(RP3D_SIMD_SSE)
+
+RP3D_FORCE_INLINE DecimalW::DecimalW(decimal value) : mValues(_mm_set1_ps(value)) {}
+
+RP3D_FORCE_INLINE DecimalW DecimalW::load(const decimal* values) {
+    DecimalW result;
+    result.mValues = _mm_loadu_ps(values);
+    return result;
+}
+
+RP3D_FORCE_INLINE void DecimalW::store(decimal* values) const {
+    _mm_storeu_ps(values, mValues);
+}
+
+RP3D_FORCE_INLINE DecimalW operator+(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm_add_ps(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm_sub_ps(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator*(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm_mul_ps(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a) {
+    DecimalW result;
+    result.mValues = _mm_xor_ps(a.mValues, _mm_set1_ps(-0.0f));
+    return result;
+}
+
+// The operands are swapped because _mm_min_ps(a, b) returns b when the values are equal
+RP3D_FORCE_INLINE DecimalW min(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm_min_ps(b.mValues, a.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW max(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = _mm_max_ps(b.mValues, a.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE uint32 lessOrEqualMask(const DecimalW& a, const DecimalW& b) {
+    return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(a.mValues, b.mValues)));
+}
+
+#elif defined(RP3D_SIMD_NEON)
+
+RP3D_FORCE_INLINE DecimalW::DecimalW(decimal value) : mValues(vdupq_n_f32(value)) {}
+
+RP3D_FORCE_INLINE DecimalW DecimalW::load(const decimal* values) {
+    DecimalW result;
+    result.mValues = vld1q_f32(values);
+    return result;
+}
+
+RP3D_FORCE_INLINE void DecimalW::store(decimal* values) const {
+    vst1q_f32(values, mValues);
+}
+
+RP3D_FORCE_INLINE DecimalW operator+(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = vaddq_f32(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = vsubq_f32(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator*(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = vmulq_f32(a.mValues, b.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a) {
+    DecimalW result;
+    result.mValues = vnegq_f32(a.mValues);
+    return result;
+}
+
+// Select the lanes explicitly to return the same lane as std::min() and std::max() for equal values
+RP3D_FORCE_INLINE DecimalW min(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = vbslq_f32(vcltq_f32(b.mValues, a.mValues), b.mValues, a.mValues);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW max(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    result.mValues = vbslq_f32(vcltq_f32(a.mValues, b.mValues), b.mValues, a.mValues);
+    return result;
+}
+
+// NEON has no movemask instruction and therefore each lane of the comparison is kept as one bit
+RP3D_FORCE_INLINE uint32 lessOrEqualMask(const DecimalW& a, const DecimalW& b) {
+    const uint32_t laneBits[4] = {1, 2, 4, 8};
+    const uint32x4_t bits = vandq_u32(vcleq_f32(a.mValues, b.mValues), vld1q_u32(laneBits));
+    const uint32x2_t sums = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return vget_lane_u32(vpadd_u32(sums, sums), 0);
+}
+
+#else
+
+RP3D_FORCE_INLINE DecimalW::DecimalW(decimal value) {
+    for (uint32 i=0; i < NB_LANES; i++) mValues[i] = value;
+}
+
+RP3D_FORCE_INLINE DecimalW DecimalW::load(const decimal* values) {
+    DecimalW result;
+    for (uint32 i=0; i < NB_LANES; i++) result.mValues[i] = values[i];
+    return result;
+}
+
+RP3D_FORCE_INLINE void DecimalW::store(decimal* values) const {
+    for (uint32 i=0; i < NB_LANES; i++) values[i] = mValues[i];
+}
+
+RP3D_FORCE_INLINE DecimalW operator+(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) result.mValues[i] = a.mValues[i] + b.mValues[i];
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) result.mValues[i] = a.mValues[i] - b.mValues[i];
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator*(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) result.mValues[i] = a.mValues[i] * b.mValues[i];
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW operator-(const DecimalW& a) {
+    DecimalW result;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) result.mValues[i] = -a.mValues[i];
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW min(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) result.mValues[i] = std::min(a.mValues[i], b.mValues[i]);
+    return result;
+}
+
+RP3D_FORCE_INLINE DecimalW max(const DecimalW& a, const DecimalW& b) {
+    DecimalW result;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) result.mValues[i] = std::max(a.mValues[i], b.mValues[i]);
+    return result;
+}
+
+RP3D_FORCE_INLINE uint32 lessOrEqualMask(const DecimalW& a, const DecimalW& b) {
+    uint32 mask = 0;
+    for (uint32 i=0; i < DecimalW::NB_LANES; i++) {
+        if (a.mValues[i] <= b.mValues[i]) mask |= (1u << i);
+    }
+    return mask;
+}
+
+#endif
+
+}
+
+#endif
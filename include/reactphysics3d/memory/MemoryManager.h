@@ -31,6 +31,8 @@
 #include <reactphysics3d/memory/PoolAllocator.h>
 #include <reactphysics3d/memory/HeapAllocator.h>
 #include <reactphysics3d/memory/SingleFrameAllocator.h>
+#include <reactphysics3d/memory/PoolAllocatorCache.h>
+#include <reactphysics3d/containers/Array.h>
 
 /// Namespace ReactPhysics3D
 namespace reactphysics3d {
@@ -45,7 +47,10 @@ class MemoryAllocator;
  * allocated specified by the user. The HeapAllocator is used on top of the base allocator.
  * The SingleFrameAllocator is used for memory that is allocated only during a frame and the PoolAllocator
  * is used to allocated objects of small size. Both SingleFrameAllocator and PoolAllocator will fall back to
- * HeapAllocator if an allocation request cannot be fulfilled.
+ * HeapAllocator if an allocation request cannot be fulfilled. Each thread of a task scheduler can also
+ * get its own single frame allocator and its own cache of the PoolAllocator. Those thread allocators
+ * do not lock any mutex while the allocation requests can be fulfilled locally and therefore the
+ * threads of the parallel stages do not contend on the allocation of memory.
  */
 class MemoryManager {
 
@@ -66,8 +71,20 @@ class MemoryManager {
        /// Single frame stack allocator
        SingleFrameAllocator mSingleFrameAllocator;
 
+       /// Single frame allocator of each thread of the task scheduler
+       Array<SingleFrameAllocator*> mThreadFrameAllocators;
+
+       /// Cache of the pool allocator of each thread of the task scheduler
+       Array<PoolAllocatorCache*> mThreadPoolAllocators;
+
     public:
 
+       // -------------------- Constants -------------------- //
+
+       /// Initial size (in bytes) of the single frame allocator of a thread
+       static const size_t THREAD_FRAME_ALLOCATOR_NB_BYTES = 65536; // 64Kb
+
+
         /// Memory allocation types
        enum class AllocationType {
            Base, 	// Base memory allocator
@@ -80,7 +97,7 @@ class MemoryManager {
        MemoryManager(MemoryAllocator* baseAllocator, size_t initAllocatedMemory = 0);
 
        /// Destructor
-       ~MemoryManager() = default;
+       ~MemoryManager();
 
         /// Allocate memory of a given type
         void* allocate(AllocationType allocationType, size_t size);
@@ -97,6 +114,18 @@ class MemoryManager {
         /// Return the heap allocator
         HeapAllocator& getHeapAllocator();
 
+        /// Make sure there are allocators for a given number of threads
+        void createThreadAllocators(uint32 nbThreads);
+
+        /// Return the single frame allocator of a thread of the task scheduler
+        SingleFrameAllocator& getThreadFrameAllocator(uint32 threadIndex);
+
+        /// Return the cache of the pool allocator of a thread of the task scheduler
+        PoolAllocatorCache& getThreadPoolAllocator(uint32 threadIndex);
+
+        /// Reset the single frame allocators of the threads
+        void resetThreadFrameAllocators();
+
         /// Reset the single frame allocator
         void resetFrameAllocator();
 };
@@ -144,9 +173,31 @@ RP3D_FORCE_INLINE HeapAllocator& MemoryManager::getHeapAllocator() {
    return mHeapAllocator;
 }
 
+// Return the single frame allocator of a thread of the task scheduler
+/// The allocator must only be used by the thread with this index while a task is executed
+RP3D_FORCE_INLINE SingleFrameAllocator& MemoryManager::getThreadFrameAllocator(uint32 threadIndex) {
+   assert(threadIndex < mThreadFrameAllocators.size());
+   return *(mThreadFrameAllocators[threadIndex]);
+}
+
+// Return the cache of the pool allocator of a thread of the task scheduler
+/// The memory allocated with the cache must be released with the same cache by the same thread
+RP3D_FORCE_INLINE PoolAllocatorCache& MemoryManager::getThreadPoolAllocator(uint32 threadIndex) {
+   assert(threadIndex < mThreadPoolAllocators.size());
+   return *(mThreadPoolAllocators[threadIndex]);
+}
+
+// Reset the single frame allocators of the threads
+RP3D_FORCE_INLINE void MemoryManager::resetThreadFrameAllocators() {
+   for (uint32 i=0; i < mThreadFrameAllocators.size(); i++) {
+       mThreadFrameAllocators[i]->reset();
+   }
+}
+
 // Reset the single frame allocator
 RP3D_FORCE_INLINE void MemoryManager::resetFrameAllocator() {
    mSingleFrameAllocator.reset();
+   resetThreadFrameAllocators();
 }
 
 }
@@ -34,6 +34,9 @@
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
 
+// Declarations
+class PoolAllocatorCache;
+
 // Class PoolAllocator
 /**
  * This class is used to efficiently allocate memory on the heap.
@@ -131,6 +134,17 @@ class PoolAllocator : public MemoryAllocator {
         int mNbTimesAllocateMethodCalled;
 #endif
 
+        // -------------------- Methods -------------------- //
+
+        /// Return a free memory unit of a given heap
+        MemoryUnit* allocateUnit(int indexHeap);
+
+        /// Allocate a linked-list of memory units of a given heap
+        MemoryUnit* allocateUnits(int indexHeap, uint32 nbUnits);
+
+        /// Release a linked-list of memory units of a given heap
+        void releaseUnits(int indexHeap, MemoryUnit* firstUnit, MemoryUnit* lastUnit, uint32 nbUnits);
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -150,6 +164,10 @@ class PoolAllocator : public MemoryAllocator {
 
         /// Release previously allocated memory.
         virtual void release(void* pointer, size_t size) override;
+
+        // -------------------- Friendship -------------------- //
+
+        friend class PoolAllocatorCache;
 };
 
 }
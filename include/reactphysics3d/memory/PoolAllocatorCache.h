@@ -0,0 +1,100 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_POOL_ALLOCATOR_CACHE_H
+#define REACTPHYSICS3D_POOL_ALLOCATOR_CACHE_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/memory/PoolAllocator.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class PoolAllocatorCache
+/**
+ * This class is a cache of free memory units of a pool allocator that is used by a single thread.
+ * The memory units are allocated and released in the cache without locking the mutex of the
+ * pool allocator. The cache only locks the pool allocator to get or give back many memory units
+ * at once. The memory allocated with a cache must be released with the same cache by the same
+ * thread. Allocation requests larger than the maximum memory unit size fall back to the pool
+ * allocator.
+ */
+class PoolAllocatorCache : public MemoryAllocator {
+
+    private :
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of memory units to get from the pool allocator when a heap of the cache is empty
+        static const uint32 NB_REFILL_UNITS = 16;
+
+        /// Maximum number of free memory units in a heap of the cache
+        static const uint32 MAX_NB_FREE_UNITS = 64;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Pool allocator that owns the memory units
+        PoolAllocator& mPoolAllocator;
+
+        /// Pointers to the first free memory unit for each heap
+        PoolAllocator::MemoryUnit* mFreeMemoryUnits[PoolAllocator::NB_HEAPS];
+
+        /// Number of free memory units for each heap
+        uint32 mNbFreeMemoryUnits[PoolAllocator::NB_HEAPS];
+
+        // -------------------- Methods -------------------- //
+
+        /// Give back some free memory units of a heap to the pool allocator
+        void releaseUnits(int indexHeap, uint32 nbUnits);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        PoolAllocatorCache(PoolAllocator& poolAllocator);
+
+        /// Destructor
+        virtual ~PoolAllocatorCache() override;
+
+        /// Assignment operator
+        PoolAllocatorCache& operator=(PoolAllocatorCache& allocator) = delete;
+
+        /// Allocate memory of a given size (in bytes) and return a pointer to the
+        /// allocated memory.
+        virtual void* allocate(size_t size) override;
+
+        /// Release previously allocated memory.
+        virtual void release(void* pointer, size_t size) override;
+
+        /// Give back all the free memory units of the cache to the pool allocator
+        void flush();
+};
+
+}
+
+#endif
@@ -0,0 +1,84 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SCRATCH_ALLOCATOR_H
+#define REACTPHYSICS3D_SCRATCH_ALLOCATOR_H
+
+// Libraries
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/configuration.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class ScratchAllocator
+/**
+ * This class represents a memory allocator for the temporary memory of a single call of a
+ * method (a scene query for instance). The memory is allocated linearly in a buffer given by
+ * the caller (usually on the stack) and is all released when the allocator is destroyed. The
+ * allocator does not lock any mutex but it must only be used by a single thread. When the buffer
+ * is full, the memory is allocated with the base allocator.
+ */
+class ScratchAllocator : public MemoryAllocator {
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Reference to the base memory allocator
+        MemoryAllocator& mBaseAllocator;
+
+        /// Pointer to the beginning of the memory buffer
+        char* mMemoryBufferStart;
+
+        /// Size (in bytes) of the memory buffer
+        size_t mTotalSizeBytes;
+
+        /// Offset of the next available memory location in the buffer
+        size_t mCurrentOffset;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ScratchAllocator(void* buffer, size_t sizeBytes, MemoryAllocator& baseAllocator);
+
+        /// Destructor
+        virtual ~ScratchAllocator() override = default;
+
+        /// Assignment operator
+        ScratchAllocator& operator=(ScratchAllocator& allocator) = delete;
+
+        /// Allocate memory of a given size (in bytes)
+        virtual void* allocate(size_t size) override;
+
+        /// Release previously allocated memory.
+        virtual void release(void* pointer, size_t size) override;
+};
+
+}
+
+#endif
@@ -29,7 +29,7 @@
 // Libraries
 #include <reactphysics3d/memory/MemoryAllocator.h>
 #include <reactphysics3d/configuration.h>
-#include <mutex>
+#include <atomic>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -37,7 +37,11 @@ namespace reactphysics3d {
 // Class SingleFrameAllocator
 /**
  * This class represent a memory allocator used to efficiently allocate
- * memory on the heap that is used during a single frame.
+ * memory on the heap that is used during a single frame. The allocation
+ * of memory is lock-free and can be done concurrently by multiple threads.
+ * When the memory block is full, the memory is allocated with the base
+ * allocator. The reset() method must not be called while other threads
+ * are allocating memory.
  */
 class SingleFrameAllocator : public MemoryAllocator {
 
@@ -46,13 +50,10 @@ class SingleFrameAllocator : public MemoryAllocator {
         // -------------------- Constants -------------------- //
 
         /// Initial size (in bytes) of the single frame allocator
-        size_t INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES = 1048576; // 1Mb
+        static const size_t INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES = 1048576; // 1Mb
 
         // -------------------- Attributes -------------------- //
 
-        /// Mutex
-        std::mutex mMutex;
-
         /// Reference to the base memory allocator
         MemoryAllocator& mBaseAllocator;
 
@@ -63,17 +64,17 @@ class SingleFrameAllocator : public MemoryAllocator {
         char* mMemoryBufferStart;
 
         /// Pointer to the next available memory location in the buffer
-        size_t mCurrentOffset;
+        std::atomic<size_t> mCurrentOffset;
 
         /// True if we need to allocate more memory in the next reset() call
-        bool mNeedToAllocatedMore;
+        std::atomic<bool> mNeedToAllocatedMore;
 
     public :
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SingleFrameAllocator(MemoryAllocator& baseAllocator);
+        SingleFrameAllocator(MemoryAllocator& baseAllocator, size_t initSizeBytes = INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES);
 
         /// Destructor
         virtual ~SingleFrameAllocator() override;
@@ -43,6 +43,8 @@
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/engine/Material.h>
 #include <reactphysics3d/engine/EventListener.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
 #include <reactphysics3d/collision/shapes/CollisionShape.h>
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
@@ -28,8 +28,13 @@
 
 // Libraries
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/broadphase/SweepAndPrune.h>
+#include <reactphysics3d/collision/broadphase/SpatialHashGrid.h>
 #include <reactphysics3d/containers/LinkedList.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/Map.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/components/RigidBodyComponents.h>
@@ -43,9 +48,13 @@ class CollisionDetectionSystem;
 class BroadPhaseSystem;
 class Body;
 class Collider;
+struct RaycastInfo;
 class MemoryManager;
 class Profiler;
 
+/// Enumeration for the algorithm used by the broad-phase to compute the overlapping pairs of colliders
+enum class BroadPhaseAlgorithmType {DYNAMIC_AABB_TREE, SWEEP_AND_PRUNE, SPATIAL_HASH_GRID};
+
 // class AABBOverlapCallback
 class AABBOverlapCallback : public DynamicAABBTreeOverlapCallback {
 
@@ -79,13 +88,19 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
         RaycastTest& mRaycastTest;
 
+        /// Maximum fraction of the ray after the hits reported so far
+        decimal mMaxFraction;
+
+        /// True if the user has stopped the raycast
+        bool mIsRaycastStopped;
+
     public:
 
         // Constructor
         BroadPhaseRaycastCallback(const DynamicAABBTree& dynamicAABBTree, unsigned short raycastWithCategoryMaskBits,
-                                  RaycastTest& raycastTest)
+                                  RaycastTest& raycastTest, decimal maxFraction)
             : mDynamicAABBTree(dynamicAABBTree), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
-              mRaycastTest(raycastTest) {
+              mRaycastTest(raycastTest), mMaxFraction(maxFraction), mIsRaycastStopped(false) {
 
         }
 
@@ -95,6 +110,84 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
         // Called for a broad-phase shape that has to be tested for raycast
         virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
 
+        // Return the maximum fraction of the ray after the hits reported so far
+        decimal getMaxFraction() const {
+            return mMaxFraction;
+        }
+
+        // Return true if the user has stopped the raycast
+        bool isRaycastStopped() const {
+            return mIsRaycastStopped;
+        }
+
+};
+
+// Class BroadPhaseRaycastPacketCallback
+/**
+ * Callback called when the AABB of a leaf node of the broad-phase Dynamic AABB Tree is hit
+ * by a ray of a packet. It keeps the closest hit of each ray of the packet.
+ */
+class BroadPhaseRaycastPacketCallback : public DynamicAABBTreeRaycastPacketCallback {
+
+    private :
+
+        const DynamicAABBTree& mDynamicAABBTree;
+
+        unsigned short mRaycastWithCategoryMaskBits;
+
+        /// Closest hit of each ray of the packet
+        RaycastInfo* mRaycastInfos;
+
+        /// Allocator used for the temporary memory of the raycast
+        MemoryAllocator& mAllocator;
+
+    public:
+
+        // Constructor
+        BroadPhaseRaycastPacketCallback(const DynamicAABBTree& dynamicAABBTree, unsigned short raycastWithCategoryMaskBits,
+                                        RaycastInfo* raycastInfos, MemoryAllocator& allocator)
+            : mDynamicAABBTree(dynamicAABBTree), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
+              mRaycastInfos(raycastInfos), mAllocator(allocator) {
+
+        }
+
+        // Destructor
+        virtual ~BroadPhaseRaycastPacketCallback() override = default;
+
+        // Called for a broad-phase shape that has to be tested for raycast with a ray of the packet
+        virtual decimal raycastBroadPhaseShape(int32 nodeId, uint32 rayIndex, const Ray& ray) override;
+};
+
+// Class BroadPhaseGridRaycastCallback
+/**
+ * Callback called when the AABB of a collider of the broad-phase spatial hash grid
+ * is hit by a ray. The grid gives the broad-phase ID of the collider as node ID.
+ */
+class BroadPhaseGridRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+    private :
+
+        const BroadPhaseSystem& mBroadPhaseSystem;
+
+        unsigned short mRaycastWithCategoryMaskBits;
+
+        RaycastTest& mRaycastTest;
+
+    public:
+
+        // Constructor
+        BroadPhaseGridRaycastCallback(const BroadPhaseSystem& broadPhaseSystem, unsigned short raycastWithCategoryMaskBits,
+                                      RaycastTest& raycastTest)
+            : mBroadPhaseSystem(broadPhaseSystem), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
+              mRaycastTest(raycastTest) {
+
+        }
+
+        // Destructor
+        virtual ~BroadPhaseGridRaycastCallback() override = default;
+
+        // Called for a broad-phase shape that has to be tested for raycast
+        virtual decimal raycastBroadPhaseShape(int32 broadPhaseId, const Ray& ray) override;
 };
 
 // Class BroadPhaseSystem
@@ -103,17 +196,149 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
  * goal of the broad-phase collision detection is to compute the pairs of colliders
  * that have their AABBs overlapping. Only those pairs of bodies will be tested
  * later for collision during the narrow-phase collision detection. A dynamic AABB
- * tree data structure is used for fast broad-phase collision detection.
+ * tree data structure is used for fast broad-phase collision detection. The colliders
+ * of the static bodies are stored in a separate tree. This way, the moving colliders do
+ * not have to walk the static geometry twice and the static colliders are never tested
+ * against each other during the simulation (two static bodies never collide). The
+ * broad-phase ID of a collider encodes the tree that contains it. The queries against the
+ * static colliders use a wide copy of the static tree (StaticAABBTree) that is rebuilt before
+ * the computation of the overlapping pairs if the static colliders have changed. The overlapping
+ * pairs of the moved colliders can also be computed with a sweep-and-prune instead of the trees.
+ * The trees are still used for the world queries in this case. With a spatial hash grid, the
+ * trees are not used at all. The grid stores the fat AABBs and the colliders of the broad-phase
+ * IDs and the world queries are also answered by the grid.
  */
 class BroadPhaseSystem {
 
     protected :
 
+        // -------------------- Constants -------------------- //
+
+        /// Minimum number of moved shapes tested for overlap by a thread of the task scheduler
+        static constexpr uint32 OVERLAPPING_PAIRS_MIN_BATCH_SIZE = 64;
+
+        /// Bit of a broad-phase ID that is set if the shape is in the static tree
+        static constexpr int32 STATIC_TREE_BIT = 1;
+
+        /// Number of consecutive broad-phase updates without a change of the static colliders
+        /// before the wide tree of the static colliders is rebuilt
+        static constexpr uint32 STATIC_WIDE_TREE_REBUILD_DELAY = 8;
+
+        /// Number of ranges of moved shapes per thread (more ranges for a better load balancing)
+        static const uint32 OVERLAPPING_PAIRS_NB_RANGES_PER_THREAD = 4;
+
+        /// Minimum number of colliders whose AABB is computed by a thread of the task scheduler
+        static const uint32 UPDATE_COLLIDERS_MIN_BATCH_SIZE = 128;
+
+        // -------------------- Classes -------------------- //
+
+        // Class OverlappingPairsTask
+        /**
+         * Parallel task that tests ranges of moved shapes for overlap against the AABB trees.
+         * The trees are only read during the task. Each range writes its overlapping pairs into its own
+         * array. A pair of two moved shapes is only kept in the range of the shape that comes first in
+         * the array of shapes to test (as the first report of the pair with a serial query).
+         */
+        class OverlappingPairsTask : public TaskScheduler::ParallelTask {
+
+            private:
+
+                /// Reference to the broad-phase system
+                const BroadPhaseSystem& mBroadPhaseSystem;
+
+                /// Broad-phase IDs of the shapes to test
+                const Array<int32>& mShapesToTest;
+
+                /// Map a broad-phase ID of a shape to test to its index in the array of shapes to test
+                const Map<int32, uint32>& mShapesToTestIndices;
+
+                /// Number of shapes to test per range
+                uint32 mRangeSize;
+
+                /// Overlapping pairs of each range
+                Array<Array<Pair<int32, int32>>>& mRangesOverlappingNodes;
+
+            public:
+
+                /// Constructor
+                OverlappingPairsTask(const BroadPhaseSystem& broadPhaseSystem, const Array<int32>& shapesToTest,
+                                     const Map<int32, uint32>& shapesToTestIndices, uint32 rangeSize,
+                                     Array<Array<Pair<int32, int32>>>& rangesOverlappingNodes)
+                    : mBroadPhaseSystem(broadPhaseSystem), mShapesToTest(shapesToTest), mShapesToTestIndices(shapesToTestIndices),
+                      mRangeSize(rangeSize), mRangesOverlappingNodes(rangesOverlappingNodes) {
+
+                }
+
+                /// Test the shapes of the ranges [startIndex, endIndex)
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+        };
+
+        // Class ComputeCollidersAABBsTask
+        /**
+         * Parallel task that computes the world-space AABBs of a range of enabled colliders and
+         * checks if they have escaped the fat AABB of their node in the AABB trees. The
+         * trees are only read during the task.
+         */
+        class ComputeCollidersAABBsTask : public TaskScheduler::ParallelTask {
+
+            private:
+
+                /// Reference to the broad-phase system
+                BroadPhaseSystem& mBroadPhaseSystem;
+
+                /// World-space AABB of each enabled collider
+                AABB* mAABBs;
+
+                /// True if the collider of the same index needs to be updated in the dynamic AABB tree
+                bool* mNeedTreeUpdate;
+
+                /// True if the collider of the same index must be reinserted because its shape has changed size
+                bool* mForceReInsert;
+
+            public:
+
+                /// Constructor
+                ComputeCollidersAABBsTask(BroadPhaseSystem& broadPhaseSystem, AABB* aabbs, bool* needTreeUpdate, bool* forceReInsert)
+                    : mBroadPhaseSystem(broadPhaseSystem), mAABBs(aabbs), mNeedTreeUpdate(needTreeUpdate), mForceReInsert(forceReInsert) {
+
+                }
+
+                /// Compute the AABBs of the colliders in the range [startIndex, endIndex)
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+        };
+
         // -------------------- Attributes -------------------- //
 
-        /// Dynamic AABB tree
+        /// Dynamic AABB tree with the colliders of the dynamic and kinematic bodies
         DynamicAABBTree mDynamicAABBTree;
 
+        /// Dynamic AABB tree with the colliders of the static bodies
+        DynamicAABBTree mStaticAABBTree;
+
+        /// Wide copy of the tree of the static colliders (the data of an item is its node ID in mStaticAABBTree)
+        StaticAABBTree mStaticWideTree;
+
+        /// True if the wide tree of the static colliders is up to date with the static tree
+        bool mIsStaticWideTreeValid;
+
+        /// Number of consecutive broad-phase updates since the static colliders have changed
+        uint32 mNbUpdatesSinceStaticChange;
+
+        /// Algorithm used to compute the overlapping pairs of the moved colliders
+        BroadPhaseAlgorithmType mAlgorithmType;
+
+        /// Sweep-and-prune with the fat AABBs of all the colliders (only used with the SWEEP_AND_PRUNE algorithm)
+        SweepAndPrune mSweepAndPrune;
+
+        /// Grid with the fat AABBs of all the colliders (only used with the SPATIAL_HASH_GRID algorithm)
+        SpatialHashGrid mSpatialHashGrid;
+
+        /// Indices of the removed broad-phase IDs of the grid that can be used again
+        Array<int32> mFreeGridIndices;
+
+        /// Number of indices of broad-phase IDs allocated for the grid
+        int32 mNbGridIndices;
+
         /// Reference to the colliders components
         ColliderComponents& mCollidersComponents;
 
@@ -128,6 +353,11 @@ class BroadPhaseSystem {
         /// for overlapping in the next simulation step.
         Set<int> mMovedShapes;
 
+        /// Set with the broad-phase IDs of the static shapes that have moved (or have been created)
+        /// and that have not been tested against the other static shapes yet. Those shapes are only
+        /// tested against the static tree when a world query needs the pairs of static shapes.
+        Set<int> mMovedStaticShapes;
+
         /// Reference to the collision detection object
         CollisionDetectionSystem& mCollisionDetection;
 
@@ -139,6 +369,39 @@ class BroadPhaseSystem {
 #endif
         // -------------------- Methods -------------------- //
 
+        /// Return the broad-phase ID of a node of one of the trees
+        static int32 computeBroadPhaseId(int32 nodeId, bool isStaticTree);
+
+        /// Return the ID of the node of a broad-phase shape in its tree
+        static int32 getTreeNodeId(int32 broadPhaseId);
+
+        /// Return the tree that contains a given broad-phase shape
+        const DynamicAABBTree& getTree(int32 broadPhaseId) const;
+
+        /// Return the tree that contains a given broad-phase shape
+        DynamicAABBTree& getTree(int32 broadPhaseId);
+
+        /// Report the broad-phase shapes of a tree overlapping with a given AABB
+        static void reportShapesOverlappingWithAABB(const DynamicAABBTree& tree, bool isStaticTree, int32 shapeId, const AABB& aabb,
+                                                    Array<int32>& nodes, Stack<int32>& stack, Array<Pair<int32, int32>>& overlappingNodes);
+
+        /// Report the static broad-phase shapes overlapping with a given AABB
+        void reportStaticShapesOverlappingWithAABB(int32 shapeId, const AABB& aabb, Array<int32>& nodes, Stack<int32>& stack,
+                                                   Stack<uint32>& wideStack, Array<Pair<int32, int32>>& overlappingNodes) const;
+
+        /// Notify that the static colliders have changed and that the wide tree is not up to date anymore
+        void invalidateStaticWideTree();
+
+        /// Rebuild the wide tree of the static colliders once the static colliders do not change anymore
+        void updateStaticWideTree();
+
+        /// Return the fat AABB of a collider in the grid
+        AABB computeGridFatAABB(const AABB& aabb, bool isStatic) const;
+
+        /// Report all the shapes overlapping with the shapes of a range of an array
+        void reportAllShapesOverlappingWithShapes(const Array<int32>& shapesToTest, uint32 startIndex, uint32 endIndex,
+                                                  Array<Pair<int32, int32>>& overlappingNodes, MemoryAllocator& allocator) const;
+
         /// Notify the Dynamic AABB tree that a collider needs to be updated
         void updateColliderInternal(int32 broadPhaseId, Collider* collider, const AABB& aabb,
                                     bool forceReInsert);
@@ -146,13 +409,22 @@ class BroadPhaseSystem {
         /// Update the broad-phase state of some colliders components
         void updateCollidersComponents(uint32 startIndex, uint32 nbItems);
 
+        /// Update the broad-phase state of all the enabled colliders with the threads of a task scheduler
+        void updateCollidersParallel(TaskScheduler& taskScheduler);
+
+        /// Compute all the overlapping pairs of collision shapes with the threads of a task scheduler
+        void computeOverlappingPairsParallel(MemoryManager& memoryManager, const Array<int32>& shapesToTest,
+                                             Array<Pair<int32, int32>>& overlappingNodes, TaskScheduler& taskScheduler);
+
     public :
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
         BroadPhaseSystem(CollisionDetectionSystem& collisionDetection, ColliderComponents& collidersComponents,
-                         TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents);
+                         TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents,
+                         BroadPhaseAlgorithmType algorithmType = BroadPhaseAlgorithmType::DYNAMIC_AABB_TREE,
+                         decimal gridCellSize = decimal(4.0));
 
         /// Destructor
         ~BroadPhaseSystem() = default;
@@ -173,7 +445,7 @@ class BroadPhaseSystem {
         void updateCollider(Entity colliderEntity);
 
         /// Update the broad-phase state of all the enabled colliders
-        void updateColliders();
+        void updateColliders(TaskScheduler* taskScheduler = nullptr);
 
         /// Add a collider in the array of colliders that have moved in the last simulation step
         /// and that need to be tested again for broad-phase overlapping.
@@ -184,7 +456,14 @@ class BroadPhaseSystem {
         void removeMovedCollider(int broadPhaseID);
 
         /// Compute all the overlapping pairs of collision shapes
-        void computeOverlappingPairs(MemoryManager& memoryManager, Array<Pair<int32, int32>>& overlappingNodes);
+        void computeOverlappingPairs(MemoryManager& memoryManager, Array<Pair<int32, int32>>& overlappingNodes,
+                                     bool includeStaticPairs, TaskScheduler* taskScheduler = nullptr);
+
+        /// Return true if a broad-phase shape is in the tree of the static colliders
+        static bool isStaticShape(int32 broadPhaseId);
+
+        /// Return the algorithm used to compute the overlapping pairs of the moved colliders
+        BroadPhaseAlgorithmType getAlgorithmType() const;
 
         /// Return the collider corresponding to the broad-phase node id in parameter
         Collider* getColliderForBroadPhaseId(int broadPhaseId) const;
@@ -198,6 +477,25 @@ class BroadPhaseSystem {
         /// Ray casting method
         void raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const;
 
+        /// Ray casting method for a packet of rays that only computes the closest hit of each ray
+        void raycastPacket(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, unsigned short raycastWithCategoryMaskBits,
+                           MemoryAllocator& allocator) const;
+
+        /// Report all the broad-phase shapes with a fat AABB overlapping with a given AABB
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes, MemoryAllocator& allocator) const;
+
+        /// Rebuild the AABB trees of the colliders with the Surface Area Heuristic
+        void rebuildTrees();
+
+        /// Incrementally improve the AABB trees of the colliders by reinserting a maximum number of colliders
+        uint32 optimizeTrees(uint32 maxNbReinsertedColliders);
+
+        /// Return the sum of the SAH costs of the AABB trees of the colliders
+        decimal computeTreesSAHCost() const;
+
+        /// Return the largest height of the AABB trees of the colliders
+        int getTreesHeight() const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -209,20 +507,99 @@ class BroadPhaseSystem {
 
 // Return the fat AABB of a given broad-phase shape
 RP3D_FORCE_INLINE const AABB& BroadPhaseSystem::getFatAABB(int broadPhaseId) const  {
-    return mDynamicAABBTree.getFatAABB(broadPhaseId);
+
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+        return mSpatialHashGrid.getAABB(broadPhaseId);
+    }
+
+    return getTree(broadPhaseId).getFatAABB(getTreeNodeId(broadPhaseId));
+}
+
+// Return the algorithm used to compute the overlapping pairs of the moved colliders
+RP3D_FORCE_INLINE BroadPhaseAlgorithmType BroadPhaseSystem::getAlgorithmType() const {
+    return mAlgorithmType;
+}
+
+// Return the broad-phase ID of a node of one of the trees
+RP3D_FORCE_INLINE int32 BroadPhaseSystem::computeBroadPhaseId(int32 nodeId, bool isStaticTree) {
+    assert(nodeId >= 0);
+    return (nodeId << 1) | (isStaticTree ? STATIC_TREE_BIT : 0);
+}
+
+// Return the ID of the node of a broad-phase shape in its tree
+RP3D_FORCE_INLINE int32 BroadPhaseSystem::getTreeNodeId(int32 broadPhaseId) {
+    return broadPhaseId >> 1;
+}
+
+// Return true if a broad-phase shape is in the tree of the static colliders
+RP3D_FORCE_INLINE bool BroadPhaseSystem::isStaticShape(int32 broadPhaseId) {
+    return (broadPhaseId & STATIC_TREE_BIT) != 0;
+}
+
+// Return the tree that contains a given broad-phase shape
+RP3D_FORCE_INLINE const DynamicAABBTree& BroadPhaseSystem::getTree(int32 broadPhaseId) const {
+    return isStaticShape(broadPhaseId) ? mStaticAABBTree : mDynamicAABBTree;
+}
+
+// Return the tree that contains a given broad-phase shape
+RP3D_FORCE_INLINE DynamicAABBTree& BroadPhaseSystem::getTree(int32 broadPhaseId) {
+    return isStaticShape(broadPhaseId) ? mStaticAABBTree : mDynamicAABBTree;
+}
+
+// Notify that the static colliders have changed and that the wide tree is not up to date anymore
+RP3D_FORCE_INLINE void BroadPhaseSystem::invalidateStaticWideTree() {
+    mIsStaticWideTreeValid = false;
+    mNbUpdatesSinceStaticChange = 0;
 }
 
 // Remove a collider from the array of colliders that have moved in the last simulation step
 // and that need to be tested again for broad-phase overlapping.
 RP3D_FORCE_INLINE void BroadPhaseSystem::removeMovedCollider(int broadPhaseID) {
 
-    // Remove the broad-phase ID from the set
+    // Remove the broad-phase ID from the sets
     mMovedShapes.remove(broadPhaseID);
+    mMovedStaticShapes.remove(broadPhaseID);
+}
+
+// Report all the broad-phase shapes with a fat AABB overlapping with a given AABB
+RP3D_FORCE_INLINE void BroadPhaseSystem::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes,
+                                                                            MemoryAllocator& allocator) const {
+
+    // The IDs of the objects of the grid are the broad-phase IDs
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+        mSpatialHashGrid.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes, allocator);
+        return;
+    }
+
+    // Report the nodes of the two trees and convert their IDs into broad-phase IDs
+    const uint64 nbPreviousNodes = overlappingNodes.size();
+    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes, allocator);
+    const uint64 nbDynamicNodes = overlappingNodes.size();
+    if (mIsStaticWideTreeValid) {
+        mStaticWideTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes, allocator);
+    }
+    else {
+        mStaticAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes, allocator);
+    }
+
+    for (uint64 i=nbPreviousNodes; i < overlappingNodes.size(); i++) {
+        overlappingNodes[i] = computeBroadPhaseId(overlappingNodes[i], i >= nbDynamicNodes);
+    }
 }
 
 // Return the collider corresponding to the broad-phase node id in parameter
 RP3D_FORCE_INLINE Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int broadPhaseId) const {
-    return static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(broadPhaseId));
+
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+        return static_cast<Collider*>(mSpatialHashGrid.getObjectData(broadPhaseId));
+    }
+
+    return static_cast<Collider*>(getTree(broadPhaseId).getNodeDataPointer(getTreeNodeId(broadPhaseId)));
+}
+
+// Return the largest height of the AABB trees of the colliders
+RP3D_FORCE_INLINE int BroadPhaseSystem::getTreesHeight() const {
+    return std::max(mDynamicAABBTree.getHeight(), mStaticAABBTree.getHeight());
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -231,6 +608,10 @@ RP3D_FORCE_INLINE Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int bro
 RP3D_FORCE_INLINE void BroadPhaseSystem::setProfiler(Profiler* profiler) {
 	mProfiler = profiler;
 	mDynamicAABBTree.setProfiler(profiler);
+	mStaticAABBTree.setProfiler(profiler);
+	mStaticWideTree.setProfiler(profiler);
+	mSweepAndPrune.setProfiler(profiler);
+	mSpatialHashGrid.setProfiler(profiler);
 }
 
 #endif
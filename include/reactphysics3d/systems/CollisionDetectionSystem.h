@@ -44,6 +44,10 @@
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/collision/HalfEdgeStructure.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <reactphysics3d/memory/SingleFrameAllocator.h>
+#include <reactphysics3d/memory/ScratchAllocator.h>
+#include <atomic>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -53,6 +57,8 @@ class PhysicsWorld;
 class CollisionCallback;
 class OverlapCallback;
 class RaycastCallback;
+struct RaycastInfo;
+class AABBQueryCallback;
 class ContactPoint;
 class MemoryManager;
 class EventListener;
@@ -76,6 +82,95 @@ class CollisionDetectionSystem {
         /// Maximum number of contact points in a reduced contact manifold
         static const int8 MAX_CONTACT_POINTS_IN_MANIFOLD = 4;
 
+        /// Minimum number of narrow-phase tests executed by a thread of the task scheduler
+        static const uint32 NARROW_PHASE_MIN_BATCH_SIZE = 32;
+
+        /// Size (in bytes) of the memory buffer on the stack for the temporary memory of a scene query
+        static const size_t QUERY_SCRATCH_MEMORY_NB_BYTES = 16384; // 16Kb
+
+        /// Minimum number of packets of rays of a batch raycast executed by a thread of the task scheduler
+        static const uint32 RAYCAST_BATCH_MIN_NB_PACKETS = 16;
+
+        // -------------------- Classes -------------------- //
+
+        // Class NarrowPhaseTask
+        /**
+         * Parallel task that runs the narrow-phase algorithms on a range of the narrow-phase tests.
+         * The batches of the narrow-phase input are seen as a single range of tests. Each
+         * thread uses its own single frame allocator for the temporary memory of the algorithms.
+         */
+        class NarrowPhaseTask : public TaskScheduler::ParallelTask {
+
+            private:
+
+                /// Reference to the collision detection system
+                CollisionDetectionSystem& mCollisionDetection;
+
+                /// Narrow-phase input with the batches to test
+                NarrowPhaseInput& mNarrowPhaseInput;
+
+                /// True if the SAT algorithm can clip with the previous separating axis
+                bool mClipWithPreviousAxisIfStillColliding;
+
+                /// True if at least one of the tests has found a contact
+                std::atomic<bool> mIsContactFound;
+
+            public:
+
+                /// Constructor
+                NarrowPhaseTask(CollisionDetectionSystem& collisionDetection, NarrowPhaseInput& narrowPhaseInput,
+                                bool clipWithPreviousAxisIfStillColliding)
+                    : mCollisionDetection(collisionDetection), mNarrowPhaseInput(narrowPhaseInput),
+                      mClipWithPreviousAxisIfStillColliding(clipWithPreviousAxisIfStillColliding), mIsContactFound(false) {
+
+                }
+
+                /// Test the narrow-phase tests in the range [startIndex, endIndex)
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+
+                /// Return true if at least one of the tests has found a contact
+                bool isContactFound() const {
+                    return mIsContactFound.load(std::memory_order_relaxed);
+                }
+        };
+
+        // Class RaycastBatchTask
+        /**
+         * Parallel task that casts a range of the packets of rays of a batch raycast.
+         */
+        class RaycastBatchTask : public TaskScheduler::ParallelTask {
+
+            private:
+
+                /// Reference to the collision detection system
+                const CollisionDetectionSystem& mCollisionDetection;
+
+                /// Array with the rays of the batch
+                const Ray* mRays;
+
+                /// Number of rays in the batch
+                uint32 mNbRays;
+
+                /// Array where the closest hit of each ray is stored
+                RaycastInfo* mRaycastInfos;
+
+                /// Bits mask corresponding to the category of colliders to be raycasted
+                unsigned short mRaycastWithCategoryMaskBits;
+
+            public:
+
+                /// Constructor
+                RaycastBatchTask(const CollisionDetectionSystem& collisionDetection, const Ray* rays, uint32 nbRays,
+                                 RaycastInfo* raycastInfos, unsigned short raycastWithCategoryMaskBits)
+                    : mCollisionDetection(collisionDetection), mRays(rays), mNbRays(nbRays), mRaycastInfos(raycastInfos),
+                      mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits) {
+
+                }
+
+                /// Cast the packets of rays in the range [startIndex, endIndex)
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+        };
+
         // -------------------- Attributes -------------------- //
 
         /// Memory manager
@@ -182,7 +277,7 @@ class CollisionDetectionSystem {
         // -------------------- Methods -------------------- //
 
         /// Compute the broad-phase collision detection
-        void computeBroadPhase();
+        void computeBroadPhase(bool isWorldQuery);
 
         /// Compute the middle-phase collision detection
         void computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts, bool isWorldQuery);
@@ -201,7 +296,8 @@ class CollisionDetectionSystem {
         bool computeNarrowPhaseCollisionSnapshot(NarrowPhaseInput& narrowPhaseInput, CollisionCallback& callback);
 
         /// Process the potential contacts after narrow-phase collision detection
-        void computeOverlapSnapshotContactPairs(NarrowPhaseInput& narrowPhaseInput, Array<ContactPair>& contactPairs) const;
+        void computeOverlapSnapshotContactPairs(NarrowPhaseInput& narrowPhaseInput, Array<ContactPair>& contactPairs,
+                                                MemoryAllocator& allocator) const;
 
         /// Convert the potential contact into actual contacts
         void computeOverlapSnapshotContactPairs(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, Array<ContactPair>& contactPairs,
@@ -231,9 +327,17 @@ class CollisionDetectionSystem {
         /// Execute the narrow-phase collision detection algorithm on batches
         bool testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput, bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator);
 
+        /// Execute the narrow-phase collision detection algorithm on a range of the tests of the batches
+        bool testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput, uint32 startIndex, uint32 endIndex,
+                                      bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator);
+
+        /// Execute the narrow-phase collision detection algorithm on batches with the threads of a task scheduler
+        bool testNarrowPhaseCollisionParallel(NarrowPhaseInput& narrowPhaseInput, bool clipWithPreviousAxisIfStillColliding,
+                                              TaskScheduler& taskScheduler);
+
         /// Compute the concave vs convex middle-phase algorithm for a given pair of bodies
         void computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator,
-                                               NarrowPhaseInput& narrowPhaseInput, bool reportContacts);
+                                               NarrowPhaseInput& narrowPhaseInput, bool reportContacts, bool useTrianglesCache = true);
 
         /// Swap the previous and current contacts arrays
         void swapPreviousAndCurrentContacts();
@@ -294,6 +398,9 @@ class CollisionDetectionSystem {
         /// Process the potential contacts where one collion is a concave shape
         void processSmoothMeshContacts(OverlappingPair* pair);
 
+        /// Return true if the two colliders of a pair are both world query colliders
+        bool isWorldQueryPair(Entity collider1Entity, Entity collider2Entity) const;
+
         /// Filter the overlapping pairs to keep only the pairs where a given body is involved
         void filterOverlappingPairs(Entity bodyEntity, Array<uint64>& convexPairs, Array<uint64>& concavePairs) const;
 
@@ -361,6 +468,17 @@ class CollisionDetectionSystem {
         void raycast(RaycastCallback* raycastCallback, const Ray& ray,
                      unsigned short raycastWithCategoryMaskBits) const;
 
+        /// Ray casting method that only computes the closest hit
+        bool raycast(const Ray& ray, RaycastInfo& raycastInfo, unsigned short raycastWithCategoryMaskBits) const;
+
+        /// Ray casting method for a batch of rays that only computes the closest hit of each ray
+        uint32 raycastBatch(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, unsigned short raycastWithCategoryMaskBits,
+                            TaskScheduler* taskScheduler) const;
+
+        /// Cast the packets of rays of a range of a batch
+        void raycastPackets(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, uint32 startPacket, uint32 endPacket,
+                            unsigned short raycastWithCategoryMaskBits) const;
+
         /// Return true if two bodies (collide) overlap
         bool testOverlap(Body* body1, Body* body2);
 
@@ -370,6 +488,12 @@ class CollisionDetectionSystem {
         /// Report all the bodies that overlap (collide) in the world
         void testOverlap(OverlapCallback& overlapCallback);
 
+        /// Report the bodies that overlap with a body without modifying the collision detection state
+        bool testOverlapQuery(Body* body1, Body* body2, OverlapCallback* callback);
+
+        /// Report all the colliders with a world-space AABB overlapping with a given AABB
+        void testOverlapAABB(const AABB& worldAABB, AABBQueryCallback& callback, unsigned short collideWithMaskBits) const;
+
         /// Test collision and report contacts between two bodies.
         void testCollision(Body* body1, Body* body2, CollisionCallback& callback);
 
@@ -457,9 +581,10 @@ RP3D_FORCE_INLINE void CollisionDetectionSystem::updateCollider(Entity colliderE
     mBroadPhaseSystem.updateCollider(colliderEntity);
 }
 
-// Update all the enabled colliders
-RP3D_FORCE_INLINE void CollisionDetectionSystem::updateColliders() {
-    mBroadPhaseSystem.updateColliders();
+// Return true if the two colliders of a pair are both world query colliders
+RP3D_FORCE_INLINE bool CollisionDetectionSystem::isWorldQueryPair(Entity collider1Entity, Entity collider2Entity) const {
+    return mCollidersComponents.getIsWorldQueryCollider(collider1Entity) &&
+           mCollidersComponents.getIsWorldQueryCollider(collider2Entity);
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
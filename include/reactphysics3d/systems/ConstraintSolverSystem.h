@@ -33,6 +33,8 @@
 #include <reactphysics3d/systems/SolveFixedJointSystem.h>
 #include <reactphysics3d/systems/SolveHingeJointSystem.h>
 #include <reactphysics3d/systems/SolveSliderJointSystem.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
 
 namespace reactphysics3d {
 
@@ -44,6 +46,7 @@ class Profiler;
 class RigidBodyComponents;
 class JointComponents;
 class DynamicsComponents;
+class MemoryManager;
 
 // Structure ConstraintSolverData
 /**
@@ -147,6 +150,14 @@ class ConstraintSolverSystem {
 
     private :
 
+        // -------------------- Constants -------------------- //
+
+        /// Number of joint types (ball-and-socket, fixed, hinge and slider joints)
+        static const uint32 NB_JOINT_TYPES = 4;
+
+        /// Island index of a body that is not in any island
+        static constexpr uint32 NO_ISLAND = 0xFFFFFFFF;
+
         // -------------------- Attributes -------------------- //
 
         /// Current time step
@@ -173,6 +184,33 @@ class ConstraintSolverSystem {
         /// Solver for the SliderJoint constraints
         SolveSliderJointSystem mSolveSliderJointSystem;
 
+        /// Island index of each rigid body component (used by the island-parallel solver)
+        Array<uint32> mBodiesIslandIndices;
+
+        /// Indices (in the components of their joint type) of the joints of each island
+        /// sorted by island and by joint type (used by the island-parallel solver)
+        Array<uint32> mIslandsJoints;
+
+        /// Start index in mIslandsJoints of the joints of each island and joint type
+        Array<uint32> mIslandsJointsStartIndices;
+
+        /// Island index of each enabled joint (sorted by joint type)
+        Array<uint32> mJointsIslandIndices;
+
+        /// Colors of the joints of an island (for the graph-colored solver)
+        ConstraintGraphColoring mColoring;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the island index of a joint (or the number of islands if the joint is not in any island)
+        uint32 computeJointIslandIndex(Entity jointEntity) const;
+
+        /// Return the entity of a joint given its joint type and its index in the components of this type
+        Entity getJointEntity(uint32 jointType, uint32 index) const;
+
+        /// Return the joint type of the joint at a given position in the array of joints of the islands
+        uint32 getIslandJointType(uint32 islandIndex, uint32 islandJointIndex) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -184,7 +222,7 @@ class ConstraintSolverSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+        ConstraintSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                TransformComponents& transformComponents,
                                JointComponents& jointComponents,
                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -197,9 +235,39 @@ class ConstraintSolverSystem {
         /// Initialize the constraint solver
         void initialize(decimal dt);
 
+        /// Set the time step and the warm starting parameter of the joints solvers
+        void setSolverParameters(decimal dt);
+
         /// Solve the constraints
         void solveVelocityConstraints();
 
+        /// Compute the joints of each island for the island-parallel solver
+        void computeIslandsJoints();
+
+        /// Initialize and warm start the joints of an island (island-parallel solver)
+        void initializeIsland(uint32 islandIndex);
+
+        /// Solve the velocity constraints of the joints of an island (island-parallel solver)
+        void solveVelocityConstraintsIsland(uint32 islandIndex);
+
+        /// Return the number of joints of an island (island-parallel solver)
+        uint32 getNbIslandJoints(uint32 islandIndex) const;
+
+        /// Compute the colors of the joints of an island for the graph-colored solver
+        void computeIslandColors(uint32 islandIndex);
+
+        /// Return the colors computed by the last call to computeIslandColors()
+        const ConstraintGraphColoring& getColoring() const;
+
+        /// Initialize a range of the joints of an island (graph-colored solver)
+        void initBeforeSolveIslandJoints(uint32 islandIndex, uint32 startIndex, uint32 endIndex);
+
+        /// Warm start some joints of an island (of the same color)
+        void warmstartIslandJoints(uint32 islandIndex, const uint32* islandJointIndices, uint32 nbJoints);
+
+        /// Solve the velocity constraints of some joints of an island (of the same color)
+        void solveVelocityConstraintsIslandJoints(uint32 islandIndex, const uint32* islandJointIndices, uint32 nbJoints);
+
         /// Solve the position constraints
         void solvePositionConstraints();
 
@@ -215,6 +283,18 @@ class ConstraintSolverSystem {
         friend class HingeJoint;
 };
 
+// Return the number of joints of an island (island-parallel solver)
+RP3D_FORCE_INLINE uint32 ConstraintSolverSystem::getNbIslandJoints(uint32 islandIndex) const {
+    const uint32 key = islandIndex * NB_JOINT_TYPES;
+    assert(key + NB_JOINT_TYPES < mIslandsJointsStartIndices.size());
+    return mIslandsJointsStartIndices[key + NB_JOINT_TYPES] - mIslandsJointsStartIndices[key];
+}
+
+// Return the colors computed by the last call to computeIslandColors()
+RP3D_FORCE_INLINE const ConstraintGraphColoring& ConstraintSolverSystem::getColoring() const {
+    return mColoring;
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
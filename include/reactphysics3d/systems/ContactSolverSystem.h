@@ -30,8 +30,10 @@
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/mathematics/Vector3.h>
 #include <reactphysics3d/mathematics/Matrix3x3.h>
+#include <reactphysics3d/mathematics/DecimalW.h>
 #include <reactphysics3d/containers/Array.h>
 #include <reactphysics3d/engine/Material.h>
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -125,6 +127,9 @@ class ContactSolverSystem {
 
     private:
 
+        /// Maximum number of contact points in a contact manifold solved by the wide solver
+        static constexpr uint32 MAX_WIDE_CONTACT_POINTS = 4;
+
         // Structure ContactPointSolver
         /**
          * Contact solver internal data structure that to store all the
@@ -275,6 +280,144 @@ class ContactSolverSystem {
             int8 nbContacts;
         };
 
+        // Structure WideContactPointSolver
+        /**
+         * Contact solver internal data structure that stores the k-th contact point
+         * of the contact manifolds of a WideContactManifoldSolver (one manifold per lane).
+         * The lanes of the manifolds that have less than k+1 contact points are zero and
+         * do not apply any impulse.
+         */
+        struct WideContactPointSolver {
+
+            /// Normal vector of the contact
+            Vector3Lanes normal;
+
+            /// Vector from the body 1 center to the contact point
+            Vector3Lanes r1;
+
+            /// Vector from the body 2 center to the contact point
+            Vector3Lanes r2;
+
+            /// Bias of the penetration depth position correction
+            decimal biasPenetrationDepth[RP3D_SIMD_WIDTH];
+
+            /// Velocity restitution bias
+            decimal restitutionBias[RP3D_SIMD_WIDTH];
+
+            /// Inverse of the matrix K for the penenetration
+            decimal inversePenetrationMass[RP3D_SIMD_WIDTH];
+
+            /// Cross product of r1 with the contact normal multiplied by the inverse inertia of body 1
+            Vector3Lanes i1TimesR1CrossN;
+
+            /// Cross product of r2 with the contact normal multiplied by the inverse inertia of body 2
+            Vector3Lanes i2TimesR2CrossN;
+
+            /// Accumulated normal impulse
+            decimal penetrationImpulse[RP3D_SIMD_WIDTH];
+
+            /// Accumulated split impulse for penetration correction
+            decimal penetrationSplitImpulse[RP3D_SIMD_WIDTH];
+        };
+
+        // Structure WideContactManifoldSolver
+        /**
+         * Contact solver internal data structure that stores RP3D_SIMD_WIDTH contact manifold
+         * constraints of the same color in structure-of-arrays layout (the width is fixed when
+         * the library is configured). Those manifolds do not
+         * share any non-static body and are solved together with SIMD instructions by the
+         * graph-colored solver. The unused lanes are zero and do not apply any impulse.
+         */
+        struct WideContactManifoldSolver {
+
+            /// Number of used lanes
+            uint32 nbManifolds;
+
+            /// Index of the contact manifold constraint of each lane
+            uint32 manifoldIndices[RP3D_SIMD_WIDTH];
+
+            /// Index of body 1 in the dynamics components arrays
+            uint32 rigidBodyComponentIndexBody1[RP3D_SIMD_WIDTH];
+
+            /// Index of body 2 in the dynamics components arrays
+            uint32 rigidBodyComponentIndexBody2[RP3D_SIMD_WIDTH];
+
+            /// Inverse of the mass of body 1
+            decimal massInverseBody1[RP3D_SIMD_WIDTH];
+
+            /// Inverse of the mass of body 2
+            decimal massInverseBody2[RP3D_SIMD_WIDTH];
+
+            /// Linear lock axis factor of body 1
+            Vector3Lanes linearLockAxisFactorBody1;
+
+            /// Linear lock axis factor of body 2
+            Vector3Lanes linearLockAxisFactorBody2;
+
+            /// Angular lock axis factor of body 1
+            Vector3Lanes angularLockAxisFactorBody1;
+
+            /// Angular lock axis factor of body 2
+            Vector3Lanes angularLockAxisFactorBody2;
+
+            /// Inverse inertia tensor of body 1 (rows)
+            Vector3Lanes inverseInertiaTensorBody1[3];
+
+            /// Inverse inertia tensor of body 2 (rows)
+            Vector3Lanes inverseInertiaTensorBody2[3];
+
+            /// Mix friction coefficient for the two bodies
+            decimal frictionCoefficient[RP3D_SIMD_WIDTH];
+
+            /// Average normal vector of the contact manifold
+            Vector3Lanes normal;
+
+            /// R1 vector for the friction constraints
+            Vector3Lanes r1Friction;
+
+            /// R2 vector for the friction constraints
+            Vector3Lanes r2Friction;
+
+            /// Cross product of r1 with 1st friction vector
+            Vector3Lanes r1CrossT1;
+
+            /// Cross product of r1 with 2nd friction vector
+            Vector3Lanes r1CrossT2;
+
+            /// Cross product of r2 with 1st friction vector
+            Vector3Lanes r2CrossT1;
+
+            /// Cross product of r2 with 2nd friction vector
+            Vector3Lanes r2CrossT2;
+
+            /// Matrix K for the first friction constraint
+            decimal inverseFriction1Mass[RP3D_SIMD_WIDTH];
+
+            /// Matrix K for the second friction constraint
+            decimal inverseFriction2Mass[RP3D_SIMD_WIDTH];
+
+            /// Matrix K for the twist friction constraint
+            decimal inverseTwistFrictionMass[RP3D_SIMD_WIDTH];
+
+            /// First friction vector in the tangent plane
+            Vector3Lanes frictionVector1;
+
+            /// Second friction vector in the tangent plane
+            Vector3Lanes frictionVector2;
+
+            /// First friction direction impulse at manifold center
+            decimal friction1Impulse[RP3D_SIMD_WIDTH];
+
+            /// Second friction direction impulse at manifold center
+            decimal friction2Impulse[RP3D_SIMD_WIDTH];
+
+            /// Twist friction impulse at contact manifold center
+            decimal frictionTwistImpulse[RP3D_SIMD_WIDTH];
+
+            /// Contact points (one per contact point slot of the manifolds)
+            WideContactPointSolver contactPoints[MAX_WIDE_CONTACT_POINTS];
+        };
+
         // -------------------- Constants --------------------- //
 
         /// Beta value for the penetration depth position correction without split impulses
@@ -312,6 +455,21 @@ class ContactSolverSystem {
         /// Number of contact constraints
         uint32 mNbContactManifolds;
 
+        /// Index of the first contact point constraint of each contact manifold constraint
+        uint32* mContactPointsStartIndices;
+
+        /// Colors of the contact manifolds of an island (for the graph-colored solver)
+        ConstraintGraphColoring mColoring;
+
+        /// Contact manifold constraints of the colors of an island packed for the wide solver
+        WideContactManifoldSolver* mWideContactManifolds;
+
+        /// Number of wide contact manifold constraints
+        uint32 mNbWideContactManifolds;
+
+        /// Index of the first wide contact manifold constraint of each color (and total number at the end)
+        uint32* mColorsWideStartIndices;
+
         /// Reference to the islands
         Islands& mIslands;
 
@@ -357,6 +515,18 @@ class ContactSolverSystem {
         /// Warm start the solver.
         void warmStart();
 
+        /// Warm start a range of contact manifold constraints
+        void warmStart(uint32 manifoldStartIndex, uint32 nbManifolds, uint32 contactPointStartIndex);
+
+        /// Solve a range of contact manifold constraints
+        void solve(uint32 manifoldStartIndex, uint32 nbManifolds, uint32 contactPointStartIndex);
+
+        /// Store the computed impulses of a range of contact manifold constraints
+        void storeImpulses(uint32 manifoldStartIndex, uint32 nbManifolds, uint32 contactPointStartIndex);
+
+        /// Pack a contact manifold constraint into a lane of a wide contact manifold constraint
+        void packWideContactManifold(WideContactManifoldSolver& wideManifold, uint32 lane, uint32 manifoldIndex);
+
    public:
 
         // -------------------- Methods -------------------- //
@@ -371,9 +541,51 @@ class ContactSolverSystem {
         /// Initialize the contact constraints
         void init(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep);
 
+        /// Allocate the memory for the contact constraints of all the islands
+        void allocate(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep);
+
         /// Initialize the constraint solver for a given island
         void initializeForIsland(uint32 islandIndex);
 
+        /// Initialize a range of contact manifold constraints
+        void initializeContactManifolds(uint32 manifoldStartIndex, uint32 nbManifolds);
+
+        /// Warm start the contact constraints of a given island
+        void warmStartIsland(uint32 islandIndex);
+
+        /// Solve the contacts of a given island
+        void solveIsland(uint32 islandIndex);
+
+        /// Store the computed impulses of the contacts of a given island
+        void storeImpulsesIsland(uint32 islandIndex);
+
+        /// Compute the colors of the contact manifolds of an island for the graph-colored solver
+        void computeIslandColors(uint32 islandIndex);
+
+        /// Return the colors computed by the last call to computeIslandColors()
+        const ConstraintGraphColoring& getColoring() const;
+
+        /// Warm start some contact manifold constraints (of the same color)
+        void warmStartManifolds(const uint32* manifoldIndices, uint32 nbManifolds);
+
+        /// Solve some contact manifold constraints (of the same color)
+        void solveManifolds(const uint32* manifoldIndices, uint32 nbManifolds);
+
+        /// Store the computed impulses of a range of contact manifold constraints
+        void storeImpulsesManifolds(uint32 manifoldStartIndex, uint32 nbManifolds);
+
+        /// Pack the contact manifolds of each color computed by computeIslandColors() for the wide solver
+        void packWideContactManifolds();
+
+        /// Return the number of wide contact manifold constraints of a color
+        uint32 getNbWideContactManifoldsInColor(uint32 color) const;
+
+        /// Solve a range of the wide contact manifold constraints of a color
+        void solveWideContactManifolds(uint32 color, uint32 startIndex, uint32 nbWideManifolds);
+
+        /// Copy the impulses of the wide contact manifold constraints back to the contact manifold constraints
+        void unpackWideContactManifolds();
+
         /// Store the computed impulses to use them to
         /// warm start the solver at the next iteration
         void storeImpulses();
@@ -398,6 +610,17 @@ class ContactSolverSystem {
 #endif
 };
 
+// Return the colors computed by the last call to computeIslandColors()
+RP3D_FORCE_INLINE const ConstraintGraphColoring& ContactSolverSystem::getColoring() const {
+    return mColoring;
+}
+
+// Return the number of wide contact manifold constraints of a color
+RP3D_FORCE_INLINE uint32 ContactSolverSystem::getNbWideContactManifoldsInColor(uint32 color) const {
+    assert(mColorsWideStartIndices != nullptr);
+    return mColorsWideStartIndices[color + 1] - mColorsWideStartIndices[color];
+}
+
 // Return true if the split impulses position correction technique is used for contacts
 RP3D_FORCE_INLINE bool ContactSolverSystem::isSplitImpulseActive() const {
     return mIsSplitImpulseActive;
@@ -32,6 +32,7 @@
 #include <reactphysics3d/components/RigidBodyComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/components/ColliderComponents.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
 
 namespace reactphysics3d {
 
@@ -46,6 +47,55 @@ class DynamicsSystem {
 
     private :
 
+        // -------------------- Constants -------------------- //
+
+        /// Minimum number of components updated by a thread of the task scheduler
+        static const uint32 MIN_BATCH_SIZE = 256;
+
+        // -------------------- Classes -------------------- //
+
+        // Class UpdateBodiesTask
+        /**
+         * Parallel task that executes one of the per-body stages of the dynamics on a range of
+         * components. Each item only reads and writes the data of its own body (or collider).
+         * Therefore, the result is the same as with a serial loop.
+         */
+        class UpdateBodiesTask : public TaskScheduler::ParallelTask {
+
+            public:
+
+                /// Stage to execute
+                enum class Stage {UpdateInertiaTensors, IntegrateVelocities, IntegratePositions,
+                                  UpdateBodiesState, UpdateCollidersTransforms};
+
+            private:
+
+                /// Reference to the dynamics system
+                DynamicsSystem& mDynamicsSystem;
+
+                /// Stage to execute
+                Stage mStage;
+
+                /// Time step
+                decimal mTimeStep;
+
+                /// True if the split impulse velocities are used to integrate the positions
+                bool mIsSplitImpulseActive;
+
+            public:
+
+                /// Constructor
+                UpdateBodiesTask(DynamicsSystem& dynamicsSystem, Stage stage, decimal timeStep = decimal(0.0),
+                                 bool isSplitImpulseActive = false)
+                    : mDynamicsSystem(dynamicsSystem), mStage(stage), mTimeStep(timeStep),
+                      mIsSplitImpulseActive(isSplitImpulseActive) {
+
+                }
+
+                /// Execute the stage on the components in the range [startIndex, endIndex)
+                virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override;
+        };
+
         // -------------------- Attributes -------------------- //
 
         /// Physics world
@@ -75,6 +125,26 @@ class DynamicsSystem {
         Profiler* mProfiler;
 #endif
 
+        // -------------------- Methods -------------------- //
+
+        /// Execute a stage on all the enabled components (on the threads of the task scheduler of the world if any)
+        void runStage(UpdateBodiesTask& task, uint32 nbComponents);
+
+        /// Update the inverse world inertia tensors of a range of rigid bodies
+        void updateBodiesInverseWorldInertiaTensors(uint32 startIndex, uint32 endIndex);
+
+        /// Integrate the velocities of a range of rigid bodies
+        void integrateRigidBodiesVelocities(decimal timeStep, uint32 startIndex, uint32 endIndex);
+
+        /// Integrate the positions and orientations of a range of rigid bodies
+        void integrateRigidBodiesPositions(decimal timeStep, bool isSplitImpulseActive, uint32 startIndex, uint32 endIndex);
+
+        /// Update the postion/orientation of a range of rigid bodies
+        void updateBodiesState(uint32 startIndex, uint32 endIndex);
+
+        /// Update the local-to-world transform of a range of colliders
+        void updateCollidersTransforms(uint32 startIndex, uint32 endIndex);
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -94,6 +164,9 @@ class DynamicsSystem {
 
 #endif
 
+        /// Update the inverse world inertia tensors of the rigid bodies
+        void updateBodiesInverseWorldInertiaTensors();
+
         /// Integrate the positions and orientations of rigid bodies.
         void integrateRigidBodiesPositions(decimal timeStep, bool isSplitImpulseActive);
 
@@ -106,9 +179,6 @@ class DynamicsSystem {
         /// Reset the external force and torque applied to the bodies
         void resetBodiesForceAndTorque();
 
-        /// Reset the split velocities of the bodies
-        void resetSplitVelocities();
-
 };
 
 #ifdef IS_RP3D_PROFILING_ENABLED
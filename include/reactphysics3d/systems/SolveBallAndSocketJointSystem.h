@@ -102,6 +102,21 @@ class SolveBallAndSocketJointSystem {
         /// Solve the velocity constraint
         void solveVelocityConstraint();
 
+        /// Initialize a joint before solving the constraint
+        void initBeforeSolve(uint32 i);
+
+        /// Warm start the constraint of a joint (apply the previous impulse at the beginning of the step)
+        void warmstart(uint32 i);
+
+        /// Solve the velocity constraint of a joint
+        void solveVelocityConstraint(uint32 i);
+
+        /// Return the number of enabled joints
+        uint32 getNbEnabledJoints() const;
+
+        /// Return the entity of a joint
+        Entity getJointEntity(uint32 i) const;
+
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
@@ -123,6 +138,17 @@ class SolveBallAndSocketJointSystem {
 
 };
 
+// Return the number of enabled joints
+RP3D_FORCE_INLINE uint32 SolveBallAndSocketJointSystem::getNbEnabledJoints() const {
+    return mBallAndSocketJointComponents.getNbEnabledComponents();
+}
+
+// Return the entity of a joint
+RP3D_FORCE_INLINE Entity SolveBallAndSocketJointSystem::getJointEntity(uint32 i) const {
+    assert(i < mBallAndSocketJointComponents.getNbComponents());
+    return mBallAndSocketJointComponents.mJointEntities[i];
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
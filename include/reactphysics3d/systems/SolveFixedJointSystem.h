@@ -99,6 +99,21 @@ class SolveFixedJointSystem {
         /// Solve the velocity constraint
         void solveVelocityConstraint();
 
+        /// Initialize a joint before solving the constraint
+        void initBeforeSolve(uint32 i);
+
+        /// Warm start the constraint of a joint (apply the previous impulse at the beginning of the step)
+        void warmstart(uint32 i);
+
+        /// Solve the velocity constraint of a joint
+        void solveVelocityConstraint(uint32 i);
+
+        /// Return the number of enabled joints
+        uint32 getNbEnabledJoints() const;
+
+        /// Return the entity of a joint
+        Entity getJointEntity(uint32 i) const;
+
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
@@ -117,6 +132,17 @@ class SolveFixedJointSystem {
 
 };
 
+// Return the number of enabled joints
+RP3D_FORCE_INLINE uint32 SolveFixedJointSystem::getNbEnabledJoints() const {
+    return mFixedJointComponents.getNbEnabledComponents();
+}
+
+// Return the entity of a joint
+RP3D_FORCE_INLINE Entity SolveFixedJointSystem::getJointEntity(uint32 i) const {
+    assert(i < mFixedJointComponents.getNbComponents());
+    return mFixedJointComponents.mJointEntities[i];
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
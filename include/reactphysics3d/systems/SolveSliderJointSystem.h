@@ -103,6 +103,21 @@ class SolveSliderJointSystem {
         /// Solve the velocity constraint
         void solveVelocityConstraint();
 
+        /// Initialize a joint before solving the constraint
+        void initBeforeSolve(uint32 i);
+
+        /// Warm start the constraint of a joint (apply the previous impulse at the beginning of the step)
+        void warmstart(uint32 i);
+
+        /// Solve the velocity constraint of a joint
+        void solveVelocityConstraint(uint32 i);
+
+        /// Return the number of enabled joints
+        uint32 getNbEnabledJoints() const;
+
+        /// Return the entity of a joint
+        Entity getJointEntity(uint32 i) const;
+
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
@@ -121,6 +136,17 @@ class SolveSliderJointSystem {
 
 };
 
+// Return the number of enabled joints
+RP3D_FORCE_INLINE uint32 SolveSliderJointSystem::getNbEnabledJoints() const {
+    return mSliderJointComponents.getNbEnabledComponents();
+}
+
+// Return the entity of a joint
+RP3D_FORCE_INLINE Entity SolveSliderJointSystem::getJointEntity(uint32 i) const {
+    assert(i < mSliderJointComponents.getNbComponents());
+    return mSliderJointComponents.mJointEntities[i];
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -33,6 +33,7 @@
 #include <reactphysics3d/configuration.h>
 #include <fstream>
 #include <chrono>
+#include <thread>
 #include <reactphysics3d/containers/Array.h>
 
 /// ReactPhysics3D namespace
@@ -288,6 +289,10 @@ class Profiler {
         /// Frame counter
         uint mFrameCounter;
 
+        /// Id of the thread that is profiled (the profiler tree is not thread-safe and
+        /// samples from other threads, like the worker threads of a task scheduler, are ignored)
+        std::thread::id mProfiledThreadId;
+
         /// Starting profiling time
         std::chrono::time_point<clock> mProfilingStartTime;
 
@@ -340,6 +345,9 @@ class Profiler {
         /// Increment the frame counter
         void incrementFrameCounter();
 
+        /// Return true if the calling thread is the thread that is profiled
+        bool isProfiledThread() const;
+
         /// Return an iterator over the profiler tree starting at the root
         ProfileNodeIterator* getIterator();
 
@@ -383,6 +391,12 @@ class ProfileSample {
 
 			assert(profiler != nullptr);
 
+            // Samples from a thread that is not profiled are ignored
+            if (!mProfiler->isProfiledThread()) {
+                mProfiler = nullptr;
+                return;
+            }
+
             // Ask the profiler to start profiling a block of code
 			mProfiler->startProfilingBlock(name);
         }
@@ -391,7 +405,9 @@ class ProfileSample {
         ~ProfileSample() {
 
             // Tell the profiler to stop profiling a block of code
-			mProfiler->stopProfilingBlock();
+            if (mProfiler != nullptr) {
+                mProfiler->stopProfilingBlock();
+            }
         }
 };
 
@@ -492,6 +508,14 @@ RP3D_FORCE_INLINE std::chrono::duration<double, std::milli> Profiler::getElapsed
 // Increment the frame counter
 RP3D_FORCE_INLINE void Profiler::incrementFrameCounter() {
     mFrameCounter++;
+
+    // The thread that steps the simulation is the one that is profiled
+    mProfiledThreadId = std::this_thread::get_id();
+}
+
+// Return true if the calling thread is the thread that is profiled
+RP3D_FORCE_INLINE bool Profiler::isProfiledThread() const {
+    return std::this_thread::get_id() == mProfiledThreadId;
 }
 
 // Return an iterator over the profiler tree starting at the root
@@ -66,10 +66,32 @@ BodyType RigidBody::getType() const {
  */
 void RigidBody::setType(BodyType type) {
 
-    if (mWorld.mRigidBodyComponents.getBodyType(mEntity) == type) return;
+    const BodyType previousType = mWorld.mRigidBodyComponents.getBodyType(mEntity);
+    if (previousType == type) return;
 
     mWorld.mRigidBodyComponents.setBodyType(mEntity, type);
 
+    // The colliders of the static bodies are in a separate tree of the broad-phase. Therefore,
+    // the colliders need to be moved to the other tree if the body becomes static or is not static anymore
+    if (previousType == BodyType::STATIC || type == BodyType::STATIC) {
+
+        const Transform& transform = mWorld.mTransformComponents.getTransform(mEntity);
+
+        const Array<Entity>& colliderEntities = mWorld.mBodyComponents.getColliders(mEntity);
+        for (uint32 i=0; i < colliderEntities.size(); i++) {
+
+            Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+
+            if (collider->getBroadPhaseId() != -1) {
+
+                const AABB aabb = collider->getCollisionShape()->computeTransformedAABB(transform * mWorld.mCollidersComponents.getLocalToBodyTransform(collider->getEntity()));
+
+                mWorld.mCollisionDetection.removeCollider(collider);
+                mWorld.mCollisionDetection.addCollider(collider, aabb);
+            }
+        }
+    }
+
     // If it is a static body
     if (type == BodyType::STATIC) {
 
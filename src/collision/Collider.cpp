@@ -172,6 +172,18 @@ const Transform& Collider::getLocalToBodyTransform() const {
  * @return True if the ray hits the collision shape
  */
 bool Collider::raycast(const Ray& ray, RaycastInfo& raycastInfo) {
+    return raycast(ray, raycastInfo, mMemoryManager.getPoolAllocator());
+}
+
+// Raycast method with feedback information
+/**
+ * @param ray Ray to use for the raycasting in world-space
+ * @param[out] raycastInfo Result of the raycasting that is valid only if the
+ *             methods returned true
+ * @param allocator Allocator used for the temporary memory of the raycast
+ * @return True if the ray hits the collision shape
+ */
+bool Collider::raycast(const Ray& ray, RaycastInfo& raycastInfo, MemoryAllocator& allocator) {
 
     // If the corresponding body is not active, it cannot be hit by rays
     if (!mBody->isActive()) return false;
@@ -182,7 +194,7 @@ bool Collider::raycast(const Ray& ray, RaycastInfo& raycastInfo) {
     Ray rayLocal(worldToLocalTransform * ray.point1, worldToLocalTransform * ray.point2, ray.maxFraction);
 
     const CollisionShape* collisionShape = mBody->mWorld.mCollidersComponents.getCollisionShape(mEntity);
-    bool isHit = collisionShape->raycast(rayLocal, raycastInfo, this, mMemoryManager.getPoolAllocator());
+    bool isHit = collisionShape->raycast(rayLocal, raycastInfo, this, allocator);
 
     // Convert the raycast info into world-space
     raycastInfo.worldPoint = localToWorldTransform * raycastInfo.worldPoint;
@@ -25,6 +25,7 @@
 
 // Libraries
 #include <reactphysics3d/collision/ConvexMesh.h>
+#include <reactphysics3d/mathematics/DecimalW.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/collision/PolygonVertexArray.h>
 #include <reactphysics3d/utils/DefaultLogger.h>
@@ -43,7 +44,8 @@ using namespace reactphysics3d;
  */
 ConvexMesh::ConvexMesh(MemoryAllocator& allocator)
                : mMemoryAllocator(allocator), mHalfEdgeStructure(allocator, 6, 8, 24),
-                 mVertices(allocator), mFacesNormals(allocator), mVolume(0) {
+                 mVertices(allocator), mVerticesX(allocator), mVerticesY(allocator), mVerticesZ(allocator),
+                 mVerticesNeighborsStartIndex(allocator), mVerticesNeighbors(allocator), mFacesNormals(allocator), mVolume(0) {
 
 }
 
@@ -64,6 +66,9 @@ bool ConvexMesh::init(const PolygonVertexArray& polygonVertexArray, std::vector<
     // Create the half-edge structure of the mesh
     isValid &= createHalfEdgeStructure(polygonVertexArray, errors);
 
+    // Compute the data used to compute the support vertices of the mesh
+    computeSupportVerticesData();
+
     // Compute the faces normals
     isValid &= computeFacesNormals(errors);
 
@@ -262,3 +267,122 @@ void ConvexMesh::computeVolume() {
 
     mVolume = std::abs(sum) / decimal(3.0);
 }
+
+// Compute the vertices neighbors and the structure-of-arrays vertices used to compute support vertices
+void ConvexMesh::computeSupportVerticesData() {
+
+    const uint32 nbVertices = getNbVertices();
+    if (nbVertices == 0) return;
+
+    // Copy the vertices in structure-of-arrays layout (padded with the first vertex so
+    // that the padding lanes cannot change the support vertex)
+    const uint32 nbPaddedVertices = ((nbVertices + DecimalW::NB_LANES - 1) / DecimalW::NB_LANES) * DecimalW::NB_LANES;
+    mVerticesX.reserve(nbPaddedVertices);
+    mVerticesY.reserve(nbPaddedVertices);
+    mVerticesZ.reserve(nbPaddedVertices);
+    for (uint32 i=0; i < nbPaddedVertices; i++) {
+        const Vector3& vertex = mVertices[i < nbVertices ? i : 0];
+        mVerticesX.add(vertex.x);
+        mVerticesY.add(vertex.y);
+        mVerticesZ.add(vertex.z);
+    }
+
+    // Each half-edge connects the vertex at its beginning with the vertex at the beginning of its twin
+    const uint32 nbHalfEdges = mHalfEdgeStructure.getNbHalfEdges();
+    mVerticesNeighborsStartIndex.reserve(nbVertices + 1);
+    for (uint32 v=0; v <= nbVertices; v++) {
+        mVerticesNeighborsStartIndex.add(0);
+    }
+    for (uint32 e=0; e < nbHalfEdges; e++) {
+        const uint32 vertexIndex = mHalfEdgeStructure.getHalfEdge(e).vertexIndex;
+        assert(vertexIndex < nbVertices);
+        mVerticesNeighborsStartIndex[vertexIndex + 1]++;
+    }
+    for (uint32 v=0; v < nbVertices; v++) {
+        mVerticesNeighborsStartIndex[v + 1] += mVerticesNeighborsStartIndex[v];
+    }
+
+    // Copy the start indices to fill the neighbors of each vertex
+    Array<uint32> nextNeighborIndex(mVerticesNeighborsStartIndex);
+    mVerticesNeighbors.addWithoutInit(nbHalfEdges);
+    for (uint32 e=0; e < nbHalfEdges; e++) {
+        const HalfEdgeStructure::Edge& edge = mHalfEdgeStructure.getHalfEdge(e);
+        const uint32 neighborIndex = mHalfEdgeStructure.getHalfEdge(edge.twinEdgeIndex).vertexIndex;
+        mVerticesNeighbors[nextNeighborIndex[edge.vertexIndex]] = neighborIndex;
+        nextNeighborIndex[edge.vertexIndex]++;
+    }
+}
+
+// Return the index of the vertex with the largest dot product with a direction by testing all the vertices
+/// The dot products are computed with SIMD instructions (if available). If several vertices have
+/// the largest dot product, the one with the smallest index is returned.
+uint32 ConvexMesh::computeSupportVertexBruteForce(const Vector3& direction) const {
+
+    const DecimalW directionX(direction.x);
+    const DecimalW directionY(direction.y);
+    const DecimalW directionZ(direction.z);
+
+    // Compute the largest dot product of each lane
+    const uint32 nbPaddedVertices = static_cast<uint32>(mVerticesX.size());
+    DecimalW lanesMaxDotProducts(DECIMAL_SMALLEST);
+    for (uint32 i=0; i < nbPaddedVertices; i += DecimalW::NB_LANES) {
+        const DecimalW dotProducts = DecimalW::load(&(mVerticesX[i])) * directionX + DecimalW::load(&(mVerticesY[i])) * directionY +
+                                     DecimalW::load(&(mVerticesZ[i])) * directionZ;
+        lanesMaxDotProducts = max(lanesMaxDotProducts, dotProducts);
+    }
+
+    decimal maxDotProducts[DecimalW::NB_LANES];
+    lanesMaxDotProducts.store(maxDotProducts);
+    decimal maxDotProduct = maxDotProducts[0];
+    for (uint32 l=1; l < DecimalW::NB_LANES; l++) {
+        maxDotProduct = std::max(maxDotProduct, maxDotProducts[l]);
+    }
+
+    // Find the first vertex with the largest dot product
+    const DecimalW maxDotProductW(maxDotProduct);
+    for (uint32 i=0; i < nbPaddedVertices; i += DecimalW::NB_LANES) {
+        const DecimalW dotProducts = DecimalW::load(&(mVerticesX[i])) * directionX + DecimalW::load(&(mVerticesY[i])) * directionY +
+                                     DecimalW::load(&(mVerticesZ[i])) * directionZ;
+        const uint32 mask = lessOrEqualMask(maxDotProductW, dotProducts);
+        if (mask != 0) {
+            uint32 lane = 0;
+            while ((mask & (1u << lane)) == 0) lane++;
+            return i + lane;
+        }
+    }
+
+    // This can only happen with an invalid direction (NaN)
+    return 0;
+}
+
+// Return the index of the vertex with the largest dot product with a direction using hill-climbing
+/// Starting from a given vertex, we move to the neighbor vertex with the largest dot product as
+/// long as it increases the dot product. Because the mesh is convex, the local maximum is also the
+/// global one. When the start vertex is the support vertex of a close direction (previous GJK
+/// iteration or previous frame), only a few vertices are visited.
+uint32 ConvexMesh::computeSupportVertexHillClimbing(const Vector3& direction, uint32 startVertexIndex) const {
+
+    uint32 supportVertexIndex = startVertexIndex < getNbVertices() ? startVertexIndex : 0;
+    decimal maxDotProduct = direction.dot(mVertices[supportVertexIndex]);
+
+    uint32 currentVertexIndex;
+    do {
+
+        currentVertexIndex = supportVertexIndex;
+
+        // For each neighbor of the current vertex
+        const uint32 endIndex = mVerticesNeighborsStartIndex[currentVertexIndex + 1];
+        for (uint32 n = mVerticesNeighborsStartIndex[currentVertexIndex]; n < endIndex; n++) {
+
+            const uint32 neighborIndex = mVerticesNeighbors[n];
+            const decimal dotProduct = direction.dot(mVertices[neighborIndex]);
+            if (dotProduct > maxDotProduct) {
+                maxDotProduct = dotProduct;
+                supportVertexIndex = neighborIndex;
+            }
+        }
+
+    } while (supportVertexIndex != currentVertexIndex);
+
+    return supportVertexIndex;
+}
@@ -35,11 +35,27 @@ decimal RaycastTest::raycastAgainstShape(Collider* shape, const Ray& ray) {
 
     // Ray casting test against the collision shape
     RaycastInfo raycastInfo;
-    bool isHit = shape->raycast(ray, raycastInfo);
+    bool isHit = shape->raycast(ray, raycastInfo, allocator);
 
     // If the ray hit the collision shape
     if (isHit) {
 
+        // If only the closest hit is computed, keep the hit and clip the ray at the hit point
+        // (the ray given in parameter is already clipped at the closest hit found so far)
+        if (userCallback == nullptr) {
+
+            assert(closestHitInfo != nullptr);
+
+            closestHitInfo->worldPoint = raycastInfo.worldPoint;
+            closestHitInfo->worldNormal = raycastInfo.worldNormal;
+            closestHitInfo->hitFraction = raycastInfo.hitFraction;
+            closestHitInfo->triangleIndex = raycastInfo.triangleIndex;
+            closestHitInfo->body = raycastInfo.body;
+            closestHitInfo->collider = raycastInfo.collider;
+
+            return raycastInfo.hitFraction;
+        }
+
         // Report the hit to the user and return the
         // user hit fraction value
         return userCallback->notifyRaycastHit(raycastInfo);
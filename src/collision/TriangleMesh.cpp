@@ -34,12 +34,13 @@ using namespace reactphysics3d;
 // Constructor
 TriangleMesh::TriangleMesh(MemoryAllocator& allocator)
              : mAllocator(allocator), mVertices(allocator), mTriangles(allocator),
-               mVerticesNormals(allocator), mDynamicAABBTree(allocator), mEpsilon(0) {
+               mVerticesNormals(allocator), mAABBTree(allocator), mEpsilon(0) {
 
 }
 
 // Initialize the mesh using a TriangleVertexArray
-bool TriangleMesh::init(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages) {
+bool TriangleMesh::init(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages,
+                        bool isAABBTreeQuantized) {
 
     bool isValid = true;
 
@@ -60,8 +61,8 @@ bool TriangleMesh::init(const TriangleVertexArray& triangleVertexArray, std::vec
         computeVerticesNormals();
     }
 
-    // Insert all the triangles into the dynamic AABB tree
-    initBVHTree();
+    // Build the AABB tree with all the triangles
+    initBVHTree(isAABBTreeQuantized);
 
     return isValid;
 }
@@ -238,15 +239,18 @@ void TriangleMesh::removeUnusedVertices(Array<bool>& areUsedVertices) {
     }
 }
 
-// Insert all the triangles into the dynamic AABB tree
-void TriangleMesh::initBVHTree() {
+// Build the static AABB tree with all the triangles of the mesh
+void TriangleMesh::initBVHTree(bool isAABBTreeQuantized) {
 
     assert(mTriangles.size() % 3 == 0);
 
-    // TODO : Try to randomly add the triangles into the tree to obtain a better tree
+    const uint32 nbTriangles = static_cast<uint32>(mTriangles.size() / 3);
+
+    Array<AABB> trianglesAABBs(mAllocator, nbTriangles);
+    Array<int32> trianglesIndices(mAllocator, nbTriangles);
 
     // For each triangle of the mesh
-    for (uint32 f=0; f < mTriangles.size() / 3; f++) {
+    for (uint32 f=0; f < nbTriangles; f++) {
 
         // Get the triangle vertices
         Vector3 trianglePoints[3];
@@ -255,11 +259,12 @@ void TriangleMesh::initBVHTree() {
         trianglePoints[2] = mVertices[mTriangles[f * 3 + 2]];
 
         // Create the AABB for the triangle
-        AABB aabb = AABB::createAABBForTriangle(trianglePoints);
-
-        // Add the AABB with the index of the triangle into the dynamic AABB tree
-        mDynamicAABBTree.addObject(aabb, f);
+        trianglesAABBs.add(AABB::createAABBForTriangle(trianglePoints));
+        trianglesIndices.add(static_cast<int32>(f));
     }
+
+    // Build the tree with the AABBs and the indices of the triangles
+    mAABBTree.build(trianglesAABBs, trianglesIndices, isAABBTreeQuantized);
 }
 
 // Return the minimum bounds of the mesh in the x,y,z direction
@@ -267,7 +272,7 @@ void TriangleMesh::initBVHTree() {
  * @return The three mimimum bounds of the mesh in the x,y,z direction
  */
 const AABB& TriangleMesh::getBounds() const {
-    return mDynamicAABBTree.getRootAABB();
+    return mAABBTree.getRootAABB();
 }
 
 // Compute the vertices normals
@@ -331,17 +336,36 @@ void TriangleMesh::computeVerticesNormals() {
     }
 }
 
-// Report all shapes overlapping with the AABB given in parameter.
-void TriangleMesh::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes) {
-    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
-}
+// Report the indices of all the triangles overlapping with the AABB given in parameter.
+void TriangleMesh::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingTriangles, MemoryAllocator& allocator) const {
+
+    const uint64 startIndex = overlappingTriangles.size();
+
+    // Get the triangles of all the leaves of the tree overlapping with the AABB
+    mAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingTriangles, allocator);
+
+    // A leaf of the tree contains several triangles. Therefore, we only keep the
+    // triangles whose AABB overlaps with the AABB in parameter
+    uint64 nbKeptTriangles = startIndex;
+    for (uint64 i=startIndex; i < overlappingTriangles.size(); i++) {
 
-// Return the integer data of leaf node of the dynamic AABB tree
-int32 TriangleMesh::getDynamicAABBTreeNodeDataInt(int32 nodeID) const {
-   return mDynamicAABBTree.getNodeDataInt(nodeID);
+        const int32 triangleIndex = overlappingTriangles[i];
+
+        Vector3 trianglePoints[3];
+        getTriangleVertices(triangleIndex, trianglePoints[0], trianglePoints[1], trianglePoints[2]);
+
+        if (aabb.testCollisionTriangleAABB(trianglePoints)) {
+            overlappingTriangles[nbKeptTriangles] = triangleIndex;
+            nbKeptTriangles++;
+        }
+    }
+
+    while (overlappingTriangles.size() > nbKeptTriangles) {
+        overlappingTriangles.removeAt(overlappingTriangles.size() - 1);
+    }
 }
 
-// Ray casting method
-void TriangleMesh::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
-    mDynamicAABBTree.raycast(ray, callback);
+// Ray casting method (the index of a triangle is given as node ID to the callback)
+void TriangleMesh::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const {
+    mAABBTree.raycast(ray, callback, allocator);
 }
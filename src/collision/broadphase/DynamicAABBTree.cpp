@@ -25,8 +25,10 @@
 
 // Libraries
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
 #include <reactphysics3d/systems/BroadPhaseSystem.h>
 #include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/containers/Pair.h>
 #include <reactphysics3d/utils/Profiler.h>
 
 using namespace reactphysics3d;
@@ -34,6 +36,28 @@ using namespace reactphysics3d;
 // Initialization of static variables
 const int32 TreeNode::NULL_TREE_NODE = -1;
 
+// Structure used to rebuild a node of the tree from a range of leaves
+struct DynamicAABBTreeRebuildTask {
+
+    /// Index of the first leaf of the range
+    uint32 startIndex;
+
+    /// Index after the last leaf of the range
+    uint32 endIndex;
+
+    /// ID of the parent node (NULL_TREE_NODE for the root)
+    int32 parentNodeID;
+
+    /// Index of the node in the children of its parent
+    int childIndex;
+};
+
+// Return half of the surface area of an AABB
+static decimal computeHalfSurfaceArea(const AABB& aabb) {
+    const Vector3 extent = aabb.getExtent();
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
 // Constructor
 DynamicAABBTree::DynamicAABBTree(MemoryAllocator& allocator, decimal fatAABBInflatePercentage)
                 : mAllocator(allocator), mFatAABBInflatePercentage(fatAABBInflatePercentage) {
@@ -72,6 +96,7 @@ void DynamicAABBTree::init() {
     mNodes[mNbAllocatedNodes - 1].nextNodeID = TreeNode::NULL_TREE_NODE;
     mNodes[mNbAllocatedNodes - 1].height = -1;
     mFreeNodeID = 0;
+    mOptimizeNodeID = 0;
 }
 
 // Clear all the nodes and reset the tree
@@ -585,6 +610,164 @@ int32 DynamicAABBTree::balanceSubTreeAtNode(int32 nodeID) {
     return nodeID;
 }
 
+// Return the SAH cost of the tree (the quality of the tree, lower is better)
+/// This is the sum of the surface areas of the internal nodes divided by the surface area of the
+/// root node. It is proportional to the expected number of internal nodes visited by a random
+/// query. The cost can be compared with the cost of the tree right after a call to rebuild() to
+/// decide when the tree must be rebuilt or optimized again.
+decimal DynamicAABBTree::computeSAHCost() const {
+
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE) return decimal(0.0);
+
+    const decimal rootArea = computeHalfSurfaceArea(mNodes[mRootNodeID].aabb);
+    if (rootArea <= decimal(0.0)) return decimal(0.0);
+
+    decimal totalArea = decimal(0.0);
+    for (int32 i=0; i < mNbAllocatedNodes; i++) {
+
+        // If the node is an internal node of the tree
+        if (mNodes[i].height > 0) {
+            totalArea += computeHalfSurfaceArea(mNodes[i].aabb);
+        }
+    }
+
+    return totalArea / rootArea;
+}
+
+// Rebuild the whole tree top-down with the Surface Area Heuristic
+/// The leaves are kept with their IDs, fat AABBs and data. All the internal nodes are
+/// replaced by the nodes of a tree built top-down where each range of leaves is split at the
+/// position that minimizes the binned SAH of the leaves centroids (as in the StaticAABBTree).
+/// This is useful when the quality of the tree has decreased after many objects have been
+/// added, moved or removed.
+void DynamicAABBTree::rebuild() {
+
+    RP3D_PROFILE("DynamicAABBTree::rebuild()", mProfiler);
+
+    // Get the leaves and release the internal nodes
+    Array<int32> leaves(mAllocator, static_cast<uint64>(mNbNodes / 2 + 1));
+    for (int32 i=0; i < mNbAllocatedNodes; i++) {
+        if (mNodes[i].isLeaf()) {
+            leaves.add(i);
+        }
+        else if (mNodes[i].height > 0) {
+            releaseNode(i);
+        }
+    }
+
+    const uint32 nbLeaves = static_cast<uint32>(leaves.size());
+    if (nbLeaves == 0) {
+        mRootNodeID = TreeNode::NULL_TREE_NODE;
+        return;
+    }
+
+    // Compute the centroid of each leaf
+    Array<AABB> leavesAABBs(mAllocator, nbLeaves);
+    Array<Vector3> centroids(mAllocator, nbLeaves);
+    Array<uint32> items(mAllocator, nbLeaves);
+    for (uint32 i=0; i < nbLeaves; i++) {
+        leavesAABBs.add(mNodes[leaves[i]].aabb);
+        centroids.add(leavesAABBs[i].getCenter());
+        items.add(i);
+    }
+
+    // The internal nodes are created before their children
+    Array<int32> internalNodes(mAllocator, nbLeaves);
+
+    Stack<DynamicAABBTreeRebuildTask> tasks(mAllocator, 64);
+    tasks.push({0, nbLeaves, TreeNode::NULL_TREE_NODE, 0});
+
+    while (tasks.size() > 0) {
+
+        const DynamicAABBTreeRebuildTask task = tasks.pop();
+
+        int32 nodeID;
+
+        // If the range has a single leaf
+        if (task.endIndex - task.startIndex == 1) {
+            nodeID = leaves[items[task.startIndex]];
+        }
+        else {
+
+            nodeID = allocateNode();
+            internalNodes.add(nodeID);
+
+            // Compute the AABB of the node
+            AABB nodeAABB = leavesAABBs[items[task.startIndex]];
+            for (uint32 i=task.startIndex + 1; i < task.endIndex; i++) {
+                nodeAABB.mergeWithAABB(leavesAABBs[items[i]]);
+            }
+            mNodes[nodeID].aabb = nodeAABB;
+
+            uint32 splitIndex;
+            decimal splitCost;
+            if (!StaticAABBTree::computeSAHSplit(leavesAABBs, centroids, items, task.startIndex, task.endIndex, nodeAABB,
+                                                 splitIndex, splitCost)) {
+
+                // If all the centroids are at the same position, we split the range in the middle
+                splitIndex = task.startIndex + (task.endIndex - task.startIndex) / 2;
+            }
+
+            assert(splitIndex > task.startIndex && splitIndex < task.endIndex);
+
+            tasks.push({splitIndex, task.endIndex, nodeID, 1});
+            tasks.push({task.startIndex, splitIndex, nodeID, 0});
+        }
+
+        // Link the node to its parent
+        mNodes[nodeID].parentID = task.parentNodeID;
+        if (task.parentNodeID == TreeNode::NULL_TREE_NODE) {
+            mRootNodeID = nodeID;
+        }
+        else {
+            mNodes[task.parentNodeID].children[task.childIndex] = nodeID;
+        }
+    }
+
+    // Compute the heights of the internal nodes from the bottom of the tree
+    for (uint64 i=internalNodes.size(); i > 0; i--) {
+        TreeNode& node = mNodes[internalNodes[i - 1]];
+        node.height = static_cast<int16>(1 + std::max(mNodes[node.children[0]].height, mNodes[node.children[1]].height));
+    }
+}
+
+// Incrementally improve the tree by reinserting a given maximum number of leaves
+/// The leaves are removed and reinserted into the tree one after the other in the order of their
+/// IDs. The next call continues with the leaves that follow the last reinserted one. Because each
+/// leaf is inserted with the current layout of the tree, this improves a tree whose leaves have
+/// been inserted in a bad order. The IDs of the leaves do not change. The number of reinserted
+/// leaves is the budget of the optimization and a call with a budget equal to the number of
+/// leaves reinserts the whole tree. The method returns the number of reinserted leaves.
+/**
+ * @param maxNbReinsertedLeaves Maximum number of leaves to reinsert
+ * @return The number of reinserted leaves
+ */
+uint32 DynamicAABBTree::optimize(uint32 maxNbReinsertedLeaves) {
+
+    RP3D_PROFILE("DynamicAABBTree::optimize()", mProfiler);
+
+    // There is nothing to optimize with less than three leaves
+    if (mNbNodes < 5) return 0;
+
+    uint32 nbReinsertedLeaves = 0;
+    for (int32 i=0; i < mNbAllocatedNodes && nbReinsertedLeaves < maxNbReinsertedLeaves; i++) {
+
+        if (mOptimizeNodeID >= mNbAllocatedNodes) {
+            mOptimizeNodeID = 0;
+        }
+
+        const int32 nodeID = mOptimizeNodeID++;
+        if (mNodes[nodeID].isLeaf()) {
+
+            removeLeafNode(nodeID);
+            insertLeafNode(nodeID);
+            nbReinsertedLeaves++;
+        }
+    }
+
+    return nbReinsertedLeaves;
+}
+
 /// Take an array of shapes to be tested for broad-phase overlap and return an array of pair of overlapping shapes
 void DynamicAABBTree::reportAllShapesOverlappingWithShapes(const Array<int32>& nodesToTest, uint32 startIndex,
                                                            size_t endIndex, Array<Pair<int32, int32>>& outOverlappingNodes) const {
@@ -638,12 +821,32 @@ void DynamicAABBTree::reportAllShapesOverlappingWithShapes(const Array<int32>& n
 }
 
 // Report all shapes overlapping with the AABB given in parameter.
-void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes) const {
+/**
+ * @param aabb The AABB to test
+ * @param overlappingNodes Array where the IDs of the overlapping leaf nodes are added
+ * @param allocator Allocator used for the temporary memory of the tree traversal
+ */
+void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes, MemoryAllocator& allocator) const {
 
     RP3D_PROFILE("DynamicAABBTree::reportAllShapesOverlappingWithAABB()", mProfiler);
 
     // Create a stack with the nodes to visit
-    Stack<int32> stack(mAllocator, 64);
+    Stack<int32> stack(allocator, 64);
+
+    reportAllShapesOverlappingWithAABB(aabb, overlappingNodes, stack);
+}
+
+// Report all shapes overlapping with the AABB given in parameter.
+/// The stack used for the tree traversal is given in parameter so that it can be reused by many queries.
+/**
+ * @param aabb The AABB to test
+ * @param overlappingNodes Array where the IDs of the overlapping leaf nodes are added
+ * @param stack Empty stack used to store the nodes to visit (it is empty again when the method returns)
+ */
+void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingNodes, Stack<int32>& stack) const {
+
+    assert(stack.size() == 0);
+
     stack.push(mRootNodeID);
 
     // While there are still nodes to visit
@@ -652,12 +855,12 @@ void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array
         // Get the next node ID to visit
         const int32 nodeIDToVisit = stack.pop();
 
+        // Skip it if it is a null node (empty tree)
+        if (nodeIDToVisit == TreeNode::NULL_TREE_NODE) continue;
+
         assert(nodeIDToVisit >= 0);
         assert(nodeIDToVisit < mNbAllocatedNodes);
 
-        // Skip it if it is a null node
-        if (nodeIDToVisit == TreeNode::NULL_TREE_NODE) continue;
-
         // Get the corresponding node
         const TreeNode* nodeToVisit = mNodes + nodeIDToVisit;
 
@@ -681,35 +884,50 @@ void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array
 }
 
 // Ray casting method
-void DynamicAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
+/// The nodes are visited from front to back along the ray. The child of a node that the ray
+/// enters first is visited first and a node is skipped if the ray has been clipped before
+/// the point where it enters the AABB of the node. Therefore, if the callback returns the
+/// hit fraction (to find the closest hit), the traversal stops early.
+/**
+ * @param ray The ray to cast
+ * @param callback Callback called for each leaf node hit by the ray
+ * @param allocator Allocator used for the temporary memory of the tree traversal
+ */
+void DynamicAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const {
 
     RP3D_PROFILE("DynamicAABBTree::raycast()", mProfiler);
 
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE) return;
+
     decimal maxFraction = ray.maxFraction;
 
     // Compute the inverse ray direction
     const Vector3 rayDirection = ray.point2 - ray.point1;
     const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
 
-    Stack<int32> stack(mAllocator, 128);
-    stack.push(mRootNodeID);
+    // Test if the ray intersects with the root AABB
+    decimal rootEntryFraction;
+    if (!mNodes[mRootNodeID].aabb.testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, rootEntryFraction)) return;
+
+    // Stack of the nodes to visit with the fraction where the ray enters their AABB
+    Stack<Pair<int32, decimal>> stack(allocator, 128);
+    stack.push(Pair<int32, decimal>(mRootNodeID, rootEntryFraction));
 
     // Walk through the tree from the root looking for colliders
     // that overlap with the ray AABB
     while (stack.size() > 0) {
 
         // Get the next node in the stack
-        int32 nodeID = stack.pop();
+        const Pair<int32, decimal> nodeToVisit = stack.pop();
+
+        // If the ray has been clipped before the AABB of the node, skip it
+        if (nodeToVisit.second > maxFraction) continue;
 
-        // If it is a null node, skip it
-        if (nodeID == TreeNode::NULL_TREE_NODE) continue;
+        const int32 nodeID = nodeToVisit.first;
 
         // Get the corresponding node
         const TreeNode* node = mNodes + nodeID;
 
-        // Test if the ray intersects with the current node AABB
-        if (!node->aabb.testRayIntersect(ray.point1, rayDirectionInverse, maxFraction)) continue;
-
         // If the node is a leaf of the tree
         if (node->isLeaf()) {
 
@@ -739,11 +957,175 @@ void DynamicAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& ca
         }
         else {  // If the node has children
 
-            // Push its children in the stack of nodes to explore
-            stack.push(node->children[0]);
-            stack.push(node->children[1]);
+            const int32 child1ID = node->children[0];
+            const int32 child2ID = node->children[1];
+
+            // Test the ray against the AABBs of the two children
+            decimal child1EntryFraction;
+            decimal child2EntryFraction;
+            const bool isChild1Hit = mNodes[child1ID].aabb.testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, child1EntryFraction);
+            const bool isChild2Hit = mNodes[child2ID].aabb.testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, child2EntryFraction);
+
+            // Push the farthest child first so that the nearest child is visited first
+            if (isChild1Hit && isChild2Hit) {
+
+                if (child1EntryFraction <= child2EntryFraction) {
+                    stack.push(Pair<int32, decimal>(child2ID, child2EntryFraction));
+                    stack.push(Pair<int32, decimal>(child1ID, child1EntryFraction));
+                }
+                else {
+                    stack.push(Pair<int32, decimal>(child1ID, child1EntryFraction));
+                    stack.push(Pair<int32, decimal>(child2ID, child2EntryFraction));
+                }
+            }
+            else if (isChild1Hit) {
+                stack.push(Pair<int32, decimal>(child1ID, child1EntryFraction));
+            }
+            else if (isChild2Hit) {
+                stack.push(Pair<int32, decimal>(child2ID, child2EntryFraction));
+            }
+        }
+    }
+}
+
+// Ray casting method for a packet of rays
+/// The rays of the packet are tested against the AABB of a node at once with SIMD instructions
+/// (one ray per lane). A node is visited if at least one ray of the packet hits its AABB and
+/// the callback is only called for the rays that hit the AABB of a leaf. Therefore, the traversal
+/// is faster if the rays of the packet are coherent (close origins and directions). The children
+/// of a node are visited from front to back along the sum of the directions of the rays.
+/**
+ * @param rays Array with the rays of the packet
+ * @param nbRays Number of rays in the packet (at most RAYCAST_PACKET_SIZE)
+ * @param maxFractions Maximum fraction of each ray (negative to ignore the ray). The fractions are
+ *                     clipped by the callback and a fraction is negative if the callback has stopped the ray.
+ * @param callback Callback called for each leaf node hit by a ray
+ * @param allocator Allocator used for the temporary memory of the tree traversal
+ */
+void DynamicAABBTree::raycastPacket(const Ray* rays, uint32 nbRays, decimal* maxFractions,
+                                    DynamicAABBTreeRaycastPacketCallback& callback, MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("DynamicAABBTree::raycastPacket()", mProfiler);
+
+    assert(nbRays <= RAYCAST_PACKET_SIZE);
+
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE) return;
+
+    // Put each ray of the packet in a lane
+    decimal originsX[RAYCAST_PACKET_SIZE], originsY[RAYCAST_PACKET_SIZE], originsZ[RAYCAST_PACKET_SIZE];
+    decimal inversesX[RAYCAST_PACKET_SIZE], inversesY[RAYCAST_PACKET_SIZE], inversesZ[RAYCAST_PACKET_SIZE];
+    decimal lanesMaxFractions[RAYCAST_PACKET_SIZE];
+    Vector3 directionsSum(0, 0, 0);
+    uint32 activeMask = 0;
+    for (uint32 i=0; i < RAYCAST_PACKET_SIZE; i++) {
+
+        if (i < nbRays && maxFractions[i] >= decimal(0.0)) {
+
+            const Vector3 rayDirection = rays[i].point2 - rays[i].point1;
+            originsX[i] = rays[i].point1.x;
+            originsY[i] = rays[i].point1.y;
+            originsZ[i] = rays[i].point1.z;
+            inversesX[i] = decimal(1.0) / rayDirection.x;
+            inversesY[i] = decimal(1.0) / rayDirection.y;
+            inversesZ[i] = decimal(1.0) / rayDirection.z;
+            lanesMaxFractions[i] = maxFractions[i];
+            directionsSum += rayDirection;
+            activeMask |= 1u << i;
+        }
+        else {
+
+            // The lane is not used
+            originsX[i] = originsY[i] = originsZ[i] = decimal(0.0);
+            inversesX[i] = inversesY[i] = inversesZ[i] = decimal(1.0);
+            lanesMaxFractions[i] = decimal(-1.0);
+        }
+    }
+
+    if (activeMask == 0) return;
+
+    const DecimalW originX = DecimalW::load(originsX);
+    const DecimalW originY = DecimalW::load(originsY);
+    const DecimalW originZ = DecimalW::load(originsZ);
+    const DecimalW inverseX = DecimalW::load(inversesX);
+    const DecimalW inverseY = DecimalW::load(inversesY);
+    const DecimalW inverseZ = DecimalW::load(inversesZ);
+    const DecimalW zero(decimal(0.0));
+
+    Stack<int32> stack(allocator, 128);
+    stack.push(mRootNodeID);
+
+    while (stack.size() > 0 && activeMask != 0) {
+
+        const int32 nodeID = stack.pop();
+        const TreeNode* node = mNodes + nodeID;
+        const Vector3& aabbMin = node->aabb.getMin();
+        const Vector3& aabbMax = node->aabb.getMax();
+
+        // Test the rays of the packet against the AABB of the node (same slab test as AABB::testRayIntersect())
+        DecimalW t1 = (DecimalW(aabbMin.x) - originX) * inverseX;
+        DecimalW t2 = (DecimalW(aabbMax.x) - originX) * inverseX;
+        DecimalW tMin = min(t1, t2);
+        DecimalW tMax = min(max(t1, t2), DecimalW::load(lanesMaxFractions));
+
+        t1 = (DecimalW(aabbMin.y) - originY) * inverseY;
+        t2 = (DecimalW(aabbMax.y) - originY) * inverseY;
+        tMin = max(tMin, min(t1, t2));
+        tMax = min(tMax, max(t1, t2));
+
+        t1 = (DecimalW(aabbMin.z) - originZ) * inverseZ;
+        t2 = (DecimalW(aabbMax.z) - originZ) * inverseZ;
+        tMin = max(tMin, min(t1, t2));
+        tMax = min(tMax, max(t1, t2));
+
+        const uint32 hitMask = lessOrEqualMask(max(tMin, zero), tMax) & activeMask;
+        if (hitMask == 0) continue;
+
+        // If the node is a leaf of the tree
+        if (node->isLeaf()) {
+
+            // For each ray that hits the AABB of the leaf
+            for (uint32 i=0; i < nbRays; i++) {
+
+                if ((hitMask & (1u << i)) == 0) continue;
+
+                Ray rayTemp(rays[i].point1, rays[i].point2, lanesMaxFractions[i]);
+
+                // Call the callback that will raycast again the broad-phase shape
+                const decimal hitFraction = callback.raycastBroadPhaseShape(nodeID, i, rayTemp);
+
+                // If the user returned a hitFraction of zero, the raycasting of this ray stops here
+                if (hitFraction == decimal(0.0)) {
+                    lanesMaxFractions[i] = decimal(-1.0);
+                    activeMask &= ~(1u << i);
+                }
+                else if (hitFraction > decimal(0.0) && hitFraction < lanesMaxFractions[i]) {
+
+                    // Clip the ray with the new maximum fraction
+                    lanesMaxFractions[i] = hitFraction;
+                }
+            }
+        }
+        else {  // If the node has children
+
+            const int32 child1ID = node->children[0];
+            const int32 child2ID = node->children[1];
+
+            // Push the farthest child first so that the nearest child is visited first
+            const Vector3 centersDifference = mNodes[child1ID].aabb.getCenter() - mNodes[child2ID].aabb.getCenter();
+            if (centersDifference.dot(directionsSum) > decimal(0.0)) {
+                stack.push(child1ID);
+                stack.push(child2ID);
+            }
+            else {
+                stack.push(child2ID);
+                stack.push(child1ID);
+            }
         }
     }
+
+    for (uint32 i=0; i < nbRays; i++) {
+        maxFractions[i] = lanesMaxFractions[i];
+    }
 }
 
 #ifndef NDEBUG
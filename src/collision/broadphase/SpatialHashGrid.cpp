@@ -0,0 +1,676 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/SpatialHashGrid.h>
+#include <reactphysics3d/mathematics/Ray.h>
+#include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+using namespace reactphysics3d;
+
+// Class SpatialHashGridLargeObjectsRaycastCallback
+/**
+ * Raycast callback for the tree of the large objects of the grid. It gives the ID of
+ * the object of a node to the callback of the grid raycast and keeps track of the
+ * clipping of the ray.
+ */
+class SpatialHashGridLargeObjectsRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+    private:
+
+        /// Tree of the large objects
+        const DynamicAABBTree& mTree;
+
+        /// Callback of the grid raycast
+        DynamicAABBTreeRaycastCallback& mCallback;
+
+        /// Maximum fraction of the ray after the hits reported so far
+        decimal mMaxFraction;
+
+        /// True if the callback has stopped the raycast
+        bool mIsRaycastStopped;
+
+    public:
+
+        // Constructor
+        SpatialHashGridLargeObjectsRaycastCallback(const DynamicAABBTree& tree, DynamicAABBTreeRaycastCallback& callback, decimal maxFraction)
+            : mTree(tree), mCallback(callback), mMaxFraction(maxFraction), mIsRaycastStopped(false) {
+
+        }
+
+        // Called for a large object that has to be tested for raycast
+        virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override {
+
+            const decimal hitFraction = mCallback.raycastBroadPhaseShape(mTree.getNodeDataInt(nodeId), ray);
+
+            if (hitFraction == decimal(0.0)) {
+                mIsRaycastStopped = true;
+            }
+            else if (hitFraction > decimal(0.0) && hitFraction < mMaxFraction) {
+                mMaxFraction = hitFraction;
+            }
+
+            return hitFraction;
+        }
+
+        // Return the maximum fraction of the ray after the hits reported so far
+        decimal getMaxFraction() const {
+            return mMaxFraction;
+        }
+
+        // Return true if the callback has stopped the raycast
+        bool isRaycastStopped() const {
+            return mIsRaycastStopped;
+        }
+};
+
+// Constructor
+SpatialHashGrid::SpatialHashGrid(MemoryAllocator& allocator, decimal cellSize)
+                : mAllocator(allocator), mCellSize(cellSize), mInverseCellSize(decimal(1.0) / cellSize), mObjects(allocator),
+                  mEntries(allocator), mFreeEntry(-1), mNbEntries(0), mBuckets(allocator, INITIAL_NB_BUCKETS),
+                  mLargeObjectsTree(allocator), mNbObjects(0), mNbCellsObjects(0) {
+
+    assert(cellSize > decimal(0.0));
+
+    for (uint32 i=0; i < INITIAL_NB_BUCKETS; i++) {
+        mBuckets.add(-1);
+    }
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+    mProfiler = nullptr;
+#endif
+
+}
+
+// Add an object with a given ID
+/**
+ * @param objectId ID of the object (a small non-negative integer not used by another object)
+ * @param aabb AABB of the object
+ * @param isStatic True if the object is static (the pairs of two static objects are never reported)
+ * @param data Pointer to the data of the object
+ */
+void SpatialHashGrid::addObject(int32 objectId, const AABB& aabb, bool isStatic, void* data) {
+
+    assert(objectId >= 0);
+    assert(!hasObject(objectId));
+
+    while (mObjects.size() <= static_cast<uint64>(objectId)) {
+        mObjects.add(SpatialHashGridObject{AABB(), {0, 0, 0}, {0, 0, 0}, -1, nullptr, false, false, false});
+    }
+
+    SpatialHashGridObject& object = mObjects[objectId];
+    object.aabb = aabb;
+    object.data = data;
+    object.isUsed = true;
+    object.isStatic = isStatic;
+    object.isMoved = false;
+
+    insertObject(objectId);
+
+    mNbObjects++;
+}
+
+// Update the AABB of an object
+/// The object is only moved to other cells if its range of cells has changed
+/**
+ * @param objectId ID of the object
+ * @param aabb New AABB of the object
+ */
+void SpatialHashGrid::updateObject(int32 objectId, const AABB& aabb) {
+
+    assert(hasObject(objectId));
+
+    SpatialHashGridObject& object = mObjects[objectId];
+
+    int32 minCell[3];
+    int32 maxCell[3];
+    const bool isInCells = computeCellsRange(aabb, minCell, maxCell);
+
+    // If the object stays in the same cells
+    if (isInCells && object.largeObjectNodeId == -1 && minCell[0] == object.minCell[0] && minCell[1] == object.minCell[1] &&
+        minCell[2] == object.minCell[2] && maxCell[0] == object.maxCell[0] && maxCell[1] == object.maxCell[1] &&
+        maxCell[2] == object.maxCell[2]) {
+
+        object.aabb = aabb;
+        mCellsObjectsBounds.mergeWithAABB(aabb);
+        return;
+    }
+
+    // If the object stays in the tree of the large objects
+    if (!isInCells && object.largeObjectNodeId != -1) {
+        object.aabb = aabb;
+        for (int i=0; i < 3; i++) {
+            object.minCell[i] = minCell[i];
+            object.maxCell[i] = maxCell[i];
+        }
+        mLargeObjectsTree.updateObject(object.largeObjectNodeId, aabb, true);
+        return;
+    }
+
+    extractObject(objectId);
+    object.aabb = aabb;
+    insertObject(objectId);
+}
+
+// Remove an object
+/**
+ * @param objectId ID of the object
+ */
+void SpatialHashGrid::removeObject(int32 objectId) {
+
+    assert(hasObject(objectId));
+
+    extractObject(objectId);
+
+    SpatialHashGridObject& object = mObjects[objectId];
+    object.isUsed = false;
+    object.isMoved = false;
+
+    mNbObjects--;
+}
+
+// Compute the range of cells overlapped by an AABB and return true if the range is not too large
+bool SpatialHashGrid::computeCellsRange(const AABB& aabb, int32* minCell, int32* maxCell) const {
+
+    bool isRangeValid = true;
+    for (int i=0; i < 3; i++) {
+        minCell[i] = computeCellCoordinate(aabb.getMin()[i]);
+        maxCell[i] = computeCellCoordinate(aabb.getMax()[i]);
+        isRangeValid &= maxCell[i] - minCell[i] < MAX_NB_CELLS_PER_AXIS;
+    }
+
+    return isRangeValid;
+}
+
+// Add an object into its cells or into the tree of the large objects
+void SpatialHashGrid::insertObject(int32 objectId) {
+
+    SpatialHashGridObject& object = mObjects[objectId];
+
+    if (!computeCellsRange(object.aabb, object.minCell, object.maxCell)) {
+        object.largeObjectNodeId = mLargeObjectsTree.addObject(object.aabb, static_cast<uint32>(objectId));
+        return;
+    }
+
+    object.largeObjectNodeId = -1;
+
+    for (int32 x=object.minCell[0]; x <= object.maxCell[0]; x++) {
+        for (int32 y=object.minCell[1]; y <= object.maxCell[1]; y++) {
+            for (int32 z=object.minCell[2]; z <= object.maxCell[2]; z++) {
+                addEntry(computeCellKey(x, y, z), objectId);
+            }
+        }
+    }
+
+    if (mNbCellsObjects == 0) {
+        mCellsObjectsBounds = object.aabb;
+    }
+    else {
+        mCellsObjectsBounds.mergeWithAABB(object.aabb);
+    }
+    mNbCellsObjects++;
+}
+
+// Remove an object from its cells or from the tree of the large objects
+void SpatialHashGrid::extractObject(int32 objectId) {
+
+    SpatialHashGridObject& object = mObjects[objectId];
+
+    if (object.largeObjectNodeId != -1) {
+        mLargeObjectsTree.removeObject(object.largeObjectNodeId);
+        object.largeObjectNodeId = -1;
+        return;
+    }
+
+    for (int32 x=object.minCell[0]; x <= object.maxCell[0]; x++) {
+        for (int32 y=object.minCell[1]; y <= object.maxCell[1]; y++) {
+            for (int32 z=object.minCell[2]; z <= object.maxCell[2]; z++) {
+                removeEntry(computeCellKey(x, y, z), objectId);
+            }
+        }
+    }
+
+    assert(mNbCellsObjects > 0);
+    mNbCellsObjects--;
+}
+
+// Add an entry of an object in a cell
+void SpatialHashGrid::addEntry(uint64 cellKey, int32 objectId) {
+
+    // Keep at most one entry per bucket on average
+    if (mNbEntries >= mBuckets.size()) {
+        growBuckets();
+    }
+
+    int32 entryIndex;
+    if (mFreeEntry != -1) {
+        entryIndex = mFreeEntry;
+        mFreeEntry = mEntries[entryIndex].nextEntry;
+    }
+    else {
+        entryIndex = static_cast<int32>(mEntries.size());
+        mEntries.add(SpatialHashGridEntry{0, -1, -1});
+    }
+
+    const uint32 bucketIndex = computeBucketIndex(cellKey);
+
+    SpatialHashGridEntry& entry = mEntries[entryIndex];
+    entry.cellKey = cellKey;
+    entry.objectId = objectId;
+    entry.nextEntry = mBuckets[bucketIndex];
+    mBuckets[bucketIndex] = entryIndex;
+
+    mNbEntries++;
+}
+
+// Remove the entry of an object in a cell
+void SpatialHashGrid::removeEntry(uint64 cellKey, int32 objectId) {
+
+    const uint32 bucketIndex = computeBucketIndex(cellKey);
+
+    int32 previousEntryIndex = -1;
+    int32 entryIndex = mBuckets[bucketIndex];
+    while (entryIndex != -1) {
+
+        SpatialHashGridEntry& entry = mEntries[entryIndex];
+        if (entry.cellKey == cellKey && entry.objectId == objectId) {
+
+            // Unlink the entry from the bucket and add it to the free entries
+            if (previousEntryIndex == -1) {
+                mBuckets[bucketIndex] = entry.nextEntry;
+            }
+            else {
+                mEntries[previousEntryIndex].nextEntry = entry.nextEntry;
+            }
+            entry.objectId = -1;
+            entry.nextEntry = mFreeEntry;
+            mFreeEntry = entryIndex;
+
+            mNbEntries--;
+
+            return;
+        }
+
+        previousEntryIndex = entryIndex;
+        entryIndex = entry.nextEntry;
+    }
+
+    assert(false);
+}
+
+// Double the number of buckets of the hash table
+void SpatialHashGrid::growBuckets() {
+
+    RP3D_PROFILE("SpatialHashGrid::growBuckets()", mProfiler);
+
+    const uint64 nbBuckets = 2 * mBuckets.size();
+    mBuckets.clear();
+    mBuckets.reserve(nbBuckets);
+    for (uint64 i=0; i < nbBuckets; i++) {
+        mBuckets.add(-1);
+    }
+
+    // Link the used entries into the new buckets
+    for (uint64 i=0; i < mEntries.size(); i++) {
+
+        SpatialHashGridEntry& entry = mEntries[i];
+        if (entry.objectId != -1) {
+
+            const uint32 bucketIndex = computeBucketIndex(entry.cellKey);
+            entry.nextEntry = mBuckets[bucketIndex];
+            mBuckets[bucketIndex] = static_cast<int32>(i);
+        }
+    }
+}
+
+// Return true if the pair of two objects must be reported by the first object
+/// The pairs of two static objects are never reported. If both objects have moved, the pair is
+/// only reported by the object with the smallest ID.
+bool SpatialHashGrid::isPairReportedByObject(const SpatialHashGridObject& object, int32 objectId,
+                                             const SpatialHashGridObject& otherObject, int32 otherObjectId) {
+
+    if (objectId == otherObjectId) return false;
+    if (object.isStatic && otherObject.isStatic) return false;
+    return !otherObject.isMoved || objectId < otherObjectId;
+}
+
+// Report the overlapping pairs of objects where at least one object has moved
+/// The moved objects of the cells are tested against the objects of their cells and against the
+/// large objects. A pair of two objects that share several cells is only reported in the first
+/// shared cell. The moved large objects are tested against the objects of the cells they overlap
+/// (or against all the objects of the cells if they overlap more cells than there are objects).
+/**
+ * @param movedObjects IDs of the objects that have moved
+ * @param overlappingPairs Array where the pairs of IDs of the overlapping objects are added (the moved object first)
+ * @param allocator Allocator for the temporary memory of the queries
+ */
+void SpatialHashGrid::reportAllOverlappingPairs(const Array<int32>& movedObjects, Array<Pair<int32, int32>>& overlappingPairs,
+                                                MemoryAllocator& allocator) {
+
+    RP3D_PROFILE("SpatialHashGrid::reportAllOverlappingPairs()", mProfiler);
+
+    const uint64 nbMovedObjects = movedObjects.size();
+    for (uint64 i=0; i < nbMovedObjects; i++) {
+        assert(hasObject(movedObjects[i]));
+        mObjects[movedObjects[i]].isMoved = true;
+    }
+
+    Array<int32> nodes(allocator, 64);
+    Stack<int32> stack(allocator, 64);
+
+    for (uint64 i=0; i < nbMovedObjects; i++) {
+        reportCellsObjectsOverlappingWithObject(movedObjects[i], overlappingPairs);
+        reportLargeObjectsOverlappingWithObject(movedObjects[i], nodes, stack, overlappingPairs);
+    }
+
+    for (uint64 i=0; i < nbMovedObjects; i++) {
+        mObjects[movedObjects[i]].isMoved = false;
+    }
+}
+
+// Report the objects of the cells that overlap with a moved object
+void SpatialHashGrid::reportCellsObjectsOverlappingWithObject(int32 objectId, Array<Pair<int32, int32>>& overlappingPairs) const {
+
+    if (mNbCellsObjects == 0) return;
+
+    const SpatialHashGridObject& object = mObjects[objectId];
+
+    const uint64 nbCells = uint64(object.maxCell[0] - object.minCell[0] + 1) * uint64(object.maxCell[1] - object.minCell[1] + 1) *
+                           uint64(object.maxCell[2] - object.minCell[2] + 1);
+
+    // If it is faster to test all the objects of the cells than to visit the cells of a large object
+    if (object.largeObjectNodeId != -1 && nbCells > mNbCellsObjects) {
+
+        for (uint64 i=0; i < mObjects.size(); i++) {
+
+            const int32 otherObjectId = static_cast<int32>(i);
+            const SpatialHashGridObject& otherObject = mObjects[i];
+            if (otherObject.isUsed && otherObject.largeObjectNodeId == -1 &&
+                isPairReportedByObject(object, objectId, otherObject, otherObjectId) && object.aabb.testCollision(otherObject.aabb)) {
+
+                overlappingPairs.add(Pair<int32, int32>(objectId, otherObjectId));
+            }
+        }
+
+        return;
+    }
+
+    for (int32 x=object.minCell[0]; x <= object.maxCell[0]; x++) {
+        for (int32 y=object.minCell[1]; y <= object.maxCell[1]; y++) {
+            for (int32 z=object.minCell[2]; z <= object.maxCell[2]; z++) {
+
+                const uint64 cellKey = computeCellKey(x, y, z);
+
+                // For each object of the cell
+                int32 entryIndex = mBuckets[computeBucketIndex(cellKey)];
+                while (entryIndex != -1) {
+
+                    const SpatialHashGridEntry& entry = mEntries[entryIndex];
+                    entryIndex = entry.nextEntry;
+
+                    if (entry.cellKey != cellKey) continue;
+
+                    const SpatialHashGridObject& otherObject = mObjects[entry.objectId];
+
+                    // Only report the pair in the first cell shared by the two objects
+                    if (x != std::max(object.minCell[0], otherObject.minCell[0]) || y != std::max(object.minCell[1], otherObject.minCell[1]) ||
+                        z != std::max(object.minCell[2], otherObject.minCell[2])) {
+                        continue;
+                    }
+
+                    if (isPairReportedByObject(object, objectId, otherObject, entry.objectId) && object.aabb.testCollision(otherObject.aabb)) {
+                        overlappingPairs.add(Pair<int32, int32>(objectId, entry.objectId));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Report the large objects that overlap with a moved object
+void SpatialHashGrid::reportLargeObjectsOverlappingWithObject(int32 objectId, Array<int32>& nodes, Stack<int32>& stack,
+                                                              Array<Pair<int32, int32>>& overlappingPairs) const {
+
+    const SpatialHashGridObject& object = mObjects[objectId];
+
+    nodes.clear();
+    mLargeObjectsTree.reportAllShapesOverlappingWithAABB(object.aabb, nodes, stack);
+
+    const uint64 nbNodes = nodes.size();
+    for (uint64 n=0; n < nbNodes; n++) {
+
+        const int32 otherObjectId = mLargeObjectsTree.getNodeDataInt(nodes[n]);
+        if (isPairReportedByObject(object, objectId, mObjects[otherObjectId], otherObjectId)) {
+            overlappingPairs.add(Pair<int32, int32>(objectId, otherObjectId));
+        }
+    }
+}
+
+// Report the IDs of all the objects overlapping with the AABB given in parameter
+/**
+ * @param aabb The AABB to test
+ * @param overlappingObjects Array where the IDs of the overlapping objects are added
+ * @param allocator Allocator for the temporary memory of the query in the tree of the large objects
+ */
+void SpatialHashGrid::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingObjects, MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("SpatialHashGrid::reportAllShapesOverlappingWithAABB()", mProfiler);
+
+    // Report the large objects and convert the IDs of their nodes into the IDs of the objects
+    const uint64 nbPreviousObjects = overlappingObjects.size();
+    mLargeObjectsTree.reportAllShapesOverlappingWithAABB(aabb, overlappingObjects, allocator);
+    for (uint64 i=nbPreviousObjects; i < overlappingObjects.size(); i++) {
+        overlappingObjects[i] = mLargeObjectsTree.getNodeDataInt(overlappingObjects[i]);
+    }
+
+    reportCellsObjectsOverlappingWithAABB(aabb, overlappingObjects);
+}
+
+// Report the objects of the cells that overlap with an AABB
+/// Only the cells of the AABB inside the bounds of the objects of the cells are visited. An object
+/// that is in several of those cells is only reported in the first one. If there are more cells to
+/// visit than objects in the cells, all the objects of the cells are tested instead.
+void SpatialHashGrid::reportCellsObjectsOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingObjects) const {
+
+    if (mNbCellsObjects == 0 || !aabb.testCollision(mCellsObjectsBounds)) return;
+
+    // Compute the range of cells of the AABB that contain objects
+    int32 minCell[3];
+    int32 maxCell[3];
+    uint64 nbCells = 1;
+    for (int i=0; i < 3; i++) {
+        minCell[i] = computeCellCoordinate(std::max(aabb.getMin()[i], mCellsObjectsBounds.getMin()[i]));
+        maxCell[i] = computeCellCoordinate(std::min(aabb.getMax()[i], mCellsObjectsBounds.getMax()[i]));
+        nbCells *= uint64(maxCell[i] - minCell[i] + 1);
+    }
+
+    // If it is faster to test all the objects of the cells than to visit the cells
+    if (nbCells > mNbCellsObjects) {
+
+        for (uint64 i=0; i < mObjects.size(); i++) {
+
+            const SpatialHashGridObject& object = mObjects[i];
+            if (object.isUsed && object.largeObjectNodeId == -1 && aabb.testCollision(object.aabb)) {
+                overlappingObjects.add(static_cast<int32>(i));
+            }
+        }
+
+        return;
+    }
+
+    for (int32 x=minCell[0]; x <= maxCell[0]; x++) {
+        for (int32 y=minCell[1]; y <= maxCell[1]; y++) {
+            for (int32 z=minCell[2]; z <= maxCell[2]; z++) {
+
+                const uint64 cellKey = computeCellKey(x, y, z);
+
+                // For each object of the cell
+                int32 entryIndex = mBuckets[computeBucketIndex(cellKey)];
+                while (entryIndex != -1) {
+
+                    const SpatialHashGridEntry& entry = mEntries[entryIndex];
+                    entryIndex = entry.nextEntry;
+
+                    if (entry.cellKey != cellKey) continue;
+
+                    const SpatialHashGridObject& object = mObjects[entry.objectId];
+
+                    // Only report the object in the first cell shared by the object and the AABB
+                    if (x != std::max(object.minCell[0], minCell[0]) || y != std::max(object.minCell[1], minCell[1]) ||
+                        z != std::max(object.minCell[2], minCell[2])) {
+                        continue;
+                    }
+
+                    if (aabb.testCollision(object.aabb)) {
+                        overlappingObjects.add(entry.objectId);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Ray casting method
+/// The ray is cast against the tree of the large objects first. Then, the cells crossed by
+/// the ray are visited from front to back with a 3D-DDA walk. An object that is in several
+/// cells is only tested in the first cell of its range crossed by the ray. Because the line
+/// enters the range of cells of an object only once, this is the case if the previous cell
+/// of the walk is not in its range. The walk stops when the next cell is beyond the end of
+/// the ray (which is clipped by the hits returned by the callback).
+/**
+ * @param ray The ray to cast
+ * @param callback Callback called with the ID of each object whose AABB is hit by the ray
+ * @param allocator Allocator for the temporary memory of the raycast in the tree
+ */
+void SpatialHashGrid::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("SpatialHashGrid::raycast()", mProfiler);
+
+    decimal maxFraction = ray.maxFraction;
+
+    SpatialHashGridLargeObjectsRaycastCallback largeObjectsCallback(mLargeObjectsTree, callback, maxFraction);
+    mLargeObjectsTree.raycast(ray, largeObjectsCallback, allocator);
+    if (largeObjectsCallback.isRaycastStopped()) return;
+    maxFraction = largeObjectsCallback.getMaxFraction();
+
+    if (mNbCellsObjects == 0) return;
+
+    // Find where the ray enters the bounds of the objects of the cells
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+    decimal entryFraction;
+    if (!mCellsObjectsBounds.testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, entryFraction)) return;
+
+    // The entry fraction is NaN if the ray lies exactly on a face of the bounds
+    if (!(entryFraction >= decimal(0.0))) {
+        entryFraction = decimal(0.0);
+    }
+
+    const Vector3 entryPoint = ray.point1 + entryFraction * rayDirection;
+
+    // Initialize the walk in the first cell
+    int32 cell[3];
+    int32 step[3];
+    int32 boundsMinCell[3];
+    int32 boundsMaxCell[3];
+    decimal nextCellFraction[3];
+    decimal cellFractionDelta[3];
+    for (int i=0; i < 3; i++) {
+
+        boundsMinCell[i] = computeCellCoordinate(mCellsObjectsBounds.getMin()[i]);
+        boundsMaxCell[i] = computeCellCoordinate(mCellsObjectsBounds.getMax()[i]);
+        cell[i] = clamp(computeCellCoordinate(entryPoint[i]), boundsMinCell[i], boundsMaxCell[i]);
+
+        if (rayDirection[i] > decimal(0.0)) {
+            step[i] = 1;
+            nextCellFraction[i] = (decimal(cell[i] + 1) * mCellSize - ray.point1[i]) * rayDirectionInverse[i];
+            cellFractionDelta[i] = mCellSize * rayDirectionInverse[i];
+        }
+        else if (rayDirection[i] < decimal(0.0)) {
+            step[i] = -1;
+            nextCellFraction[i] = (decimal(cell[i]) * mCellSize - ray.point1[i]) * rayDirectionInverse[i];
+            cellFractionDelta[i] = -mCellSize * rayDirectionInverse[i];
+        }
+        else {
+            step[i] = 0;
+            nextCellFraction[i] = DECIMAL_LARGEST;
+            cellFractionDelta[i] = DECIMAL_LARGEST;
+        }
+    }
+
+    int32 previousCell[3] = {0, 0, 0};
+    bool hasPreviousCell = false;
+
+    while (true) {
+
+        const uint64 cellKey = computeCellKey(cell[0], cell[1], cell[2]);
+
+        // For each object of the cell
+        int32 entryIndex = mBuckets[computeBucketIndex(cellKey)];
+        while (entryIndex != -1) {
+
+            const SpatialHashGridEntry& entry = mEntries[entryIndex];
+            entryIndex = entry.nextEntry;
+
+            if (entry.cellKey != cellKey) continue;
+
+            // The object has already been tested in the previous cell
+            if (hasPreviousCell && isCellInRange(mObjects[entry.objectId], previousCell)) continue;
+
+            const Ray rayTemp(ray.point1, ray.point2, maxFraction);
+            const decimal hitFraction = callback.raycastBroadPhaseShape(entry.objectId, rayTemp);
+
+            // If the user returned a hitFraction of zero, it means that the raycasting should stop here
+            if (hitFraction == decimal(0.0)) return;
+
+            // Clip the ray with the new maximum fraction
+            if (hitFraction > decimal(0.0) && hitFraction < maxFraction) {
+                maxFraction = hitFraction;
+            }
+        }
+
+        // Find the axis of the next cell crossed by the ray
+        int axis = nextCellFraction[0] < nextCellFraction[1] ? 0 : 1;
+        if (nextCellFraction[2] < nextCellFraction[axis]) {
+            axis = 2;
+        }
+
+        // Stop if the next cell is beyond the end of the ray or outside of the bounds
+        if (nextCellFraction[axis] > maxFraction) break;
+        const int32 nextCell = cell[axis] + step[axis];
+        if (nextCell < boundsMinCell[axis] || nextCell > boundsMaxCell[axis]) break;
+
+        previousCell[0] = cell[0];
+        previousCell[1] = cell[1];
+        previousCell[2] = cell[2];
+        hasPreviousCell = true;
+
+        cell[axis] = nextCell;
+        nextCellFraction[axis] += cellFractionDelta[axis];
+    }
+}
@@ -0,0 +1,767 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/containers/Pair.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+using namespace reactphysics3d;
+
+// Structure used to build a node of the tree from a range of items
+struct StaticAABBTreeBuildTask {
+
+    /// Index of the first item of the range
+    uint32 startIndex;
+
+    /// Index after the last item of the range
+    uint32 endIndex;
+
+    /// Index of the parent node if the node is a right child (-1 otherwise)
+    int32 parentIndex;
+};
+
+// Structure that represents a bin used to evaluate the SAH along an axis
+struct StaticAABBTreeBin {
+
+    /// AABB of the items in the bin
+    AABB aabb;
+
+    /// Number of items in the bin
+    uint32 nbItems = 0;
+};
+
+// Return half of the surface area of an AABB
+static decimal computeHalfSurfaceArea(const AABB& aabb) {
+    const Vector3 extent = aabb.getExtent();
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Constructor
+/// With a single item per leaf, the queries only report the items whose AABB overlaps with the
+/// query. With more items per leaf, the tree is smaller but the caller must filter the items.
+/**
+ * @param allocator The memory allocator of the tree
+ * @param maxNbItemsPerLeaf Maximum number of items in a leaf node (between 1 and 7)
+ */
+StaticAABBTree::StaticAABBTree(MemoryAllocator& allocator, uint32 maxNbItemsPerLeaf)
+               : mAllocator(allocator), mMaxNbItemsPerLeaf(maxNbItemsPerLeaf), mWideNodes(allocator), mQuantizedNodes(allocator), mItemsData(allocator),
+                 mIsQuantized(false) {
+
+    assert(mMaxNbItemsPerLeaf > 0 && mMaxNbItemsPerLeaf < (1u << NB_ITEMS_BITS));
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+    mProfiler = nullptr;
+#endif
+
+}
+
+// Build the tree with the AABBs and the data of the items
+/// The tree is built top-down. Each range of items is split at the position that
+/// minimizes the Surface Area Heuristic evaluated on NB_BINS bins of the items centroids.
+/// A range with at most mMaxNbItemsPerLeaf items becomes a leaf if splitting it is not
+/// cheaper according to the SAH. The binary tree is then collapsed into the wide tree or
+/// converted into quantized nodes. Any previous content of the tree is discarded.
+/**
+ * @param itemsAABBs Array with the AABB of each item
+ * @param itemsData Array with the data of each item (reported by the queries)
+ * @param isQuantized True if the bounds of the nodes must be quantized on 16 bits
+ */
+void StaticAABBTree::build(const Array<AABB>& itemsAABBs, const Array<int32>& itemsData, bool isQuantized) {
+
+    RP3D_PROFILE("StaticAABBTree::build()", mProfiler);
+
+    assert(itemsAABBs.size() == itemsData.size());
+
+    mWideNodes.clear(true);
+    mQuantizedNodes.clear(true);
+    mItemsData.clear(true);
+    mIsQuantized = isQuantized;
+
+    const uint32 nbItems = static_cast<uint32>(itemsAABBs.size());
+    if (nbItems == 0) return;
+
+    // Compute the centroid of each item
+    Array<Vector3> centroids(mAllocator, nbItems);
+    Array<uint32> items(mAllocator, nbItems);
+    for (uint32 i=0; i < nbItems; i++) {
+        centroids.add(itemsAABBs[i].getCenter());
+        items.add(i);
+    }
+
+    // A binary tree with one item per leaf has at most 2n-1 nodes
+    Array<StaticAABBTreeNode> nodes(mAllocator, 2 * nbItems - 1);
+    mItemsData.reserve(nbItems);
+
+    Stack<StaticAABBTreeBuildTask> tasks(mAllocator, 64);
+    tasks.push({0, nbItems, -1});
+
+    while (tasks.size() > 0) {
+
+        const StaticAABBTreeBuildTask task = tasks.pop();
+        const uint32 nodeIndex = static_cast<uint32>(nodes.size());
+        const uint32 nbNodeItems = task.endIndex - task.startIndex;
+        assert(nbNodeItems > 0);
+
+        // If the node is a right child, we link it to its parent
+        if (task.parentIndex >= 0) {
+            nodes[task.parentIndex].index = nodeIndex;
+        }
+
+        // Compute the AABB of the node
+        AABB nodeAABB = itemsAABBs[items[task.startIndex]];
+        for (uint32 i=task.startIndex + 1; i < task.endIndex; i++) {
+            nodeAABB.mergeWithAABB(itemsAABBs[items[i]]);
+        }
+
+        nodes.add({nodeAABB, 0, 0});
+
+        uint32 splitIndex = 0;
+        decimal splitCost = DECIMAL_LARGEST;
+        bool isSplitFound = false;
+        if (nbNodeItems > 1) {
+            isSplitFound = computeSAHSplit(itemsAABBs, centroids, items, task.startIndex, task.endIndex,
+                                           nodeAABB, splitIndex, splitCost);
+        }
+
+        // If the node should be a leaf
+        if (nbNodeItems <= mMaxNbItemsPerLeaf && (!isSplitFound || splitCost >= decimal(nbNodeItems))) {
+
+            nodes[nodeIndex].index = static_cast<uint32>(mItemsData.size());
+            nodes[nodeIndex].nbItems = nbNodeItems;
+            for (uint32 i=task.startIndex; i < task.endIndex; i++) {
+                mItemsData.add(itemsData[items[i]]);
+            }
+
+            continue;
+        }
+
+        // If all the centroids are at the same position, we split the range in the middle
+        if (!isSplitFound) {
+            splitIndex = task.startIndex + nbNodeItems / 2;
+        }
+
+        assert(splitIndex > task.startIndex && splitIndex < task.endIndex);
+
+        // The left child is built next so that it is stored right after its parent
+        tasks.push({splitIndex, task.endIndex, static_cast<int32>(nodeIndex)});
+        tasks.push({task.startIndex, splitIndex, -1});
+    }
+
+    mRootAABB = nodes[0].aabb;
+
+    if (mIsQuantized) {
+        quantizeNodes(nodes);
+    }
+    else {
+        collapseNodes(nodes);
+    }
+}
+
+// Create the wide nodes from the nodes of the binary tree
+/// The children of a wide node are found by starting with the two children of a binary node and
+/// by replacing the internal child with the largest surface area by its own two children until
+/// the wide node is full. This removes about half of the levels of the binary tree.
+void StaticAABBTree::collapseNodes(const Array<StaticAABBTreeNode>& nodes) {
+
+    // A wide node replaces at least one internal node of the binary tree
+    Array<StaticAABBTreeWideNode> wideNodes(mAllocator, nodes.size() / 2 + 1);
+
+    // Stack of (binary node index, wide node index) pairs
+    Stack<uint32> stack(mAllocator, 64);
+    wideNodes.add(StaticAABBTreeWideNode());
+    stack.push(0);
+    stack.push(0);
+
+    while (stack.size() > 0) {
+
+        const uint32 wideNodeIndex = stack.pop();
+        const uint32 binaryNodeIndex = stack.pop();
+
+        // Find the binary nodes that are the children of the wide node
+        uint32 children[RP3D_SIMD_WIDTH];
+        uint32 nbChildren = 0;
+        if (nodes[binaryNodeIndex].isLeaf()) {
+            children[nbChildren++] = binaryNodeIndex;
+        }
+        else {
+            children[nbChildren++] = binaryNodeIndex + 1;
+            children[nbChildren++] = nodes[binaryNodeIndex].index;
+        }
+
+        while (nbChildren < RP3D_SIMD_WIDTH) {
+
+            // Find the internal child with the largest surface area
+            int largestChild = -1;
+            decimal largestArea = decimal(-1.0);
+            for (uint32 c=0; c < nbChildren; c++) {
+                if (!nodes[children[c]].isLeaf()) {
+                    const decimal area = computeHalfSurfaceArea(nodes[children[c]].aabb);
+                    if (area > largestArea) {
+                        largestArea = area;
+                        largestChild = static_cast<int>(c);
+                    }
+                }
+            }
+
+            if (largestChild < 0) break;
+
+            // Replace the child by its two children
+            const uint32 childIndex = children[largestChild];
+            children[largestChild] = childIndex + 1;
+            children[nbChildren++] = nodes[childIndex].index;
+        }
+
+        // Set the children of the wide node
+        StaticAABBTreeWideNode wideNode;
+        wideNode.nbChildren = nbChildren;
+        for (uint32 c=0; c < RP3D_SIMD_WIDTH; c++) {
+
+            // The unused children are ignored by the queries
+            if (c >= nbChildren) {
+                wideNode.childrenMin.set(c, Vector3::zero());
+                wideNode.childrenMax.set(c, Vector3::zero());
+                wideNode.children[c] = 0;
+                continue;
+            }
+
+            const StaticAABBTreeNode& node = nodes[children[c]];
+            wideNode.childrenMin.set(c, node.aabb.getMin());
+            wideNode.childrenMax.set(c, node.aabb.getMax());
+
+            if (node.isLeaf()) {
+                assert(node.index < (1u << (32 - NB_ITEMS_BITS)));
+                wideNode.children[c] = (node.index << NB_ITEMS_BITS) | node.nbItems;
+            }
+            else {
+
+                // Create a new wide node for the internal child
+                const uint32 childWideNodeIndex = static_cast<uint32>(wideNodes.size());
+                wideNodes.add(StaticAABBTreeWideNode());
+                wideNode.children[c] = childWideNodeIndex << NB_ITEMS_BITS;
+                stack.push(children[c]);
+                stack.push(childWideNodeIndex);
+            }
+        }
+
+        wideNodes[wideNodeIndex] = wideNode;
+    }
+
+    // Copy the nodes into an array of the exact size
+    mWideNodes.reserve(wideNodes.size());
+    mWideNodes.addRange(wideNodes);
+}
+
+// Create the quantized nodes from the nodes of the binary tree
+void StaticAABBTree::quantizeNodes(const Array<StaticAABBTreeNode>& nodes) {
+
+    // Compute the quantization scale factors relative to the root AABB
+    const Vector3 rootExtent = mRootAABB.getExtent();
+    for (int axis=0; axis < 3; axis++) {
+        const bool isFlat = rootExtent[axis] <= decimal(0.0);
+        mQuantizationScale[axis] = isFlat ? decimal(0.0) : decimal(MAX_QUANTIZED_VALUE) / rootExtent[axis];
+        mDequantizationScale[axis] = isFlat ? decimal(0.0) : rootExtent[axis] / decimal(MAX_QUANTIZED_VALUE);
+    }
+
+    mQuantizedNodes.reserve(nodes.size());
+
+    for (uint32 i=0; i < nodes.size(); i++) {
+
+        const StaticAABBTreeNode& node = nodes[i];
+        assert(node.index < (1u << (32 - NB_ITEMS_BITS)));
+        assert(node.nbItems < (1u << NB_ITEMS_BITS));
+
+        StaticAABBTreeQuantizedNode quantizedNode;
+        for (int axis=0; axis < 3; axis++) {
+            quantizedNode.min[axis] = quantizeMin(node.aabb.getMin()[axis], axis);
+            quantizedNode.max[axis] = quantizeMax(node.aabb.getMax()[axis], axis);
+        }
+        quantizedNode.indexAndNbItems = (node.index << NB_ITEMS_BITS) | node.nbItems;
+
+        mQuantizedNodes.add(quantizedNode);
+    }
+}
+
+// Return the AABB of a quantized node
+/// The returned AABB contains the original AABB of the node
+AABB StaticAABBTree::getQuantizedNodeAABB(uint32 nodeIndex) const {
+
+    const StaticAABBTreeQuantizedNode& node = mQuantizedNodes[nodeIndex];
+    return AABB(Vector3(dequantize(node.min[0], 0), dequantize(node.min[1], 1), dequantize(node.min[2], 2)),
+                Vector3(dequantize(node.max[0], 0), dequantize(node.max[1], 1), dequantize(node.max[2], 2)));
+}
+
+// Compute the best split of a range of items with the binned SAH
+/// The items of the range are partitioned in place such that the items of the left
+/// child come before splitIndex. The cost of the split is relative to the cost of
+/// testing one item. This method returns false if no valid split exists.
+bool StaticAABBTree::computeSAHSplit(const Array<AABB>& itemsAABBs, const Array<Vector3>& centroids, Array<uint32>& items,
+                                     uint32 startIndex, uint32 endIndex, const AABB& nodeAABB, uint32& splitIndex,
+                                     decimal& splitCost) {
+
+    // Compute the bounds of the centroids
+    AABB centroidsBounds(centroids[items[startIndex]], centroids[items[startIndex]]);
+    for (uint32 i=startIndex + 1; i < endIndex; i++) {
+        centroidsBounds.mergeWithAABB(AABB(centroids[items[i]], centroids[items[i]]));
+    }
+    const Vector3& boundsMin = centroidsBounds.getMin();
+    const Vector3 boundsExtent = centroidsBounds.getExtent();
+
+    decimal bestCost = DECIMAL_LARGEST;
+    int bestAxis = -1;
+    uint32 bestBin = 0;
+
+    // For each axis
+    for (int axis=0; axis < 3; axis++) {
+
+        if (boundsExtent[axis] <= decimal(0.0)) continue;
+
+        const decimal binsScale = decimal(NB_BINS) / boundsExtent[axis];
+
+        // Put the items into the bins
+        StaticAABBTreeBin bins[NB_BINS];
+        for (uint32 i=startIndex; i < endIndex; i++) {
+
+            const uint32 bin = std::min(static_cast<uint32>((centroids[items[i]][axis] - boundsMin[axis]) * binsScale), NB_BINS - 1);
+            if (bins[bin].nbItems == 0) {
+                bins[bin].aabb = itemsAABBs[items[i]];
+            }
+            else {
+                bins[bin].aabb.mergeWithAABB(itemsAABBs[items[i]]);
+            }
+            bins[bin].nbItems++;
+        }
+
+        // Sweep from the right to compute the area and number of items at the right of each plane
+        decimal rightAreas[NB_BINS];
+        uint32 rightNbItems[NB_BINS];
+        AABB rightAABB;
+        uint32 nbRightItems = 0;
+        for (uint32 b=NB_BINS - 1; b > 0; b--) {
+            if (bins[b].nbItems > 0) {
+                if (nbRightItems == 0) rightAABB = bins[b].aabb;
+                else rightAABB.mergeWithAABB(bins[b].aabb);
+                nbRightItems += bins[b].nbItems;
+            }
+            rightAreas[b] = nbRightItems > 0 ? computeHalfSurfaceArea(rightAABB) : decimal(0.0);
+            rightNbItems[b] = nbRightItems;
+        }
+
+        // Sweep from the left to evaluate the cost of the plane between bin b-1 and bin b
+        AABB leftAABB;
+        uint32 nbLeftItems = 0;
+        for (uint32 b=1; b < NB_BINS; b++) {
+            if (bins[b-1].nbItems > 0) {
+                if (nbLeftItems == 0) leftAABB = bins[b-1].aabb;
+                else leftAABB.mergeWithAABB(bins[b-1].aabb);
+                nbLeftItems += bins[b-1].nbItems;
+            }
+
+            if (nbLeftItems == 0 || rightNbItems[b] == 0) continue;
+
+            const decimal cost = computeHalfSurfaceArea(leftAABB) * nbLeftItems + rightAreas[b] * rightNbItems[b];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+
+    if (bestAxis < 0) return false;
+
+    // Partition the items of the range with the best plane
+    const decimal binsScale = decimal(NB_BINS) / boundsExtent[bestAxis];
+    uint32 left = startIndex;
+    uint32 right = endIndex;
+    while (left < right) {
+        const uint32 bin = std::min(static_cast<uint32>((centroids[items[left]][bestAxis] - boundsMin[bestAxis]) * binsScale), NB_BINS - 1);
+        if (bin < bestBin) {
+            left++;
+        }
+        else {
+            right--;
+            std::swap(items[left], items[right]);
+        }
+    }
+
+    splitIndex = left;
+
+    // The cost of traversing a node is taken equal to the cost of testing an item
+    const decimal nodeArea = std::max(computeHalfSurfaceArea(nodeAABB), MACHINE_EPSILON);
+    splitCost = decimal(1.0) + bestCost / nodeArea;
+
+    return splitIndex > startIndex && splitIndex < endIndex;
+}
+
+// Report the data of all the items of the leaves overlapping with the AABB given in parameter
+/// Note that all the items of an overlapping leaf are reported. The caller should test the
+/// items individually if an exact result is needed.
+void StaticAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingItems,
+                                                        MemoryAllocator& allocator) const {
+
+    Stack<uint32> stack(allocator, 64);
+    reportAllShapesOverlappingWithAABB(aabb, overlappingItems, stack);
+}
+
+// Report the data of all the items of the leaves overlapping with the AABB given in parameter (with a stack for the traversal)
+/**
+ * @param aabb The AABB to test
+ * @param overlappingItems Array where the data of the overlapping items are added
+ * @param stack Temporary stack for the traversal of the tree (it is empty at the end)
+ */
+void StaticAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingItems, Stack<uint32>& stack) const {
+
+    RP3D_PROFILE("StaticAABBTree::reportAllShapesOverlappingWithAABB()", mProfiler);
+
+    if (getNbNodes() == 0 || !aabb.testCollision(mRootAABB)) return;
+
+    if (mIsQuantized) {
+        reportQuantizedShapesOverlappingWithAABB(aabb, overlappingItems, stack);
+        return;
+    }
+
+    const Vector3& aabbMin = aabb.getMin();
+    const Vector3& aabbMax = aabb.getMax();
+    const DecimalW minX(aabbMin.x), minY(aabbMin.y), minZ(aabbMin.z);
+    const DecimalW maxX(aabbMax.x), maxY(aabbMax.y), maxZ(aabbMax.z);
+
+    stack.push(0);
+
+    while (stack.size() > 0) {
+
+        const StaticAABBTreeWideNode& node = mWideNodes[stack.pop()];
+
+        // Test the AABB against the AABBs of all the children at once
+        const Vector3W childrenMin = node.childrenMin.load();
+        const Vector3W childrenMax = node.childrenMax.load();
+        uint32 overlapMask = lessOrEqualMask(minX, childrenMax.x) & lessOrEqualMask(childrenMin.x, maxX) &
+                             lessOrEqualMask(minY, childrenMax.y) & lessOrEqualMask(childrenMin.y, maxY) &
+                             lessOrEqualMask(minZ, childrenMax.z) & lessOrEqualMask(childrenMin.z, maxZ);
+        overlapMask &= (1u << node.nbChildren) - 1;
+
+        // For each overlapping child (the internal children are pushed in reverse order to be visited in order)
+        for (int c=static_cast<int>(node.nbChildren) - 1; c >= 0; c--) {
+
+            if ((overlapMask & (1u << c)) == 0) continue;
+
+            const uint32 index = node.children[c] >> NB_ITEMS_BITS;
+            const uint32 nbItems = node.children[c] & ((1u << NB_ITEMS_BITS) - 1);
+
+            if (nbItems > 0) {
+                for (uint32 i=0; i < nbItems; i++) {
+                    overlappingItems.add(mItemsData[index + i]);
+                }
+            }
+            else {
+                stack.push(index);
+            }
+        }
+    }
+}
+
+// Report the data of the items of the leaves overlapping with an AABB in the quantized tree
+void StaticAABBTree::reportQuantizedShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingItems,
+                                                              Stack<uint32>& stack) const {
+
+    // The AABB is quantized (rounded outward) to test it against the nodes with integer comparisons
+    uint16 queryMin[3];
+    uint16 queryMax[3];
+    for (int axis=0; axis < 3; axis++) {
+        queryMin[axis] = quantizeMin(aabb.getMin()[axis], axis);
+        queryMax[axis] = quantizeMax(aabb.getMax()[axis], axis);
+    }
+
+    stack.push(0);
+
+    while (stack.size() > 0) {
+
+        const uint32 nodeIndex = stack.pop();
+        const StaticAABBTreeQuantizedNode& node = mQuantizedNodes[nodeIndex];
+
+        // Test if the AABB overlaps with the current node
+        if (queryMax[0] < node.min[0] || queryMin[0] > node.max[0] ||
+            queryMax[1] < node.min[1] || queryMin[1] > node.max[1] ||
+            queryMax[2] < node.min[2] || queryMin[2] > node.max[2]) continue;
+
+        const uint32 index = node.indexAndNbItems >> NB_ITEMS_BITS;
+        const uint32 nbItems = node.indexAndNbItems & ((1u << NB_ITEMS_BITS) - 1);
+
+        if (nbItems > 0) {
+            for (uint32 i=0; i < nbItems; i++) {
+                overlappingItems.add(mItemsData[index + i]);
+            }
+        }
+        else {
+
+            // Push the left child last so that it is visited first
+            stack.push(index);
+            stack.push(nodeIndex + 1);
+        }
+    }
+}
+
+// Ray casting method (the data of an item is given as node ID to the callback)
+/// The ray is tested against the AABBs of all the children of a wide node at once with the
+/// same slab test as AABB::testRayIntersect(). The children hit by the ray are visited from
+/// front to back and a child is skipped if the ray has been clipped before the point where it
+/// enters the AABB of the child.
+void StaticAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("StaticAABBTree::raycast()", mProfiler);
+
+    if (getNbNodes() == 0) return;
+
+    if (mIsQuantized) {
+        raycastQuantized(ray, callback, allocator);
+        return;
+    }
+
+    decimal maxFraction = ray.maxFraction;
+
+    // Compute the inverse ray direction
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+
+    const DecimalW originX(ray.point1.x), originY(ray.point1.y), originZ(ray.point1.z);
+    const DecimalW inverseX(rayDirectionInverse.x), inverseY(rayDirectionInverse.y), inverseZ(rayDirectionInverse.z);
+    const DecimalW zero(decimal(0.0));
+
+    // Stack of the children to visit (index and number of items) with the fraction where the ray enters their AABB
+    Stack<Pair<uint32, decimal>> stack(allocator, 64);
+    stack.push(Pair<uint32, decimal>(0, decimal(0.0)));
+
+    while (stack.size() > 0) {
+
+        const Pair<uint32, decimal> child = stack.pop();
+
+        // If the ray has been clipped before the AABB of the child, skip it
+        if (child.second > maxFraction) continue;
+
+        const uint32 index = child.first >> NB_ITEMS_BITS;
+        const uint32 nbItems = child.first & ((1u << NB_ITEMS_BITS) - 1);
+
+        // If the child is a leaf
+        if (nbItems > 0) {
+
+            if (!raycastItems(ray, index, nbItems, callback, maxFraction)) return;
+
+            continue;
+        }
+
+        const StaticAABBTreeWideNode& node = mWideNodes[index];
+
+        // Test the ray against the AABBs of all the children at once
+        const Vector3W childrenMin = node.childrenMin.load();
+        const Vector3W childrenMax = node.childrenMax.load();
+
+        DecimalW t1 = (childrenMin.x - originX) * inverseX;
+        DecimalW t2 = (childrenMax.x - originX) * inverseX;
+        DecimalW tMin = min(t1, t2);
+        DecimalW tMax = min(max(t1, t2), DecimalW(maxFraction));
+
+        t1 = (childrenMin.y - originY) * inverseY;
+        t2 = (childrenMax.y - originY) * inverseY;
+        tMin = max(tMin, min(t1, t2));
+        tMax = min(tMax, max(t1, t2));
+
+        t1 = (childrenMin.z - originZ) * inverseZ;
+        t2 = (childrenMax.z - originZ) * inverseZ;
+        tMin = max(tMin, min(t1, t2));
+        tMax = min(tMax, max(t1, t2));
+
+        const DecimalW entryFraction = max(tMin, zero);
+        const uint32 hitMask = lessOrEqualMask(entryFraction, tMax) & ((1u << node.nbChildren) - 1);
+        if (hitMask == 0) continue;
+
+        decimal entryFractions[RP3D_SIMD_WIDTH];
+        entryFraction.store(entryFractions);
+
+        // Sort the children hit by the ray by decreasing entry fraction
+        uint32 hitChildren[RP3D_SIMD_WIDTH];
+        uint32 nbHitChildren = 0;
+        for (uint32 c=0; c < node.nbChildren; c++) {
+
+            if ((hitMask & (1u << c)) == 0) continue;
+
+            uint32 i = nbHitChildren;
+            while (i > 0 && entryFractions[hitChildren[i - 1]] < entryFractions[c]) {
+                hitChildren[i] = hitChildren[i - 1];
+                i--;
+            }
+            hitChildren[i] = c;
+            nbHitChildren++;
+        }
+
+        // Push the children so that the nearest child is visited first
+        for (uint32 i=0; i < nbHitChildren; i++) {
+            stack.push(Pair<uint32, decimal>(node.children[hitChildren[i]], entryFractions[hitChildren[i]]));
+        }
+    }
+}
+
+// Ray casting method for the quantized tree
+void StaticAABBTree::raycastQuantized(const Ray& ray, DynamicAABBTreeRaycastCallback& callback, MemoryAllocator& allocator) const {
+
+    decimal maxFraction = ray.maxFraction;
+
+    // Compute the inverse ray direction
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+
+    // Test if the ray intersects with the root AABB
+    decimal rootEntryFraction;
+    if (!getQuantizedNodeAABB(0).testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, rootEntryFraction)) return;
+
+    // Stack of the nodes to visit with the fraction where the ray enters their AABB
+    Stack<Pair<uint32, decimal>> stack(allocator, 64);
+    stack.push(Pair<uint32, decimal>(0, rootEntryFraction));
+
+    while (stack.size() > 0) {
+
+        const Pair<uint32, decimal> nodeToVisit = stack.pop();
+
+        // If the ray has been clipped before the AABB of the node, skip it
+        if (nodeToVisit.second > maxFraction) continue;
+
+        const uint32 nodeIndex = nodeToVisit.first;
+        const uint32 index = mQuantizedNodes[nodeIndex].indexAndNbItems >> NB_ITEMS_BITS;
+        const uint32 nbItems = mQuantizedNodes[nodeIndex].indexAndNbItems & ((1u << NB_ITEMS_BITS) - 1);
+
+        if (nbItems > 0) {
+
+            if (!raycastItems(ray, index, nbItems, callback, maxFraction)) return;
+        }
+        else {
+
+            // Test the ray against the AABBs of the two children
+            const uint32 leftChildIndex = nodeIndex + 1;
+            decimal leftEntryFraction;
+            decimal rightEntryFraction;
+            const bool isLeftHit = getQuantizedNodeAABB(leftChildIndex).testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, leftEntryFraction);
+            const bool isRightHit = getQuantizedNodeAABB(index).testRayIntersect(ray.point1, rayDirectionInverse, maxFraction, rightEntryFraction);
+
+            // Push the farthest child first so that the nearest child is visited first
+            if (isLeftHit && isRightHit) {
+
+                if (leftEntryFraction <= rightEntryFraction) {
+                    stack.push(Pair<uint32, decimal>(index, rightEntryFraction));
+                    stack.push(Pair<uint32, decimal>(leftChildIndex, leftEntryFraction));
+                }
+                else {
+                    stack.push(Pair<uint32, decimal>(leftChildIndex, leftEntryFraction));
+                    stack.push(Pair<uint32, decimal>(index, rightEntryFraction));
+                }
+            }
+            else if (isLeftHit) {
+                stack.push(Pair<uint32, decimal>(leftChildIndex, leftEntryFraction));
+            }
+            else if (isRightHit) {
+                stack.push(Pair<uint32, decimal>(index, rightEntryFraction));
+            }
+        }
+    }
+}
+
+// Call the raycast callback for the items of a leaf
+/**
+ * @param ray The ray to cast
+ * @param index Index of the first item of the leaf
+ * @param nbItems Number of items in the leaf
+ * @param callback Callback called for each item
+ * @param maxFraction Current maximum fraction of the ray (clipped by the callback)
+ * @return False if the callback has stopped the raycast
+ */
+bool StaticAABBTree::raycastItems(const Ray& ray, uint32 index, uint32 nbItems, DynamicAABBTreeRaycastCallback& callback,
+                                  decimal& maxFraction) const {
+
+    for (uint32 i=0; i < nbItems; i++) {
+
+        Ray rayTemp(ray.point1, ray.point2, maxFraction);
+
+        // Call the callback that will raycast again the item
+        decimal hitFraction = callback.raycastBroadPhaseShape(mItemsData[index + i], rayTemp);
+
+        // If the user returned a hitFraction of zero, it means that
+        // the raycasting should stop here
+        if (hitFraction == decimal(0.0)) {
+            return false;
+        }
+
+        // If the user returned a positive fraction, we clip the ray
+        if (hitFraction > decimal(0.0) && hitFraction < maxFraction) {
+            maxFraction = hitFraction;
+        }
+    }
+
+    return true;
+}
+
+// Compute the height of the tree
+/// The height of the wide tree is the number of levels of wide nodes
+uint32 StaticAABBTree::computeHeight() const {
+
+    if (getNbNodes() == 0) return 0;
+
+    uint32 height = 0;
+
+    // Stack of (node index, depth) pairs
+    Stack<uint32> stack(mAllocator, 128);
+    stack.push(0);
+    stack.push(1);
+
+    while (stack.size() > 0) {
+
+        const uint32 depth = stack.pop();
+        const uint32 nodeIndex = stack.pop();
+
+        height = std::max(height, depth);
+
+        if (mIsQuantized) {
+
+            const uint32 indexAndNbItems = mQuantizedNodes[nodeIndex].indexAndNbItems;
+            if ((indexAndNbItems & ((1u << NB_ITEMS_BITS) - 1)) == 0) {
+                stack.push(nodeIndex + 1);
+                stack.push(depth + 1);
+                stack.push(indexAndNbItems >> NB_ITEMS_BITS);
+                stack.push(depth + 1);
+            }
+        }
+        else {
+
+            const StaticAABBTreeWideNode& node = mWideNodes[nodeIndex];
+            for (uint32 c=0; c < node.nbChildren; c++) {
+                if ((node.children[c] & ((1u << NB_ITEMS_BITS) - 1)) == 0) {
+                    stack.push(node.children[c] >> NB_ITEMS_BITS);
+                    stack.push(depth + 1);
+                }
+            }
+        }
+    }
+
+    return height;
+}
@@ -0,0 +1,235 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/SweepAndPrune.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <algorithm>
+
+using namespace reactphysics3d;
+
+// Return true if a box comes before another one in the sorted array
+static bool isBoxBefore(const SweepAndPruneBox& box1, const SweepAndPruneBox& box2) {
+
+    // The boxes with the same minimum are sorted by object ID to always get the same order
+    return box1.min < box2.min || (box1.min == box2.min && box1.objectId < box2.objectId);
+}
+
+// Constructor
+SweepAndPrune::SweepAndPrune(MemoryAllocator& allocator)
+              : mAllocator(allocator), mProxies(allocator), mSortedBoxes(allocator), mNbUnsortedBoxes(0), mSweepAxis(0),
+                mNbObjects(0) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+    mProfiler = nullptr;
+#endif
+
+}
+
+// Add an object with a given ID
+/**
+ * @param objectId ID of the object (a small non-negative integer not used by another object)
+ * @param aabb AABB of the object
+ * @param isStatic True if the object is static (the pairs of two static objects are never reported)
+ */
+void SweepAndPrune::addObject(int32 objectId, const AABB& aabb, bool isStatic) {
+
+    assert(objectId >= 0);
+    assert(!hasObject(objectId));
+
+    while (mProxies.size() <= static_cast<uint64>(objectId)) {
+        mProxies.add(SweepAndPruneProxy{AABB(), false, false, false, false});
+    }
+
+    SweepAndPruneProxy& proxy = mProxies[objectId];
+    proxy.aabb = aabb;
+    proxy.isUsed = true;
+    proxy.isStatic = isStatic;
+    proxy.isMoved = true;
+
+    // The box of a removed object with the same ID may still be in the array of sorted boxes
+    if (!proxy.isSorted) {
+        mSortedBoxes.add(SweepAndPruneBox{aabb.getMin()[mSweepAxis], aabb.getMax()[mSweepAxis], objectId});
+        proxy.isSorted = true;
+        mNbUnsortedBoxes++;
+    }
+
+    mNbObjects++;
+}
+
+// Update the AABB of an object
+/// The interval of the object on the sweep axis is updated at the next sort of the boxes
+/**
+ * @param objectId ID of the object
+ * @param aabb New AABB of the object
+ */
+void SweepAndPrune::updateObject(int32 objectId, const AABB& aabb) {
+
+    assert(hasObject(objectId));
+
+    mProxies[objectId].aabb = aabb;
+}
+
+// Remove an object
+/// The box of the object is removed from the array of sorted boxes at the next sort
+/**
+ * @param objectId ID of the object
+ */
+void SweepAndPrune::removeObject(int32 objectId) {
+
+    assert(hasObject(objectId));
+
+    SweepAndPruneProxy& proxy = mProxies[objectId];
+    proxy.isUsed = false;
+    proxy.isMoved = false;
+
+    mNbObjects--;
+}
+
+// Update the intervals of the sorted boxes, choose the sweep axis and sort the boxes
+void SweepAndPrune::sortBoxes() {
+
+    RP3D_PROFILE("SweepAndPrune::sortBoxes()", mProfiler);
+
+    // Remove the boxes of the removed objects and compute the variance of the centers of the AABBs
+    Vector3 centersSum(0, 0, 0);
+    Vector3 centersSquaredSum(0, 0, 0);
+    uint64 nbBoxes = 0;
+    for (uint64 i=0; i < mSortedBoxes.size(); i++) {
+
+        SweepAndPruneProxy& proxy = mProxies[mSortedBoxes[i].objectId];
+        if (!proxy.isUsed) {
+            proxy.isSorted = false;
+            continue;
+        }
+
+        const Vector3 center = proxy.aabb.getCenter();
+        centersSum += center;
+        centersSquaredSum += Vector3(center.x * center.x, center.y * center.y, center.z * center.z);
+
+        mSortedBoxes[nbBoxes] = mSortedBoxes[i];
+        nbBoxes++;
+    }
+    while (mSortedBoxes.size() > nbBoxes) {
+        mSortedBoxes.removeAt(mSortedBoxes.size() - 1);
+    }
+
+    if (nbBoxes == 0) {
+        mNbUnsortedBoxes = 0;
+        return;
+    }
+
+    // Choose the axis with the largest variance of the centers (the axis is only changed if the
+    // variance is much larger to avoid sorting the whole array again at each frame)
+    const Vector3 mean = centersSum / decimal(nbBoxes);
+    const Vector3 variance = centersSquaredSum / decimal(nbBoxes) - Vector3(mean.x * mean.x, mean.y * mean.y, mean.z * mean.z);
+    const int maxVarianceAxis = variance.getMaxAxis();
+    bool isAxisChanged = false;
+    if (variance[maxVarianceAxis] > SWEEP_AXIS_CHANGE_RATIO * variance[mSweepAxis]) {
+        mSweepAxis = maxVarianceAxis;
+        isAxisChanged = true;
+    }
+
+    // Update the intervals of the boxes on the sweep axis
+    for (uint64 i=0; i < nbBoxes; i++) {
+
+        SweepAndPruneBox& box = mSortedBoxes[i];
+        const AABB& aabb = mProxies[box.objectId].aabb;
+        box.min = aabb.getMin()[mSweepAxis];
+        box.max = aabb.getMax()[mSweepAxis];
+    }
+
+    // If the axis has changed or if many objects have been added, the order of the previous sort is
+    // not coherent anymore and the whole array is sorted again
+    if (isAxisChanged || mNbUnsortedBoxes > nbBoxes / 8) {
+        std::sort(&mSortedBoxes[0], &mSortedBoxes[0] + nbBoxes, isBoxBefore);
+    }
+    else {
+
+        // Insertion sort (nearly linear because the boxes move little between two sorts)
+        for (uint64 i=1; i < nbBoxes; i++) {
+
+            const SweepAndPruneBox box = mSortedBoxes[i];
+            uint64 j = i;
+            while (j > 0 && isBoxBefore(box, mSortedBoxes[j - 1])) {
+                mSortedBoxes[j] = mSortedBoxes[j - 1];
+                j--;
+            }
+            mSortedBoxes[j] = box;
+        }
+    }
+
+    mNbUnsortedBoxes = 0;
+}
+
+// Report the overlapping pairs of objects where at least one object has moved
+/// The boxes are sorted along the sweep axis and each box is tested against the next boxes
+/// that start before its end. The pairs of two static objects and the pairs where no object
+/// has moved are not reported. A pair is reported once with a moved object first. The moved
+/// flags of the objects are reset.
+/**
+ * @param overlappingPairs Array where the pairs of IDs of the overlapping objects are added
+ */
+void SweepAndPrune::reportAllOverlappingPairs(Array<Pair<int32, int32>>& overlappingPairs) {
+
+    RP3D_PROFILE("SweepAndPrune::reportAllOverlappingPairs()", mProfiler);
+
+    sortBoxes();
+
+    const uint64 nbBoxes = mSortedBoxes.size();
+    for (uint64 i=0; i < nbBoxes; i++) {
+
+        const SweepAndPruneBox& box1 = mSortedBoxes[i];
+        const SweepAndPruneProxy& proxy1 = mProxies[box1.objectId];
+
+        // For each box that starts inside the interval of the first box
+        for (uint64 j=i+1; j < nbBoxes && mSortedBoxes[j].min <= box1.max; j++) {
+
+            const SweepAndPruneBox& box2 = mSortedBoxes[j];
+            const SweepAndPruneProxy& proxy2 = mProxies[box2.objectId];
+
+            if (!proxy1.isMoved && !proxy2.isMoved) continue;
+            if (proxy1.isStatic && proxy2.isStatic) continue;
+
+            // Test the AABBs on the other axes
+            if (proxy1.aabb.testCollision(proxy2.aabb)) {
+
+                if (proxy1.isMoved) {
+                    overlappingPairs.add(Pair<int32, int32>(box1.objectId, box2.objectId));
+                }
+                else {
+                    overlappingPairs.add(Pair<int32, int32>(box2.objectId, box1.objectId));
+                }
+            }
+        }
+    }
+
+    // Reset the moved flags
+    for (uint64 i=0; i < nbBoxes; i++) {
+        mProxies[mSortedBoxes[i].objectId].isMoved = false;
+    }
+}
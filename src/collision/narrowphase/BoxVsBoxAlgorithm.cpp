@@ -0,0 +1,478 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/mathematics/DecimalW.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <cassert>
+#include <cmath>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal BoxVsBoxAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
+const decimal BoxVsBoxAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
+
+// Clip a polygon with an axis-aligned plane and return the number of output vertices
+/// The vertices "p" with sign * p[axis] <= offset are kept (Sutherland-Hodgman algorithm)
+static uint32 clipPolygonWithAxisPlane(const Vector3* inputVertices, uint32 nbInputVertices, int axis, decimal sign,
+                                       decimal offset, Vector3* outputVertices) {
+
+    uint32 nbOutputVertices = 0;
+    if (nbInputVertices == 0) return nbOutputVertices;
+
+    Vector3 v1 = inputVertices[nbInputVertices - 1];
+    decimal distance1 = sign * v1[axis] - offset;
+
+    for (uint32 i=0; i < nbInputVertices; i++) {
+
+        const Vector3& v2 = inputVertices[i];
+        const decimal distance2 = sign * v2[axis] - offset;
+
+        // If the edge crosses the plane, we add the intersection point
+        if ((distance1 > decimal(0.0)) != (distance2 > decimal(0.0))) {
+            const decimal t = distance1 / (distance1 - distance2);
+            outputVertices[nbOutputVertices++] = v1 + t * (v2 - v1);
+        }
+
+        // If the end vertex of the edge is inside, we keep it
+        if (distance2 <= decimal(0.0)) {
+            outputVertices[nbOutputVertices++] = v2;
+        }
+
+        v1 = v2;
+        distance1 = distance2;
+    }
+
+    return nbOutputVertices;
+}
+
+// Compute the narrow-phase collision detection between two boxes
+/// The items of the batch are processed by groups of DecimalW::NB_LANES items. The penetration depths
+/// along the 15 axes of a group are computed with SIMD instructions (see computePenetrationDepths()).
+/// For the items that are not separated, the axis of minimum penetration is selected (with a
+/// preference for the face normals and for the normals of the first box, as in the SATAlgorithm)
+/// and the contact points are computed along this axis.
+bool BoxVsBoxAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                                      bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& /*memoryAllocator*/) {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::testCollision()", mProfiler);
+
+    bool isCollisionFound = false;
+
+    const uint32 batchEndIndex = batchStartIndex + batchNbItems;
+
+    Transform box1ToBox2Transforms[DecimalW::NB_LANES];
+    Transform box2ToBox1Transforms[DecimalW::NB_LANES];
+    Vector3 halfExtents1[DecimalW::NB_LANES];
+    Vector3 halfExtents2[DecimalW::NB_LANES];
+    decimal penetrationDepths[DecimalW::NB_LANES][NB_AXES];
+
+    // For each group of items in the batch
+    for (uint32 groupStartIndex = batchStartIndex; groupStartIndex < batchEndIndex; groupStartIndex += DecimalW::NB_LANES) {
+
+        const uint32 nbLanes = std::min(batchEndIndex - groupStartIndex, DecimalW::NB_LANES);
+
+        for (uint32 lane=0; lane < nbLanes; lane++) {
+
+            const uint32 batchIndex = groupStartIndex + lane;
+
+            assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getName() == CollisionShapeName::BOX);
+            assert(narrowPhaseInfoBatch.collisionShapes2[batchIndex]->getName() == CollisionShapeName::BOX);
+
+            halfExtents1[lane] = static_cast<const BoxShape*>(narrowPhaseInfoBatch.collisionShapes1[batchIndex])->getHalfExtents();
+            halfExtents2[lane] = static_cast<const BoxShape*>(narrowPhaseInfoBatch.collisionShapes2[batchIndex])->getHalfExtents();
+            box1ToBox2Transforms[lane] = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getInverse() *
+                                         narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
+            box2ToBox1Transforms[lane] = box1ToBox2Transforms[lane].getInverse();
+        }
+
+        const uint32 separatedMask = computePenetrationDepths(box2ToBox1Transforms, halfExtents1, halfExtents2, nbLanes, penetrationDepths);
+
+        for (uint32 lane=0; lane < nbLanes; lane++) {
+
+            const uint32 batchIndex = groupStartIndex + lane;
+
+            assert(narrowPhaseInfoBatch.nbContactPoints[batchIndex] == 0);
+            assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
+
+            LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[batchIndex];
+            const bool wasColliding = lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingSAT &&
+                                      lastFrameCollisionInfo->wasColliding;
+            lastFrameCollisionInfo->wasUsingSAT = true;
+            lastFrameCollisionInfo->wasUsingGJK = false;
+
+            // If we have found a separating axis
+            if ((separatedMask & (1u << lane)) != 0) continue;
+
+            const decimal* depths = penetrationDepths[lane];
+
+            // If the two boxes were colliding along a face normal in the previous frame and are still overlapping
+            // along this axis, we clip the faces along the previous axis for consistency of the contact manifold
+            const uint32 previousAxisIndex = lastFrameCollisionInfo->satBoxAxisIndex;
+            if (clipWithPreviousAxisIfStillColliding && wasColliding && previousAxisIndex < FIRST_EDGE_AXIS &&
+                depths[previousAxisIndex] > decimal(0.0)) {
+
+                if (computeFaceContactPoints(previousAxisIndex, halfExtents1[lane], halfExtents2[lane], box1ToBox2Transforms[lane],
+                                             box2ToBox1Transforms[lane], narrowPhaseInfoBatch, batchIndex)) {
+
+                    narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+                    isCollisionFound = true;
+                    continue;
+                }
+
+                // The contact manifold is empty. Therefore, we have to select the axis again
+            }
+
+            // Find the face normal of minimum penetration of each box
+            uint32 minFaceAxis1 = 0;
+            uint32 minFaceAxis2 = 3;
+            for (uint32 i=1; i < 3; i++) {
+                if (depths[i] < depths[minFaceAxis1]) minFaceAxis1 = i;
+                if (depths[3 + i] < depths[minFaceAxis2]) minFaceAxis2 = 3 + i;
+            }
+
+            // We prefer the face normal of box 1 if the two penetration depths are almost the same (for consistency between frames)
+            uint32 minAxisIndex = depths[minFaceAxis1] < depths[minFaceAxis2] * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE ?
+                                  minFaceAxis1 : minFaceAxis2;
+            decimal minPenetrationDepth = std::min(depths[minFaceAxis1], depths[minFaceAxis2]);
+            bool isMinPenetrationFaceNormal = true;
+
+            // We only use an edge vs edge axis if its penetration depth is significantly smaller than the one of the face normals
+            for (uint32 a=FIRST_EDGE_AXIS; a < NB_AXES; a++) {
+                if ((isMinPenetrationFaceNormal && depths[a] * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE < minPenetrationDepth) ||
+                    (!isMinPenetrationFaceNormal && depths[a] < minPenetrationDepth)) {
+
+                    minPenetrationDepth = depths[a];
+                    minAxisIndex = a;
+                    isMinPenetrationFaceNormal = false;
+                }
+            }
+
+            assert(minPenetrationDepth > decimal(0.0));
+
+            lastFrameCollisionInfo->satBoxAxisIndex = static_cast<uint8>(minAxisIndex);
+
+            if (isMinPenetrationFaceNormal) {
+
+                // There should be clipping points here. If it is not the case, it might be
+                // because of a numerical issue and we return no collision
+                if (!computeFaceContactPoints(minAxisIndex, halfExtents1[lane], halfExtents2[lane], box1ToBox2Transforms[lane],
+                                              box2ToBox1Transforms[lane], narrowPhaseInfoBatch, batchIndex)) {
+                    continue;
+                }
+            }
+            else {
+
+                computeEdgeContactPoint(minAxisIndex - FIRST_EDGE_AXIS, minPenetrationDepth, halfExtents1[lane], halfExtents2[lane],
+                                        box1ToBox2Transforms[lane], box2ToBox1Transforms[lane], narrowPhaseInfoBatch, batchIndex);
+            }
+
+            narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+            isCollisionFound = true;
+        }
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the penetration depths along the 15 axes of a group of items with SIMD instructions
+/// The rotation "R" and the translation "t" of box 2 relative to box 1 and the half-extents "a" and "b" of
+/// the two boxes are packed in structure-of-arrays layout. The penetration depth along an axis "L" is
+/// ra + rb - |t.L| where "ra" and "rb" are the projected radii of the boxes on "L" and are computed in
+/// closed form with the entries of R (see "Real-Time Collision Detection" by Christer Ericson). The
+/// penetration depths along the edge vs edge axes are divided by the length of the axis (and are
+/// DECIMAL_LARGEST for parallel edges) for the items that are not separated. This method returns a bit
+/// mask where the bit i is set if the boxes of the item i of the group are separated.
+uint32 BoxVsBoxAlgorithm::computePenetrationDepths(const Transform* box2ToBox1Transforms, const Vector3* halfExtents1,
+                                                   const Vector3* halfExtents2, uint32 nbLanes,
+                                                   decimal penetrationDepths[][NB_AXES]) const {
+
+    assert(nbLanes <= DecimalW::NB_LANES);
+
+    // Squared length of the cross product of two edges below which the edges are parallel
+    const decimal parallelEdgesLengthSquare = decimal(0.00001);
+
+    decimal rotations[3][3][DecimalW::NB_LANES];
+    Vector3Lanes translations;
+    Vector3Lanes extents1;
+    Vector3Lanes extents2;
+
+    for (uint32 lane=0; lane < DecimalW::NB_LANES; lane++) {
+
+        // The unused lanes are filled with two boxes that overlap
+        const bool isUsed = lane < nbLanes;
+        const Matrix3x3 rotation = isUsed ? box2ToBox1Transforms[lane].getOrientation().getMatrix() : Matrix3x3::identity();
+        for (int r=0; r < 3; r++) {
+            for (int c=0; c < 3; c++) {
+                rotations[r][c][lane] = rotation[r][c];
+            }
+        }
+        translations.set(lane, isUsed ? box2ToBox1Transforms[lane].getPosition() : Vector3::zero());
+        extents1.set(lane, isUsed ? halfExtents1[lane] : Vector3(1, 1, 1));
+        extents2.set(lane, isUsed ? halfExtents2[lane] : Vector3(1, 1, 1));
+    }
+
+    DecimalW R[3][3];
+    DecimalW absR[3][3];
+    for (int r=0; r < 3; r++) {
+        for (int c=0; c < 3; c++) {
+            R[r][c] = DecimalW::load(rotations[r][c]);
+            absR[r][c] = max(R[r][c], -R[r][c]);
+        }
+    }
+    const Vector3W translation = translations.load();
+    const Vector3W e1 = extents1.load();
+    const Vector3W e2 = extents2.load();
+    const DecimalW t[3] = {translation.x, translation.y, translation.z};
+    const DecimalW a[3] = {e1.x, e1.y, e1.z};
+    const DecimalW b[3] = {e2.x, e2.y, e2.z};
+    const DecimalW zero(decimal(0.0));
+
+    decimal depths[NB_AXES][DecimalW::NB_LANES];
+    decimal edgeLengthsSquare[NB_AXES - FIRST_EDGE_AXIS][DecimalW::NB_LANES];
+    uint32 separatedMask = 0;
+
+    for (int i=0; i < 3; i++) {
+
+        // Face normal "i" of box 1
+        const DecimalW depth1 = a[i] + b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2] - max(t[i], -t[i]);
+        depth1.store(depths[i]);
+        separatedMask |= lessOrEqualMask(depth1, zero);
+
+        // Face normal "i" of box 2
+        const DecimalW distance = t[0] * R[0][i] + t[1] * R[1][i] + t[2] * R[2][i];
+        const DecimalW depth2 = a[0] * absR[0][i] + a[1] * absR[1][i] + a[2] * absR[2][i] + b[i] - max(distance, -distance);
+        depth2.store(depths[3 + i]);
+        separatedMask |= lessOrEqualMask(depth2, zero);
+    }
+
+    // Cross products of the edge "i" of box 1 and the edge "j" of box 2
+    const DecimalW one(decimal(1.0));
+    const DecimalW parallelThreshold(parallelEdgesLengthSquare);
+    for (int i=0; i < 3; i++) {
+
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+
+        for (int j=0; j < 3; j++) {
+
+            const int j1 = (j + 1) % 3;
+            const int j2 = (j + 2) % 3;
+
+            const DecimalW radius1 = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+            const DecimalW radius2 = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+            const DecimalW distance = t[i2] * R[i1][j] - t[i1] * R[i2][j];
+            const DecimalW depth = radius1 + radius2 - max(distance, -distance);
+            const DecimalW lengthSquare = one - R[i][j] * R[i][j];
+
+            const uint32 edgeIndex = static_cast<uint32>(i * 3 + j);
+            depth.store(depths[FIRST_EDGE_AXIS + edgeIndex]);
+            lengthSquare.store(edgeLengthsSquare[edgeIndex]);
+
+            // The cross product of two parallel edges is not a valid axis
+            separatedMask |= lessOrEqualMask(depth, zero) & ~lessOrEqualMask(lengthSquare, parallelThreshold);
+        }
+    }
+
+    separatedMask &= (1u << nbLanes) - 1;
+
+    // Copy the penetration depths of the items that are not separated
+    for (uint32 lane=0; lane < nbLanes; lane++) {
+
+        if ((separatedMask & (1u << lane)) != 0) continue;
+
+        for (uint32 axis=0; axis < FIRST_EDGE_AXIS; axis++) {
+            penetrationDepths[lane][axis] = depths[axis][lane];
+        }
+        for (uint32 e=0; e < NB_AXES - FIRST_EDGE_AXIS; e++) {
+            const decimal lengthSquare = edgeLengthsSquare[e][lane];
+            penetrationDepths[lane][FIRST_EDGE_AXIS + e] = lengthSquare > parallelEdgesLengthSquare ?
+                                                           depths[FIRST_EDGE_AXIS + e][lane] / std::sqrt(lengthSquare) : DECIMAL_LARGEST;
+        }
+    }
+
+    return separatedMask;
+}
+
+// Compute the contact points between the reference face of a box and the incident face of the other box
+/// The reference face is the face of box 1 (if faceAxisIndex < 3) or of box 2 whose normal is the axis of
+/// minimum penetration. The incident face is the face of the other box that is the most anti-parallel to
+/// this normal. The incident face is clipped against the four side planes of the reference face in the
+/// local-space of the reference box and only the clipped points below the reference face are kept. This
+/// method returns true if contact points have been found.
+bool BoxVsBoxAlgorithm::computeFaceContactPoints(uint32 faceAxisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                                 const Transform& box1ToBox2Transform, const Transform& box2ToBox1Transform,
+                                                 NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::computeFaceContactPoints()", mProfiler);
+
+    assert(faceAxisIndex < FIRST_EDGE_AXIS);
+
+    const bool isReferenceBox1 = faceAxisIndex < 3;
+    const int referenceAxis = static_cast<int>(isReferenceBox1 ? faceAxisIndex : faceAxisIndex - 3);
+    const Vector3& referenceHalfExtents = isReferenceBox1 ? halfExtents1 : halfExtents2;
+    const Vector3& incidentHalfExtents = isReferenceBox1 ? halfExtents2 : halfExtents1;
+    const Transform& referenceToIncidentTransform = isReferenceBox1 ? box1ToBox2Transform : box2ToBox1Transform;
+    const Transform& incidentToReferenceTransform = isReferenceBox1 ? box2ToBox1Transform : box1ToBox2Transform;
+
+    // The normal of the reference face points toward the incident box
+    const decimal referenceSign = incidentToReferenceTransform.getPosition()[referenceAxis] < decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+    Vector3 axisReferenceSpace = Vector3::zero();
+    axisReferenceSpace[referenceAxis] = referenceSign;
+    const Vector3 axisIncidentSpace = referenceToIncidentTransform.getOrientation() * axisReferenceSpace;
+
+    // Compute the world normal
+    const Vector3 normalWorld = isReferenceBox1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex].getOrientation() * axisReferenceSpace :
+                                                  -(narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * axisReferenceSpace);
+
+    // Find the incident face (most anti-parallel face)
+    const int incidentAxis = axisIncidentSpace.getAbsoluteVector().getMaxAxis();
+    const int incidentAxis1 = (incidentAxis + 1) % 3;
+    const int incidentAxis2 = (incidentAxis + 2) % 3;
+    Vector3 incidentFaceCenter = Vector3::zero();
+    incidentFaceCenter[incidentAxis] = axisIncidentSpace[incidentAxis] > decimal(0.0) ? -incidentHalfExtents[incidentAxis] :
+                                                                                        incidentHalfExtents[incidentAxis];
+    Vector3 incidentFaceEdge1 = Vector3::zero();
+    incidentFaceEdge1[incidentAxis1] = incidentHalfExtents[incidentAxis1];
+    Vector3 incidentFaceEdge2 = Vector3::zero();
+    incidentFaceEdge2[incidentAxis2] = incidentHalfExtents[incidentAxis2];
+
+    // Get the vertices of the incident face (in the reference local-space)
+    Vector3 vertices1[NB_MAX_CLIPPED_VERTICES];
+    Vector3 vertices2[NB_MAX_CLIPPED_VERTICES];
+    vertices1[0] = incidentToReferenceTransform * (incidentFaceCenter + incidentFaceEdge1 + incidentFaceEdge2);
+    vertices1[1] = incidentToReferenceTransform * (incidentFaceCenter - incidentFaceEdge1 + incidentFaceEdge2);
+    vertices1[2] = incidentToReferenceTransform * (incidentFaceCenter - incidentFaceEdge1 - incidentFaceEdge2);
+    vertices1[3] = incidentToReferenceTransform * (incidentFaceCenter + incidentFaceEdge1 - incidentFaceEdge2);
+
+    // Clip the incident face with the four side planes of the reference face
+    const int referenceAxis1 = (referenceAxis + 1) % 3;
+    const int referenceAxis2 = (referenceAxis + 2) % 3;
+    uint32 nbVertices = 4;
+    nbVertices = clipPolygonWithAxisPlane(vertices1, nbVertices, referenceAxis1, decimal(1.0), referenceHalfExtents[referenceAxis1], vertices2);
+    nbVertices = clipPolygonWithAxisPlane(vertices2, nbVertices, referenceAxis1, decimal(-1.0), referenceHalfExtents[referenceAxis1], vertices1);
+    nbVertices = clipPolygonWithAxisPlane(vertices1, nbVertices, referenceAxis2, decimal(1.0), referenceHalfExtents[referenceAxis2], vertices2);
+    nbVertices = clipPolygonWithAxisPlane(vertices2, nbVertices, referenceAxis2, decimal(-1.0), referenceHalfExtents[referenceAxis2], vertices1);
+    assert(nbVertices <= NB_MAX_CLIPPED_VERTICES);
+
+    // We only keep the clipped points that are below the reference face
+    const decimal referenceFaceOffset = referenceSign * referenceHalfExtents[referenceAxis];
+    bool contactPointsFound = false;
+    for (uint32 i=0; i < nbVertices; i++) {
+
+        // Compute the penetration depth of this contact point
+        const decimal penetrationDepth = (referenceFaceOffset - vertices1[i][referenceAxis]) * referenceSign;
+
+        // If the clip point is below the reference face
+        if (penetrationDepth > decimal(0.0)) {
+
+            contactPointsFound = true;
+
+            // If we need to report contacts
+            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
+
+                // Convert the clip incident box vertex into the incident box local-space
+                const Vector3 contactPointIncidentBox = referenceToIncidentTransform * vertices1[i];
+
+                // Project the contact point onto the reference face
+                Vector3 contactPointReferenceBox = vertices1[i];
+                contactPointReferenceBox[referenceAxis] = referenceFaceOffset;
+
+                // Create a new contact point
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                                     isReferenceBox1 ? contactPointReferenceBox : contactPointIncidentBox,
+                                                     isReferenceBox1 ? contactPointIncidentBox : contactPointReferenceBox);
+            }
+        }
+    }
+
+    return contactPointsFound;
+}
+
+// Compute the contact point between an edge of each box
+/// The axis is the cross product of the edge direction "i" of box 1 and the edge direction "j" of
+/// box 2 (with edgeAxisIndex = i * 3 + j). The contact point is the closest points between the edge
+/// of box 1 that is the furthest along the axis and the edge of box 2 that is the furthest along
+/// the opposite direction.
+void BoxVsBoxAlgorithm::computeEdgeContactPoint(uint32 edgeAxisIndex, decimal penetrationDepth, const Vector3& halfExtents1,
+                                                const Vector3& halfExtents2, const Transform& box1ToBox2Transform,
+                                                const Transform& box2ToBox1Transform, NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                                uint32 batchIndex) const {
+
+    assert(edgeAxisIndex < NB_AXES - FIRST_EDGE_AXIS);
+
+    // If we do not need to report contacts
+    if (!narrowPhaseInfoBatch.reportContacts[batchIndex]) return;
+
+    const int edge1Axis = static_cast<int>(edgeAxisIndex / 3);
+    const int edge2Axis = static_cast<int>(edgeAxisIndex % 3);
+
+    // Compute the directions of the two edges (in the local-space of box 1)
+    Vector3 edge1Direction = Vector3::zero();
+    edge1Direction[edge1Axis] = decimal(1.0);
+    Vector3 edge2DirectionBox2 = Vector3::zero();
+    edge2DirectionBox2[edge2Axis] = decimal(1.0);
+    const Vector3 edge2Direction = box2ToBox1Transform.getOrientation() * edge2DirectionBox2;
+
+    // Compute the separating axis and make sure it goes from box 1 to box 2
+    Vector3 axis = edge1Direction.cross(edge2Direction).getUnit();
+    if (axis.dot(box2ToBox1Transform.getPosition()) < decimal(0.0)) {
+        axis = -axis;
+    }
+    const Vector3 axisBox2 = box1ToBox2Transform.getOrientation() * axis;
+
+    // Compute the edge of box 1 that is the furthest along the axis and the
+    // edge of box 2 that is the furthest along the opposite direction
+    Vector3 edge1Center;
+    Vector3 edge2Center;
+    for (int k=0; k < 3; k++) {
+        edge1Center[k] = axis[k] < decimal(0.0) ? -halfExtents1[k] : halfExtents1[k];
+        edge2Center[k] = axisBox2[k] > decimal(0.0) ? -halfExtents2[k] : halfExtents2[k];
+    }
+    edge1Center[edge1Axis] = decimal(0.0);
+    edge2Center[edge2Axis] = decimal(0.0);
+
+    const Vector3 edge1A = edge1Center - halfExtents1[edge1Axis] * edge1Direction;
+    const Vector3 edge1B = edge1Center + halfExtents1[edge1Axis] * edge1Direction;
+    const Vector3 edge2A = box2ToBox1Transform * (edge2Center - halfExtents2[edge2Axis] * edge2DirectionBox2);
+    const Vector3 edge2B = box2ToBox1Transform * (edge2Center + halfExtents2[edge2Axis] * edge2DirectionBox2);
+
+    // Compute the closest points between the two edges (in the local-space of box 1)
+    Vector3 closestPointBox1Edge, closestPointBox2Edge;
+    computeClosestPointBetweenTwoSegments(edge1A, edge1B, edge2A, edge2B, closestPointBox1Edge, closestPointBox2Edge);
+
+    // Compute the world normal
+    const Vector3 normalWorld = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex].getOrientation() * axis;
+
+    // Create the contact point
+    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, closestPointBox1Edge,
+                                         box1ToBox2Transform * closestPointBox2Edge);
+}
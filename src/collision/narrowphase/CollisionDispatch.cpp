@@ -38,6 +38,7 @@ CollisionDispatch::CollisionDispatch(MemoryAllocator& allocator) : mAllocator(al
     mSphereVsConvexPolyAllocatedSize = std::ceil(sizeof(SphereVsConvexPolyhedronAlgorithm) / float(GLOBAL_ALIGNMENT)) * GLOBAL_ALIGNMENT;
     mCapsuleVsConvexPolyAllocatedSize = std::ceil(sizeof(CapsuleVsConvexPolyhedronAlgorithm) / float(GLOBAL_ALIGNMENT)) * GLOBAL_ALIGNMENT;
     mConvexPolyVsConvexPolyAllocatedSize = std::ceil(sizeof(ConvexPolyhedronVsConvexPolyhedronAlgorithm) / float(GLOBAL_ALIGNMENT)) * GLOBAL_ALIGNMENT;
+    mBoxVsBoxAllocatedSize = std::ceil(sizeof(BoxVsBoxAlgorithm) / float(GLOBAL_ALIGNMENT)) * GLOBAL_ALIGNMENT;
 
     // Create the default narrow-phase algorithms
     mSphereVsSphereAlgorithm = new (allocator.allocate(mSphereVsSphereAllocatedSize)) SphereVsSphereAlgorithm();
@@ -46,6 +47,7 @@ CollisionDispatch::CollisionDispatch(MemoryAllocator& allocator) : mAllocator(al
     mSphereVsConvexPolyhedronAlgorithm = new (allocator.allocate(mSphereVsConvexPolyAllocatedSize)) SphereVsConvexPolyhedronAlgorithm();
     mCapsuleVsConvexPolyhedronAlgorithm = new (allocator.allocate(mCapsuleVsConvexPolyAllocatedSize)) CapsuleVsConvexPolyhedronAlgorithm();
     mConvexPolyhedronVsConvexPolyhedronAlgorithm = new (allocator.allocate(mConvexPolyVsConvexPolyAllocatedSize)) ConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    mBoxVsBoxAlgorithm = new (allocator.allocate(mBoxVsBoxAllocatedSize)) BoxVsBoxAlgorithm();
 
     // Fill in the collision matrix
     fillInCollisionMatrix();
@@ -73,6 +75,9 @@ CollisionDispatch::~CollisionDispatch() {
     if (mIsConvexPolyhedronVsConvexPolyhedronDefault) {
         mAllocator.release(mConvexPolyhedronVsConvexPolyhedronAlgorithm, mConvexPolyVsConvexPolyAllocatedSize);
     }
+    if (mIsBoxVsBoxDefault) {
+        mAllocator.release(mBoxVsBoxAlgorithm, mBoxVsBoxAllocatedSize);
+    }
 }
 
 // Select and return the narrow-phase collision detection algorithm to
@@ -192,6 +197,17 @@ void CollisionDispatch::setConvexPolyhedronVsConvexPolyhedronAlgorithm(ConvexPol
     fillInCollisionMatrix();
 }
 
+// Set the Box vs Box narrow-phase collision detection algorithm
+void CollisionDispatch::setBoxVsBoxAlgorithm(BoxVsBoxAlgorithm* algorithm) {
+
+    if (mIsBoxVsBoxDefault) {
+        mAllocator.release(mBoxVsBoxAlgorithm, mBoxVsBoxAllocatedSize);
+        mIsBoxVsBoxDefault = false;
+    }
+
+    mBoxVsBoxAlgorithm = algorithm;
+}
+
 
 // Fill-in the collision detection matrix
 void CollisionDispatch::fillInCollisionMatrix() {
@@ -221,5 +237,18 @@ NarrowPhaseAlgorithmType CollisionDispatch::selectNarrowPhaseAlgorithm(const Col
     return mCollisionMatrix[shape1Index][shape2Index];
 }
 
+// Return the narrow-phase algorithm type to use between two convex collision shapes
+/// This is the algorithm given by the types of the two shapes except for two boxes where the
+/// box vs box algorithm is used (if enabled) instead of the convex polyhedron vs convex polyhedron one
+NarrowPhaseAlgorithmType CollisionDispatch::selectNarrowPhaseAlgorithm(const CollisionShape* shape1, const CollisionShape* shape2) const {
+
+    const NarrowPhaseAlgorithmType algorithmType = selectNarrowPhaseAlgorithm(shape1->getType(), shape2->getType());
 
+    if (algorithmType == NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron && mIsBoxVsBoxAlgorithmEnabled &&
+        shape1->getName() == CollisionShapeName::BOX && shape2->getName() == CollisionShapeName::BOX) {
 
+        return NarrowPhaseAlgorithmType::BoxVsBox;
+    }
+
+    return algorithmType;
+}
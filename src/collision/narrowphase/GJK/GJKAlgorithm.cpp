@@ -28,6 +28,9 @@
 #include <reactphysics3d/constraint/ContactPoint.h>
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/collision/shapes/TriangleShape.h>
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/mathematics/DecimalW.h>
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/containers/Array.h>
@@ -38,201 +41,351 @@
 // We want to use the ReactPhysics3D namespace
 using namespace reactphysics3d;
 
+// Return true if the support points (without margin) of a shape are the corners of a box centered at the origin
+/// This is the case for the spheres (point), capsules (segment along the y axis) and boxes. The
+/// half-extents of the box are returned in the "extents" parameter.
+static bool getBoxLikeSupportExtents(const ConvexShape* shape, Vector3& extents) {
+
+    switch (shape->getName()) {
+        case CollisionShapeName::SPHERE:
+            extents.setToZero();
+            return true;
+        case CollisionShapeName::CAPSULE:
+            extents.setAllValues(0, static_cast<const CapsuleShape*>(shape)->getHeight() * decimal(0.5), 0);
+            return true;
+        case CollisionShapeName::BOX:
+            extents = static_cast<const BoxShape*>(shape)->getHalfExtents();
+            return true;
+        default:
+            return false;
+    }
+}
+
 // Compute a contact info if the two collision shapes collide.
-/// This method implements the Hybrid Technique for computing the penetration depth by
-/// running the GJK algorithm on original objects (without margin). If the shapes intersect
-/// only in the margins, the method compute the penetration depth and contact points
-/// (of enlarged objects). If the original objects (without margin) intersect, we
-/// call the computePenetrationDepthForEnlargedObjects() method that run the GJK
-/// algorithm on the enlarged object to obtain a simplex polytope that contains the
-/// origin, they we give that simplex polytope to the EPA algorithm which will compute
-/// the correct penetration depth and contact points between the enlarged objects.
+/// Before the GJK algorithm, the items of the batch are processed by groups of DecimalW::NB_LANES items
+/// to test with SIMD instructions if the two shapes are separated along their cached separating axis
+/// (see testCachedSeparatingAxes()). This is only an early-out: the GJK iterations are not vectorized
+/// and are still run one item at a time on the items that are not separated along their cached axis.
+/// Running the GJK iterations of several items in lockstep would not pay off because the reduction of
+/// the simplex (Voronoi regions), the degenerate cases and the handoff to EPA or SAT take a different
+/// branch for each item so that the lanes would quickly diverge.
 void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
                                  uint32 batchNbItems, Array<GJKResult>& gjkResults) {
 
     RP3D_PROFILE("GJKAlgorithm::testCollision()", mProfiler);
-    
-    // For each item in the batch
-    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
-
-        Vector3 suppA;             // Support point of object A
-        Vector3 suppB;             // Support point of object B
-        Vector3 w;                 // Support point of Minkowski difference A-B
-        Vector3 pA;                // Closest point of object A
-        Vector3 pB;                // Closest point of object B
-        decimal vDotw;
-        decimal prevDistSquare;
-        bool contactFound = false;
-
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->isConvex());
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->isConvex());
-
-        const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
-        const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
-
-        // Get the local-space to world-space transforms
-        const Transform& transform1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
-        const Transform& transform2 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
-
-        // Transform a point from local space of body 2 to local
-        // space of body 1 (the GJK algorithm is done in local space of body 1)
-        Transform transform1Inverse = transform1.getInverse();
-        Transform body2Tobody1 = transform1Inverse * transform2;
-
-        // Quaternion that transform a direction from local
-        // space of body 1 into local space of body 2
-        Quaternion rotateToBody2 = transform2.getOrientation().getInverse() * transform1.getOrientation();
-
-        // Initialize the margin (sum of margins of both objects)
-        decimal margin = shape1->getMargin() + shape2->getMargin();
-        decimal marginSquare = margin * margin;
-        assert(margin > decimal(0.0));
-
-        // Create a simplex set
-        VoronoiSimplex simplex;
-
-        // Get the last collision frame info
-        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
-
-        // Get the previous point V (last cached separating axis)
+
+    const uint32 batchEndIndex = batchStartIndex + batchNbItems;
+
+    // For each group of items in the batch
+    for (uint32 groupStartIndex = batchStartIndex; groupStartIndex < batchEndIndex; groupStartIndex += DecimalW::NB_LANES) {
+
+        const uint32 nbLanes = std::min(batchEndIndex - groupStartIndex, DecimalW::NB_LANES);
+
+        // Find the items of the group that are separated along their cached separating axis
+        const uint32 separatedMask = testCachedSeparatingAxes(narrowPhaseInfoBatch, groupStartIndex, nbLanes);
+
+        for (uint32 lane=0; lane < nbLanes; lane++) {
+
+            assert(gjkResults.size() == groupStartIndex + lane - batchStartIndex);
+
+            LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[groupStartIndex + lane];
+
+            if ((separatedMask & (1u << lane)) != 0) {
+                lastFrameCollisionInfo->gjkWasSeparatedAlongCachedAxis = true;
+                gjkResults.add(GJKResult::SEPARATED);
+            }
+            else {
+                lastFrameCollisionInfo->gjkWasSeparatedAlongCachedAxis = false;
+                gjkResults.add(testCollision(narrowPhaseInfoBatch, groupStartIndex + lane));
+            }
+        }
+    }
+}
+
+// Test with SIMD instructions if the two shapes of a group of items are separated along their cached axis
+/// The axis of an item is its cached separating axis of the previous frame or the direction between the
+/// origins of the two shapes if there is no cached axis. The shapes (with margins) are separated along an axis
+/// "v" if v.w > |v| * margin where "w" is the support point of the Minkowski difference A-B in
+/// direction -v. The support points of the spheres, capsules and boxes are computed in
+/// structure-of-arrays layout with SIMD instructions. The items that were colliding in the
+/// previous frame are skipped. This method returns a bit mask where the bit i is set if
+/// the shapes of the item (groupStartIndex + i) are separated.
+uint32 GJKAlgorithm::testCachedSeparatingAxes(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 groupStartIndex, uint32 nbLanes) {
+
+    assert(nbLanes <= DecimalW::NB_LANES);
+
+    Vector3Lanes axes;                  // Separating axes "v" (in local-space of shape 1)
+    Vector3Lanes axesShape2;            // Separating axes (in local-space of shape 2)
+    Vector3Lanes extents1;              // Extents of the box-like support points of shape 1
+    Vector3Lanes extents2;              // Extents of the box-like support points of shape 2
+    decimal offsets[DecimalW::NB_LANES];       // Dot products that do not depend on the box-like extents
+    decimal marginsLengths[DecimalW::NB_LANES];  // Margin times the length of the axis
+    uint32 activeMask = 0;
+
+    for (uint32 lane=0; lane < DecimalW::NB_LANES; lane++) {
+
+        axes.set(lane, Vector3::zero());
+        axesShape2.set(lane, Vector3::zero());
+        extents1.set(lane, Vector3::zero());
+        extents2.set(lane, Vector3::zero());
+        offsets[lane] = decimal(0.0);
+        marginsLengths[lane] = DECIMAL_LARGEST;
+
+        if (lane >= nbLanes) continue;
+
+        const uint32 batchIndex = groupStartIndex + lane;
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[batchIndex];
+
+        // The shapes that were colliding in the previous frame are most likely still colliding
+        if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasColliding) continue;
+
+        const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.collisionShapes1[batchIndex]);
+        const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.collisionShapes2[batchIndex]);
+
+        const Transform& shape1ToWorldTransform = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
+        const Transform& shape2ToWorldTransform = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
+        const Transform body2Tobody1 = shape1ToWorldTransform.getInverse() * shape2ToWorldTransform;
+        const Quaternion rotateToBody2 = shape2ToWorldTransform.getOrientation().getInverse() *
+                                         shape1ToWorldTransform.getOrientation();
+
+        // Get the previous separating axis or the direction from the origin of shape 2 to the origin of shape 1
         Vector3 v;
         if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK) {
             v = lastFrameCollisionInfo->gjkSeparatingAxis;
-            assert(v.lengthSquare() > decimal(0.000001));
         }
         else {
-            v.setAllValues(0, 1, 0);
+            v = -body2Tobody1.getPosition();
+        }
+        const decimal vLengthSquare = v.lengthSquare();
+        if (vLengthSquare < MACHINE_EPSILON) continue;
+
+        const Vector3 vShape2 = rotateToBody2 * v;
+
+        // The support point of shape 1 in direction -v and the support point of shape 2 in direction v
+        // are computed in the SIMD loop below for the box-like shapes and with a virtual call otherwise
+        decimal offset = -v.dot(body2Tobody1.getPosition());
+        Vector3 extents;
+        if (getBoxLikeSupportExtents(shape1, extents)) {
+            extents1.set(lane, extents);
+        }
+        else {
+            offset += v.dot(shape1->getLocalSupportPointWithoutMarginFromVertex(-v, lastFrameCollisionInfo->gjkSupportVertexIndex1));
+        }
+        if (getBoxLikeSupportExtents(shape2, extents)) {
+            extents2.set(lane, extents);
+        }
+        else {
+            offset -= vShape2.dot(shape2->getLocalSupportPointWithoutMarginFromVertex(vShape2, lastFrameCollisionInfo->gjkSupportVertexIndex2));
+        }
+
+        axes.set(lane, v);
+        axesShape2.set(lane, vShape2);
+        offsets[lane] = offset;
+        marginsLengths[lane] = (shape1->getMargin() + shape2->getMargin()) * std::sqrt(vLengthSquare);
+        activeMask |= (1u << lane);
+    }
+
+    if (activeMask == 0) return 0;
+
+    // Compute v.w = v.(suppA - suppB) for all the lanes where the support point of a box-like shape
+    // with extents "e" in direction "d" has the dot product |d.x| * e.x + |d.y| * e.y + |d.z| * e.z with "d"
+    const Vector3W v = axes.load();
+    const Vector3W vShape2 = axesShape2.load();
+    const Vector3W e1 = extents1.load();
+    const Vector3W e2 = extents2.load();
+    const DecimalW vDotSupport1 = max(v.x, -v.x) * e1.x + max(v.y, -v.y) * e1.y + max(v.z, -v.z) * e1.z;
+    const DecimalW vDotSupport2 = max(vShape2.x, -vShape2.x) * e2.x + max(vShape2.y, -vShape2.y) * e2.y +
+                                  max(vShape2.z, -vShape2.z) * e2.z;
+    const DecimalW vDotw = DecimalW::load(offsets) - vDotSupport1 - vDotSupport2;
+
+    // The shapes are separated if v.w > |v| * margin (the comparisons are false for NaN values)
+    const DecimalW marginLength = DecimalW::load(marginsLengths);
+    const uint32 separatedMask = lessOrEqualMask(marginLength, vDotw) & ~lessOrEqualMask(vDotw, marginLength) & activeMask;
+
+    // Cache the separating axis for frame coherence
+    for (uint32 lane=0; lane < nbLanes; lane++) {
+        if ((separatedMask & (1u << lane)) != 0) {
+            narrowPhaseInfoBatch.lastFrameCollisionInfos[groupStartIndex + lane]->gjkSeparatingAxis = axes.get(lane);
         }
+    }
+
+    return separatedMask;
+}
 
-        // Initialize the upper bound for the square distance
-        decimal distSquare = DECIMAL_LARGEST;
+// Compute a contact info if the two collision shapes collide.
+/// This method implements the Hybrid Technique for computing the penetration depth by
+/// running the GJK algorithm on original objects (without margin). If the shapes intersect
+/// only in the margins, the method compute the penetration depth and contact points
+/// (of enlarged objects). If the original objects (without margin) intersect, we
+/// call the computePenetrationDepthForEnlargedObjects() method that run the GJK
+/// algorithm on the enlarged object to obtain a simplex polytope that contains the
+/// origin, they we give that simplex polytope to the EPA algorithm which will compute
+/// the correct penetration depth and contact points between the enlarged objects.
+GJKAlgorithm::GJKResult GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) {
 
-        bool noIntersection = false;
 
-        do {
+    Vector3 suppA;             // Support point of object A
+    Vector3 suppB;             // Support point of object B
+    Vector3 w;                 // Support point of Minkowski difference A-B
+    Vector3 pA;                // Closest point of object A
+    Vector3 pB;                // Closest point of object B
+    decimal vDotw;
+    decimal prevDistSquare;
+    bool contactFound = false;
 
-            // Compute the support points for original objects (without margins) A and B
-            suppA = shape1->getLocalSupportPointWithoutMargin(-v);
-            suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMargin(rotateToBody2 * v);
+    assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->isConvex());
+    assert(narrowPhaseInfoBatch.collisionShapes2[batchIndex]->isConvex());
 
-            // Compute the support point for the Minkowski difference A-B
-            w = suppA - suppB;
+    const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.collisionShapes1[batchIndex]);
+    const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.collisionShapes2[batchIndex]);
 
-            vDotw = v.dot(w);
+    // Get the local-space to world-space transforms
+    const Transform& transform1 = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
+    const Transform& transform2 = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
 
-            // If the enlarge objects (with margins) do not intersect
-            if (vDotw > decimal(0.0) && vDotw * vDotw > distSquare * marginSquare) {
+    // Transform a point from local space of body 2 to local
+    // space of body 1 (the GJK algorithm is done in local space of body 1)
+    Transform transform1Inverse = transform1.getInverse();
+    Transform body2Tobody1 = transform1Inverse * transform2;
 
-                // Cache the current separating axis for frame coherence
-                lastFrameCollisionInfo->gjkSeparatingAxis = v;
+    // Quaternion that transform a direction from local
+    // space of body 1 into local space of body 2
+    Quaternion rotateToBody2 = transform2.getOrientation().getInverse() * transform1.getOrientation();
 
-                // No intersection, we return
-                assert(gjkResults.size() == batchIndex);
-                gjkResults.add(GJKResult::SEPARATED);
-                noIntersection = true;
-                break;
-            }
+    // Initialize the margin (sum of margins of both objects)
+    decimal margin = shape1->getMargin() + shape2->getMargin();
+    decimal marginSquare = margin * margin;
+    assert(margin > decimal(0.0));
 
-            // If the objects intersect only in the margins
-            if (simplex.isPointInSimplex(w) || distSquare - vDotw <= distSquare * REL_ERROR_SQUARE) {
+    // Create a simplex set
+    VoronoiSimplex simplex;
 
-                // Contact point has been found
-                contactFound = true;
-                break;
-            }
+    // Get the last collision frame info
+    LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[batchIndex];
 
-            // Add the new support point to the simplex
-            simplex.addPoint(w, suppA, suppB);
+    // Get the previous point V (last cached separating axis)
+    Vector3 v;
+    if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK) {
+        v = lastFrameCollisionInfo->gjkSeparatingAxis;
+        assert(v.lengthSquare() > decimal(0.000001));
+    }
+    else {
+        v.setAllValues(0, 1, 0);
+    }
 
-            // If the simplex is affinely dependent
-            if (simplex.isAffinelyDependent()) {
+    // Initialize the upper bound for the square distance
+    decimal distSquare = DECIMAL_LARGEST;
 
-                // Contact point has been found
-                contactFound = true;
-                break;
-            }
+    do {
 
-            // Compute the point of the simplex closest to the origin
-            // If the computation of the closest point fails
-            if (!simplex.computeClosestPoint(v)) {
+        // Compute the support points for original objects (without margins) A and B (starting
+        // from the support vertices of the previous iteration or of the previous frame)
+        suppA = shape1->getLocalSupportPointWithoutMarginFromVertex(-v, lastFrameCollisionInfo->gjkSupportVertexIndex1);
+        suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMarginFromVertex(rotateToBody2 * v,
+                                                                                  lastFrameCollisionInfo->gjkSupportVertexIndex2);
 
-                // Contact point has been found
-                contactFound = true;
-                break;
-            }
+        // Compute the support point for the Minkowski difference A-B
+        w = suppA - suppB;
 
-            // Store and update the squared distance of the closest point
-            prevDistSquare = distSquare;
-            distSquare = v.lengthSquare();
+        vDotw = v.dot(w);
 
-            // If the distance to the closest point doesn't improve a lot
-            if (prevDistSquare - distSquare <= MACHINE_EPSILON * prevDistSquare) {
+        // If the enlarge objects (with margins) do not intersect
+        if (vDotw > decimal(0.0) && vDotw * vDotw > distSquare * marginSquare) {
 
-                simplex.backupClosestPointInSimplex(v);
+            // Cache the current separating axis for frame coherence
+            lastFrameCollisionInfo->gjkSeparatingAxis = v;
 
-                // Get the new squared distance
-                distSquare = v.lengthSquare();
+            // No intersection, we return
+            return GJKResult::SEPARATED;
+        }
 
-                // Contact point has been found
-                contactFound = true;
-                break;
-            }
+        // If the objects intersect only in the margins
+        if (simplex.isPointInSimplex(w) || distSquare - vDotw <= distSquare * REL_ERROR_SQUARE) {
 
-        } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint());
+            // Contact point has been found
+            contactFound = true;
+            break;
+        }
+
+        // Add the new support point to the simplex
+        simplex.addPoint(w, suppA, suppB);
+
+        // If the simplex is affinely dependent
+        if (simplex.isAffinelyDependent()) {
 
-        if (noIntersection) {
-            continue;
+            // Contact point has been found
+            contactFound = true;
+            break;
         }
 
-        if (contactFound && distSquare > MACHINE_EPSILON) {
+        // Compute the point of the simplex closest to the origin
+        // If the computation of the closest point fails
+        if (!simplex.computeClosestPoint(v)) {
 
-            // Compute the closet points of both objects (without the margins)
-            simplex.computeClosestPointsOfAandB(pA, pB);
+            // Contact point has been found
+            contactFound = true;
+            break;
+        }
 
-            // Project those two points on the margins to have the closest points of both
-            // object with the margins
-            decimal dist = std::sqrt(distSquare);
-            assert(dist > decimal(0.0));
+        // Store and update the squared distance of the closest point
+        prevDistSquare = distSquare;
+        distSquare = v.lengthSquare();
 
-            pA = (pA - (shape1->getMargin() / dist) * v);
-            pB = body2Tobody1.getInverse() * (pB + (shape2->getMargin() / dist) * v);
+        // If the distance to the closest point doesn't improve a lot
+        if (prevDistSquare - distSquare <= MACHINE_EPSILON * prevDistSquare) {
 
-            // Compute the contact info
-            Vector3 normal = transform1.getOrientation() * (-v.getUnit());
-            decimal penetrationDepth = margin - dist;
+            simplex.backupClosestPointInSimplex(v);
 
-            // If the penetration depth is negative (due too numerical errors), there is no contact
-            if (penetrationDepth <= decimal(0.0)) {
-                assert(gjkResults.size() == batchIndex);
-                gjkResults.add(GJKResult::SEPARATED);
-                continue;
-            }
+            // Get the new squared distance
+            distSquare = v.lengthSquare();
 
-            // Do not generate a contact point with zero normal length
-            if (normal.lengthSquare() < MACHINE_EPSILON) {
-                assert(gjkResults.size() == batchIndex);
-                gjkResults.add(GJKResult::SEPARATED);
-                continue;
-            }
+            // Contact point has been found
+            contactFound = true;
+            break;
+        }
 
-            // If we need to report contacts
-            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+    } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint());
 
-                // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-                TriangleShape::computeSmoothTriangleMeshContact(shape1, shape2, pA, pB, transform1, transform2,
-                                                                penetrationDepth, normal);
+    if (contactFound && distSquare > MACHINE_EPSILON) {
 
-                // Add a new contact point
-                narrowPhaseInfoBatch.addContactPoint(batchIndex, normal, penetrationDepth, pA, pB);
-            }
+        // Compute the closet points of both objects (without the margins)
+        simplex.computeClosestPointsOfAandB(pA, pB);
+
+        // Project those two points on the margins to have the closest points of both
+        // object with the margins
+        decimal dist = std::sqrt(distSquare);
+        assert(dist > decimal(0.0));
+
+        pA = (pA - (shape1->getMargin() / dist) * v);
+        pB = body2Tobody1.getInverse() * (pB + (shape2->getMargin() / dist) * v);
+
+        // Compute the contact info
+        Vector3 normal = transform1.getOrientation() * (-v.getUnit());
+        decimal penetrationDepth = margin - dist;
+
+        // If the penetration depth is negative (due too numerical errors), there is no contact
+        if (penetrationDepth <= decimal(0.0)) {
+            return GJKResult::SEPARATED;
+        }
+
+        // Do not generate a contact point with zero normal length
+        if (normal.lengthSquare() < MACHINE_EPSILON) {
+            return GJKResult::SEPARATED;
+        }
 
-            assert(gjkResults.size() == batchIndex);
-            gjkResults.add(GJKResult::COLLIDE_IN_MARGIN);
+        // If we need to report contacts
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
-            continue;
+            // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
+            TriangleShape::computeSmoothTriangleMeshContact(shape1, shape2, pA, pB, transform1, transform2,
+                                                            penetrationDepth, normal);
+
+            // Add a new contact point
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normal, penetrationDepth, pA, pB);
         }
 
-        assert(gjkResults.size() == batchIndex);
-        gjkResults.add(GJKResult::INTERPENETRATE);
+        return GJKResult::COLLIDE_IN_MARGIN;
     }
+
+    return GJKResult::INTERPENETRATE;
 }
@@ -37,7 +37,12 @@ const size_t NarrowPhaseInfoBatch::mTriangleShapeAllocatedSize = std::ceil(sizeo
 
 // Constructor
 NarrowPhaseInfoBatch::NarrowPhaseInfoBatch(OverlappingPairs& overlappingPairs, MemoryAllocator& allocator)
-                     : mMemoryAllocator(allocator), mOverlappingPairs(overlappingPairs), narrowPhaseInfos(allocator){
+                     : mMemoryAllocator(allocator), mOverlappingPairs(overlappingPairs), mNbReservedContactPoints(0),
+                       overlappingPairIds(allocator), colliderEntities1(allocator), colliderEntities2(allocator),
+                       lastFrameCollisionInfos(allocator), collisionShapeAllocators(allocator), shape1ToWorldTransforms(allocator),
+                       shape2ToWorldTransforms(allocator), collisionShapes1(allocator), collisionShapes2(allocator),
+                       reportContacts(allocator), isColliding(allocator), nbContactPoints(allocator),
+                       contactPointsIndices(allocator), contactPoints(allocator) {
 
 }
 
@@ -49,28 +54,65 @@ NarrowPhaseInfoBatch::~NarrowPhaseInfoBatch() {
 // Initialize the containers using cached capacity
 void NarrowPhaseInfoBatch::reserveMemory() {
 
-    narrowPhaseInfos.reserve(mCachedCapacity);
+    overlappingPairIds.reserve(mCachedCapacity);
+    colliderEntities1.reserve(mCachedCapacity);
+    colliderEntities2.reserve(mCachedCapacity);
+    lastFrameCollisionInfos.reserve(mCachedCapacity);
+    collisionShapeAllocators.reserve(mCachedCapacity);
+    shape1ToWorldTransforms.reserve(mCachedCapacity);
+    shape2ToWorldTransforms.reserve(mCachedCapacity);
+    collisionShapes1.reserve(mCachedCapacity);
+    collisionShapes2.reserve(mCachedCapacity);
+    reportContacts.reserve(mCachedCapacity);
+    isColliding.reserve(mCachedCapacity);
+    nbContactPoints.reserve(mCachedCapacity);
+    contactPointsIndices.reserve(mCachedCapacity);
+}
+
+// Allocate the output buffer of contact points before the narrow-phase tests
+/**
+ * The buffer is large enough for all the tests of the batch to generate contacts. However, its
+ * memory is not initialized and only the blocks reserved by the colliding tests are written.
+ * This method must be called before the narrow-phase tests because the blocks might be reserved
+ * concurrently by several threads and the buffer cannot grow at this point.
+ */
+void NarrowPhaseInfoBatch::allocateContactPoints() {
+
+    const uint64 nbRequiredContactPoints = static_cast<uint64>(getNbObjects()) * NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO;
+    if (contactPoints.size() < nbRequiredContactPoints) {
+        contactPoints.addWithoutInit(nbRequiredContactPoints - contactPoints.size());
+    }
+}
+
+// Reserve a block of contact points in the output buffer for a given test
+void NarrowPhaseInfoBatch::reserveContactPointsBlock(uint32 index) {
+
+    assert(contactPointsIndices[index] == INVALID_INDEX);
+
+    contactPointsIndices[index] = mNbReservedContactPoints.fetch_add(NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO, std::memory_order_relaxed);
+
+    assert(contactPointsIndices[index] + NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO <= contactPoints.size());
 }
 
 // Clear all the objects in the batch
 void NarrowPhaseInfoBatch::clear() {
 
-    const uint32 nbNarrowPhaseInfos = static_cast<uint32>(narrowPhaseInfos.size());
+    const uint32 nbNarrowPhaseInfos = getNbObjects();
     for (uint32 i=0; i < nbNarrowPhaseInfos; i++) {
 
-        assert(narrowPhaseInfos[i].nbContactPoints == 0);
+        assert(nbContactPoints[i] == 0);
 
         // TODO OPTI : Better manage this
 
         // Release the memory of the TriangleShape (this memory was allocated in the
         // MiddlePhaseTriangleCallback::testTriangle() method)
-        if (narrowPhaseInfos[i].collisionShape1->getName() == CollisionShapeName::TRIANGLE) {
-            narrowPhaseInfos[i].collisionShape1->~CollisionShape();
-            narrowPhaseInfos[i].collisionShapeAllocator->release(narrowPhaseInfos[i].collisionShape1, mTriangleShapeAllocatedSize);
+        if (collisionShapes1[i]->getName() == CollisionShapeName::TRIANGLE) {
+            collisionShapes1[i]->~CollisionShape();
+            collisionShapeAllocators[i]->release(collisionShapes1[i], mTriangleShapeAllocatedSize);
         }
-        if (narrowPhaseInfos[i].collisionShape2->getName() == CollisionShapeName::TRIANGLE) {
-            narrowPhaseInfos[i].collisionShape2->~CollisionShape();
-            narrowPhaseInfos[i].collisionShapeAllocator->release(narrowPhaseInfos[i].collisionShape2, mTriangleShapeAllocatedSize);
+        if (collisionShapes2[i]->getName() == CollisionShapeName::TRIANGLE) {
+            collisionShapes2[i]->~CollisionShape();
+            collisionShapeAllocators[i]->release(collisionShapes2[i], mTriangleShapeAllocatedSize);
         }
     }
 
@@ -79,7 +121,22 @@ void NarrowPhaseInfoBatch::clear() {
     // allocated in the next frame at a possibly different location in memory (remember that the
     // location of the allocated memory of a single frame allocator might change between two frames)
 
-    mCachedCapacity = static_cast<uint32>(narrowPhaseInfos.capacity());
-
-    narrowPhaseInfos.clear(true);
+    mCachedCapacity = static_cast<uint32>(overlappingPairIds.capacity());
+
+    overlappingPairIds.clear(true);
+    colliderEntities1.clear(true);
+    colliderEntities2.clear(true);
+    lastFrameCollisionInfos.clear(true);
+    collisionShapeAllocators.clear(true);
+    shape1ToWorldTransforms.clear(true);
+    shape2ToWorldTransforms.clear(true);
+    collisionShapes1.clear(true);
+    collisionShapes2.clear(true);
+    reportContacts.clear(true);
+    isColliding.clear(true);
+    nbContactPoints.clear(true);
+    contactPointsIndices.clear(true);
+    contactPoints.clear(true);
+
+    mNbReservedContactPoints.store(0, std::memory_order_relaxed);
 }
@@ -33,7 +33,7 @@ NarrowPhaseInput::NarrowPhaseInput(MemoryAllocator& allocator, OverlappingPairs&
     :mSphereVsSphereBatch(overlappingPairs, allocator), mSphereVsCapsuleBatch(overlappingPairs, allocator),
      mCapsuleVsCapsuleBatch(overlappingPairs, allocator), mSphereVsConvexPolyhedronBatch(overlappingPairs, allocator),
      mCapsuleVsConvexPolyhedronBatch(overlappingPairs, allocator),
-     mConvexPolyhedronVsConvexPolyhedronBatch(overlappingPairs, allocator) {
+     mConvexPolyhedronVsConvexPolyhedronBatch(overlappingPairs, allocator), mBoxVsBoxBatch(overlappingPairs, allocator) {
 
 }
 
@@ -46,6 +46,19 @@ void NarrowPhaseInput::reserveMemory() {
     mSphereVsConvexPolyhedronBatch.reserveMemory();
     mCapsuleVsConvexPolyhedronBatch.reserveMemory();
     mConvexPolyhedronVsConvexPolyhedronBatch.reserveMemory();
+    mBoxVsBoxBatch.reserveMemory();
+}
+
+// Allocate the output buffers of contact points of the batches before the narrow-phase tests
+void NarrowPhaseInput::allocateContactPoints() {
+
+    mSphereVsSphereBatch.allocateContactPoints();
+    mSphereVsCapsuleBatch.allocateContactPoints();
+    mCapsuleVsCapsuleBatch.allocateContactPoints();
+    mSphereVsConvexPolyhedronBatch.allocateContactPoints();
+    mCapsuleVsConvexPolyhedronBatch.allocateContactPoints();
+    mConvexPolyhedronVsConvexPolyhedronBatch.allocateContactPoints();
+    mBoxVsBoxBatch.allocateContactPoints();
 }
 
 // Clear
@@ -57,4 +70,5 @@ void NarrowPhaseInput::clear() {
     mSphereVsConvexPolyhedronBatch.clear();
     mCapsuleVsConvexPolyhedronBatch.clear();
     mConvexPolyhedronVsConvexPolyhedronBatch.clear();
+    mBoxVsBoxBatch.clear();
 }
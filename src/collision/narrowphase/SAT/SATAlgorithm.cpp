@@ -42,6 +42,8 @@ using namespace reactphysics3d;
 // Static variables initialization
 const decimal SATAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
 const decimal SATAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
+const decimal SATAlgorithm::TEMPORAL_COHERENCE_LINEAR_THRESHOLD = decimal(0.005);
+const decimal SATAlgorithm::TEMPORAL_COHERENCE_ANGULAR_THRESHOLD = decimal(0.01);
 
 // Constructor
 SATAlgorithm::SATAlgorithm(bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator)
@@ -63,19 +65,19 @@ bool SATAlgorithm::testCollisionSphereVsConvexPolyhedron(NarrowPhaseInfoBatch& n
 
     for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
 
-        bool isSphereShape1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::SPHERE;
+        bool isSphereShape1 = narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::SPHERE;
 
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::CONVEX_POLYHEDRON ||
-               narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::SPHERE ||
-               narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getType() == CollisionShapeType::SPHERE);
+        assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::CONVEX_POLYHEDRON ||
+               narrowPhaseInfoBatch.collisionShapes2[batchIndex]->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
+        assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::SPHERE ||
+               narrowPhaseInfoBatch.collisionShapes2[batchIndex]->getType() == CollisionShapeType::SPHERE);
 
         // Get the capsule collision shapes
-        const SphereShape* sphere = static_cast<const SphereShape*>(isSphereShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1 : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
-        const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(isSphereShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2 : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
+        const SphereShape* sphere = static_cast<const SphereShape*>(isSphereShape1 ? narrowPhaseInfoBatch.collisionShapes1[batchIndex] : narrowPhaseInfoBatch.collisionShapes2[batchIndex]);
+        const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(isSphereShape1 ? narrowPhaseInfoBatch.collisionShapes2[batchIndex] : narrowPhaseInfoBatch.collisionShapes1[batchIndex]);
 
-        const Transform& sphereToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
-        const Transform& polyhedronToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+        const Transform& sphereToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
+        const Transform& polyhedronToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
 
         // Get the transform from sphere local-space to polyhedron local-space
         const Transform worldToPolyhedronTransform = polyhedronToWorldTransform.getInverse();
@@ -114,7 +116,7 @@ bool SATAlgorithm::testCollisionSphereVsConvexPolyhedron(NarrowPhaseInfoBatch& n
         }
 
         // If we need to report contacts
-        if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
             const Vector3 minFaceNormal = polyhedron->getFaceNormal(minFaceIndex);
             Vector3 minFaceNormalWorld = polyhedronToWorldTransform.getOrientation() * minFaceNormal;
@@ -124,10 +126,10 @@ bool SATAlgorithm::testCollisionSphereVsConvexPolyhedron(NarrowPhaseInfoBatch& n
             Vector3 normalWorld = isSphereShape1 ? -minFaceNormalWorld : minFaceNormalWorld;
 
             // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-            TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2,
+            TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.collisionShapes1[batchIndex], narrowPhaseInfoBatch.collisionShapes2[batchIndex],
                                                             isSphereShape1 ? contactPointSphereLocal : contactPointPolyhedronLocal,
                                                             isSphereShape1 ? contactPointPolyhedronLocal : contactPointSphereLocal,
-                                                            narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform,
+                                                            narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex], narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex],
                                                             minPenetrationDepth, normalWorld);
 
             // Create the contact info object
@@ -136,7 +138,7 @@ bool SATAlgorithm::testCollisionSphereVsConvexPolyhedron(NarrowPhaseInfoBatch& n
                                              isSphereShape1 ? contactPointPolyhedronLocal : contactPointSphereLocal);
         }
 
-        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
         isCollisionFound = true;
     }
 
@@ -166,19 +168,19 @@ bool SATAlgorithm::testCollisionCapsuleVsConvexPolyhedron(NarrowPhaseInfoBatch&
 
     RP3D_PROFILE("SATAlgorithm::testCollisionCapsuleVsConvexPolyhedron()", mProfiler);
 
-    bool isCapsuleShape1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::CAPSULE;
+    bool isCapsuleShape1 = narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::CAPSULE;
 
-    assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::CONVEX_POLYHEDRON ||
-           narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
-    assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::CAPSULE ||
-           narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getType() == CollisionShapeType::CAPSULE);
+    assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::CONVEX_POLYHEDRON ||
+           narrowPhaseInfoBatch.collisionShapes2[batchIndex]->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
+    assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::CAPSULE ||
+           narrowPhaseInfoBatch.collisionShapes2[batchIndex]->getType() == CollisionShapeType::CAPSULE);
 
     // Get the collision shapes
-    const CapsuleShape* capsuleShape = static_cast<const CapsuleShape*>(isCapsuleShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1 : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
-    const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(isCapsuleShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2 : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
+    const CapsuleShape* capsuleShape = static_cast<const CapsuleShape*>(isCapsuleShape1 ? narrowPhaseInfoBatch.collisionShapes1[batchIndex] : narrowPhaseInfoBatch.collisionShapes2[batchIndex]);
+    const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(isCapsuleShape1 ? narrowPhaseInfoBatch.collisionShapes2[batchIndex] : narrowPhaseInfoBatch.collisionShapes1[batchIndex]);
 
-    const Transform capsuleToWorld = isCapsuleShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
-    const Transform polyhedronToWorld = isCapsuleShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform : narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+    const Transform capsuleToWorld = isCapsuleShape1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
+    const Transform polyhedronToWorld = isCapsuleShape1 ? narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
 
     const Transform polyhedronToCapsuleTransform = capsuleToWorld.getInverse() * polyhedronToWorld;
 
@@ -278,7 +280,7 @@ bool SATAlgorithm::testCollisionCapsuleVsConvexPolyhedron(NarrowPhaseInfoBatch&
     if (isMinPenetrationFaceNormal) {
 
         // If we need to report contacts
-        if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
             return computeCapsulePolyhedronFaceContactPoints(minFaceIndex, capsuleRadius, polyhedron, minPenetrationDepth,
                                                       polyhedronToCapsuleTransform, normalWorld, separatingAxisCapsuleSpace,
@@ -289,7 +291,7 @@ bool SATAlgorithm::testCollisionCapsuleVsConvexPolyhedron(NarrowPhaseInfoBatch&
     else {   // The separating axis is the cross product of a polyhedron edge and the inner capsule segment
 
         // If we need to report contacts
-        if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
             // Compute the closest points between the inner capsule segment and the
             // edge of the polyhedron in polyhedron local-space
@@ -302,10 +304,10 @@ bool SATAlgorithm::testCollisionCapsuleVsConvexPolyhedron(NarrowPhaseInfoBatch&
             Vector3 contactPointCapsule = (polyhedronToCapsuleTransform * closestPointCapsuleInnerSegment) - separatingAxisCapsuleSpace * capsuleRadius;
 
             // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-            TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2,
+            TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.collisionShapes1[batchIndex], narrowPhaseInfoBatch.collisionShapes2[batchIndex],
                                                         isCapsuleShape1 ? contactPointCapsule : closestPointPolyhedronEdge,
                                                         isCapsuleShape1 ? closestPointPolyhedronEdge : contactPointCapsule,
-                                                        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform,
+                                                        narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex], narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex],
                                                         minPenetrationDepth, normalWorld);
 
             // Create the contact point
@@ -452,10 +454,10 @@ bool SATAlgorithm::computeCapsulePolyhedronFaceContactPoints(uint32 referenceFac
 
 
             // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-            TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2,
+            TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.collisionShapes1[batchIndex], narrowPhaseInfoBatch.collisionShapes2[batchIndex],
                                                         isCapsuleShape1 ? contactPointCapsule : contactPointPolyhedron,
                                                         isCapsuleShape1 ? contactPointPolyhedron : contactPointCapsule,
-                                                        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform,
+                                                        narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex], narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex],
                                                         penetrationDepth, normalWorld);
 
 
@@ -490,14 +492,14 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
     for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
 
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
-        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].nbContactPoints == 0);
+        assert(narrowPhaseInfoBatch.collisionShapes1[batchIndex]->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
+        assert(narrowPhaseInfoBatch.collisionShapes2[batchIndex]->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
+        assert(narrowPhaseInfoBatch.nbContactPoints[batchIndex] == 0);
 
-        const ConvexPolyhedronShape* polyhedron1 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
-        const ConvexPolyhedronShape* polyhedron2 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
+        const ConvexPolyhedronShape* polyhedron1 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.collisionShapes1[batchIndex]);
+        const ConvexPolyhedronShape* polyhedron2 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.collisionShapes2[batchIndex]);
 
-        const Transform polyhedron1ToPolyhedron2 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform.getInverse() * narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+        const Transform polyhedron1ToPolyhedron2 = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getInverse() * narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
         const Transform polyhedron2ToPolyhedron1 = polyhedron1ToPolyhedron2.getInverse();
 
         decimal minPenetrationDepth = DECIMAL_LARGEST;
@@ -511,7 +513,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
         Vector3 minEdgeVsEdgeSeparatingAxisPolyhedron2Space;
         const bool isShape1Triangle = polyhedron1->getName() == CollisionShapeName::TRIANGLE;
 
-        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[batchIndex];
 
         // If the last frame collision info is valid and was also using SAT algorithm
         if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingSAT) {
@@ -520,10 +522,27 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             // axis. If it is the case, we directly report the collision without executing the whole SAT algorithm again. If
             // the shapes are still separated along this axis, we directly exit with no collision.
 
+            // If the shapes were colliding and have almost not moved relative to each other since the contact features (incident
+            // face or edges) were computed (resting contact for instance), we reuse these features and only compute the contact
+            // points again (without the support point along the previous axis, the search of the incident face or the
+            // Minkowski face test)
+            const bool reuseContactFeatures = lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding &&
+                                              isRelativeMotionBelowCoherenceThreshold(lastFrameCollisionInfo, polyhedron1ToPolyhedron2);
+
             // If the previous separating axis (or axis with minimum penetration depth)
             // was a face normal of polyhedron 1
             if (lastFrameCollisionInfo->satIsAxisFacePolyhedron1) {
 
+                // Clip the previous incident face with the previous reference face
+                if (reuseContactFeatures && computePolyhedronVsPolyhedronFaceContactPoints(true, polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
+                                                                                           polyhedron2ToPolyhedron1, lastFrameCollisionInfo->satMinAxisFaceIndex,
+                                                                                           lastFrameCollisionInfo, true, narrowPhaseInfoBatch, batchIndex)) {
+
+                    narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+                    isCollisionFound = true;
+                    continue;
+                }
+
                 const decimal penetrationDepth = testSingleFaceDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
                                                      lastFrameCollisionInfo->satMinAxisFaceIndex);
 
@@ -545,7 +564,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                     // Compute the contact points between two faces of two convex polyhedra.
                     if(computePolyhedronVsPolyhedronFaceContactPoints(isMinPenetrationFaceNormalPolyhedron1, polyhedron1, polyhedron2,
                                               polyhedron1ToPolyhedron2, polyhedron2ToPolyhedron1, minFaceIndex,
-                                              narrowPhaseInfoBatch, batchIndex)) {
+                                              lastFrameCollisionInfo, false, narrowPhaseInfoBatch, batchIndex)) {
 
                         lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = isMinPenetrationFaceNormalPolyhedron1;
                         lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = !isMinPenetrationFaceNormalPolyhedron1;
@@ -553,7 +572,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
                         // The shapes are still overlapping in the previous axis (the contact manifold is not empty).
                         // Therefore, we can return without running the whole SAT algorithm
-                        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+                        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
                         isCollisionFound = true;
                         continue;
                     }
@@ -564,6 +583,16 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             else if (lastFrameCollisionInfo->satIsAxisFacePolyhedron2) { // If the previous separating axis (or axis with minimum penetration depth)
                                        // was a face normal of polyhedron 2
 
+                // Clip the previous incident face with the previous reference face
+                if (reuseContactFeatures && computePolyhedronVsPolyhedronFaceContactPoints(false, polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
+                                                                                           polyhedron2ToPolyhedron1, lastFrameCollisionInfo->satMinAxisFaceIndex,
+                                                                                           lastFrameCollisionInfo, true, narrowPhaseInfoBatch, batchIndex)) {
+
+                    narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+                    isCollisionFound = true;
+                    continue;
+                }
+
                 decimal penetrationDepth = testSingleFaceDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1,
                                                      lastFrameCollisionInfo->satMinAxisFaceIndex);
 
@@ -585,7 +614,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                     // Compute the contact points between two faces of two convex polyhedra.
                     if(computePolyhedronVsPolyhedronFaceContactPoints(isMinPenetrationFaceNormalPolyhedron1, polyhedron1, polyhedron2,
                                               polyhedron1ToPolyhedron2, polyhedron2ToPolyhedron1, minFaceIndex,
-                                              narrowPhaseInfoBatch, batchIndex)) {
+                                              lastFrameCollisionInfo, false, narrowPhaseInfoBatch, batchIndex)) {
 
                         lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = isMinPenetrationFaceNormalPolyhedron1;
                         lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = !isMinPenetrationFaceNormalPolyhedron1;
@@ -593,7 +622,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
                         // The shapes are still overlapping in the previous axis (the contact manifold is not empty).
                         // Therefore, we can return without running the whole SAT algorithm
-                        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+                        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
                         isCollisionFound = true;
                         continue;
                     }
@@ -614,8 +643,9 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                 const Vector3 edge2Direction = edge2B - edge2A;
 
                 // If the two edges build a minkowski face (and the cross product is
-                // therefore a candidate for separating axis
-                if (testEdgesBuildMinkowskiFace(polyhedron1, edge1, polyhedron2, edge2, polyhedron1ToPolyhedron2)) {
+                // therefore a candidate for separating axis). This is not tested again
+                // if the edges are reused for a resting contact.
+                if (reuseContactFeatures || testEdgesBuildMinkowskiFace(polyhedron1, edge1, polyhedron2, edge2, polyhedron1ToPolyhedron2)) {
 
                     Vector3 separatingAxisPolyhedron2Space;
 
@@ -655,18 +685,18 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                         if (t1 >= decimal(0.0) && t1 <= decimal(1) && t2 >= decimal(0.0) && t2 <= decimal(1.0)) {
 
                             // If we need to report contact points
-                            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+                            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
                                 // Compute the contact point on polyhedron 1 edge in the local-space of polyhedron 1
                                 Vector3 closestPointPolyhedron1EdgeLocalSpace = polyhedron2ToPolyhedron1 * closestPointPolyhedron1Edge;
 
                                 // Compute the world normal
-                                Vector3 normalWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform.getOrientation() * separatingAxisPolyhedron2Space;
+                                Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * separatingAxisPolyhedron2Space;
 
                                 // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-                                TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2,
+                                TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.collisionShapes1[batchIndex], narrowPhaseInfoBatch.collisionShapes2[batchIndex],
                                 closestPointPolyhedron1EdgeLocalSpace, closestPointPolyhedron2Edge,
-                                narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform,
+                                narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex], narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex],
                                 penetrationDepth, normalWorld);
 
                                 // Create the contact point
@@ -675,9 +705,14 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
                             }
 
+                            // The edges are the contact features for this relative transform
+                            if (!reuseContactFeatures) {
+                                lastFrameCollisionInfo->satFeaturesRelativeTransform = polyhedron1ToPolyhedron2;
+                            }
+
                             // The shapes are overlapping on the previous axis (the contact manifold is not empty). Therefore
                             // we return without running the whole SAT algorithm
-                            narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+                            narrowPhaseInfoBatch.isColliding[batchIndex] = true;
                             isCollisionFound = true;
                             continue;
                         }
@@ -830,7 +865,8 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             // Compute the contact points between two faces of two convex polyhedra.
             bool contactsFound = computePolyhedronVsPolyhedronFaceContactPoints(isMinPenetrationFaceNormalPolyhedron1, polyhedron1,
                                                                                 polyhedron2, polyhedron1ToPolyhedron2, polyhedron2ToPolyhedron1,
-                                                                                minFaceIndex, narrowPhaseInfoBatch, batchIndex);
+                                                                                minFaceIndex, lastFrameCollisionInfo, false,
+                                                                                narrowPhaseInfoBatch, batchIndex);
 
             // There should be clipping points here. If it is not the case, it might be
             // because of a numerical issue
@@ -851,7 +887,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
         else {    // If we have an edge vs edge contact
 
             // If we need to report contacts
-            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
                 // Compute the closest points between the two edges (in the local-space of poylhedron 2)
                 Vector3 closestPointPolyhedron1Edge, closestPointPolyhedron2Edge;
@@ -862,12 +898,12 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                 Vector3 closestPointPolyhedron1EdgeLocalSpace = polyhedron2ToPolyhedron1 * closestPointPolyhedron1Edge;
 
                 // Compute the world normal
-                Vector3 normalWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform.getOrientation() * minEdgeVsEdgeSeparatingAxisPolyhedron2Space;
+                Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * minEdgeVsEdgeSeparatingAxisPolyhedron2Space;
 
                 // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-                TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2,
+                TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.collisionShapes1[batchIndex], narrowPhaseInfoBatch.collisionShapes2[batchIndex],
                                                                 closestPointPolyhedron1EdgeLocalSpace, closestPointPolyhedron2Edge,
-                                                                narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform,
+                                                                narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex], narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex],
                                                                 minPenetrationDepth, normalWorld);
 
                 // Create the contact point
@@ -879,9 +915,10 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = false;
             lastFrameCollisionInfo->satMinEdge1Index = minSeparatingEdge1Index;
             lastFrameCollisionInfo->satMinEdge2Index = minSeparatingEdge2Index;
+            lastFrameCollisionInfo->satFeaturesRelativeTransform = polyhedron1ToPolyhedron2;
         }
 
-        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
         isCollisionFound = true;
     }
 
@@ -889,11 +926,15 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 }
 
 // Compute the contact points between two faces of two convex polyhedra.
+/// If "reuseIncidentFace" is true, the incident face of the last frame is clipped. Otherwise, the incident face
+/// is computed and stored in the last frame collision info with the current relative transform of the polyhedra.
 /// The method returns true if contact points have been found
 bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPenetrationFaceNormalPolyhedron1,
                                                                   const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
                                                                   const Transform& polyhedron1ToPolyhedron2, const Transform& polyhedron2ToPolyhedron1,
-                                                                  uint32 minFaceIndex, NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const {
+                                                                  uint32 minFaceIndex, LastFrameCollisionInfo* lastFrameCollisionInfo,
+                                                                  bool reuseIncidentFace, NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                                                  uint32 batchIndex) const {
 
     RP3D_PROFILE("SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints", mProfiler);
 
@@ -915,14 +956,20 @@ bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPene
     const Vector3 axisIncidentSpace = referenceToIncidentTransform.getOrientation() * axisReferenceSpace;
 
     // Compute the world normal
-    const Vector3 normalWorld = isMinPenetrationFaceNormalPolyhedron1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform.getOrientation() * axisReferenceSpace :
-                                    -(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform.getOrientation() * axisReferenceSpace);
+    const Vector3 normalWorld = isMinPenetrationFaceNormalPolyhedron1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex].getOrientation() * axisReferenceSpace :
+                                    -(narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * axisReferenceSpace);
 
     // Get the reference face
     const HalfEdgeStructure::Face& referenceFace = referencePolyhedron->getFace(minFaceIndex);
 
     // Find the incident face on the other polyhedron (most anti-parallel face)
-    uint32 incidentFaceIndex = incidentPolyhedron->findMostAntiParallelFace(axisIncidentSpace);
+    uint32 incidentFaceIndex = lastFrameCollisionInfo->satIncidentFaceIndex;
+    if (!reuseIncidentFace) {
+        incidentFaceIndex = incidentPolyhedron->findMostAntiParallelFace(axisIncidentSpace);
+        lastFrameCollisionInfo->satIncidentFaceIndex = incidentFaceIndex;
+        lastFrameCollisionInfo->satFeaturesRelativeTransform = polyhedron1ToPolyhedron2;
+    }
+    assert(incidentFaceIndex < incidentPolyhedron->getNbFaces());
 
     // Get the incident face
     const HalfEdgeStructure::Face& incidentFace = incidentPolyhedron->getFace(incidentFaceIndex);
@@ -1007,7 +1054,7 @@ bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPene
             contactPointsFound = true;
 
             // If we need to report contacts
-            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
                 Vector3 outWorldNormal = normalWorld;
 
@@ -1018,10 +1065,10 @@ bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPene
                 Vector3 contactPointReferencePolyhedron = projectPointOntoPlane(clippedPolygonVertices[i], axisReferenceSpace, referenceFaceVertex);
 
                 // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
-                TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2,
+                TriangleShape::computeSmoothTriangleMeshContact(narrowPhaseInfoBatch.collisionShapes1[batchIndex], narrowPhaseInfoBatch.collisionShapes2[batchIndex],
                                         isMinPenetrationFaceNormalPolyhedron1 ? contactPointReferencePolyhedron : contactPointIncidentPolyhedron,
                                         isMinPenetrationFaceNormalPolyhedron1 ? contactPointIncidentPolyhedron : contactPointReferencePolyhedron,
-                                        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform, narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform,
+                                        narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex], narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex],
                                         penetrationDepth, outWorldNormal);
 
                 // Create a new contact point
@@ -1035,6 +1082,19 @@ bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPene
     return contactPointsFound;
 }
 
+// Return true if two polyhedra have almost not moved relative to each other since their contact features were computed
+/// The angle "a" between the two relative orientations is compared using 1 - cos(a/2) ~ a^2 / 8 for small angles
+bool SATAlgorithm::isRelativeMotionBelowCoherenceThreshold(const LastFrameCollisionInfo* lastFrameCollisionInfo,
+                                                           const Transform& polyhedron1ToPolyhedron2) const {
+
+    const Transform& featuresRelativeTransform = lastFrameCollisionInfo->satFeaturesRelativeTransform;
+
+    const decimal displacementSquare = (polyhedron1ToPolyhedron2.getPosition() - featuresRelativeTransform.getPosition()).lengthSquare();
+    if (displacementSquare > TEMPORAL_COHERENCE_LINEAR_THRESHOLD * TEMPORAL_COHERENCE_LINEAR_THRESHOLD) return false;
+
+    const decimal cosHalfAngle = std::abs(polyhedron1ToPolyhedron2.getOrientation().dot(featuresRelativeTransform.getOrientation()));
+    return decimal(1.0) - cosHalfAngle < TEMPORAL_COHERENCE_ANGULAR_THRESHOLD * TEMPORAL_COHERENCE_ANGULAR_THRESHOLD * decimal(0.125);
+}
 
 // Compute and return the distance between the two edges in the direction of the candidate separating axis
 decimal SATAlgorithm::computeDistanceBetweenEdges(const Vector3& edge1A, const Vector3& edge2A,
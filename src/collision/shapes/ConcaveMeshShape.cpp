@@ -143,23 +143,21 @@ void ConcaveMeshShape::computeOverlappingTriangles(const AABB& localAABB, Array<
     AABB aabb(localAABB);
     aabb.applyScale(Vector3(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z));
 
-    // Compute the nodes of the internal AABB tree that are overlapping with the AABB
-    Array<int> overlappingNodes(allocator, 64);
-    mTriangleMesh->reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
+    // Compute the triangles of the internal AABB tree that are overlapping with the AABB
+    Array<int> overlappingTriangles(allocator, 64);
+    mTriangleMesh->reportAllShapesOverlappingWithAABB(aabb, overlappingTriangles, allocator);
 
-    const uint32 nbOverlappingNodes = static_cast<uint32>(overlappingNodes.size());
+    const uint32 nbOverlappingTriangles = static_cast<uint32>(overlappingTriangles.size());
 
     // Add space in the array of triangles vertices/normals for the new triangles
-    triangleVertices.addWithoutInit(nbOverlappingNodes * 3);
-    triangleVerticesNormals.addWithoutInit(nbOverlappingNodes * 3);
+    triangleVertices.addWithoutInit(nbOverlappingTriangles * 3);
+    triangleVerticesNormals.addWithoutInit(nbOverlappingTriangles * 3);
 
-    // For each overlapping node
-    for (uint32 i=0; i < nbOverlappingNodes; i++) {
+    // For each overlapping triangle
+    for (uint32 i=0; i < nbOverlappingTriangles; i++) {
 
-        int nodeId = overlappingNodes[i];
-
-        // Get the node data (triangle index and mesh subpart index)
-        int32 data = mTriangleMesh->getDynamicAABBTreeNodeDataInt(nodeId);
+        // Get the triangle index
+        int32 data = overlappingTriangles[i];
 
         // Get the triangle vertices for this node from the concave mesh shape
         getTriangleVertices(data, triangleVertices[i * 3], triangleVertices[i * 3 + 1], triangleVertices[i * 3 + 2]);
@@ -186,7 +184,7 @@ bool ConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
     Ray scaledRay(ray.point1 * inverseScale, ray.point2 * inverseScale, ray.maxFraction);
 
     // Create the callback object that will compute ray casting against triangles
-    ConcaveMeshRaycastCallback raycastCallback(*this, collider, raycastInfo, scaledRay, mScale, allocator);
+    ConcaveMeshRaycastCallback raycastCallback(*this, collider, raycastInfo, mScale, allocator);
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -195,76 +193,67 @@ bool ConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
 
 #endif
 
-    // Ask the Dynamic AABB Tree to report all AABB nodes that are hit by the ray.
-    // The raycastCallback object will then compute ray casting against the triangles
-    // in the hit AABBs.
-    mTriangleMesh->raycast(scaledRay, raycastCallback);
-
-    raycastCallback.raycastTriangles();
+    // Ask the AABB tree of the mesh to report the triangles hit by the ray from front to back.
+    // The raycastCallback object computes the ray casting against each triangle and clips
+    // the ray at the closest hit so that the farther nodes of the tree are skipped.
+    mTriangleMesh->raycast(scaledRay, raycastCallback, allocator);
 
     return raycastCallback.getIsHit();
 }
 
-// Collect all the AABB nodes that are hit by the ray in the Dynamic AABB Tree
+// Raycast the triangle of a leaf hit by the ray in the AABB tree of the mesh
+/// The ray given in parameter is clipped at the closest hit found so far. Therefore, a triangle
+/// that is hit is always closer than the previous hit and the hit fraction is returned to clip
+/// the ray in the tree.
 decimal ConcaveMeshRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray) {
 
-    // Add the id of the hit AABB node into
-    mHitAABBNodes.add(nodeId);
-
-    return ray.maxFraction;
-}
+    // Get the triangle index
+    const int32 data = nodeId;
 
-// Raycast all collision shapes that have been collected
-void ConcaveMeshRaycastCallback::raycastTriangles() {
+    // Get the triangle vertices for this node from the concave mesh shape
+    Vector3 trianglePoints[3];
+    mConcaveMeshShape.getTriangleVertices(data, trianglePoints[0], trianglePoints[1], trianglePoints[2]);
 
-    Array<int>::Iterator it;
-    decimal smallestHitFraction = mRay.maxFraction;
+    // Get the vertices normals of the triangle
+    Vector3 verticesNormals[3];
+    mConcaveMeshShape.getTriangleVerticesNormals(data, verticesNormals[0], verticesNormals[1], verticesNormals[2]);
 
-    for (it = mHitAABBNodes.begin(); it != mHitAABBNodes.end(); ++it) {
-
-        // Get the node data (triangle index and mesh subpart index)
-        int32 data = mConcaveMeshShape.getDynamicAABBTreeNodeDataInt(*it);
-
-        // Get the triangle vertices for this node from the concave mesh shape
-        Vector3 trianglePoints[3];
-        mConcaveMeshShape.getTriangleVertices(data, trianglePoints[0], trianglePoints[1], trianglePoints[2]);
+    // Create a triangle collision shape
+    TriangleShape triangleShape(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data), mConcaveMeshShape.mTriangleHalfEdgeStructure, mAllocator);
+    triangleShape.setRaycastTestType(mConcaveMeshShape.getRaycastTestType());
 
-        // Get the vertices normals of the triangle
-        Vector3 verticesNormals[3];
-        mConcaveMeshShape.getTriangleVerticesNormals(data, verticesNormals[0], verticesNormals[1], verticesNormals[2]);
-
-        // Create a triangle collision shape
-        TriangleShape triangleShape(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data), mConcaveMeshShape.mTriangleHalfEdgeStructure, mAllocator);
-        triangleShape.setRaycastTestType(mConcaveMeshShape.getRaycastTestType());
-		
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 
-		// Set the profiler to the triangle shape
-		triangleShape.setProfiler(mProfiler);
+    // Set the profiler to the triangle shape
+    triangleShape.setProfiler(mProfiler);
 
 #endif
 
-        // Ray casting test against the collision shape
-        RaycastInfo raycastInfo;
-        bool isTriangleHit = triangleShape.raycast(mRay, raycastInfo, mCollider, mAllocator);
+    // Ray casting test against the collision shape
+    RaycastInfo raycastInfo;
+    bool isTriangleHit = triangleShape.raycast(ray, raycastInfo, mCollider, mAllocator);
+
+    // If the ray hit the collision shape
+    if (isTriangleHit) {
 
-        // If the ray hit the collision shape
-        if (isTriangleHit && raycastInfo.hitFraction <= smallestHitFraction) {
+        assert(raycastInfo.hitFraction >= decimal(0.0));
+        assert(raycastInfo.hitFraction <= ray.maxFraction);
 
-            assert(raycastInfo.hitFraction >= decimal(0.0));
+        mRaycastInfo.body = raycastInfo.body;
+        mRaycastInfo.collider = raycastInfo.collider;
+        mRaycastInfo.hitFraction = raycastInfo.hitFraction;
+        mRaycastInfo.worldPoint = raycastInfo.worldPoint * mMeshScale;
+        mRaycastInfo.worldNormal = raycastInfo.worldNormal;
+        mRaycastInfo.triangleIndex = data;
 
-            mRaycastInfo.body = raycastInfo.body;
-            mRaycastInfo.collider = raycastInfo.collider;
-            mRaycastInfo.hitFraction = raycastInfo.hitFraction;
-            mRaycastInfo.worldPoint = raycastInfo.worldPoint * mMeshScale;
-            mRaycastInfo.worldNormal = raycastInfo.worldNormal;
-            mRaycastInfo.triangleIndex = data;
+        mIsHit = true;
 
-            smallestHitFraction = raycastInfo.hitFraction;
-            mIsHit = true;
-        }
+        return raycastInfo.hitFraction;
     }
+
+    // Continue the raycast as if the triangle did not exist
+    return decimal(-1.0);
 }
 
 // Return the local bounds of the shape in x, y and z directions.
@@ -284,11 +273,6 @@ AABB ConcaveMeshShape::getLocalBounds() const {
     return aabb;
 }
 
-// Return the integer data of leaf node of the dynamic AABB tree
-int32 ConcaveMeshShape::getDynamicAABBTreeNodeDataInt(int32 nodeID) const {
-   return mTriangleMesh->getDynamicAABBTreeNodeDataInt(nodeID);
-}
-
 // Return the string representation of the shape
 std::string ConcaveMeshShape::to_string() const {
 
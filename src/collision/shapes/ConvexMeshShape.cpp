@@ -70,35 +70,52 @@ void ConvexMeshShape::computeScaledFacesNormals() {
 }
 
 // Return a local support point in a given direction without the object margin.
-/// If the edges information is not used for collision detection, this method will go through
-/// the whole vertices array and pick up the vertex with the largest dot product in the support
-/// direction. This is an O(n) process with "n" being the number of vertices in the mesh.
-/// However, if the edges information is used, we can cache the previous support vertex and use
-/// it as a start in a hill-climbing (local search) process to find the new support vertex which
-/// will be in most of the cases very close to the previous one. Using hill-climbing, this method
-/// runs in almost constant time.
+/// This method goes through the whole vertices array (using SIMD instructions) and picks up the
+/// vertex with the largest dot product in the support direction. This is an O(n) process with "n"
+/// being the number of vertices in the mesh. When a previous support vertex is available, the
+/// getLocalSupportPointWithoutMarginFromVertex() method is faster for the larger meshes.
 Vector3 ConvexMeshShape::getLocalSupportPointWithoutMargin(const Vector3& direction) const {
 
-    decimal maxDotProduct = DECIMAL_SMALLEST;
-    uint32 indexMaxDotProduct = 0;
+    // The support vertex of the scaled mesh is the vertex of the mesh with
+    // the largest dot product with the scaled direction
+    const Vector3 scaledDirection = direction * mScale;
+    const uint32 supportVertexIndex = mConvexMesh->computeSupportVertexBruteForce(scaledDirection);
 
-    // For each vertex of the mesh
-    for (uint32 i=0; i<mConvexMesh->getNbVertices(); i++) {
+    assert(scaledDirection.dot(mConvexMesh->getVertex(supportVertexIndex)) >= decimal(0.0));
 
-        // Compute the dot product of the current vertex
-        decimal dotProduct = direction.dot(mConvexMesh->getVertex(i));
+    // Return the vertex with the largest dot product in the support direction
+    return mConvexMesh->getVertex(supportVertexIndex) * mScale;
+}
 
-        // If the current dot product is larger than the maximum one
-        if (dotProduct > maxDotProduct) {
-            indexMaxDotProduct = i;
-            maxDotProduct = dotProduct;
-        }
+// Return a local support point in a given direction without the object margin starting
+// the search from the support vertex of a previous call
+/// For the larger meshes, the previous support vertex is used as a start in a hill-climbing (local
+/// search) process over the edges of the mesh. The new support vertex will be in most of the cases
+/// very close to the previous one and therefore this method runs in almost constant time. For the
+/// smaller meshes, testing all the vertices with SIMD instructions is faster.
+/**
+ * @param direction The support direction
+ * @param supportVertexIndex Index of the support vertex of a previous call (updated with the
+ *                           index of the new support vertex)
+ * @return The support point in the given direction
+ */
+Vector3 ConvexMeshShape::getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction, uint32& supportVertexIndex) const {
+
+    // The support vertex of the scaled mesh is the vertex of the mesh with
+    // the largest dot product with the scaled direction
+    const Vector3 scaledDirection = direction * mScale;
+
+    if (mConvexMesh->getNbVertices() < CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES) {
+        supportVertexIndex = mConvexMesh->computeSupportVertexBruteForce(scaledDirection);
+    }
+    else {
+        supportVertexIndex = mConvexMesh->computeSupportVertexHillClimbing(scaledDirection, supportVertexIndex);
     }
 
-    assert(maxDotProduct >= decimal(0.0));
+    assert(scaledDirection.dot(mConvexMesh->getVertex(supportVertexIndex)) >= decimal(0.0));
 
     // Return the vertex with the largest dot product in the support direction
-    return mConvexMesh->getVertex(indexMaxDotProduct) * mScale;
+    return mConvexMesh->getVertex(supportVertexIndex) * mScale;
 }
 
 // Raycast method with feedback information
@@ -54,3 +54,18 @@ Vector3 ConvexShape::getLocalSupportPointWithMargin(const Vector3& direction) co
 
     return supportPoint;
 }
+
+// Return a local support point in a given direction without the object margin starting
+// the search from the support vertex of a previous call
+/// By default, the support vertex index is not used. It is overridden by the shapes
+/// for which the support point can be computed faster when starting from a close vertex.
+/**
+ * @param direction The support direction
+ * @param supportVertexIndex Index of the support vertex of a previous call (updated with the
+ *                           index of the new support vertex)
+ * @return The support point in the given direction
+ */
+Vector3 ConvexShape::getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction,
+                                                                  uint32& /*supportVertexIndex*/) const {
+    return getLocalSupportPointWithoutMargin(direction);
+}
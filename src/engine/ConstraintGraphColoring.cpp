@@ -0,0 +1,126 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
+
+using namespace reactphysics3d;
+
+// Constructor
+ConstraintGraphColoring::ConstraintGraphColoring(MemoryAllocator& allocator)
+                        : mBodiesColorMasks(allocator), mConstraints(allocator), mConstraintsColors(allocator),
+                          mConstraintsBodies(allocator), mColoredConstraints(allocator), mColorsStartIndices(allocator) {
+
+}
+
+// Remove all the constraints and make sure the color masks can be used for a number of bodies
+/**
+ * @param nbBodies Number of rigid body components (body indices are in the range [0, nbBodies))
+ */
+void ConstraintGraphColoring::reset(uint32 nbBodies) {
+
+    mConstraints.clear();
+    mConstraintsColors.clear();
+    mConstraintsBodies.clear();
+    mColoredConstraints.clear();
+    mColorsStartIndices.clear();
+
+    // The color masks are always reset to zero after the coloring
+    mBodiesColorMasks.reserve(nbBodies);
+    while (mBodiesColorMasks.size() < nbBodies) {
+        mBodiesColorMasks.add(0);
+    }
+}
+
+// Add a constraint between two bodies and give it a color
+/// The constraint gets the first color that is not already used by one of its two bodies.
+/**
+ * @param constraintIndex Index of the constraint (returned by getColorConstraints())
+ * @param body1Index Rigid body component index of the first body (or NO_BODY for a static body)
+ * @param body2Index Rigid body component index of the second body (or NO_BODY for a static body)
+ */
+void ConstraintGraphColoring::addConstraint(uint32 constraintIndex, uint32 body1Index, uint32 body2Index) {
+
+    assert(body1Index == NO_BODY || body1Index < mBodiesColorMasks.size());
+    assert(body2Index == NO_BODY || body2Index < mBodiesColorMasks.size());
+
+    const uint32 usedColors = (body1Index != NO_BODY ? mBodiesColorMasks[body1Index] : 0) |
+                              (body2Index != NO_BODY ? mBodiesColorMasks[body2Index] : 0);
+
+    // Find the first color that is not used by the two bodies
+    uint32 color = 0;
+    while (color < NB_MAX_COLORS && (usedColors & (uint32(1) << color)) != 0) {
+        color++;
+    }
+
+    // If a color has been found, it cannot be used anymore by the two bodies
+    if (color < NB_MAX_COLORS) {
+        if (body1Index != NO_BODY) mBodiesColorMasks[body1Index] |= (uint32(1) << color);
+        if (body2Index != NO_BODY) mBodiesColorMasks[body2Index] |= (uint32(1) << color);
+    }
+
+    mConstraints.add(constraintIndex);
+    mConstraintsColors.add(color);
+    mConstraintsBodies.add(body1Index);
+    mConstraintsBodies.add(body2Index);
+}
+
+// Sort the added constraints by color
+/// The constraints of each color keep the order in which they have been added.
+void ConstraintGraphColoring::computeColors() {
+
+    const uint32 nbColors = getNbColors();
+    const uint32 nbConstraints = static_cast<uint32>(mConstraints.size());
+
+    // Count the number of constraints of each color
+    mColorsStartIndices.reserve(nbColors + 1);
+    for (uint32 c=0; c < nbColors + 1; c++) {
+        mColorsStartIndices.add(0);
+    }
+    for (uint32 i=0; i < nbConstraints; i++) {
+        mColorsStartIndices[mConstraintsColors[i] + 1]++;
+    }
+    for (uint32 c=0; c < nbColors; c++) {
+        mColorsStartIndices[c + 1] += mColorsStartIndices[c];
+    }
+
+    // Sort the constraints by color (the start indices are shifted here and restored below)
+    mColoredConstraints.addWithoutInit(nbConstraints);
+    for (uint32 i=0; i < nbConstraints; i++) {
+        mColoredConstraints[mColorsStartIndices[mConstraintsColors[i]]] = mConstraints[i];
+        mColorsStartIndices[mConstraintsColors[i]]++;
+    }
+    for (uint32 c=nbColors; c > 0; c--) {
+        mColorsStartIndices[c] = mColorsStartIndices[c - 1];
+    }
+    mColorsStartIndices[0] = 0;
+
+    // Reset the color masks of the bodies for the next coloring
+    for (uint32 i=0; i < mConstraintsBodies.size(); i++) {
+        if (mConstraintsBodies[i] != NO_BODY) {
+            mBodiesColorMasks[mConstraintsBodies[i]] = 0;
+        }
+    }
+}
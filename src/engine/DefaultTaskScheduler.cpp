@@ -0,0 +1,238 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <algorithm>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+namespace {
+
+    // Scheduler for which the current thread is executing a task (nullptr if none)
+    thread_local const DefaultTaskScheduler* tlsCurrentScheduler = nullptr;
+
+    // Index of the current thread in the scheduler that is running it
+    thread_local uint32 tlsCurrentThreadIndex = 0;
+}
+
+// Constructor
+/**
+ * @param allocator Memory allocator used to allocate the threads and queues
+ * @param nbThreads Total number of threads (including the thread calling parallelFor()).
+ *                  If zero, the number of hardware threads is used.
+ */
+DefaultTaskScheduler::DefaultTaskScheduler(MemoryAllocator& allocator, uint32 nbThreads)
+                     : mAllocator(allocator), mNbThreads(nbThreads), mWorkerThreads(allocator), mQueues(nullptr),
+                       mTask(nullptr), mNbItems(0), mBatchSize(1), mNbRemainingBatches(0), mTaskCounter(0),
+                       mIsQuitting(false) {
+
+    if (mNbThreads == 0) {
+        mNbThreads = std::thread::hardware_concurrency();
+    }
+    if (mNbThreads == 0) {
+        mNbThreads = 1;
+    }
+
+    // Create the work queues
+    mQueues = static_cast<WorkQueue*>(mAllocator.allocate(mNbThreads * sizeof(WorkQueue)));
+    for (uint32 i=0; i < mNbThreads; i++) {
+        new (mQueues + i) WorkQueue();
+    }
+
+    // Create the worker threads (the calling thread is the thread with index 0)
+    mWorkerThreads.reserve(mNbThreads - 1);
+    for (uint32 i=1; i < mNbThreads; i++) {
+        std::thread* thread = new (mAllocator.allocate(sizeof(std::thread))) std::thread(&DefaultTaskScheduler::workerMain, this, i);
+        mWorkerThreads.add(thread);
+    }
+}
+
+// Destructor
+DefaultTaskScheduler::~DefaultTaskScheduler() {
+
+    // Ask the worker threads to exit
+    {
+        std::lock_guard<std::mutex> lock(mWorkersMutex);
+        mIsQuitting = true;
+    }
+    mWorkersCondition.notify_all();
+
+    // Wait for the workers and destroy them
+    for (uint32 i=0; i < mWorkerThreads.size(); i++) {
+        mWorkerThreads[i]->join();
+        mWorkerThreads[i]->~thread();
+        mAllocator.release(mWorkerThreads[i], sizeof(std::thread));
+    }
+    mWorkerThreads.clear();
+
+    // Destroy the work queues
+    for (uint32 i=0; i < mNbThreads; i++) {
+        mQueues[i].~WorkQueue();
+    }
+    mAllocator.release(mQueues, mNbThreads * sizeof(WorkQueue));
+}
+
+// Execute the task over the items [0, nbItems) and return when all the items have been processed
+/**
+ * @param task The task to execute
+ * @param nbItems Number of items to process
+ * @param minBatchSize Minimum number of items in a batch
+ */
+void DefaultTaskScheduler::parallelFor(ParallelTask& task, uint32 nbItems, uint32 minBatchSize) {
+
+    if (nbItems == 0) return;
+
+    // If this is a nested call from inside a task of this scheduler, we run the nested task serially
+    if (tlsCurrentScheduler == this) {
+        task.execute(0, nbItems, tlsCurrentThreadIndex);
+        return;
+    }
+
+    // If there are no worker threads
+    if (mNbThreads == 1) {
+        task.execute(0, nbItems, 0);
+        return;
+    }
+
+    std::lock_guard<std::mutex> parallelForLock(mParallelForMutex);
+
+    // Compute the size of a batch. We use a few batches per thread so that the
+    // threads can steal work from each other if the items do not have the same cost
+    const uint32 nbBatchesPerThread = 4;
+    const uint32 nbTargetBatches = mNbThreads * nbBatchesPerThread;
+    uint32 batchSize = (nbItems + nbTargetBatches - 1) / nbTargetBatches;
+    if (batchSize < minBatchSize) batchSize = minBatchSize;
+    if (batchSize == 0) batchSize = 1;
+    const uint32 nbBatches = (nbItems + batchSize - 1) / batchSize;
+
+    mTask = &task;
+    mNbItems = nbItems;
+    mBatchSize = batchSize;
+    mNbRemainingBatches.store(nbBatches, std::memory_order_relaxed);
+
+    // Give a contiguous range of batches to each thread
+    for (uint32 i=0; i < mNbThreads; i++) {
+
+        std::lock_guard<std::mutex> lock(mQueues[i].mutex);
+        mQueues[i].frontBatchIndex = static_cast<uint32>((uint64(nbBatches) * i) / mNbThreads);
+        mQueues[i].endBatchIndex = static_cast<uint32>((uint64(nbBatches) * (i + 1)) / mNbThreads);
+    }
+
+    // Wake up the workers
+    {
+        std::lock_guard<std::mutex> lock(mWorkersMutex);
+        mTaskCounter++;
+    }
+    mWorkersCondition.notify_all();
+
+    // The calling thread also executes batches
+    tlsCurrentScheduler = this;
+    tlsCurrentThreadIndex = 0;
+    executeBatches(0);
+    tlsCurrentScheduler = nullptr;
+
+    // Wait until the batches that have been stolen by the workers are completed
+    while (mNbRemainingBatches.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+
+    mTask = nullptr;
+}
+
+// Main loop of a worker thread
+void DefaultTaskScheduler::workerMain(uint32 threadIndex) {
+
+    tlsCurrentScheduler = this;
+    tlsCurrentThreadIndex = threadIndex;
+
+    uint64 lastTaskCounter = 0;
+
+    while (true) {
+
+        // Wait until there is a new task or until we need to exit
+        {
+            std::unique_lock<std::mutex> lock(mWorkersMutex);
+            mWorkersCondition.wait(lock, [&] { return mIsQuitting || mTaskCounter != lastTaskCounter; });
+
+            if (mIsQuitting) return;
+
+            lastTaskCounter = mTaskCounter;
+        }
+
+        executeBatches(threadIndex);
+    }
+}
+
+// Execute the batches until there are no batches left in any queue
+void DefaultTaskScheduler::executeBatches(uint32 threadIndex) {
+
+    uint32 batchIndex;
+    while (getNextBatch(threadIndex, batchIndex)) {
+
+        const uint32 startIndex = batchIndex * mBatchSize;
+        const uint32 endIndex = std::min(startIndex + mBatchSize, mNbItems);
+
+        mTask->execute(startIndex, endIndex, threadIndex);
+
+        mNbRemainingBatches.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+// Pop a batch from the front of the queue of a thread or steal one from the back of another queue
+/**
+ * @param threadIndex Index of the thread that needs some work
+ * @param[out] batchIndex Index of the batch to process
+ * @return True if a batch has been found and false if all the queues are empty
+ */
+bool DefaultTaskScheduler::getNextBatch(uint32 threadIndex, uint32& batchIndex) {
+
+    // Take a batch from the front of our own queue
+    {
+        WorkQueue& queue = mQueues[threadIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.frontBatchIndex < queue.endBatchIndex) {
+            batchIndex = queue.frontBatchIndex;
+            queue.frontBatchIndex++;
+            return true;
+        }
+    }
+
+    // Steal a batch from the back of the queue of another thread
+    for (uint32 i=1; i < mNbThreads; i++) {
+
+        WorkQueue& queue = mQueues[(threadIndex + i) % mNbThreads];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.frontBatchIndex < queue.endBatchIndex) {
+            queue.endBatchIndex--;
+            batchIndex = queue.endBatchIndex;
+            return true;
+        }
+    }
+
+    return false;
+}
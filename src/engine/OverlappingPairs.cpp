@@ -416,7 +416,7 @@ uint64 OverlappingPairs::addPair(uint32 collider1Index, uint32 collider2Index, b
     if (isConvexVsConvex) {
 
         assert(!mMapConvexPairIdToPairIndex.containsKey(pairId));
-        NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1->getType(), collisionShape2->getType());
+        NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1, collisionShape2);
 
         // Map the entity with the new component lookup index
         mMapConvexPairIdToPairIndex.add(Pair<uint64, uint64>(pairId, mConvexPairs.size()));
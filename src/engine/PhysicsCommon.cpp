@@ -46,6 +46,7 @@ PhysicsCommon::PhysicsCommon(MemoryAllocator* baseMemoryAllocator)
                 mHeightFieldShapes(mMemoryManager.getHeapAllocator()), mConvexMeshes(mMemoryManager.getHeapAllocator()),
                 mTriangleMeshes(mMemoryManager.getHeapAllocator()), mHeightFields(mMemoryManager.getHeapAllocator()),
                 mProfilers(mMemoryManager.getHeapAllocator()), mDefaultLoggers(mMemoryManager.getHeapAllocator()),
+                mDefaultTaskSchedulers(mMemoryManager.getHeapAllocator()),
                 mBoxShapeHalfEdgeStructure(mMemoryManager.getHeapAllocator(), 6, 8, 24),
                 mTriangleShapeHalfEdgeStructure(mMemoryManager.getHeapAllocator(), 2, 3, 6) {
 
@@ -199,6 +200,12 @@ void PhysicsCommon::release() {
     }
     mDefaultLoggers.clear();
 
+    // Destroy the default task schedulers
+    for (auto it = mDefaultTaskSchedulers.begin(); it != mDefaultTaskSchedulers.end(); ++it) {
+        deleteDefaultTaskScheduler(*it);
+    }
+    mDefaultTaskSchedulers.clear();
+
 // If profiling is enabled
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -695,14 +702,20 @@ void PhysicsCommon::deleteConvexMesh(ConvexMesh* convexMesh) {
 
 // Create a triangle mesh from a TriangleVertexArray
 /// The data (vertices, faces indices) are copied from the TriangleVertexArray into the created ConvexMesh.
+/// If isAABBTreeQuantized is true, the bounds of the nodes of the AABB tree of the mesh are stored
+/// on 16 bits. This reduces the memory used by the tree but the tree is slightly less tight.
 /**
+ * @param triangleVertexArray A reference to the input TriangleVertexArray
+ * @param messages A reference to the array of messages (errors, warnings) about the mesh creation
+ * @param isAABBTreeQuantized True if the bounds of the nodes of the AABB tree must be quantized
  * @return A pointer to the created triangle mesh
  */
-TriangleMesh* PhysicsCommon::createTriangleMesh(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages) {
+TriangleMesh* PhysicsCommon::createTriangleMesh(const TriangleVertexArray& triangleVertexArray, std::vector<Message>& messages,
+                                                bool isAABBTreeQuantized) {
 
     TriangleMesh* mesh = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(TriangleMesh))) TriangleMesh(mMemoryManager.getHeapAllocator());
 
-    bool isValid = mesh->init(triangleVertexArray, messages);
+    bool isValid = mesh->init(triangleVertexArray, messages, isAABBTreeQuantized);
 
     if (!isValid) {
 
@@ -799,6 +812,49 @@ void PhysicsCommon::deleteDefaultLogger(DefaultLogger* logger) {
    mMemoryManager.release(MemoryManager::AllocationType::Pool, logger, sizeof(DefaultLogger));
 }
 
+// Create and return a new default task scheduler
+/// The scheduler can be given to a physics world with the PhysicsWorld::WorldSettings or
+/// with the PhysicsWorld::setTaskScheduler() method. The same scheduler can be shared by
+/// multiple worlds as long as they are not updated at the same time.
+/**
+ * @param nbThreads Total number of threads used by the scheduler (including the thread
+ *                  that updates the world). If zero, the number of hardware threads is used.
+ * @return A pointer to the task scheduler that has been created
+ */
+DefaultTaskScheduler* PhysicsCommon::createDefaultTaskScheduler(uint32 nbThreads) {
+
+    DefaultTaskScheduler* taskScheduler = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(DefaultTaskScheduler)))
+                                          DefaultTaskScheduler(mMemoryManager.getHeapAllocator(), nbThreads);
+
+    mDefaultTaskSchedulers.add(taskScheduler);
+
+    return taskScheduler;
+}
+
+// Destroy a default task scheduler
+/**
+ * @param taskScheduler A pointer to the default task scheduler to destroy
+ */
+void PhysicsCommon::destroyDefaultTaskScheduler(DefaultTaskScheduler* taskScheduler) {
+
+    deleteDefaultTaskScheduler(taskScheduler);
+
+    mDefaultTaskSchedulers.remove(taskScheduler);
+}
+
+// Delete a default task scheduler
+/**
+ * @param taskScheduler A pointer to the default task scheduler to destroy
+ */
+void PhysicsCommon::deleteDefaultTaskScheduler(DefaultTaskScheduler* taskScheduler) {
+
+   // Call the destructor of the task scheduler (this stops the worker threads)
+   taskScheduler->~DefaultTaskScheduler();
+
+   // Release allocated memory
+   mMemoryManager.release(MemoryManager::AllocationType::Pool, taskScheduler, sizeof(DefaultTaskScheduler));
+}
+
 // If profiling is enabled
 #ifdef IS_RP3D_PROFILING_ENABLED
 
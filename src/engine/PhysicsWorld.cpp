@@ -68,7 +68,7 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
                 mName(worldSettings.worldName),  mIslands(mMemoryManager.getSingleFrameAllocator()), mProcessContactPairsOrderIslands(mMemoryManager.getSingleFrameAllocator()),
                 mContactSolverSystem(mMemoryManager, *this, mIslands, mBodyComponents, mRigidBodyComponents,
                                mCollidersComponents, mConfig.restitutionVelocityThreshold),
-                mConstraintSolverSystem(*this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
+                mConstraintSolverSystem(mMemoryManager, *this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
                                         mBallAndSocketJointsComponents, mFixedJointsComponents, mHingeJointsComponents,
                                         mSliderJointsComponents),
                 mDynamicsSystem(*this, mBodyComponents, mRigidBodyComponents, mTransformComponents, mCollidersComponents, mIsGravityEnabled, mConfig.gravity),
@@ -76,7 +76,9 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
                 mNbPositionSolverIterations(mConfig.defaultPositionSolverNbIterations), 
                 mIsSleepingEnabled(mConfig.isSleepingEnabled), mRigidBodies(mMemoryManager.getPoolAllocator()),
                 mSleepLinearVelocity(mConfig.defaultSleepLinearVelocity),
-                mSleepAngularVelocity(mConfig.defaultSleepAngularVelocity), mTimeBeforeSleep(mConfig.defaultTimeBeforeSleep) {
+                mSleepAngularVelocity(mConfig.defaultSleepAngularVelocity), mIsQuerySnapshotActive(false),
+                mTimeBeforeSleep(mConfig.defaultTimeBeforeSleep),
+                mTaskScheduler(mConfig.taskScheduler) {
 
     // Automatically generate a name for the world
     if (mName == "") {
@@ -215,9 +217,99 @@ void PhysicsWorld::setJointDisabled(Entity jointEntity, bool isDisabled) {
  * @return True if the two bodies overlap
  */
 bool PhysicsWorld::testOverlap(Body* body1, Body* body2) {
+
+    // During a query snapshot, the state of the collision detection must not be modified
+    if (mIsQuerySnapshotActive) {
+        return mCollisionDetection.testOverlapQuery(body1, body2, nullptr);
+    }
+
     return mCollisionDetection.testOverlap(body1, body2);
 }
 
+// Begin a query snapshot of the world
+/// During a query snapshot, the world is frozen and the raycast(), testOverlap(Body*, Body*),
+/// testOverlap(Body*, OverlapCallback&) and testOverlap(const AABB&, AABBQueryCallback&) methods
+/// only read the state of the world. Therefore, those queries can be called concurrently by multiple
+/// threads until the endQuerySnapshot() method is called. During a snapshot, you must not update the
+/// world, create or destroy bodies or colliders, move bodies or call the testCollision() and
+/// testOverlap(OverlapCallback&) methods.
+void PhysicsWorld::beginQuerySnapshot() {
+
+    if (mIsQuerySnapshotActive) {
+
+        RP3D_LOG(mConfig.worldName, Logger::Level::Error, Logger::Category::World,
+                 "Error when beginning a query snapshot: a query snapshot is already active",  __FILE__, __LINE__);
+
+        assert(false);
+        return;
+    }
+
+    mIsQuerySnapshotActive = true;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Begin query snapshot",  __FILE__, __LINE__);
+}
+
+// End the current query snapshot of the world
+/// This method must be called once all the queries of the snapshot have returned.
+void PhysicsWorld::endQuerySnapshot() {
+
+    if (!mIsQuerySnapshotActive) {
+
+        RP3D_LOG(mConfig.worldName, Logger::Level::Error, Logger::Category::World,
+                 "Error when ending a query snapshot: no query snapshot is active",  __FILE__, __LINE__);
+
+        assert(false);
+        return;
+    }
+
+    mIsQuerySnapshotActive = false;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: End query snapshot",  __FILE__, __LINE__);
+}
+
+// Rebuild the broad-phase AABB trees of the colliders
+/// The trees are rebuilt top-down with the Surface Area Heuristic. This can be used to restore the
+/// quality of the trees after many colliders have been created, moved and destroyed. The trees are
+/// also used by the other broad-phase algorithms for the queries.
+void PhysicsWorld::rebuildBroadPhase() {
+
+    // The trees cannot be modified while other threads might be querying the world
+    if (mIsQuerySnapshotActive) {
+
+        RP3D_LOG(mConfig.worldName, Logger::Level::Error, Logger::Category::World,
+                 "Error when rebuilding the broad-phase: the world cannot be modified during a query snapshot",  __FILE__, __LINE__);
+
+        assert(false);
+        return;
+    }
+
+    mCollisionDetection.mBroadPhaseSystem.rebuildTrees();
+}
+
+// Incrementally improve the broad-phase AABB trees by reinserting a maximum number of colliders
+/// The colliders are reinserted into the trees in a round-robin order across the calls. This can be
+/// called at each frame with a small budget to spread the cost of the optimization.
+/**
+ * @param maxNbReinsertedColliders Maximum number of colliders to reinsert into the trees
+ * @return The number of reinserted colliders
+ */
+uint32 PhysicsWorld::optimizeBroadPhase(uint32 maxNbReinsertedColliders) {
+
+    // The trees cannot be modified while other threads might be querying the world
+    if (mIsQuerySnapshotActive) {
+
+        RP3D_LOG(mConfig.worldName, Logger::Level::Error, Logger::Category::World,
+                 "Error when optimizing the broad-phase: the world cannot be modified during a query snapshot",  __FILE__, __LINE__);
+
+        assert(false);
+        return 0;
+    }
+
+    return mCollisionDetection.mBroadPhaseSystem.optimizeTrees(maxNbReinsertedColliders);
+}
+
 // Return the current world-space AABB of given collider
 /**
  * @param collider Pointer to a collider
@@ -246,6 +338,16 @@ void PhysicsWorld::update(decimal timeStep) {
 
     RP3D_PROFILE("PhysicsWorld::update()", mProfiler);
 
+    // The world cannot be updated while other threads might be querying it
+    if (mIsQuerySnapshotActive) {
+
+        RP3D_LOG(mConfig.worldName, Logger::Level::Error, Logger::Category::World,
+                 "Error when updating the world: the world cannot be updated during a query snapshot",  __FILE__, __LINE__);
+
+        assert(false);
+        return;
+    }
+
     // Reset the debug renderer
     if (mIsDebugRenderingEnabled) {
         mDebugRenderer.reset();
@@ -308,13 +410,7 @@ void PhysicsWorld::update(decimal timeStep) {
 
 // Update the world inverse inertia tensors of rigid bodies
 void PhysicsWorld::updateBodiesInverseWorldInertiaTensors() {
-
-    uint32 nbComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbComponents; i++) {
-        const Matrix3x3 orientation = mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]).getOrientation().getMatrix();
-
-        RigidBody::computeWorldInertiaTensorInverse(orientation, mRigidBodyComponents.mInverseInertiaTensorsLocal[i], mRigidBodyComponents.mInverseInertiaTensorsWorld[i]);
-    }
+    mDynamicsSystem.updateBodiesInverseWorldInertiaTensors();
 }
 
 // Solve the contacts and constraints
@@ -322,6 +418,13 @@ void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
 
     RP3D_PROFILE("PhysicsWorld::solveContactsAndConstraints()", mProfiler);
 
+    // If there are several threads to solve the islands
+    if (mTaskScheduler != nullptr && mTaskScheduler->getNbThreads() > 1 && mIslands.getNbIslands() > 0) {
+
+        solveContactsAndConstraintsParallel(timeStep);
+        return;
+    }
+
     // ---------- Solve velocity constraints for joints and contacts ---------- //
 
     // Initialize the contact solver
@@ -344,6 +447,246 @@ void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
     mContactSolverSystem.reset();
 }
 
+// Solve the contacts and constraints of the islands on the threads of the task scheduler
+/// The constraints of each island are allocated and prepared on the calling thread and each
+/// island is then initialized and solved independently. This gives exactly the same result
+/// as the serial solver. The islands with many constraints are solved afterwards one at a
+/// time with the graph-colored solver that uses all the threads for a single island.
+void PhysicsWorld::solveContactsAndConstraintsParallel(decimal timeStep) {
+
+    RP3D_PROFILE("PhysicsWorld::solveContactsAndConstraintsParallel()", mProfiler);
+
+    assert(mTaskScheduler != nullptr);
+
+    // Allocate the contact constraints of all the islands
+    mContactSolverSystem.allocate(mCollisionDetection.mCurrentContactManifolds, mCollisionDetection.mCurrentContactPoints, timeStep);
+
+    // Prepare the joints solver and compute the joints of each island
+    mConstraintSolverSystem.setSolverParameters(timeStep);
+    mConstraintSolverSystem.computeIslandsJoints();
+
+    // Find the large islands that are solved with the graph-colored solver
+    const uint32 nbIslands = mIslands.getNbIslands();
+    Array<uint32> islandsIndices(mMemoryManager.getSingleFrameAllocator(), nbIslands + 1);
+    Array<uint32> largeIslandsIndices(mMemoryManager.getSingleFrameAllocator());
+    for (uint32 i=0; i < nbIslands; i++) {
+
+        const uint32 nbConstraints = mIslands.nbContactManifolds[i] + mConstraintSolverSystem.getNbIslandJoints(i);
+        if (nbConstraints >= mConfig.graphColoringNbConstraintsThreshold) {
+            largeIslandsIndices.add(i);
+        }
+        else {
+            islandsIndices.add(i);
+        }
+    }
+
+    // Add the joints that are not in any island
+    islandsIndices.add(nbIslands);
+
+    // Solve the islands concurrently
+    SolveIslandsTask task(*this, islandsIndices);
+    TaskScheduler::run(mTaskScheduler, task, static_cast<uint32>(islandsIndices.size()), 1);
+
+    // Solve the large islands one after the other
+    for (uint32 i=0; i < largeIslandsIndices.size(); i++) {
+        solveIslandGraphColoring(largeIslandsIndices[i]);
+    }
+
+    // Reset the contact solver
+    mContactSolverSystem.reset();
+}
+
+// Solve the contacts and constraints of a large island with the graph-colored solver
+/// The constraints of the island are split into colors that do not share any non-static
+/// body. The colors are solved one after the other and the constraints of each color are
+/// solved on the threads of the task scheduler. The contacts and joints are initialized
+/// and solved in the same order as with the serial solver (joints before contacts).
+void PhysicsWorld::solveIslandGraphColoring(uint32 islandIndex) {
+
+    RP3D_PROFILE("PhysicsWorld::solveIslandGraphColoring()", mProfiler);
+
+    const uint32 nbManifolds = mIslands.nbContactManifolds[islandIndex];
+    const uint32 nbJoints = mConstraintSolverSystem.getNbIslandJoints(islandIndex);
+
+    SolveIslandColorTask task(*this, islandIndex);
+
+    // Initialize and warm start the contacts
+    if (nbManifolds > 0) {
+
+        task.setStage(SolveIslandColorTask::Stage::InitializeContacts, nullptr);
+        TaskScheduler::run(mTaskScheduler, task, nbManifolds, GRAPH_COLORING_MIN_BATCH_SIZE);
+
+        mContactSolverSystem.computeIslandColors(islandIndex);
+        executeColors(task, SolveIslandColorTask::Stage::WarmStartContacts, mContactSolverSystem.getColoring());
+
+        if (mConfig.isWideContactSolverEnabled) {
+            mContactSolverSystem.packWideContactManifolds();
+        }
+    }
+
+    // Initialize and warm start the joints
+    if (nbJoints > 0) {
+
+        task.setStage(SolveIslandColorTask::Stage::InitializeJoints, nullptr);
+        TaskScheduler::run(mTaskScheduler, task, nbJoints, GRAPH_COLORING_MIN_BATCH_SIZE);
+
+        mConstraintSolverSystem.computeIslandColors(islandIndex);
+        executeColors(task, SolveIslandColorTask::Stage::WarmStartJoints, mConstraintSolverSystem.getColoring());
+    }
+
+    // For each iteration of the velocity solver
+    for (uint32 i=0; i < mNbVelocitySolverIterations; i++) {
+
+        if (nbJoints > 0) {
+            executeColors(task, SolveIslandColorTask::Stage::SolveJoints, mConstraintSolverSystem.getColoring());
+        }
+
+        if (nbManifolds > 0) {
+            if (mConfig.isWideContactSolverEnabled) {
+                executeWideContactColors(task);
+            }
+            else {
+                executeColors(task, SolveIslandColorTask::Stage::SolveContacts, mContactSolverSystem.getColoring());
+            }
+        }
+    }
+
+    if (nbManifolds > 0) {
+
+        if (mConfig.isWideContactSolverEnabled) {
+            mContactSolverSystem.unpackWideContactManifolds();
+        }
+
+        task.setStage(SolveIslandColorTask::Stage::StoreImpulses, nullptr);
+        TaskScheduler::run(mTaskScheduler, task, nbManifolds, GRAPH_COLORING_MIN_BATCH_SIZE);
+    }
+}
+
+// Execute a stage of the graph-colored solver on each color
+/**
+ * @param task The task of the graph-colored solver
+ * @param stage The stage to execute
+ * @param coloring The colors of the constraints
+ */
+void PhysicsWorld::executeColors(SolveIslandColorTask& task, SolveIslandColorTask::Stage stage,
+                                 const ConstraintGraphColoring& coloring) {
+
+    for (uint32 c=0; c < coloring.getNbColors(); c++) {
+
+        const uint32 nbConstraints = coloring.getNbConstraintsInColor(c);
+        if (nbConstraints == 0) continue;
+
+        task.setStage(stage, coloring.getColorConstraints(c));
+
+        // The constraints of the overflow color can share bodies and must be solved serially
+        if (coloring.isOverflowColor(c)) {
+            task.execute(0, nbConstraints, 0);
+        }
+        else {
+            TaskScheduler::run(mTaskScheduler, task, nbConstraints, GRAPH_COLORING_MIN_BATCH_SIZE);
+        }
+    }
+}
+
+// Solve the contacts of each color of a large island with the wide contact solver
+/// The items of the task are the wide contact manifold constraints of the color. The
+/// overflow color is solved serially with the scalar solver.
+/**
+ * @param task The task of the graph-colored solver
+ */
+void PhysicsWorld::executeWideContactColors(SolveIslandColorTask& task) {
+
+    const ConstraintGraphColoring& coloring = mContactSolverSystem.getColoring();
+
+    for (uint32 c=0; c < coloring.getNbColors(); c++) {
+
+        if (coloring.isOverflowColor(c)) {
+
+            const uint32 nbConstraints = coloring.getNbConstraintsInColor(c);
+            if (nbConstraints == 0) continue;
+
+            task.setStage(SolveIslandColorTask::Stage::SolveContacts, coloring.getColorConstraints(c));
+            task.execute(0, nbConstraints, 0);
+        }
+        else {
+
+            const uint32 nbWideManifolds = mContactSolverSystem.getNbWideContactManifoldsInColor(c);
+            if (nbWideManifolds == 0) continue;
+
+            task.setStage(SolveIslandColorTask::Stage::SolveWideContacts, nullptr, c);
+            TaskScheduler::run(mTaskScheduler, task, nbWideManifolds, GRAPH_COLORING_MIN_BATCH_SIZE / RP3D_SIMD_WIDTH);
+        }
+    }
+}
+
+// Execute the current stage for the items in the range [startIndex, endIndex)
+void PhysicsWorld::SolveIslandColorTask::execute(uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+    const uint32 nbItems = endIndex - startIndex;
+    const uint32 manifoldStartIndex = mWorld.mIslands.contactManifoldsIndices[mIslandIndex];
+
+    switch (mStage) {
+        case Stage::InitializeContacts:
+            mWorld.mContactSolverSystem.initializeContactManifolds(manifoldStartIndex + startIndex, nbItems);
+            break;
+        case Stage::WarmStartContacts:
+            mWorld.mContactSolverSystem.warmStartManifolds(mColorConstraints + startIndex, nbItems);
+            break;
+        case Stage::SolveContacts:
+            mWorld.mContactSolverSystem.solveManifolds(mColorConstraints + startIndex, nbItems);
+            break;
+        case Stage::SolveWideContacts:
+            mWorld.mContactSolverSystem.solveWideContactManifolds(mColorIndex, startIndex, nbItems);
+            break;
+        case Stage::StoreImpulses:
+            mWorld.mContactSolverSystem.storeImpulsesManifolds(manifoldStartIndex + startIndex, nbItems);
+            break;
+        case Stage::InitializeJoints:
+            mWorld.mConstraintSolverSystem.initBeforeSolveIslandJoints(mIslandIndex, startIndex, endIndex);
+            break;
+        case Stage::WarmStartJoints:
+            mWorld.mConstraintSolverSystem.warmstartIslandJoints(mIslandIndex, mColorConstraints + startIndex, nbItems);
+            break;
+        case Stage::SolveJoints:
+            mWorld.mConstraintSolverSystem.solveVelocityConstraintsIslandJoints(mIslandIndex, mColorConstraints + startIndex, nbItems);
+            break;
+    }
+}
+
+// Solve the islands in the range [startIndex, endIndex) of the islands indices
+void PhysicsWorld::SolveIslandsTask::execute(uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+    const uint32 nbIslands = mWorld.mIslands.getNbIslands();
+
+    for (uint32 k = startIndex; k < endIndex; k++) {
+
+        const uint32 i = mIslandsIndices[k];
+
+        const bool hasContacts = i < nbIslands && mWorld.mIslands.nbContactManifolds[i] > 0;
+
+        // Initialize the contact and joints constraints of the island
+        if (hasContacts) {
+            mWorld.mContactSolverSystem.initializeForIsland(i);
+            mWorld.mContactSolverSystem.warmStartIsland(i);
+        }
+        mWorld.mConstraintSolverSystem.initializeIsland(i);
+
+        // For each iteration of the velocity solver
+        for (uint32 j=0; j < mWorld.mNbVelocitySolverIterations; j++) {
+
+            mWorld.mConstraintSolverSystem.solveVelocityConstraintsIsland(i);
+
+            if (hasContacts) {
+                mWorld.mContactSolverSystem.solveIsland(i);
+            }
+        }
+
+        if (hasContacts) {
+            mWorld.mContactSolverSystem.storeImpulsesIsland(i);
+        }
+    }
+}
+
 // Solve the position error correction of the constraints
 void PhysicsWorld::solvePositionCorrection() {
 
@@ -33,6 +33,43 @@ MemoryManager::MemoryManager(MemoryAllocator* baseAllocator, size_t initAllocate
                mBaseAllocator(baseAllocator == nullptr ? &mDefaultAllocator : baseAllocator),
                mHeapAllocator(*mBaseAllocator, initAllocatedMemory),
                mPoolAllocator(mHeapAllocator),
-               mSingleFrameAllocator(mHeapAllocator) {
+               mSingleFrameAllocator(mHeapAllocator), mThreadFrameAllocators(mHeapAllocator),
+               mThreadPoolAllocators(mHeapAllocator) {
 
 }
+
+// Destructor
+MemoryManager::~MemoryManager() {
+
+    // Destroy the allocators of the threads (the free memory units of the caches are given back to the pool allocator)
+    for (uint32 i=0; i < mThreadFrameAllocators.size(); i++) {
+
+        mThreadFrameAllocators[i]->~SingleFrameAllocator();
+        mHeapAllocator.release(mThreadFrameAllocators[i], sizeof(SingleFrameAllocator));
+
+        mThreadPoolAllocators[i]->~PoolAllocatorCache();
+        mHeapAllocator.release(mThreadPoolAllocators[i], sizeof(PoolAllocatorCache));
+    }
+
+    mThreadFrameAllocators.clear(true);
+    mThreadPoolAllocators.clear(true);
+}
+
+// Make sure there are allocators for a given number of threads
+/// This method must be called before the threads of the task scheduler use their allocators
+/**
+ * @param nbThreads Number of threads of the task scheduler
+ */
+void MemoryManager::createThreadAllocators(uint32 nbThreads) {
+
+    while (mThreadFrameAllocators.size() < nbThreads) {
+
+        SingleFrameAllocator* frameAllocator = new (mHeapAllocator.allocate(sizeof(SingleFrameAllocator)))
+                                                    SingleFrameAllocator(mHeapAllocator, THREAD_FRAME_ALLOCATOR_NB_BYTES);
+        mThreadFrameAllocators.add(frameAllocator);
+
+        PoolAllocatorCache* poolAllocator = new (mHeapAllocator.allocate(sizeof(PoolAllocatorCache)))
+                                                 PoolAllocatorCache(mPoolAllocator);
+        mThreadPoolAllocators.add(poolAllocator);
+    }
+}
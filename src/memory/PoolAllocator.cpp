@@ -128,6 +128,17 @@ void* PoolAllocator::allocate(size_t size) {
     int indexHeap = mMapSizeToHeapIndex[size];
     assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
 
+    void* allocatedMemory = static_cast<void*>(allocateUnit(indexHeap));
+
+    // Check that allocated memory is 16-bytes aligned
+    assert(reinterpret_cast<uintptr_t>(allocatedMemory) % GLOBAL_ALIGNMENT == 0);
+
+    return allocatedMemory;
+}
+
+// Return a free memory unit of a given heap (the mutex must be locked by the caller)
+PoolAllocator::MemoryUnit* PoolAllocator::allocateUnit(int indexHeap) {
+
     // If there still are free memory units in the corresponding heap
     if (mFreeMemoryUnits[indexHeap] != nullptr) {
 
@@ -135,12 +146,7 @@ void* PoolAllocator::allocate(size_t size) {
         MemoryUnit* unit = mFreeMemoryUnits[indexHeap];
         mFreeMemoryUnits[indexHeap] = unit->nextUnit;
 
-        void* allocatedMemory = static_cast<void*>(unit);
-
-        // Check that allocated memory is 16-bytes aligned
-        assert(reinterpret_cast<uintptr_t>(allocatedMemory) % GLOBAL_ALIGNMENT == 0);
-
-        return allocatedMemory;
+        return unit;
     }
     else {  // If there is no more free memory units in the corresponding heap
 
@@ -181,14 +187,65 @@ void* PoolAllocator::allocate(size_t size) {
         mFreeMemoryUnits[indexHeap] = newBlock->memoryUnits->nextUnit;
         mNbCurrentMemoryBlocks++;
 
-        void* allocatedMemory = newBlock->memoryUnits;
+        // Return the pointer to the first memory unit of the new allocated block
+        return newBlock->memoryUnits;
+    }
+}
 
-        // Check that allocated memory is 16-bytes aligned
-        assert(reinterpret_cast<uintptr_t>(allocatedMemory) % GLOBAL_ALIGNMENT == 0);
+// Allocate a linked-list of memory units of a given heap
+/// This method is used by the pool allocator caches of the threads to get many memory
+/// units with a single lock of the mutex.
+/**
+ * @param indexHeap Index of the heap of the memory units
+ * @param nbUnits Number of memory units to allocate
+ * @return Pointer to the first memory unit of the linked-list
+ */
+PoolAllocator::MemoryUnit* PoolAllocator::allocateUnits(int indexHeap, uint32 nbUnits) {
 
-        // Return the pointer to the first memory unit of the new allocated block
-        return allocatedMemory;
+    assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
+    assert(nbUnits > 0);
+
+    // Lock the method with a mutex
+    std::lock_guard<std::mutex> lock(mMutex);
+
+#ifndef NDEBUG
+        mNbTimesAllocateMethodCalled += nbUnits;
+#endif
+
+    MemoryUnit* firstUnit = nullptr;
+    for (uint32 i=0; i < nbUnits; i++) {
+        MemoryUnit* unit = allocateUnit(indexHeap);
+        unit->nextUnit = firstUnit;
+        firstUnit = unit;
     }
+
+    return firstUnit;
+}
+
+// Release a linked-list of memory units of a given heap
+/**
+ * @param indexHeap Index of the heap of the memory units
+ * @param firstUnit Pointer to the first memory unit of the linked-list
+ * @param lastUnit Pointer to the last memory unit of the linked-list
+ * @param nbUnits Number of memory units in the linked-list
+ */
+void PoolAllocator::releaseUnits(int indexHeap, MemoryUnit* firstUnit, MemoryUnit* lastUnit, uint32 nbUnits) {
+
+    assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
+
+    // Lock the method with a mutex
+    std::lock_guard<std::mutex> lock(mMutex);
+
+#ifndef NDEBUG
+        mNbTimesAllocateMethodCalled -= nbUnits;
+#else
+        // The number of units is only used to count the allocations in debug mode
+        (void)nbUnits;
+#endif
+
+    // Insert the memory units at the beginning of the list of free memory units of the heap
+    lastUnit->nextUnit = mFreeMemoryUnits[indexHeap];
+    mFreeMemoryUnits[indexHeap] = firstUnit;
 }
 
 // Release previously allocated memory.
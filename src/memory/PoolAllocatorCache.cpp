@@ -0,0 +1,145 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/memory/PoolAllocatorCache.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+/**
+ * @param poolAllocator Pool allocator used to get the memory units of the cache
+ */
+PoolAllocatorCache::PoolAllocatorCache(PoolAllocator& poolAllocator) : mPoolAllocator(poolAllocator) {
+
+    memset(mFreeMemoryUnits, 0, sizeof(mFreeMemoryUnits));
+    memset(mNbFreeMemoryUnits, 0, sizeof(mNbFreeMemoryUnits));
+}
+
+// Destructor
+PoolAllocatorCache::~PoolAllocatorCache() {
+    flush();
+}
+
+// Allocate memory of a given size (in bytes) and return a pointer to the
+// allocated memory.
+void* PoolAllocatorCache::allocate(size_t size) {
+
+    assert(size > 0);
+
+    // We cannot allocate zero bytes
+    if (size == 0) return nullptr;
+
+    // If we need to allocate more than the maximum memory unit size
+    if (size > PoolAllocator::MAX_UNIT_SIZE) {
+        return mPoolAllocator.allocate(size);
+    }
+
+    // Get the index of the heap that will take care of the allocation request
+    const int indexHeap = PoolAllocator::mMapSizeToHeapIndex[size];
+    assert(indexHeap >= 0 && indexHeap < PoolAllocator::NB_HEAPS);
+
+    // If there are no more free memory units in the heap of the cache
+    if (mFreeMemoryUnits[indexHeap] == nullptr) {
+
+        // Get some free memory units from the pool allocator
+        mFreeMemoryUnits[indexHeap] = mPoolAllocator.allocateUnits(indexHeap, NB_REFILL_UNITS);
+        mNbFreeMemoryUnits[indexHeap] = NB_REFILL_UNITS;
+    }
+
+    // Return a pointer to the memory unit
+    PoolAllocator::MemoryUnit* unit = mFreeMemoryUnits[indexHeap];
+    mFreeMemoryUnits[indexHeap] = unit->nextUnit;
+    mNbFreeMemoryUnits[indexHeap]--;
+
+    void* allocatedMemory = static_cast<void*>(unit);
+
+    // Check that allocated memory is 16-bytes aligned
+    assert(reinterpret_cast<uintptr_t>(allocatedMemory) % GLOBAL_ALIGNMENT == 0);
+
+    return allocatedMemory;
+}
+
+// Release previously allocated memory.
+void PoolAllocatorCache::release(void* pointer, size_t size) {
+
+    assert(size > 0);
+
+    // Cannot release a 0-byte allocated memory
+    if (size == 0) return;
+
+    // If the size is larger than the maximum memory unit size
+    if (size > PoolAllocator::MAX_UNIT_SIZE) {
+        mPoolAllocator.release(pointer, size);
+        return;
+    }
+
+    // Get the index of the heap that has handled the corresponding allocation request
+    const int indexHeap = PoolAllocator::mMapSizeToHeapIndex[size];
+    assert(indexHeap >= 0 && indexHeap < PoolAllocator::NB_HEAPS);
+
+    // Insert the released memory unit into the list of free memory units of the heap
+    PoolAllocator::MemoryUnit* releasedUnit = static_cast<PoolAllocator::MemoryUnit*>(pointer);
+    releasedUnit->nextUnit = mFreeMemoryUnits[indexHeap];
+    mFreeMemoryUnits[indexHeap] = releasedUnit;
+    mNbFreeMemoryUnits[indexHeap]++;
+
+    // If the cache keeps too many free memory units, give half of them back to the pool allocator
+    if (mNbFreeMemoryUnits[indexHeap] > MAX_NB_FREE_UNITS) {
+        releaseUnits(indexHeap, MAX_NB_FREE_UNITS / 2);
+    }
+}
+
+// Give back some free memory units of a heap to the pool allocator
+/**
+ * @param indexHeap Index of the heap
+ * @param nbUnits Number of free memory units to give back (from the beginning of the list)
+ */
+void PoolAllocatorCache::releaseUnits(int indexHeap, uint32 nbUnits) {
+
+    assert(nbUnits > 0 && nbUnits <= mNbFreeMemoryUnits[indexHeap]);
+
+    PoolAllocator::MemoryUnit* firstUnit = mFreeMemoryUnits[indexHeap];
+    PoolAllocator::MemoryUnit* lastUnit = firstUnit;
+    for (uint32 i=1; i < nbUnits; i++) {
+        lastUnit = lastUnit->nextUnit;
+    }
+
+    mFreeMemoryUnits[indexHeap] = lastUnit->nextUnit;
+    mNbFreeMemoryUnits[indexHeap] -= nbUnits;
+
+    mPoolAllocator.releaseUnits(indexHeap, firstUnit, lastUnit, nbUnits);
+}
+
+// Give back all the free memory units of the cache to the pool allocator
+void PoolAllocatorCache::flush() {
+
+    for (int i=0; i < PoolAllocator::NB_HEAPS; i++) {
+        if (mNbFreeMemoryUnits[i] > 0) {
+            releaseUnits(i, mNbFreeMemoryUnits[i]);
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/memory/ScratchAllocator.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+/**
+ * @param buffer Memory buffer used for the allocations (it must stay valid during the lifetime of the allocator)
+ * @param sizeBytes Size (in bytes) of the memory buffer
+ * @param baseAllocator Allocator used when the memory buffer is full
+ */
+ScratchAllocator::ScratchAllocator(void* buffer, size_t sizeBytes, MemoryAllocator& baseAllocator)
+                 : mBaseAllocator(baseAllocator), mMemoryBufferStart(static_cast<char*>(buffer)),
+                   mTotalSizeBytes(sizeBytes), mCurrentOffset(0) {
+
+}
+
+// Allocate memory of a given size (in bytes) and return a pointer to the
+// allocated memory. Allocated memory must be 16-bytes aligned.
+void* ScratchAllocator::allocate(size_t size) {
+
+    // Allocate a little bit more memory to make sure we can return an aligned address
+    const size_t totalSize = size + GLOBAL_ALIGNMENT;
+
+    // Check that there is enough remaining memory in the buffer
+    if (mCurrentOffset + totalSize > mTotalSizeBytes) {
+
+        // Return default memory allocation
+        return mBaseAllocator.allocate(size);
+    }
+
+    // Compute the next aligned memory address
+    void* nextAvailableMemory = alignAddress(mMemoryBufferStart + mCurrentOffset, GLOBAL_ALIGNMENT);
+
+    // Increment the offset
+    mCurrentOffset += totalSize;
+
+    // Check that allocated memory is 16-bytes aligned
+    assert(reinterpret_cast<uintptr_t>(nextAvailableMemory) % GLOBAL_ALIGNMENT == 0);
+
+    return nextAvailableMemory;
+}
+
+// Release previously allocated memory.
+void ScratchAllocator::release(void* pointer, size_t size) {
+
+    // If allocated memory is not within the buffer
+    char* p = static_cast<char*>(pointer);
+    if (p < mMemoryBufferStart || p >= mMemoryBufferStart + mTotalSizeBytes) {
+
+        // Use default deallocation
+        mBaseAllocator.release(pointer, size);
+    }
+}
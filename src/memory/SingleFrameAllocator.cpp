@@ -32,8 +32,12 @@
 using namespace reactphysics3d;
 
 // Constructor
-SingleFrameAllocator::SingleFrameAllocator(MemoryAllocator& baseAllocator) : mBaseAllocator(baseAllocator),
-                                           mTotalSizeBytes(INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES),
+/**
+ * @param baseAllocator Allocator used to allocate the memory block of the allocator
+ * @param initSizeBytes Initial size (in bytes) of the memory block (doubled each time it is too small)
+ */
+SingleFrameAllocator::SingleFrameAllocator(MemoryAllocator& baseAllocator, size_t initSizeBytes) : mBaseAllocator(baseAllocator),
+                                           mTotalSizeBytes(initSizeBytes),
                                            mCurrentOffset(0), mNeedToAllocatedMore(false) {
 
     // Allocate a whole block of memory at the beginning
@@ -58,30 +62,27 @@ SingleFrameAllocator::~SingleFrameAllocator() {
 // allocated memory. Allocated memory must be 16-bytes aligned.
 void* SingleFrameAllocator::allocate(size_t size) {
 
-    // Lock the method with a mutex
-    std::lock_guard<std::mutex> lock(mMutex);
-
     // Allocate a little bit more memory to make sure we can return an aligned address
     const size_t totalSize = size + GLOBAL_ALIGNMENT;
 
-    // Check that there is enough remaining memory in the buffer
-    if (mCurrentOffset + totalSize > mTotalSizeBytes) {
+    // Reserve the memory range by moving the offset forward (retry if another thread has moved it before us)
+    size_t currentOffset = mCurrentOffset.load(std::memory_order_relaxed);
+    do {
 
-        // We need to allocate more memory next time reset() is called
-       mNeedToAllocatedMore = true;
+        // Check that there is enough remaining memory in the buffer
+        if (currentOffset + totalSize > mTotalSizeBytes) {
 
-       // Return default memory allocation
-       return mBaseAllocator.allocate(size);
-    }
+            // We need to allocate more memory next time reset() is called
+            mNeedToAllocatedMore.store(true, std::memory_order_relaxed);
 
-    // Next available memory location
-    void* nextAvailableMemory = mMemoryBufferStart + mCurrentOffset;
+            // Return default memory allocation
+            return mBaseAllocator.allocate(size);
+        }
 
-    // Compute the next aligned memory address
-    nextAvailableMemory = alignAddress(nextAvailableMemory, GLOBAL_ALIGNMENT);
+    } while (!mCurrentOffset.compare_exchange_weak(currentOffset, currentOffset + totalSize, std::memory_order_relaxed));
 
-    // Increment the offset
-    mCurrentOffset += totalSize;
+    // Compute the next aligned memory address
+    void* nextAvailableMemory = alignAddress(mMemoryBufferStart + currentOffset, GLOBAL_ALIGNMENT);
 
     // Check that allocated memory is 16-bytes aligned
     assert(reinterpret_cast<uintptr_t>(nextAvailableMemory) % GLOBAL_ALIGNMENT == 0);
@@ -93,9 +94,6 @@ void* SingleFrameAllocator::allocate(size_t size) {
 // Release previously allocated memory.
 void SingleFrameAllocator::release(void* pointer, size_t size) {
 
-    // Lock the method with a mutex
-    std::lock_guard<std::mutex> lock(mMutex);
-
     // If allocated memory is not within the single frame allocation range
     char* p = static_cast<char*>(pointer);
     if (p < mMemoryBufferStart || p > mMemoryBufferStart + mTotalSizeBytes) {
@@ -108,11 +106,8 @@ void SingleFrameAllocator::release(void* pointer, size_t size) {
 // Reset the marker of the current allocated memory
 void SingleFrameAllocator::reset() {
 
-    // Lock the method with a mutex
-    std::lock_guard<std::mutex> lock(mMutex);
-
     // If we need to allocate more memory
-    if (mNeedToAllocatedMore) {
+    if (mNeedToAllocatedMore.load(std::memory_order_relaxed)) {
 
         // Release the memory allocated at the beginning
         mBaseAllocator.release(mMemoryBufferStart, mTotalSizeBytes);
@@ -124,9 +119,9 @@ void SingleFrameAllocator::reset() {
         mMemoryBufferStart = static_cast<char*>(mBaseAllocator.allocate(mTotalSizeBytes));
         assert(mMemoryBufferStart != nullptr);
 
-        mNeedToAllocatedMore = false;
+        mNeedToAllocatedMore.store(false, std::memory_order_relaxed);
     }
 
     // Reset the current offset at the beginning of the block
-    mCurrentOffset = 0;
+    mCurrentOffset.store(0, std::memory_order_relaxed);
 }
@@ -36,10 +36,18 @@ using namespace reactphysics3d;
 
 // Constructor
 BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection, ColliderComponents& collidersComponents,
-                                   TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents)
+                                   TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents,
+                                   BroadPhaseAlgorithmType algorithmType, decimal gridCellSize)
                     :mDynamicAABBTree(collisionDetection.getMemoryManager().getHeapAllocator(), DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE),
+                     mStaticAABBTree(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mStaticWideTree(collisionDetection.getMemoryManager().getHeapAllocator(), 1), mIsStaticWideTreeValid(false),
+                     mNbUpdatesSinceStaticChange(0),
+                     mAlgorithmType(algorithmType), mSweepAndPrune(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mSpatialHashGrid(collisionDetection.getMemoryManager().getHeapAllocator(), gridCellSize),
+                     mFreeGridIndices(collisionDetection.getMemoryManager().getHeapAllocator()), mNbGridIndices(0),
                      mCollidersComponents(collidersComponents), mTransformsComponents(transformComponents),
                      mRigidBodyComponents(rigidBodyComponents), mMovedShapes(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mMovedStaticShapes(collisionDetection.getMemoryManager().getHeapAllocator()),
                      mCollisionDetection(collisionDetection) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -59,37 +67,139 @@ bool BroadPhaseSystem::testOverlappingShapes(int32 shape1BroadPhaseId, int32 sha
     assert(shape1BroadPhaseId != -1 && shape2BroadPhaseId != -1);
 
     // Get the two AABBs of the collision shapes
-    const AABB& aabb1 = mDynamicAABBTree.getFatAABB(shape1BroadPhaseId);
-    const AABB& aabb2 = mDynamicAABBTree.getFatAABB(shape2BroadPhaseId);
+    const AABB& aabb1 = getFatAABB(shape1BroadPhaseId);
+    const AABB& aabb2 = getFatAABB(shape2BroadPhaseId);
 
     // Check if the two AABBs are overlapping
     return aabb1.testCollision(aabb2);
 }
 
 // Ray casting method
+/// The ray is cast against the tree of the moving colliders first and then against the tree of the
+/// static colliders. The second raycast is clipped by the hits of the first one. The wide tree of
+/// the static colliders is used if it is up to date. With the SPATIAL_HASH_GRID algorithm, the
+/// cells of the grid crossed by the ray are visited instead.
 void BroadPhaseSystem::raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const {
 
     RP3D_PROFILE("BroadPhaseSystem::raycast()", mProfiler);
 
-    BroadPhaseRaycastCallback broadPhaseRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastTest);
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
 
-    // Compute the inverse ray direction
-    const Vector3 rayDirection = ray.point2 - ray.point1;
-    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+        BroadPhaseGridRaycastCallback gridRaycastCallback(*this, raycastWithCategoryMaskBits, raycastTest);
+        mSpatialHashGrid.raycast(ray, gridRaycastCallback, raycastTest.allocator);
+        return;
+    }
+
+    BroadPhaseRaycastCallback dynamicRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastTest, ray.maxFraction);
+    mDynamicAABBTree.raycast(ray, dynamicRaycastCallback, raycastTest.allocator);
 
-    mDynamicAABBTree.raycast(ray, broadPhaseRaycastCallback);
+    // If the user has not stopped the raycast
+    if (!dynamicRaycastCallback.isRaycastStopped()) {
+
+        const Ray staticRay(ray.point1, ray.point2, dynamicRaycastCallback.getMaxFraction());
+        BroadPhaseRaycastCallback staticRaycastCallback(mStaticAABBTree, raycastWithCategoryMaskBits, raycastTest, staticRay.maxFraction);
+        if (mIsStaticWideTreeValid) {
+            mStaticWideTree.raycast(staticRay, staticRaycastCallback, raycastTest.allocator);
+        }
+        else {
+            mStaticAABBTree.raycast(staticRay, staticRaycastCallback, raycastTest.allocator);
+        }
+    }
+}
+
+// Ray casting method for a packet of rays that only computes the closest hit of each ray
+/// The packet is cast against the tree of the moving colliders first and then against the tree of
+/// the static colliders with the rays clipped by the hits of the first tree. Both trees are traversed
+/// once for the whole packet. With the SPATIAL_HASH_GRID algorithm, each ray of the packet walks
+/// the cells of the grid instead.
+/**
+ * @param rays Array with the rays of the packet
+ * @param nbRays Number of rays in the packet (at most DynamicAABBTree::RAYCAST_PACKET_SIZE)
+ * @param raycastInfos Array where the closest hit of each ray is stored (the collider of a ray that has
+ *                     not hit anything is not modified)
+ * @param raycastWithCategoryMaskBits Bits mask corresponding to the category of colliders to be raycasted
+ * @param allocator Allocator used for the temporary memory of the raycast
+ */
+void BroadPhaseSystem::raycastPacket(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, unsigned short raycastWithCategoryMaskBits,
+                                     MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("BroadPhaseSystem::raycastPacket()", mProfiler);
+
+    assert(nbRays <= DynamicAABBTree::RAYCAST_PACKET_SIZE);
+
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+
+        for (uint32 i=0; i < nbRays; i++) {
+
+            // Keep the closest hit of the ray
+            RaycastTest raycastTest(raycastInfos[i], allocator);
+            BroadPhaseGridRaycastCallback gridRaycastCallback(*this, raycastWithCategoryMaskBits, raycastTest);
+            mSpatialHashGrid.raycast(rays[i], gridRaycastCallback, allocator);
+        }
+
+        return;
+    }
+
+    // Maximum fraction of each ray (clipped by the hits in the trees)
+    decimal maxFractions[DynamicAABBTree::RAYCAST_PACKET_SIZE];
+    for (uint32 i=0; i < nbRays; i++) {
+        maxFractions[i] = rays[i].maxFraction;
+    }
+
+    BroadPhaseRaycastPacketCallback dynamicRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastInfos, allocator);
+    mDynamicAABBTree.raycastPacket(rays, nbRays, maxFractions, dynamicRaycastCallback, allocator);
+
+    BroadPhaseRaycastPacketCallback staticRaycastCallback(mStaticAABBTree, raycastWithCategoryMaskBits, raycastInfos, allocator);
+    mStaticAABBTree.raycastPacket(rays, nbRays, maxFractions, staticRaycastCallback, allocator);
 }
 
 // Add a collider into the broad-phase collision detection
+/// With the SPATIAL_HASH_GRID algorithm, the collider is only added into the grid and its
+/// broad-phase ID is allocated by the broad-phase instead of a tree.
 void BroadPhaseSystem::addCollider(Collider* collider, const AABB& aabb) {
 
     assert(collider->getBroadPhaseId() == -1);
 
-    // Add the collision shape into the dynamic AABB tree and get its broad-phase ID
-    int nodeId = mDynamicAABBTree.addObject(aabb, collider);
+    // The colliders of the static bodies are added into the static tree
+    const Entity bodyEntity = mCollidersComponents.getBody(collider->getEntity());
+    const bool isStatic = mRigidBodyComponents.hasComponent(bodyEntity) && mRigidBodyComponents.getBodyType(bodyEntity) == BodyType::STATIC;
+
+    int32 broadPhaseId;
+
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+
+        // Get an unused broad-phase ID
+        int32 gridIndex;
+        if (mFreeGridIndices.size() > 0) {
+            gridIndex = mFreeGridIndices[mFreeGridIndices.size() - 1];
+            mFreeGridIndices.removeAt(mFreeGridIndices.size() - 1);
+        }
+        else {
+            gridIndex = mNbGridIndices;
+            mNbGridIndices++;
+        }
+        broadPhaseId = computeBroadPhaseId(gridIndex, isStatic);
+
+        mSpatialHashGrid.addObject(broadPhaseId, computeGridFatAABB(aabb, isStatic), isStatic, collider);
+    }
+    else {
+
+        // Add the collision shape into the AABB tree and get its broad-phase ID
+        DynamicAABBTree& tree = isStatic ? mStaticAABBTree : mDynamicAABBTree;
+        const int32 nodeId = tree.addObject(aabb, collider);
+        broadPhaseId = computeBroadPhaseId(nodeId, isStatic);
+
+        if (isStatic) {
+            invalidateStaticWideTree();
+        }
+
+        if (mAlgorithmType == BroadPhaseAlgorithmType::SWEEP_AND_PRUNE) {
+            mSweepAndPrune.addObject(broadPhaseId, tree.getFatAABB(nodeId), isStatic);
+        }
+    }
 
     // Set the broad-phase ID of the collider
-    mCollidersComponents.setBroadPhaseId(collider->getEntity(), nodeId);
+    mCollidersComponents.setBroadPhaseId(collider->getEntity(), broadPhaseId);
 
     // Add the collision shape into the array of bodies that have moved (or have been created)
     // during the last simulation step
@@ -105,8 +215,25 @@ void BroadPhaseSystem::removeCollider(Collider* collider) {
 
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), -1);
 
-    // Remove the collision shape from the dynamic AABB tree
-    mDynamicAABBTree.removeObject(broadPhaseID);
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+
+        // Remove the collision shape from the grid and release its broad-phase ID
+        mSpatialHashGrid.removeObject(broadPhaseID);
+        mFreeGridIndices.add(getTreeNodeId(broadPhaseID));
+    }
+    else {
+
+        // Remove the collision shape from its AABB tree
+        getTree(broadPhaseID).removeObject(getTreeNodeId(broadPhaseID));
+
+        if (mAlgorithmType == BroadPhaseAlgorithmType::SWEEP_AND_PRUNE) {
+            mSweepAndPrune.removeObject(broadPhaseID);
+        }
+
+        if (isStaticShape(broadPhaseID)) {
+            invalidateStaticWideTree();
+        }
+    }
 
     // Remove the collision shape into the array of shapes that have moved (or have been created)
     // during the last simulation step
@@ -126,13 +253,91 @@ void BroadPhaseSystem::updateCollider(Entity colliderEntity) {
 }
 
 // Update the broad-phase state of all the enabled colliders
-void BroadPhaseSystem::updateColliders() {
+/**
+ * @param taskScheduler Task scheduler used to compute the AABBs of the colliders on multiple threads (can be nullptr)
+ */
+void BroadPhaseSystem::updateColliders(TaskScheduler* taskScheduler) {
 
     RP3D_PROFILE("BroadPhaseSystem::updateColliders()", mProfiler);
 
-    // Update all the enabled collider components
-    if (mCollidersComponents.getNbEnabledComponents() > 0) {
-        updateCollidersComponents(0, mCollidersComponents.getNbEnabledComponents());
+    const uint32 nbEnabledColliders = mCollidersComponents.getNbEnabledComponents();
+
+    if (taskScheduler != nullptr && taskScheduler->getNbThreads() > 1 && nbEnabledColliders > UPDATE_COLLIDERS_MIN_BATCH_SIZE) {
+        updateCollidersParallel(*taskScheduler);
+    }
+    else if (nbEnabledColliders > 0) {
+
+        // Update all the enabled collider components
+        updateCollidersComponents(0, nbEnabledColliders);
+    }
+}
+
+// Update the broad-phase state of all the enabled colliders with the threads of a task scheduler
+/// The update is done in two phases. First, the world-space AABBs of the colliders are computed
+/// in parallel and compared with the fat AABBs of the tree. Then, only the colliders that have
+/// escaped their fat AABB (or whose shape has changed size) are updated in the tree. This second
+/// phase is serial and follows the order of the components. Therefore, the tree is the same as
+/// with the serial update.
+/**
+ * @param taskScheduler Task scheduler used to compute the AABBs of the colliders
+ */
+void BroadPhaseSystem::updateCollidersParallel(TaskScheduler& taskScheduler) {
+
+    RP3D_PROFILE("BroadPhaseSystem::updateCollidersParallel()", mProfiler);
+
+    MemoryManager& memoryManager = mCollisionDetection.getMemoryManager();
+
+    const uint32 nbEnabledColliders = mCollidersComponents.getNbEnabledComponents();
+
+    const size_t aabbsSize = nbEnabledColliders * sizeof(AABB);
+    const size_t flagsSize = nbEnabledColliders * sizeof(bool);
+    AABB* aabbs = static_cast<AABB*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, aabbsSize));
+    bool* needTreeUpdate = static_cast<bool*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, flagsSize));
+    bool* forceReInsert = static_cast<bool*>(memoryManager.allocate(MemoryManager::AllocationType::Frame, flagsSize));
+
+    // Compute the world-space AABBs of the colliders
+    ComputeCollidersAABBsTask task(*this, aabbs, needTreeUpdate, forceReInsert);
+    TaskScheduler::run(&taskScheduler, task, nbEnabledColliders, UPDATE_COLLIDERS_MIN_BATCH_SIZE);
+
+    // Update the colliders that have escaped their fat AABB in the dynamic AABB tree
+    for (uint32 i=0; i < nbEnabledColliders; i++) {
+
+        if (needTreeUpdate[i]) {
+            updateColliderInternal(mCollidersComponents.mBroadPhaseIds[i], mCollidersComponents.mColliders[i], aabbs[i], forceReInsert[i]);
+        }
+    }
+
+    memoryManager.release(MemoryManager::AllocationType::Frame, forceReInsert, flagsSize);
+    memoryManager.release(MemoryManager::AllocationType::Frame, needTreeUpdate, flagsSize);
+    memoryManager.release(MemoryManager::AllocationType::Frame, aabbs, aabbsSize);
+}
+
+// Compute the AABBs of the colliders in the range [startIndex, endIndex)
+void BroadPhaseSystem::ComputeCollidersAABBsTask::execute(uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+    ColliderComponents& collidersComponents = mBroadPhaseSystem.mCollidersComponents;
+
+    for (uint32 i = startIndex; i < endIndex; i++) {
+
+        mNeedTreeUpdate[i] = false;
+
+        const int32 broadPhaseId = collidersComponents.mBroadPhaseIds[i];
+        if (broadPhaseId != -1) {
+
+            const Entity& bodyEntity = collidersComponents.mBodiesEntities[i];
+            const Transform& transform = mBroadPhaseSystem.mTransformsComponents.getTransform(bodyEntity);
+
+            // Recompute the world-space AABB of the collision shape
+            new (mAABBs + i) AABB(collidersComponents.mCollisionShapes[i]->computeTransformedAABB(transform * collidersComponents.mLocalToBodyTransforms[i]));
+
+            // If the size of the collision shape has been changed by the user,
+            // we need to reset the broad-phase AABB to its new size
+            mForceReInsert[i] = collidersComponents.mHasCollisionShapeChangedSize[i];
+            collidersComponents.mHasCollisionShapeChangedSize[i] = false;
+
+            // The tree only needs to be updated if the AABB is not inside the fat AABB anymore
+            mNeedTreeUpdate[i] = mForceReInsert[i] || !mBroadPhaseSystem.getFatAABB(broadPhaseId).contains(mAABBs[i]);
+        }
     }
 }
 
@@ -142,19 +347,52 @@ void BroadPhaseSystem::updateColliderInternal(int32 broadPhaseId, Collider* coll
 
     assert(broadPhaseId >= 0);
 
-    // Update the dynamic AABB tree according to the movement of the collision shape
-    bool hasBeenReInserted = mDynamicAABBTree.updateObject(broadPhaseId, aabb, forceReInsert);
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+
+        // The grid only needs to be updated if the AABB is not inside the fat AABB anymore
+        if (!forceReInsert && mSpatialHashGrid.getAABB(broadPhaseId).contains(aabb)) return;
+
+        mSpatialHashGrid.updateObject(broadPhaseId, computeGridFatAABB(aabb, isStaticShape(broadPhaseId)));
+
+        // Add the collision shape into the array of shapes that have moved (or have been created)
+        // during the last simulation step
+        addMovedCollider(broadPhaseId, collider);
+
+        return;
+    }
+
+    // Update the AABB tree according to the movement of the collision shape
+    bool hasBeenReInserted = getTree(broadPhaseId).updateObject(getTreeNodeId(broadPhaseId), aabb, forceReInsert);
 
     // If the collision shape has moved out of its fat AABB (and therefore has been reinserted
     // into the tree).
     if (hasBeenReInserted) {
 
+        if (isStaticShape(broadPhaseId)) {
+            invalidateStaticWideTree();
+        }
+
+        if (mAlgorithmType == BroadPhaseAlgorithmType::SWEEP_AND_PRUNE) {
+            mSweepAndPrune.updateObject(broadPhaseId, getFatAABB(broadPhaseId));
+        }
+
         // Add the collision shape into the array of shapes that have moved (or have been created)
         // during the last simulation step
         addMovedCollider(broadPhaseId, collider);
     }
 }
 
+// Return the fat AABB of a collider in the grid
+/// The AABB is inflated like in the tree that would contain the collider (the AABBs of the
+/// static colliders are not inflated).
+AABB BroadPhaseSystem::computeGridFatAABB(const AABB& aabb, bool isStatic) const {
+
+    if (isStatic) return aabb;
+
+    const Vector3 gap(aabb.getExtent() * DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE * decimal(0.5));
+    return AABB(aabb.getMin() - gap, aabb.getMax() + gap);
+}
+
 // Update the broad-phase state of some colliders components
 void BroadPhaseSystem::updateCollidersComponents(uint32 startIndex, uint32 nbItems) {
 
@@ -198,26 +436,336 @@ void BroadPhaseSystem::addMovedCollider(int broadPhaseID, Collider* collider) {
     // Store the broad-phase ID into the array of shapes that have moved
     mMovedShapes.add(broadPhaseID);
 
+    // A static shape will also have to be tested against the other static shapes for the world queries
+    if (isStaticShape(broadPhaseID)) {
+        mMovedStaticShapes.add(broadPhaseID);
+    }
+
     // Notify that the overlapping pairs where this shape is involved need to be tested for overlap
     mCollisionDetection.notifyOverlappingPairsToTestOverlap(collider);
 }
 
 // Compute all the overlapping pairs of collision shapes
-void BroadPhaseSystem::computeOverlappingPairs(MemoryManager& memoryManager, Array<Pair<int32, int32>>& overlappingNodes) {
+/// The moved shapes are tested against the tree of the moving colliders and the moved shapes of
+/// the dynamic and kinematic bodies are also tested against the tree of the static colliders. With
+/// the SWEEP_AND_PRUNE algorithm, those pairs are computed with a single sweep over all the shapes
+/// instead. With the SPATIAL_HASH_GRID algorithm, all the pairs are computed with the grid and the
+/// trees are not used. The pairs of two static shapes are only computed if they are requested (for
+/// the world queries).
+/**
+ * @param memoryManager Reference to the memory manager
+ * @param overlappingNodes Array where the overlapping pairs of broad-phase IDs are added
+ * @param includeStaticPairs True if the moved static shapes must also be tested against the other static shapes
+ * @param taskScheduler Task scheduler used to test the moved shapes on multiple threads (can be nullptr)
+ */
+void BroadPhaseSystem::computeOverlappingPairs(MemoryManager& memoryManager, Array<Pair<int32, int32>>& overlappingNodes,
+                                               bool includeStaticPairs, TaskScheduler* taskScheduler) {
 
     RP3D_PROFILE("BroadPhaseSystem::computeOverlappingPairs()", mProfiler);
 
+    // Make sure the wide tree of the static colliders is up to date for the queries
+    if (mAlgorithmType != BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+        updateStaticWideTree();
+    }
+
     // Get the array of the colliders that have moved or have been created in the last frame
     Array<int> shapesToTest = mMovedShapes.toArray(memoryManager.getHeapAllocator());
 
-    // Ask the dynamic AABB tree to report all collision shapes that overlap with the shapes to test
-    mDynamicAABBTree.reportAllShapesOverlappingWithShapes(shapesToTest, 0, static_cast<uint32>(shapesToTest.size()), overlappingNodes);
+    if (mAlgorithmType == BroadPhaseAlgorithmType::SWEEP_AND_PRUNE) {
+
+        // Sweep all the shapes and report the pairs with a moved shape
+        const uint64 nbShapesToTest = shapesToTest.size();
+        for (uint64 i=0; i < nbShapesToTest; i++) {
+            mSweepAndPrune.setIsObjectMoved(shapesToTest[i]);
+        }
+        mSweepAndPrune.reportAllOverlappingPairs(overlappingNodes);
+    }
+    else if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+
+        // Test the moved shapes against the objects of their cells and against the large objects
+        mSpatialHashGrid.reportAllOverlappingPairs(shapesToTest, overlappingNodes, memoryManager.getHeapAllocator());
+    }
+    else if (taskScheduler != nullptr && taskScheduler->getNbThreads() > 1 &&
+        shapesToTest.size() > 2 * OVERLAPPING_PAIRS_MIN_BATCH_SIZE) {
+
+        computeOverlappingPairsParallel(memoryManager, shapesToTest, overlappingNodes, *taskScheduler);
+    }
+    else {
+
+        // Ask the AABB trees to report all collision shapes that overlap with the shapes to test
+        reportAllShapesOverlappingWithShapes(shapesToTest, 0, static_cast<uint32>(shapesToTest.size()), overlappingNodes,
+                                             memoryManager.getHeapAllocator());
+    }
+
+    // Test the static shapes that have moved against the other static shapes if necessary
+    if (includeStaticPairs && mMovedStaticShapes.size() > 0) {
+
+        Array<int32> nodes(memoryManager.getHeapAllocator(), 64);
+        Stack<int32> stack(memoryManager.getHeapAllocator(), 64);
+        Stack<uint32> wideStack(memoryManager.getHeapAllocator(), 64);
+        for (auto it = mMovedStaticShapes.begin(); it != mMovedStaticShapes.end(); ++it) {
+
+            if (mAlgorithmType == BroadPhaseAlgorithmType::SPATIAL_HASH_GRID) {
+
+                // Only keep the static shapes reported by the grid (the other pairs have already been computed)
+                nodes.clear();
+                mSpatialHashGrid.reportAllShapesOverlappingWithAABB(getFatAABB(*it), nodes, memoryManager.getHeapAllocator());
+                for (uint64 n=0; n < nodes.size(); n++) {
+                    if (nodes[n] != *it && isStaticShape(nodes[n])) {
+                        overlappingNodes.add(Pair<int32, int32>(*it, nodes[n]));
+                    }
+                }
+            }
+            else {
+                reportStaticShapesOverlappingWithAABB(*it, getFatAABB(*it), nodes, stack, wideStack, overlappingNodes);
+            }
+        }
+
+        mMovedStaticShapes.clear();
+    }
 
     // Reset the array of collision shapes that have move (or have been created) during the
     // last simulation step
     mMovedShapes.clear();
 }
 
+// Report the broad-phase shapes of a tree overlapping with a given AABB
+/**
+ * @param tree The tree to query
+ * @param isStaticTree True if the tree is the tree of the static colliders
+ * @param shapeId Broad-phase ID of the shape with the AABB
+ * @param aabb AABB of the shape
+ * @param nodes Temporary array for the overlapping nodes of the tree
+ * @param stack Temporary stack for the traversal of the tree
+ * @param overlappingNodes Array where the overlapping pairs of broad-phase IDs are added
+ */
+void BroadPhaseSystem::reportShapesOverlappingWithAABB(const DynamicAABBTree& tree, bool isStaticTree, int32 shapeId, const AABB& aabb,
+                                                       Array<int32>& nodes, Stack<int32>& stack, Array<Pair<int32, int32>>& overlappingNodes) {
+
+    nodes.clear();
+    tree.reportAllShapesOverlappingWithAABB(aabb, nodes, stack);
+
+    const uint64 nbNodes = nodes.size();
+    for (uint64 n=0; n < nbNodes; n++) {
+        overlappingNodes.add(Pair<int32, int32>(shapeId, computeBroadPhaseId(nodes[n], isStaticTree)));
+    }
+}
+
+// Report the static broad-phase shapes overlapping with a given AABB
+/// The wide tree of the static colliders is used if it is up to date
+/**
+ * @param shapeId Broad-phase ID of the shape with the AABB
+ * @param aabb AABB of the shape
+ * @param nodes Temporary array for the overlapping nodes of the tree
+ * @param stack Temporary stack for the traversal of the static tree
+ * @param wideStack Temporary stack for the traversal of the wide tree
+ * @param overlappingNodes Array where the overlapping pairs of broad-phase IDs are added
+ */
+void BroadPhaseSystem::reportStaticShapesOverlappingWithAABB(int32 shapeId, const AABB& aabb, Array<int32>& nodes, Stack<int32>& stack,
+                                                             Stack<uint32>& wideStack, Array<Pair<int32, int32>>& overlappingNodes) const {
+
+    if (!mIsStaticWideTreeValid) {
+        reportShapesOverlappingWithAABB(mStaticAABBTree, true, shapeId, aabb, nodes, stack, overlappingNodes);
+        return;
+    }
+
+    nodes.clear();
+    mStaticWideTree.reportAllShapesOverlappingWithAABB(aabb, nodes, wideStack);
+
+    const uint64 nbNodes = nodes.size();
+    for (uint64 n=0; n < nbNodes; n++) {
+        overlappingNodes.add(Pair<int32, int32>(shapeId, computeBroadPhaseId(nodes[n], true)));
+    }
+}
+
+// Rebuild the wide tree of the static colliders once the static colliders do not change anymore
+/// The wide tree has a single collider per leaf. Therefore, it reports the same colliders as the
+/// static tree. Since the wide tree is built from scratch, it is only rebuilt when the static
+/// colliders have not changed during STATIC_WIDE_TREE_REBUILD_DELAY consecutive broad-phase updates.
+/// Until then, the static tree is used. Therefore, the wide tree is not rebuilt at each frame when
+/// some static colliders are moved, added or removed at each frame.
+void BroadPhaseSystem::updateStaticWideTree() {
+
+    if (mIsStaticWideTreeValid) return;
+
+    // Wait until the static colliders do not change anymore
+    mNbUpdatesSinceStaticChange++;
+    if (mNbUpdatesSinceStaticChange < STATIC_WIDE_TREE_REBUILD_DELAY) return;
+
+    RP3D_PROFILE("BroadPhaseSystem::updateStaticWideTree()", mProfiler);
+
+    MemoryAllocator& allocator = mCollisionDetection.getMemoryManager().getHeapAllocator();
+
+    // Get the AABBs and the node IDs of all the static colliders
+    Array<AABB> aabbs(allocator);
+    Array<int32> nodesIds(allocator);
+    const uint32 nbColliders = mCollidersComponents.getNbComponents();
+    for (uint32 i=0; i < nbColliders; i++) {
+
+        const int32 broadPhaseId = mCollidersComponents.mBroadPhaseIds[i];
+        if (broadPhaseId != -1 && isStaticShape(broadPhaseId)) {
+            aabbs.add(getFatAABB(broadPhaseId));
+            nodesIds.add(getTreeNodeId(broadPhaseId));
+        }
+    }
+
+    mStaticWideTree.build(aabbs, nodesIds);
+
+    mIsStaticWideTreeValid = true;
+}
+
+// Rebuild the AABB trees of the colliders with the Surface Area Heuristic
+/// The broad-phase IDs of the colliders do not change. The wide tree of the static colliders
+/// is still valid because it only uses the leaves of the static tree.
+void BroadPhaseSystem::rebuildTrees() {
+
+    RP3D_PROFILE("BroadPhaseSystem::rebuildTrees()", mProfiler);
+
+    mDynamicAABBTree.rebuild();
+    mStaticAABBTree.rebuild();
+}
+
+// Incrementally improve the AABB trees of the colliders by reinserting a maximum number of colliders
+/// The colliders of the dynamic tree are reinserted first and the remaining budget is used for
+/// the static tree. The method returns the number of reinserted colliders.
+uint32 BroadPhaseSystem::optimizeTrees(uint32 maxNbReinsertedColliders) {
+
+    RP3D_PROFILE("BroadPhaseSystem::optimizeTrees()", mProfiler);
+
+    const uint32 nbReinsertedColliders = mDynamicAABBTree.optimize(maxNbReinsertedColliders);
+    return nbReinsertedColliders + mStaticAABBTree.optimize(maxNbReinsertedColliders - nbReinsertedColliders);
+}
+
+// Return the sum of the SAH costs of the AABB trees of the colliders
+decimal BroadPhaseSystem::computeTreesSAHCost() const {
+    return mDynamicAABBTree.computeSAHCost() + mStaticAABBTree.computeSAHCost();
+}
+
+// Report all the shapes overlapping with the shapes of the range [startIndex, endIndex) of an array
+/// Each shape is tested against the tree of the moving colliders. Only the shapes of the dynamic
+/// and kinematic bodies are tested against the tree of the static colliders.
+/**
+ * @param shapesToTest Broad-phase IDs of the shapes to test
+ * @param startIndex Index of the first shape to test
+ * @param endIndex Index after the last shape to test
+ * @param overlappingNodes Array where the overlapping pairs of broad-phase IDs are added
+ * @param allocator Allocator for the temporary memory of the tree traversals
+ */
+void BroadPhaseSystem::reportAllShapesOverlappingWithShapes(const Array<int32>& shapesToTest, uint32 startIndex, uint32 endIndex,
+                                                            Array<Pair<int32, int32>>& overlappingNodes, MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("BroadPhaseSystem::reportAllShapesOverlappingWithShapes()", mProfiler);
+
+    Array<int32> nodes(allocator, 64);
+    Stack<int32> stack(allocator, 64);
+    Stack<uint32> wideStack(allocator, 64);
+
+    for (uint32 i=startIndex; i < endIndex; i++) {
+
+        const int32 shapeId = shapesToTest[i];
+        assert(shapeId != -1);
+
+        const AABB& shapeAABB = getFatAABB(shapeId);
+
+        reportShapesOverlappingWithAABB(mDynamicAABBTree, false, shapeId, shapeAABB, nodes, stack, overlappingNodes);
+
+        // Two static shapes never collide
+        if (!isStaticShape(shapeId)) {
+            reportStaticShapesOverlappingWithAABB(shapeId, shapeAABB, nodes, stack, wideStack, overlappingNodes);
+        }
+    }
+}
+
+// Compute all the overlapping pairs of collision shapes with the threads of a task scheduler
+/// The moved shapes are split into ranges that are tested concurrently against the dynamic
+/// AABB tree. The overlapping pairs of the ranges are merged in the order of the ranges. The
+/// pairs of a shape with itself and the second report of a pair of two moved shapes are removed.
+/// The result is therefore the same sequence of new pairs as with the serial query.
+/**
+ * @param memoryManager Reference to the memory manager
+ * @param shapesToTest Broad-phase IDs of the moved shapes
+ * @param overlappingNodes Array where the overlapping pairs of broad-phase IDs are added
+ * @param taskScheduler Task scheduler used to test the ranges of shapes
+ */
+void BroadPhaseSystem::computeOverlappingPairsParallel(MemoryManager& memoryManager, const Array<int32>& shapesToTest,
+                                                       Array<Pair<int32, int32>>& overlappingNodes, TaskScheduler& taskScheduler) {
+
+    RP3D_PROFILE("BroadPhaseSystem::computeOverlappingPairsParallel()", mProfiler);
+
+    MemoryAllocator& allocator = memoryManager.getHeapAllocator();
+
+    const uint32 nbShapesToTest = static_cast<uint32>(shapesToTest.size());
+
+    // Index of each shape to test in the array (used to remove the duplicated pairs)
+    Map<int32, uint32> shapesToTestIndices(allocator, nbShapesToTest);
+    for (uint32 i=0; i < nbShapesToTest; i++) {
+        shapesToTestIndices.add(Pair<int32, uint32>(shapesToTest[i], i));
+    }
+
+    // Split the shapes to test into ranges
+    const uint32 maxNbRanges = taskScheduler.getNbThreads() * OVERLAPPING_PAIRS_NB_RANGES_PER_THREAD;
+    const uint32 rangeSize = std::max(OVERLAPPING_PAIRS_MIN_BATCH_SIZE, (nbShapesToTest + maxNbRanges - 1) / maxNbRanges);
+    const uint32 nbRanges = (nbShapesToTest + rangeSize - 1) / rangeSize;
+
+    // The overlapping pairs of the ranges grow on the threads of the task scheduler and therefore use
+    // the single frame allocator that does not lock any mutex
+    Array<Array<Pair<int32, int32>>> rangesOverlappingNodes(allocator, nbRanges);
+    for (uint32 r=0; r < nbRanges; r++) {
+        rangesOverlappingNodes.emplace(memoryManager.getSingleFrameAllocator());
+    }
+
+    // Make sure each thread has its own allocators for the temporary memory of the tree traversals
+    memoryManager.createThreadAllocators(taskScheduler.getNbThreads());
+
+    OverlappingPairsTask task(*this, shapesToTest, shapesToTestIndices, rangeSize, rangesOverlappingNodes);
+    TaskScheduler::run(&taskScheduler, task, nbRanges, 1);
+
+    // Merge the overlapping pairs of the ranges
+    uint64 nbOverlappingNodes = overlappingNodes.size();
+    for (uint32 r=0; r < nbRanges; r++) {
+        nbOverlappingNodes += rangesOverlappingNodes[r].size();
+    }
+    overlappingNodes.reserve(nbOverlappingNodes);
+    for (uint32 r=0; r < nbRanges; r++) {
+        overlappingNodes.addRange(rangesOverlappingNodes[r]);
+    }
+}
+
+// Test the shapes of the ranges [startIndex, endIndex)
+void BroadPhaseSystem::OverlappingPairsTask::execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) {
+
+    MemoryManager& memoryManager = mBroadPhaseSystem.mCollisionDetection.getMemoryManager();
+
+    const uint32 nbShapesToTest = static_cast<uint32>(mShapesToTest.size());
+
+    for (uint32 r=startIndex; r < endIndex; r++) {
+
+        const uint32 firstShapeIndex = r * mRangeSize;
+        const uint32 lastShapeIndex = std::min(firstShapeIndex + mRangeSize, nbShapesToTest);
+
+        Array<Pair<int32, int32>>& overlappingNodes = mRangesOverlappingNodes[r];
+        mBroadPhaseSystem.reportAllShapesOverlappingWithShapes(mShapesToTest, firstShapeIndex, lastShapeIndex, overlappingNodes,
+                                                               memoryManager.getThreadPoolAllocator(threadIndex));
+
+        // Remove the pairs of a shape with itself and the pairs already reported by a previous shape to test
+        uint64 nbKeptNodes = 0;
+        for (uint64 i=0; i < overlappingNodes.size(); i++) {
+
+            const Pair<int32, int32>& nodePair = overlappingNodes[i];
+            if (nodePair.first == nodePair.second) continue;
+
+            auto it = mShapesToTestIndices.find(nodePair.second);
+            if (it != mShapesToTestIndices.end() && it->second < mShapesToTestIndices[nodePair.first]) continue;
+
+            overlappingNodes[nbKeptNodes] = nodePair;
+            nbKeptNodes++;
+        }
+        while (overlappingNodes.size() > nbKeptNodes) {
+            overlappingNodes.removeAt(overlappingNodes.size() - 1);
+        }
+    }
+}
+
 // Called when a overlapping node has been found during the call to
 // DynamicAABBTree:reportAllShapesOverlappingWithAABB()
 void AABBOverlapCallback::notifyOverlappingNode(int nodeId) {
@@ -239,7 +787,48 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
         // the collider of this node because the ray is overlapping
         // with the shape in the broad-phase
         hitFraction = mRaycastTest.raycastAgainstShape(collider, ray);
+
+        // Keep track of the clipping of the ray (as the tree does) for the raycast against the next tree
+        if (hitFraction == decimal(0.0)) {
+            mIsRaycastStopped = true;
+        }
+        else if (hitFraction > decimal(0.0) && hitFraction < mMaxFraction) {
+            mMaxFraction = hitFraction;
+        }
     }
 
     return hitFraction;
 }
+
+// Called for a broad-phase shape that has to be tested for raycast
+decimal BroadPhaseGridRaycastCallback::raycastBroadPhaseShape(int32 broadPhaseId, const Ray& ray) {
+
+    // Get the collider from the broad-phase ID
+    Collider* collider = mBroadPhaseSystem.getColliderForBroadPhaseId(broadPhaseId);
+
+    // Check if the raycast filtering mask allows raycast against this shape and if world query is enabled for this collider
+    if ((mRaycastWithCategoryMaskBits & collider->getCollisionCategoryBits()) != 0 && collider->getIsWorldQueryCollider()) {
+
+        // Ask the collision detection to perform a ray cast test against the collider
+        return mRaycastTest.raycastAgainstShape(collider, ray);
+    }
+
+    return decimal(-1.0);
+}
+
+// Called for a broad-phase shape that has to be tested for raycast with a ray of the packet
+decimal BroadPhaseRaycastPacketCallback::raycastBroadPhaseShape(int32 nodeId, uint32 rayIndex, const Ray& ray) {
+
+    // Get the collider from the node
+    Collider* collider = static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(nodeId));
+
+    // Check if the raycast filtering mask allows raycast against this shape and if world query is enabled for this collider
+    if ((mRaycastWithCategoryMaskBits & collider->getCollisionCategoryBits()) != 0 && collider->getIsWorldQueryCollider()) {
+
+        // Keep the hit if it is closer than the previous hits of the ray (the ray is clipped at the previous hits)
+        RaycastTest raycastTest(mRaycastInfos[rayIndex], mAllocator);
+        return raycastTest.raycastAgainstShape(collider, ray);
+    }
+
+    return decimal(-1.0);
+}
@@ -61,7 +61,8 @@ CollisionDetectionSystem::CollisionDetectionSystem(PhysicsWorld* world, Collider
                      mOverlappingPairs(mMemoryManager, mCollidersComponents, bodyComponents, rigidBodyComponents,
                                        mNoCollisionPairs, mCollisionDispatch),
                      mBroadPhaseOverlappingNodes(mMemoryManager.getHeapAllocator(), 32),
-                     mBroadPhaseSystem(*this, mCollidersComponents, transformComponents, rigidBodyComponents),
+                     mBroadPhaseSystem(*this, mCollidersComponents, transformComponents, rigidBodyComponents, world->mConfig.broadPhaseAlgorithmType,
+                                      world->mConfig.broadPhaseGridCellSize),
                      mMapBroadPhaseIdToColliderEntity(memoryManager.getPoolAllocator()),
                      mNarrowPhaseInput(mMemoryManager.getSingleFrameAllocator(), mOverlappingPairs), mPotentialContactPoints(mMemoryManager.getSingleFrameAllocator()),
                      mPotentialContactManifolds(mMemoryManager.getSingleFrameAllocator()), mContactPairs1(mMemoryManager.getPoolAllocator()),
@@ -90,7 +91,7 @@ void CollisionDetectionSystem::computeCollisionDetection() {
     RP3D_PROFILE("CollisionDetectionSystem::computeCollisionDetection()", mProfiler);
 	    
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(false);
 
     // Compute the middle-phase collision detection
     computeMiddlePhase(mNarrowPhaseInput, true, false);
@@ -99,8 +100,15 @@ void CollisionDetectionSystem::computeCollisionDetection() {
     computeNarrowPhase();
 }
 
+// Update all the enabled colliders
+void CollisionDetectionSystem::updateColliders() {
+
+    // The world-space AABBs of the colliders are computed on the threads of the task scheduler (if any)
+    mBroadPhaseSystem.updateColliders(mWorld->getTaskScheduler());
+}
+
 // Compute the broad-phase collision detection
-void CollisionDetectionSystem::computeBroadPhase() {
+void CollisionDetectionSystem::computeBroadPhase(bool isWorldQuery) {
 
     RP3D_PROFILE("CollisionDetectionSystem::computeBroadPhase()", mProfiler);
 
@@ -108,8 +116,10 @@ void CollisionDetectionSystem::computeBroadPhase() {
 
     // Ask the broad-phase to compute all the shapes overlapping with the shapes that
     // have moved or have been added in the last frame. This call can only add new
-    // overlapping pairs in the collision detection.
-    mBroadPhaseSystem.computeOverlappingPairs(mMemoryManager, mBroadPhaseOverlappingNodes);
+    // overlapping pairs in the collision detection. The moved shapes are tested on the threads
+    // of the task scheduler of the world (if any). The pairs of static shapes are only needed
+    // by the world queries.
+    mBroadPhaseSystem.computeOverlappingPairs(mMemoryManager, mBroadPhaseOverlappingNodes, isWorldQuery, mWorld->getTaskScheduler());
 
     // Create new overlapping pairs if necessary
     updateOverlappingPairs(mBroadPhaseOverlappingNodes);
@@ -519,7 +529,8 @@ void CollisionDetectionSystem::computeMiddlePhaseCollisionSnapshot(Array<uint64>
 }
 
 // Compute the concave vs convex middle-phase algorithm for a given pair of bodies
-void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator, NarrowPhaseInput& narrowPhaseInput, bool reportContacts) {
+void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator,
+                                                                 NarrowPhaseInput& narrowPhaseInput, bool reportContacts, bool useTrianglesCache) {
 
     RP3D_PROFILE("CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase()", mProfiler);
 
@@ -556,10 +567,59 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     const AABB aabb = convexShape->computeTransformedAABB(convexToConcaveTransform);
 
     // Compute the concave shape triangles that are overlapping with the convex mesh AABB
-    Array<Vector3> triangleVertices(allocator, 64);
-    Array<Vector3> triangleVerticesNormals(allocator, 64);
-    Array<uint> shapeIds(allocator, 64);
-    concaveShape->computeOverlappingTriangles(aabb, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+    Array<Vector3> triangleVertices(allocator, useTrianglesCache ? 0 : 64);
+    Array<Vector3> triangleVerticesNormals(allocator, useTrianglesCache ? 0 : 64);
+    Array<uint> shapeIds(allocator, useTrianglesCache ? 0 : 64);
+
+    if (useTrianglesCache) {
+
+        // If the convex shape has moved out of the inflated AABB used to compute the cached
+        // triangles (or if the scale of the concave shape has changed), we need to compute them again
+        if (!overlappingPair.isTrianglesCacheValid || !overlappingPair.cachedTrianglesAABB.contains(aabb) ||
+            overlappingPair.cachedTrianglesConcaveScale != concaveShape->getScale()) {
+
+            // Inflate the AABB of the convex shape so that the triangles can be reused in the next frames
+            const Vector3 gap = aabb.getExtent() * CONCAVE_TRIANGLES_CACHE_AABB_INFLATE_PERCENTAGE * decimal(0.5);
+            AABB inflatedAABB = aabb;
+            inflatedAABB.inflate(gap.x, gap.y, gap.z);
+
+            overlappingPair.cachedTrianglesVertices.clear();
+            overlappingPair.cachedTrianglesVerticesNormals.clear();
+            overlappingPair.cachedTrianglesShapeIds.clear();
+            concaveShape->computeOverlappingTriangles(inflatedAABB, overlappingPair.cachedTrianglesVertices,
+                                                      overlappingPair.cachedTrianglesVerticesNormals,
+                                                      overlappingPair.cachedTrianglesShapeIds, allocator);
+
+            overlappingPair.cachedTrianglesAABB = inflatedAABB;
+            overlappingPair.cachedTrianglesConcaveScale = concaveShape->getScale();
+            overlappingPair.isTrianglesCacheValid = true;
+        }
+
+        // Only keep the cached triangles that are overlapping with the convex shape AABB (with the
+        // same test as the one used by the concave shape to compute its overlapping triangles)
+        const uint32 nbCachedTriangles = static_cast<uint32>(overlappingPair.cachedTrianglesShapeIds.size());
+        triangleVertices.reserve(nbCachedTriangles * 3);
+        triangleVerticesNormals.reserve(nbCachedTriangles * 3);
+        shapeIds.reserve(nbCachedTriangles);
+        for (uint32 i=0; i < nbCachedTriangles; i++) {
+
+            const Vector3* trianglePoints = &(overlappingPair.cachedTrianglesVertices[i * 3]);
+            if (aabb.testCollisionTriangleAABB(trianglePoints)) {
+
+                const Vector3* triangleNormals = &(overlappingPair.cachedTrianglesVerticesNormals[i * 3]);
+                triangleVertices.add(trianglePoints[0]);
+                triangleVertices.add(trianglePoints[1]);
+                triangleVertices.add(trianglePoints[2]);
+                triangleVerticesNormals.add(triangleNormals[0]);
+                triangleVerticesNormals.add(triangleNormals[1]);
+                triangleVerticesNormals.add(triangleNormals[2]);
+                shapeIds.add(overlappingPair.cachedTrianglesShapeIds[i]);
+            }
+        }
+    }
+    else {
+        concaveShape->computeOverlappingTriangles(aabb, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+    }
 
     assert(triangleVertices.size() == triangleVerticesNormals.size());
     assert(shapeIds.size() == triangleVertices.size() / 3);
@@ -618,6 +678,36 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
 bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput,
                                                         bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator) {
 
+    narrowPhaseInput.allocateContactPoints();
+
+    return testNarrowPhaseCollision(narrowPhaseInput, 0, narrowPhaseInput.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+}
+
+// Compute the items of a narrow-phase batch that are inside a range [startIndex, endIndex) of the tests of all the batches.
+/// The batchStartIndex parameter is the index of the first item of the batch among all the tests and is
+/// moved to the index of the first item of the next batch. This method returns true if the ranges intersect.
+static bool computeBatchItemsInRange(const NarrowPhaseInfoBatch& batch, uint32 startIndex, uint32 endIndex,
+                                     uint32& batchStartIndex, uint32& batchItemIndex, uint32& batchNbItems) {
+
+    const uint32 batchEndIndex = batchStartIndex + batch.getNbObjects();
+    const uint32 rangeStartIndex = std::max(startIndex, batchStartIndex);
+    const uint32 rangeEndIndex = std::min(endIndex, batchEndIndex);
+
+    batchItemIndex = rangeStartIndex - batchStartIndex;
+    batchNbItems = rangeEndIndex > rangeStartIndex ? rangeEndIndex - rangeStartIndex : 0;
+    batchStartIndex = batchEndIndex;
+
+    return batchNbItems > 0;
+}
+
+// Execute the narrow-phase collision detection algorithm on a range of the tests of the batches
+/**
+ * The tests of all the batches of the narrow-phase input are seen as a single range (in the order of
+ * the batches) and only the tests with an index in [startIndex, endIndex) are computed.
+ */
+bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput, uint32 startIndex, uint32 endIndex,
+                                                        bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator) {
+
     bool contactFound = false;
 
     // Get the narrow-phase collision detection algorithms for each kind of collision shapes
@@ -627,6 +717,7 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     SphereVsConvexPolyhedronAlgorithm* sphereVsConvexPolyAlgo = mCollisionDispatch.getSphereVsConvexPolyhedronAlgorithm();
     CapsuleVsConvexPolyhedronAlgorithm* capsuleVsConvexPolyAlgo = mCollisionDispatch.getCapsuleVsConvexPolyhedronAlgorithm();
     ConvexPolyhedronVsConvexPolyhedronAlgorithm* convexPolyVsConvexPolyAlgo = mCollisionDispatch.getConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    BoxVsBoxAlgorithm* boxVsBoxAlgo = mCollisionDispatch.getBoxVsBoxAlgorithm();
 
     // get the narrow-phase batches to test for collision for contacts
     NarrowPhaseInfoBatch& sphereVsSphereBatchContacts = narrowPhaseInput.getSphereVsSphereBatch();
@@ -635,30 +726,75 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatchContacts = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatchContacts = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatchContacts = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatchContacts = narrowPhaseInput.getBoxVsBoxBatch();
+
+    uint32 batchStartIndex = 0;
+    uint32 batchItemIndex;
+    uint32 batchNbItems;
 
     // Compute the narrow-phase collision detection for each kind of collision shapes (for contacts)
-    if (sphereVsSphereBatchContacts.getNbObjects() > 0) {
-        contactFound |= sphereVsSphereAlgo->testCollision(sphereVsSphereBatchContacts, 0, sphereVsSphereBatchContacts.getNbObjects(), allocator);
+    if (computeBatchItemsInRange(sphereVsSphereBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= sphereVsSphereAlgo->testCollision(sphereVsSphereBatchContacts, batchItemIndex, batchNbItems, allocator);
+    }
+    if (computeBatchItemsInRange(sphereVsCapsuleBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= sphereVsCapsuleAlgo->testCollision(sphereVsCapsuleBatchContacts, batchItemIndex, batchNbItems, allocator);
     }
-    if (sphereVsCapsuleBatchContacts.getNbObjects() > 0) {
-        contactFound |= sphereVsCapsuleAlgo->testCollision(sphereVsCapsuleBatchContacts, 0, sphereVsCapsuleBatchContacts.getNbObjects(), allocator);
+    if (computeBatchItemsInRange(capsuleVsCapsuleBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= capsuleVsCapsuleAlgo->testCollision(capsuleVsCapsuleBatchContacts, batchItemIndex, batchNbItems, allocator);
     }
-    if (capsuleVsCapsuleBatchContacts.getNbObjects() > 0) {
-        contactFound |= capsuleVsCapsuleAlgo->testCollision(capsuleVsCapsuleBatchContacts, 0, capsuleVsCapsuleBatchContacts.getNbObjects(), allocator);
+    if (computeBatchItemsInRange(sphereVsConvexPolyhedronBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= sphereVsConvexPolyAlgo->testCollision(sphereVsConvexPolyhedronBatchContacts, batchItemIndex, batchNbItems, clipWithPreviousAxisIfStillColliding, allocator);
     }
-    if (sphereVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= sphereVsConvexPolyAlgo->testCollision(sphereVsConvexPolyhedronBatchContacts, 0, sphereVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+    if (computeBatchItemsInRange(capsuleVsConvexPolyhedronBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= capsuleVsConvexPolyAlgo->testCollision(capsuleVsConvexPolyhedronBatchContacts, batchItemIndex, batchNbItems, clipWithPreviousAxisIfStillColliding, allocator);
     }
-    if (capsuleVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= capsuleVsConvexPolyAlgo->testCollision(capsuleVsConvexPolyhedronBatchContacts, 0, capsuleVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+    if (computeBatchItemsInRange(convexPolyhedronVsConvexPolyhedronBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, batchItemIndex, batchNbItems, clipWithPreviousAxisIfStillColliding, allocator);
     }
-    if (convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, 0, convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+    if (computeBatchItemsInRange(boxVsBoxBatchContacts, startIndex, endIndex, batchStartIndex, batchItemIndex, batchNbItems)) {
+        contactFound |= boxVsBoxAlgo->testCollision(boxVsBoxBatchContacts, batchItemIndex, batchNbItems, clipWithPreviousAxisIfStillColliding, allocator);
     }
 
     return contactFound;
 }
 
+// Execute the narrow-phase collision detection algorithm on batches with the threads of a task scheduler
+/**
+ * The narrow-phase tests are independent from each other. They are split into chunks that are
+ * computed concurrently. Each thread uses its own single frame allocator for the temporary memory
+ * of the algorithms. The results are written in the narrow-phase info of each test and are
+ * therefore the same as with a serial execution.
+ */
+bool CollisionDetectionSystem::testNarrowPhaseCollisionParallel(NarrowPhaseInput& narrowPhaseInput, bool clipWithPreviousAxisIfStillColliding,
+                                                                TaskScheduler& taskScheduler) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::testNarrowPhaseCollisionParallel()", mProfiler);
+
+    // Make sure each thread has its own single frame allocator
+    mMemoryManager.createThreadAllocators(taskScheduler.getNbThreads());
+
+    // The output buffers of contact points cannot grow during the parallel tests
+    narrowPhaseInput.allocateContactPoints();
+
+    NarrowPhaseTask task(*this, narrowPhaseInput, clipWithPreviousAxisIfStillColliding);
+    TaskScheduler::run(&taskScheduler, task, narrowPhaseInput.getNbObjects(), NARROW_PHASE_MIN_BATCH_SIZE);
+
+    // The temporary memory of the algorithms is not used anymore
+    mMemoryManager.resetThreadFrameAllocators();
+
+    return task.isContactFound();
+}
+
+// Test the narrow-phase tests in the range [startIndex, endIndex)
+void CollisionDetectionSystem::NarrowPhaseTask::execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) {
+
+    MemoryAllocator& allocator = mCollisionDetection.mMemoryManager.getThreadFrameAllocator(threadIndex);
+
+    if (mCollisionDetection.testNarrowPhaseCollision(mNarrowPhaseInput, startIndex, endIndex, mClipWithPreviousAxisIfStillColliding, allocator)) {
+        mIsContactFound.store(true, std::memory_order_relaxed);
+    }
+}
+
 // Process the potential contacts after narrow-phase collision detection
 void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo,
                                                      Array<ContactPointInfo>& potentialContactPoints,
@@ -676,6 +812,7 @@ void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& nar
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatch = narrowPhaseInput.getBoxVsBoxBatch();
 
     // Process the potential contacts
     processPotentialContacts(sphereVsSphereBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
@@ -685,6 +822,7 @@ void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& nar
     processPotentialContacts(capsuleVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
     processPotentialContacts(convexPolyhedronVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints,
                              potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
+    processPotentialContacts(boxVsBoxBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
 }
 
 // Compute the narrow-phase collision detection
@@ -700,8 +838,17 @@ void CollisionDetectionSystem::computeNarrowPhase() {
     mPotentialContactManifolds.reserve(mNbPreviousPotentialContactManifolds);
     mPotentialContactPoints.reserve(mNbPreviousPotentialContactPoints);
 
-    // Test the narrow-phase collision detection on the batches to be tested
-    testNarrowPhaseCollision(mNarrowPhaseInput, true, allocator);
+    // Test the narrow-phase collision detection on the batches to be tested (with the
+    // threads of the task scheduler if the world has one)
+    TaskScheduler* taskScheduler = mWorld->getTaskScheduler();
+    if (taskScheduler != nullptr && taskScheduler->getNbThreads() > 1 &&
+        mNarrowPhaseInput.getNbObjects() > NARROW_PHASE_MIN_BATCH_SIZE) {
+
+        testNarrowPhaseCollisionParallel(mNarrowPhaseInput, true, *taskScheduler);
+    }
+    else {
+        testNarrowPhaseCollision(mNarrowPhaseInput, true, allocator);
+    }
 
     // Process all the potential contacts after narrow-phase collision
     processAllPotentialContacts(mNarrowPhaseInput, true, mPotentialContactPoints,
@@ -756,7 +903,7 @@ bool CollisionDetectionSystem::computeNarrowPhaseOverlapSnapshot(NarrowPhaseInpu
         // Compute the overlapping colliders
         Array<ContactPair> contactPairs(allocator);
         Array<ContactPair> lostContactPairs(allocator);          // Always empty in this case (snapshot)
-        computeOverlapSnapshotContactPairs(narrowPhaseInput, contactPairs);
+        computeOverlapSnapshotContactPairs(narrowPhaseInput, contactPairs, mMemoryManager.getHeapAllocator());
 
         // Report overlapping colliders
         OverlapCallback::CallbackData callbackData(contactPairs, lostContactPairs, false, *mWorld);
@@ -767,9 +914,10 @@ bool CollisionDetectionSystem::computeNarrowPhaseOverlapSnapshot(NarrowPhaseInpu
 }
 
 // Process the potential overlapping bodies  for the testOverlap() methods
-void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInput& narrowPhaseInput, Array<ContactPair>& contactPairs) const {
+void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInput& narrowPhaseInput, Array<ContactPair>& contactPairs,
+                                                                  MemoryAllocator& allocator) const {
 
-    Set<uint64> setOverlapContactPairId(mMemoryManager.getHeapAllocator());
+    Set<uint64> setOverlapContactPairId(allocator);
 
     // get the narrow-phase batches to test for collision
     NarrowPhaseInfoBatch& sphereVsSphereBatch = narrowPhaseInput.getSphereVsSphereBatch();
@@ -778,6 +926,7 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatch = narrowPhaseInput.getBoxVsBoxBatch();
 
     // Process the potential contacts
     computeOverlapSnapshotContactPairs(sphereVsSphereBatch, contactPairs, setOverlapContactPairId);
@@ -786,6 +935,7 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     computeOverlapSnapshotContactPairs(sphereVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(capsuleVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(convexPolyhedronVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(boxVsBoxBatch, contactPairs, setOverlapContactPairId);
 }
 
 // Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
@@ -812,13 +962,13 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInf
     for(uint32 i=0; i < narrowPhaseInfoBatch.getNbObjects(); i++) {
 
         // If there is a collision
-        if (narrowPhaseInfoBatch.narrowPhaseInfos[i].isColliding) {
+        if (narrowPhaseInfoBatch.isColliding[i]) {
 
             // If the contact pair does not already exist
-            if (!setOverlapContactPairId.contains(narrowPhaseInfoBatch.narrowPhaseInfos[i].overlappingPairId)) {
+            if (!setOverlapContactPairId.contains(narrowPhaseInfoBatch.overlappingPairIds[i])) {
 
-                const Entity collider1Entity = narrowPhaseInfoBatch.narrowPhaseInfos[i].colliderEntity1;
-                const Entity collider2Entity = narrowPhaseInfoBatch.narrowPhaseInfos[i].colliderEntity2;
+                const Entity collider1Entity = narrowPhaseInfoBatch.colliderEntities1[i];
+                const Entity collider2Entity = narrowPhaseInfoBatch.colliderEntities2[i];
 
                 const uint32 collider1Index = mCollidersComponents.getEntityIndex(collider1Entity);
                 const uint32 collider2Index = mCollidersComponents.getEntityIndex(collider2Entity);
@@ -829,10 +979,10 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInf
                 const bool isTrigger = mCollidersComponents.mIsTrigger[collider1Index] || mCollidersComponents.mIsTrigger[collider2Index];
 
                 // Create a new contact pair
-                ContactPair contactPair(narrowPhaseInfoBatch.narrowPhaseInfos[i].overlappingPairId, body1Entity, body2Entity, collider1Entity, collider2Entity, static_cast<uint32>(contactPairs.size()), false, isTrigger);
+                ContactPair contactPair(narrowPhaseInfoBatch.overlappingPairIds[i], body1Entity, body2Entity, collider1Entity, collider2Entity, static_cast<uint32>(contactPairs.size()), false, isTrigger);
                 contactPairs.add(contactPair);
 
-                setOverlapContactPairId.add(narrowPhaseInfoBatch.narrowPhaseInfos[i].overlappingPairId);
+                setOverlapContactPairId.add(narrowPhaseInfoBatch.overlappingPairIds[i]);
             }
         }
 
@@ -1187,13 +1337,113 @@ void CollisionDetectionSystem::raycast(RaycastCallback* raycastCallback, const R
 
     RP3D_PROFILE("CollisionDetectionSystem::raycast()", mProfiler);
 
-    RaycastTest rayCastTest(raycastCallback);
+    // The temporary memory of the raycast is allocated on the stack (the raycast does not lock any allocator
+    // and can therefore be called concurrently by multiple threads while the world is not modified)
+    char scratchMemory[QUERY_SCRATCH_MEMORY_NB_BYTES];
+    ScratchAllocator allocator(scratchMemory, QUERY_SCRATCH_MEMORY_NB_BYTES, mMemoryManager.getHeapAllocator());
+
+    RaycastTest rayCastTest(raycastCallback, allocator);
 
     // Ask the broad-phase algorithm to call the testRaycastAgainstShape()
     // callback method for each collider hit by the ray in the broad-phase
     mBroadPhaseSystem.raycast(ray, rayCastTest, raycastWithCategoryMaskBits);
 }
 
+// Ray casting method that only computes the closest hit
+/// The ray is clipped at each hit. Since the trees visit their nodes from front to back, the
+/// nodes behind the closest hit found so far are skipped.
+/**
+ * @param ray The ray to cast
+ * @param raycastInfo Information about the closest hit (only valid if the method returns true)
+ * @param raycastWithCategoryMaskBits Bits mask corresponding to the category of colliders to be raycasted
+ * @return True if the ray hits a collider
+ */
+bool CollisionDetectionSystem::raycast(const Ray& ray, RaycastInfo& raycastInfo, unsigned short raycastWithCategoryMaskBits) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::raycast()", mProfiler);
+
+    // The temporary memory of the raycast is allocated on the stack (the raycast does not lock any allocator
+    // and can therefore be called concurrently by multiple threads while the world is not modified)
+    char scratchMemory[QUERY_SCRATCH_MEMORY_NB_BYTES];
+    ScratchAllocator allocator(scratchMemory, QUERY_SCRATCH_MEMORY_NB_BYTES, mMemoryManager.getHeapAllocator());
+
+    raycastInfo.collider = nullptr;
+
+    RaycastTest rayCastTest(raycastInfo, allocator);
+
+    mBroadPhaseSystem.raycast(ray, rayCastTest, raycastWithCategoryMaskBits);
+
+    return raycastInfo.collider != nullptr;
+}
+
+// Ray casting method for a batch of rays that only computes the closest hit of each ray
+/// The rays are split into packets of consecutive rays that are cast together through the
+/// broad-phase trees. The packets are cast on the threads of the task scheduler (if any).
+/**
+ * @param rays Array with the rays to cast
+ * @param nbRays Number of rays
+ * @param raycastInfos Array where the closest hit of each ray is stored (the collider is nullptr if the ray has not hit anything)
+ * @param raycastWithCategoryMaskBits Bits mask corresponding to the category of colliders to be raycasted
+ * @param taskScheduler Task scheduler used to cast the packets of rays on multiple threads (can be nullptr)
+ * @return The number of rays that hit a collider
+ */
+uint32 CollisionDetectionSystem::raycastBatch(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, unsigned short raycastWithCategoryMaskBits,
+                                              TaskScheduler* taskScheduler) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::raycastBatch()", mProfiler);
+
+    const uint32 nbPackets = (nbRays + DynamicAABBTree::RAYCAST_PACKET_SIZE - 1) / DynamicAABBTree::RAYCAST_PACKET_SIZE;
+
+    RaycastBatchTask task(*this, rays, nbRays, raycastInfos, raycastWithCategoryMaskBits);
+    TaskScheduler::run(taskScheduler, task, nbPackets, RAYCAST_BATCH_MIN_NB_PACKETS);
+
+    uint32 nbHits = 0;
+    for (uint32 i=0; i < nbRays; i++) {
+        if (raycastInfos[i].collider != nullptr) nbHits++;
+    }
+
+    return nbHits;
+}
+
+// Cast the packets of rays of a range of a batch
+/**
+ * @param rays Array with the rays of the batch
+ * @param nbRays Number of rays in the batch
+ * @param raycastInfos Array where the closest hit of each ray is stored
+ * @param startPacket Index of the first packet to cast
+ * @param endPacket Index after the last packet to cast
+ * @param raycastWithCategoryMaskBits Bits mask corresponding to the category of colliders to be raycasted
+ */
+void CollisionDetectionSystem::raycastPackets(const Ray* rays, uint32 nbRays, RaycastInfo* raycastInfos, uint32 startPacket,
+                                              uint32 endPacket, unsigned short raycastWithCategoryMaskBits) const {
+
+    // The temporary memory of the raycasts is allocated on the stack (the packets can therefore be
+    // cast concurrently by multiple threads)
+    char scratchMemory[QUERY_SCRATCH_MEMORY_NB_BYTES];
+    ScratchAllocator allocator(scratchMemory, QUERY_SCRATCH_MEMORY_NB_BYTES, mMemoryManager.getHeapAllocator());
+
+    for (uint32 p=startPacket; p < endPacket; p++) {
+
+        const uint32 firstRayIndex = p * DynamicAABBTree::RAYCAST_PACKET_SIZE;
+        const uint32 nbRaysInPacket = std::min(DynamicAABBTree::RAYCAST_PACKET_SIZE, nbRays - firstRayIndex);
+
+        for (uint32 i=firstRayIndex; i < firstRayIndex + nbRaysInPacket; i++) {
+            raycastInfos[i].collider = nullptr;
+            raycastInfos[i].body = nullptr;
+            raycastInfos[i].hitFraction = decimal(-1.0);
+            raycastInfos[i].triangleIndex = -1;
+        }
+
+        mBroadPhaseSystem.raycastPacket(rays + firstRayIndex, nbRaysInPacket, raycastInfos + firstRayIndex,
+                                        raycastWithCategoryMaskBits, allocator);
+    }
+}
+
+// Cast the packets of rays in the range [startIndex, endIndex)
+void CollisionDetectionSystem::RaycastBatchTask::execute(uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+    mCollisionDetection.raycastPackets(mRays, mNbRays, mRaycastInfos, startIndex, endIndex, mRaycastWithCategoryMaskBits);
+}
+
 // Convert the potential contact into actual contacts
 void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, bool updateLastFrameInfo,
                                                         Array<ContactPointInfo>& potentialContactPoints,
@@ -1210,10 +1460,10 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
         // For each narrow phase info object
         for(uint32 i=0; i < nbObjects; i++) {
 
-            narrowPhaseInfoBatch.narrowPhaseInfos[i].lastFrameCollisionInfo->wasColliding = narrowPhaseInfoBatch.narrowPhaseInfos[i].isColliding;
+            narrowPhaseInfoBatch.lastFrameCollisionInfos[i]->wasColliding = narrowPhaseInfoBatch.isColliding[i];
 
             // The previous frame collision info is now valid
-            narrowPhaseInfoBatch.narrowPhaseInfos[i].lastFrameCollisionInfo->isValid = true;
+            narrowPhaseInfoBatch.lastFrameCollisionInfos[i]->isValid = true;
         }
     }
 
@@ -1221,17 +1471,17 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
     for(uint32 i=0; i < nbObjects; i++) {
 
         // If the two colliders are colliding
-        if (narrowPhaseInfoBatch.narrowPhaseInfos[i].isColliding) {
+        if (narrowPhaseInfoBatch.isColliding[i]) {
 
-            const uint64 pairId = narrowPhaseInfoBatch.narrowPhaseInfos[i].overlappingPairId;
+            const uint64 pairId = narrowPhaseInfoBatch.overlappingPairIds[i];
             OverlappingPairs::OverlappingPair* overlappingPair = mOverlappingPairs.getOverlappingPair(pairId);
             assert(overlappingPair != nullptr);
 
             overlappingPair->collidingInCurrentFrame = true;
 
 
-            const Entity collider1Entity = narrowPhaseInfoBatch.narrowPhaseInfos[i].colliderEntity1;
-            const Entity collider2Entity = narrowPhaseInfoBatch.narrowPhaseInfos[i].colliderEntity2;
+            const Entity collider1Entity = narrowPhaseInfoBatch.colliderEntities1[i];
+            const Entity collider2Entity = narrowPhaseInfoBatch.colliderEntities2[i];
 
             const uint32 collider1Index = mCollidersComponents.getEntityIndex(collider1Entity);
             const uint32 collider2Index = mCollidersComponents.getEntityIndex(collider2Entity);
@@ -1240,8 +1490,8 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
             const Entity body2Entity = mCollidersComponents.mBodiesEntities[collider2Index];
 
             const bool isTrigger = mCollidersComponents.mIsTrigger[collider1Index] || mCollidersComponents.mIsTrigger[collider2Index];
-            assert((isTrigger && narrowPhaseInfoBatch.narrowPhaseInfos[i].nbContactPoints == 0) ||
-                   (!isTrigger && narrowPhaseInfoBatch.narrowPhaseInfos[i].nbContactPoints > 0));
+            assert((isTrigger && narrowPhaseInfoBatch.nbContactPoints[i] == 0) ||
+                   (!isTrigger && narrowPhaseInfoBatch.nbContactPoints[i] > 0));
 
             // If we have a convex vs convex collision (if we consider the base collision shapes of the colliders)
             if (mCollidersComponents.mCollisionShapes[collider1Index]->isConvex() &&
@@ -1257,7 +1507,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                 ContactPair* pairContact = &((*contactPairs)[newContactPairIndex]);
 
                 // If there are contact points (not the case with collision with a trigger)
-                if (narrowPhaseInfoBatch.narrowPhaseInfos[i].nbContactPoints > 0) {
+                if (narrowPhaseInfoBatch.nbContactPoints[i] > 0) {
 
                     // Create a new potential contact manifold for the overlapping pair
                     uint32 contactManifoldIndex = static_cast<uint>(potentialContactManifolds.size());
@@ -1267,7 +1517,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                     const uint32 contactPointIndexStart = static_cast<uint>(potentialContactPoints.size());
 
                     // Add the potential contacts
-                    for (uint32 j=0; j < narrowPhaseInfoBatch.narrowPhaseInfos[i].nbContactPoints; j++) {
+                    for (uint32 j=0; j < narrowPhaseInfoBatch.nbContactPoints[i]; j++) {
 
                         if (contactManifoldInfo.nbPotentialContactPoints < NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD) {
 
@@ -1276,7 +1526,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                             contactManifoldInfo.nbPotentialContactPoints++;
 
                             // Add the contact point to the array of potential contact points
-                            const ContactPointInfo& contactPoint = narrowPhaseInfoBatch.narrowPhaseInfos[i].contactPoints[j];
+                            const ContactPointInfo& contactPoint = narrowPhaseInfoBatch.getContactPoint(i, j);
 
                             potentialContactPoints.add(contactPoint);
                         }
@@ -1315,12 +1565,12 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                 assert(pairContact != nullptr);
 
                 // If there are contact points (not the case with collision with a trigger)
-                if (narrowPhaseInfoBatch.narrowPhaseInfos[i].nbContactPoints > 0) {
+                if (narrowPhaseInfoBatch.nbContactPoints[i] > 0) {
 
                     // Add the potential contacts
-                    for (uint32 j=0; j < narrowPhaseInfoBatch.narrowPhaseInfos[i].nbContactPoints; j++) {
+                    for (uint32 j=0; j < narrowPhaseInfoBatch.nbContactPoints[i]; j++) {
 
-                        const ContactPointInfo& contactPoint = narrowPhaseInfoBatch.narrowPhaseInfos[i].contactPoints[j];
+                        const ContactPointInfo& contactPoint = narrowPhaseInfoBatch.getContactPoint(i, j);
 
                         // Add the contact point to the array of potential contact points
                         const uint32 contactPointIndex = static_cast<uint32>(potentialContactPoints.size());
@@ -1777,7 +2027,7 @@ bool CollisionDetectionSystem::testOverlap(Body* body1, Body* body2) {
     NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(true);
 
     // Filter the overlapping pairs to get only the ones with the selected body involved
     Array<uint64> convexPairs(mMemoryManager.getPoolAllocator());
@@ -1802,7 +2052,7 @@ void CollisionDetectionSystem::testOverlap(OverlapCallback& callback) {
     NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(true);
 
     // Compute the middle-phase collision detection
     computeMiddlePhase(narrowPhaseInput, false, true);
@@ -1817,7 +2067,7 @@ void CollisionDetectionSystem::testOverlap(Body* body, OverlapCallback& callback
     NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(true);
 
     // Filter the overlapping pairs to get only the ones with the selected body involved
     Array<uint64> convexPairs(mMemoryManager.getPoolAllocator());
@@ -1834,13 +2084,174 @@ void CollisionDetectionSystem::testOverlap(Body* body, OverlapCallback& callback
     }
 }
 
+// Report the bodies that overlap with a body without modifying the collision detection state
+/// This method is used for the queries during a query snapshot of the world. Instead of using the
+/// overlapping pairs of the world, the colliders of the body are tested against the dynamic AABB
+/// tree of the broad-phase and temporary pairs are created for the middle-phase and narrow-phase.
+/// All the temporary memory is allocated on the stack with a scratch allocator. Therefore, this method
+/// can be called concurrently by multiple threads while the world is not modified.
+/**
+ * @param body1 Body to test
+ * @param body2 The other body to test or nullptr to test the body against all the other bodies
+ * @param callback Callback used to report the overlapping bodies (or nullptr)
+ * @return True if the body overlaps with another body
+ */
+bool CollisionDetectionSystem::testOverlapQuery(Body* body1, Body* body2, OverlapCallback* callback) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::testOverlapQuery()", mProfiler);
+
+    char scratchMemory[QUERY_SCRATCH_MEMORY_NB_BYTES];
+    ScratchAllocator allocator(scratchMemory, QUERY_SCRATCH_MEMORY_NB_BYTES, mMemoryManager.getHeapAllocator());
+
+    const Entity body1Entity = body1->getEntity();
+
+    NarrowPhaseInput narrowPhaseInput(allocator, mOverlappingPairs);
+    Array<LastFrameCollisionInfo*> lastFrameInfos(allocator);
+    Array<OverlappingPairs::ConcaveOverlappingPair*> concavePairs(allocator);
+    Array<int32> overlappingNodes(allocator, 64);
+
+    // For each collider of the body
+    const Array<Entity>& colliderEntities = mWorld->mBodyComponents.getColliders(body1Entity);
+    const uint32 nbColliderEntities = static_cast<uint32>(colliderEntities.size());
+    for (uint32 c=0; c < nbColliderEntities; c++) {
+
+        const uint32 collider1Index = mCollidersComponents.getEntityIndex(colliderEntities[c]);
+        const int32 broadPhaseId1 = mCollidersComponents.mBroadPhaseIds[collider1Index];
+
+        // If the collider is not in the broad-phase (disabled collider) or is not a world query collider
+        if (broadPhaseId1 == -1 || !mCollidersComponents.mIsWorldQueryCollider[collider1Index]) continue;
+
+        // Get the broad-phase shapes overlapping with the collider
+        overlappingNodes.clear();
+        mBroadPhaseSystem.reportAllShapesOverlappingWithAABB(mBroadPhaseSystem.getFatAABB(broadPhaseId1), overlappingNodes, allocator);
+
+        const uint32 nbOverlappingNodes = static_cast<uint32>(overlappingNodes.size());
+        for (uint32 i=0; i < nbOverlappingNodes; i++) {
+
+            const int32 broadPhaseId2 = overlappingNodes[i];
+            if (broadPhaseId2 == broadPhaseId1) continue;
+
+            const Entity collider2Entity = mBroadPhaseSystem.getColliderForBroadPhaseId(broadPhaseId2)->getEntity();
+            const uint32 collider2Index = mCollidersComponents.getEntityIndex(collider2Entity);
+
+            // Apply the same filtering as for the overlapping pairs of the world
+            if (!mCollidersComponents.mIsWorldQueryCollider[collider2Index]) continue;
+            const Entity body2Entity = mCollidersComponents.mBodiesEntities[collider2Index];
+            if (body2Entity == body1Entity) continue;
+            if (body2 != nullptr && body2Entity != body2->getEntity()) continue;
+            if (mNoCollisionPairs.contains(OverlappingPairs::computeBodiesIndexPair(body1Entity, body2Entity))) continue;
+            if ((mCollidersComponents.mCollideWithMaskBits[collider1Index] & mCollidersComponents.mCollisionCategoryBits[collider2Index]) == 0 ||
+                (mCollidersComponents.mCollisionCategoryBits[collider1Index] & mCollidersComponents.mCollideWithMaskBits[collider2Index]) == 0) {
+                continue;
+            }
+
+            CollisionShape* collisionShape1 = mCollidersComponents.mCollisionShapes[collider1Index];
+            CollisionShape* collisionShape2 = mCollidersComponents.mCollisionShapes[collider2Index];
+            const bool isShape1Convex = collisionShape1->isConvex();
+            const bool isShape2Convex = collisionShape2->isConvex();
+            if (!isShape1Convex && !isShape2Convex) continue;
+
+            const uint64 pairId = pairNumbers(std::max(broadPhaseId1, broadPhaseId2), std::min(broadPhaseId1, broadPhaseId2));
+
+            if (isShape1Convex && isShape2Convex) {
+
+                // The last frame collision info of the temporary pair is only used by the algorithms during this query
+                LastFrameCollisionInfo* lastFrameInfo = new (allocator.allocate(sizeof(LastFrameCollisionInfo))) LastFrameCollisionInfo();
+                lastFrameInfos.add(lastFrameInfo);
+
+                NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1, collisionShape2);
+                narrowPhaseInput.addNarrowPhaseTest(pairId, colliderEntities[c], collider2Entity, collisionShape1, collisionShape2,
+                                                    mCollidersComponents.mLocalToWorldTransforms[collider1Index],
+                                                    mCollidersComponents.mLocalToWorldTransforms[collider2Index],
+                                                    algorithmType, false, lastFrameInfo, allocator);
+            }
+            else {
+
+                NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(isShape1Convex ? collisionShape1->getType() : collisionShape2->getType(),
+                                                                                                       CollisionShapeType::CONVEX_POLYHEDRON);
+
+                OverlappingPairs::ConcaveOverlappingPair* concavePair = new (allocator.allocate(sizeof(OverlappingPairs::ConcaveOverlappingPair)))
+                                         OverlappingPairs::ConcaveOverlappingPair(pairId, broadPhaseId1, broadPhaseId2, colliderEntities[c], collider2Entity,
+                                                                                  algorithmType, isShape1Convex, allocator, allocator, true);
+                concavePairs.add(concavePair);
+
+                computeConvexVsConcaveMiddlePhase(*concavePair, allocator, narrowPhaseInput, false, false);
+            }
+        }
+    }
+
+    // Compute the narrow-phase collision detection
+    bool collisionFound = testNarrowPhaseCollision(narrowPhaseInput, false, allocator);
+    if (collisionFound && callback != nullptr) {
+
+        // Compute the overlapping colliders
+        Array<ContactPair> contactPairs(allocator);
+        Array<ContactPair> lostContactPairs(allocator);          // Always empty in this case (snapshot)
+        computeOverlapSnapshotContactPairs(narrowPhaseInput, contactPairs, allocator);
+
+        // Report overlapping colliders
+        OverlapCallback::CallbackData callbackData(contactPairs, lostContactPairs, false, *mWorld);
+        (*callback).onOverlap(callbackData);
+    }
+
+    // Release the temporary memory that can have been allocated outside of the scratch memory
+    narrowPhaseInput.clear();
+    for (uint32 i=0; i < lastFrameInfos.size(); i++) {
+        lastFrameInfos[i]->LastFrameCollisionInfo::~LastFrameCollisionInfo();
+        allocator.release(lastFrameInfos[i], sizeof(LastFrameCollisionInfo));
+    }
+    for (uint32 i=0; i < concavePairs.size(); i++) {
+        concavePairs[i]->destroyLastFrameCollisionInfos();
+        concavePairs[i]->~ConcaveOverlappingPair();
+        allocator.release(concavePairs[i], sizeof(OverlappingPairs::ConcaveOverlappingPair));
+    }
+
+    return collisionFound;
+}
+
+// Report all the colliders with a world-space AABB overlapping with a given AABB
+/// The dynamic AABB tree of the broad-phase is only read and the temporary memory is allocated on the
+/// stack. Therefore, this method can be called concurrently by multiple threads while the world is not modified.
+/**
+ * @param worldAABB The AABB (in world-space) to test
+ * @param callback Callback called for each collider overlapping with the AABB
+ * @param collideWithMaskBits Bits mask of the collision categories of the colliders to report
+ */
+void CollisionDetectionSystem::testOverlapAABB(const AABB& worldAABB, AABBQueryCallback& callback, unsigned short collideWithMaskBits) const {
+
+    RP3D_PROFILE("CollisionDetectionSystem::testOverlapAABB()", mProfiler);
+
+    char scratchMemory[QUERY_SCRATCH_MEMORY_NB_BYTES];
+    ScratchAllocator allocator(scratchMemory, QUERY_SCRATCH_MEMORY_NB_BYTES, mMemoryManager.getHeapAllocator());
+
+    // Get the broad-phase shapes with a fat AABB overlapping with the AABB
+    Array<int32> overlappingNodes(allocator, 64);
+    mBroadPhaseSystem.reportAllShapesOverlappingWithAABB(worldAABB, overlappingNodes, allocator);
+
+    const uint32 nbOverlappingNodes = static_cast<uint32>(overlappingNodes.size());
+    for (uint32 i=0; i < nbOverlappingNodes; i++) {
+
+        Collider* collider = mBroadPhaseSystem.getColliderForBroadPhaseId(overlappingNodes[i]);
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(collider->getEntity());
+
+        // Check that the collider is a world query collider and its collision category
+        if (!mCollidersComponents.mIsWorldQueryCollider[colliderIndex]) continue;
+        if ((mCollidersComponents.mCollisionCategoryBits[colliderIndex] & collideWithMaskBits) == 0) continue;
+
+        // Test the actual world-space AABB of the collider
+        if (worldAABB.testCollision(collider->getWorldAABB())) {
+            callback.notifyOverlappingCollider(collider);
+        }
+    }
+}
+
 // Test collision and report contacts between two bodies.
 void CollisionDetectionSystem::testCollision(Body* body1, Body* body2, CollisionCallback& callback) {
 
     NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(true);
 
     // Filter the overlapping pairs to get only the ones with the selected body involved
     Array<uint64> convexPairs(mMemoryManager.getPoolAllocator());
@@ -1863,7 +2274,7 @@ void CollisionDetectionSystem::testCollision(Body* body, CollisionCallback& call
     NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(true);
 
     // Filter the overlapping pairs to get only the ones with the selected body involved
     Array<uint64> convexPairs(mMemoryManager.getPoolAllocator());
@@ -1886,7 +2297,7 @@ void CollisionDetectionSystem::testCollision(CollisionCallback& callback) {
     NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
-    computeBroadPhase();
+    computeBroadPhase(true);
 
     // Compute the middle-phase collision detection
     computeMiddlePhase(narrowPhaseInput, true, true);
@@ -1902,8 +2313,9 @@ void CollisionDetectionSystem::filterOverlappingPairs(Entity bodyEntity, Array<u
     const uint32 nbConvexPairs = static_cast<uint32>(mOverlappingPairs.mConvexPairs.size());
     for (uint32 i=0; i < nbConvexPairs; i++) {
 
-        if (mCollidersComponents.getBody(mOverlappingPairs.mConvexPairs[i].collider1) == bodyEntity ||
-            mCollidersComponents.getBody(mOverlappingPairs.mConvexPairs[i].collider2) == bodyEntity) {
+        if ((mCollidersComponents.getBody(mOverlappingPairs.mConvexPairs[i].collider1) == bodyEntity ||
+             mCollidersComponents.getBody(mOverlappingPairs.mConvexPairs[i].collider2) == bodyEntity) &&
+            isWorldQueryPair(mOverlappingPairs.mConvexPairs[i].collider1, mOverlappingPairs.mConvexPairs[i].collider2)) {
 
             convexPairs.add(mOverlappingPairs.mConvexPairs[i].pairID);
         }
@@ -1913,8 +2325,9 @@ void CollisionDetectionSystem::filterOverlappingPairs(Entity bodyEntity, Array<u
     const uint32 nbConcavePairs = static_cast<uint32>(mOverlappingPairs.mConcavePairs.size());
     for (uint32 i=0; i < nbConcavePairs; i++) {
 
-        if (mCollidersComponents.getBody(mOverlappingPairs.mConcavePairs[i].collider1) == bodyEntity ||
-            mCollidersComponents.getBody(mOverlappingPairs.mConcavePairs[i].collider2) == bodyEntity) {
+        if ((mCollidersComponents.getBody(mOverlappingPairs.mConcavePairs[i].collider1) == bodyEntity ||
+             mCollidersComponents.getBody(mOverlappingPairs.mConcavePairs[i].collider2) == bodyEntity) &&
+            isWorldQueryPair(mOverlappingPairs.mConcavePairs[i].collider1, mOverlappingPairs.mConcavePairs[i].collider2)) {
 
             concavePairs.add(mOverlappingPairs.mConcavePairs[i].pairID);
         }
@@ -1931,8 +2344,9 @@ void CollisionDetectionSystem::filterOverlappingPairs(Entity body1Entity, Entity
         const Entity collider1Body = mCollidersComponents.getBody(mOverlappingPairs.mConvexPairs[i].collider1);
         const Entity collider2Body = mCollidersComponents.getBody(mOverlappingPairs.mConvexPairs[i].collider2);
 
-        if ((collider1Body == body1Entity && collider2Body == body2Entity) ||
-            (collider1Body == body2Entity && collider2Body == body1Entity)) {
+        if (((collider1Body == body1Entity && collider2Body == body2Entity) ||
+             (collider1Body == body2Entity && collider2Body == body1Entity)) &&
+            isWorldQueryPair(mOverlappingPairs.mConvexPairs[i].collider1, mOverlappingPairs.mConvexPairs[i].collider2)) {
 
             convexPairs.add(mOverlappingPairs.mConvexPairs[i].pairID);
         }
@@ -1945,8 +2359,9 @@ void CollisionDetectionSystem::filterOverlappingPairs(Entity body1Entity, Entity
         const Entity collider1Body = mCollidersComponents.getBody(mOverlappingPairs.mConcavePairs[i].collider1);
         const Entity collider2Body = mCollidersComponents.getBody(mOverlappingPairs.mConcavePairs[i].collider2);
 
-        if ((collider1Body == body1Entity && collider2Body == body2Entity) ||
-            (collider1Body == body2Entity && collider2Body == body1Entity)) {
+        if (((collider1Body == body1Entity && collider2Body == body2Entity) ||
+             (collider1Body == body2Entity && collider2Body == body1Entity)) &&
+            isWorldQueryPair(mOverlappingPairs.mConcavePairs[i].collider1, mOverlappingPairs.mConcavePairs[i].collider2)) {
 
             concavePairs.add(mOverlappingPairs.mConcavePairs[i].pairID);
         }
@@ -29,11 +29,13 @@
 #include <reactphysics3d/components/BallAndSocketJointComponents.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/engine/Island.h>
+#include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/memory/MemoryManager.h>
 
 using namespace reactphysics3d;
 
 // Constructor
-ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+ConstraintSolverSystem::ConstraintSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                                TransformComponents& transformComponents,
                                                JointComponents& jointComponents,
                                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -45,7 +47,10 @@ ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& isl
                    mSolveBallAndSocketJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
                    mSolveFixedJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
                    mSolveHingeJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, hingeJointComponents),
-                   mSolveSliderJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents) {
+                   mSolveSliderJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents),
+                   mBodiesIslandIndices(memoryManager.getHeapAllocator()), mIslandsJoints(memoryManager.getHeapAllocator()),
+                   mIslandsJointsStartIndices(memoryManager.getHeapAllocator()), mJointsIslandIndices(memoryManager.getHeapAllocator()),
+                   mColoring(memoryManager.getHeapAllocator()) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -61,6 +66,24 @@ void ConstraintSolverSystem::initialize(decimal dt) {
 
     RP3D_PROFILE("ConstraintSolverSystem::initialize()", mProfiler);
 
+    setSolverParameters(dt);
+
+    mSolveBallAndSocketJointSystem.initBeforeSolve();
+    mSolveFixedJointSystem.initBeforeSolve();
+    mSolveHingeJointSystem.initBeforeSolve();
+    mSolveSliderJointSystem.initBeforeSolve();
+
+    if (mIsWarmStartingActive) {
+        mSolveBallAndSocketJointSystem.warmstart();
+        mSolveFixedJointSystem.warmstart();
+        mSolveHingeJointSystem.warmstart();
+        mSolveSliderJointSystem.warmstart();
+    }
+}
+
+// Set the time step and the warm starting parameter of the joints solvers
+void ConstraintSolverSystem::setSolverParameters(decimal dt) {
+
     // Set the current time step
     mTimeStep = dt;
 
@@ -76,18 +99,6 @@ void ConstraintSolverSystem::initialize(decimal dt) {
     mSolveHingeJointSystem.setIsWarmStartingActive(mIsWarmStartingActive);
     mSolveSliderJointSystem.setTimeStep(dt);
     mSolveSliderJointSystem.setIsWarmStartingActive(mIsWarmStartingActive);
-
-    mSolveBallAndSocketJointSystem.initBeforeSolve();
-    mSolveFixedJointSystem.initBeforeSolve();
-    mSolveHingeJointSystem.initBeforeSolve();
-    mSolveSliderJointSystem.initBeforeSolve();
-
-    if (mIsWarmStartingActive) {
-        mSolveBallAndSocketJointSystem.warmstart();
-        mSolveFixedJointSystem.warmstart();
-        mSolveHingeJointSystem.warmstart();
-        mSolveSliderJointSystem.warmstart();
-    }
 }
 
 // Solve the velocity constraints
@@ -101,6 +112,296 @@ void ConstraintSolverSystem::solveVelocityConstraints() {
     mSolveSliderJointSystem.solveVelocityConstraint();
 }
 
+// Compute the joints of each island for the island-parallel solver
+/// The joints of each island are sorted by joint type and keep the order of the
+/// joints components. Therefore, solving the joints island by island applies exactly
+/// the same sequence of impulses on each body as the serial solver. The joints that
+/// do not belong to any island are put into an additional group after the islands.
+void ConstraintSolverSystem::computeIslandsJoints() {
+
+    RP3D_PROFILE("ConstraintSolverSystem::computeIslandsJoints()", mProfiler);
+
+    RigidBodyComponents& rigidBodyComponents = mConstraintSolverData.rigidBodyComponents;
+
+    const uint32 nbIslands = mIslands.getNbIslands();
+    const uint32 nbKeys = (nbIslands + 1) * NB_JOINT_TYPES;
+
+    // Compute the island index of each non-static rigid body (a static body can be in several islands)
+    const uint32 nbRigidBodyComponents = rigidBodyComponents.getNbComponents();
+    mBodiesIslandIndices.clear();
+    mBodiesIslandIndices.reserve(nbRigidBodyComponents);
+    for (uint32 b=0; b < nbRigidBodyComponents; b++) {
+        mBodiesIslandIndices.add(NO_ISLAND);
+    }
+    for (uint32 i=0; i < nbIslands; i++) {
+
+        const uint32 startIndex = mIslands.startBodyEntitiesIndex[i];
+        for (uint32 b=startIndex; b < startIndex + mIslands.nbBodiesInIsland[i]; b++) {
+
+            const Entity bodyEntity = mIslands.bodyEntities[b];
+            if (rigidBodyComponents.getBodyType(bodyEntity) != BodyType::STATIC) {
+                mBodiesIslandIndices[rigidBodyComponents.getEntityIndex(bodyEntity)] = i;
+            }
+        }
+    }
+
+    const uint32 nbJoints[NB_JOINT_TYPES] = {mSolveBallAndSocketJointSystem.getNbEnabledJoints(),
+                                             mSolveFixedJointSystem.getNbEnabledJoints(),
+                                             mSolveHingeJointSystem.getNbEnabledJoints(),
+                                             mSolveSliderJointSystem.getNbEnabledJoints()};
+
+    // Compute the island of each joint and count the number of joints of each island and joint type
+    mJointsIslandIndices.clear();
+    mIslandsJointsStartIndices.clear();
+    mIslandsJointsStartIndices.reserve(nbKeys + 1);
+    for (uint32 k=0; k < nbKeys + 1; k++) {
+        mIslandsJointsStartIndices.add(0);
+    }
+    for (uint32 t=0; t < NB_JOINT_TYPES; t++) {
+        for (uint32 j=0; j < nbJoints[t]; j++) {
+
+            const uint32 islandIndex = computeJointIslandIndex(getJointEntity(t, j));
+            mJointsIslandIndices.add(islandIndex);
+            mIslandsJointsStartIndices[islandIndex * NB_JOINT_TYPES + t + 1]++;
+        }
+    }
+
+    // Compute the start index of the joints of each island and joint type
+    for (uint32 k=0; k < nbKeys; k++) {
+        mIslandsJointsStartIndices[k + 1] += mIslandsJointsStartIndices[k];
+    }
+
+    // Sort the joints by island and joint type (stable counting sort)
+    mIslandsJoints.clear();
+    mIslandsJoints.addWithoutInit(mJointsIslandIndices.size());
+    uint32 jointIndex = 0;
+    for (uint32 t=0; t < NB_JOINT_TYPES; t++) {
+        for (uint32 j=0; j < nbJoints[t]; j++) {
+
+            const uint32 key = mJointsIslandIndices[jointIndex] * NB_JOINT_TYPES + t;
+
+            // The start index is incremented here and restored below
+            mIslandsJoints[mIslandsJointsStartIndices[key]] = j;
+            mIslandsJointsStartIndices[key]++;
+
+            jointIndex++;
+        }
+    }
+
+    // Restore the start indices (each start index is now equal to the start index of the next key)
+    for (uint32 k=nbKeys; k > 0; k--) {
+        mIslandsJointsStartIndices[k] = mIslandsJointsStartIndices[k - 1];
+    }
+    mIslandsJointsStartIndices[0] = 0;
+}
+
+// Return the island index of a joint (or the number of islands if the joint is not in any island)
+/**
+ * @param jointEntity Entity of the joint
+ * @return The index of the island of the first non-static body of the joint
+ */
+uint32 ConstraintSolverSystem::computeJointIslandIndex(Entity jointEntity) const {
+
+    const RigidBodyComponents& rigidBodyComponents = mConstraintSolverData.rigidBodyComponents;
+    const JointComponents& jointComponents = mConstraintSolverData.jointComponents;
+
+    uint32 islandIndex = mBodiesIslandIndices[rigidBodyComponents.getEntityIndex(jointComponents.getBody1Entity(jointEntity))];
+    if (islandIndex == NO_ISLAND) {
+        islandIndex = mBodiesIslandIndices[rigidBodyComponents.getEntityIndex(jointComponents.getBody2Entity(jointEntity))];
+    }
+
+    return islandIndex == NO_ISLAND ? mIslands.getNbIslands() : islandIndex;
+}
+
+// Return the entity of a joint given its joint type and its index in the components of this type
+Entity ConstraintSolverSystem::getJointEntity(uint32 jointType, uint32 index) const {
+
+    switch (jointType) {
+        case 0: return mSolveBallAndSocketJointSystem.getJointEntity(index);
+        case 1: return mSolveFixedJointSystem.getJointEntity(index);
+        case 2: return mSolveHingeJointSystem.getJointEntity(index);
+        default: return mSolveSliderJointSystem.getJointEntity(index);
+    }
+}
+
+// Initialize and warm start the joints of an island (island-parallel solver)
+/**
+ * @param islandIndex Index of the island (or number of islands for the joints that are not in any island)
+ */
+void ConstraintSolverSystem::initializeIsland(uint32 islandIndex) {
+
+    const uint32 key = islandIndex * NB_JOINT_TYPES;
+    assert(key + NB_JOINT_TYPES < mIslandsJointsStartIndices.size());
+
+    for (uint32 j=mIslandsJointsStartIndices[key]; j < mIslandsJointsStartIndices[key + 1]; j++) {
+        mSolveBallAndSocketJointSystem.initBeforeSolve(mIslandsJoints[j]);
+    }
+    for (uint32 j=mIslandsJointsStartIndices[key + 1]; j < mIslandsJointsStartIndices[key + 2]; j++) {
+        mSolveFixedJointSystem.initBeforeSolve(mIslandsJoints[j]);
+    }
+    for (uint32 j=mIslandsJointsStartIndices[key + 2]; j < mIslandsJointsStartIndices[key + 3]; j++) {
+        mSolveHingeJointSystem.initBeforeSolve(mIslandsJoints[j]);
+    }
+    for (uint32 j=mIslandsJointsStartIndices[key + 3]; j < mIslandsJointsStartIndices[key + 4]; j++) {
+        mSolveSliderJointSystem.initBeforeSolve(mIslandsJoints[j]);
+    }
+
+    if (mIsWarmStartingActive) {
+
+        for (uint32 j=mIslandsJointsStartIndices[key]; j < mIslandsJointsStartIndices[key + 1]; j++) {
+            mSolveBallAndSocketJointSystem.warmstart(mIslandsJoints[j]);
+        }
+        for (uint32 j=mIslandsJointsStartIndices[key + 1]; j < mIslandsJointsStartIndices[key + 2]; j++) {
+            mSolveFixedJointSystem.warmstart(mIslandsJoints[j]);
+        }
+        for (uint32 j=mIslandsJointsStartIndices[key + 2]; j < mIslandsJointsStartIndices[key + 3]; j++) {
+            mSolveHingeJointSystem.warmstart(mIslandsJoints[j]);
+        }
+        for (uint32 j=mIslandsJointsStartIndices[key + 3]; j < mIslandsJointsStartIndices[key + 4]; j++) {
+            mSolveSliderJointSystem.warmstart(mIslandsJoints[j]);
+        }
+    }
+}
+
+// Solve the velocity constraints of the joints of an island (island-parallel solver)
+/**
+ * @param islandIndex Index of the island (or number of islands for the joints that are not in any island)
+ */
+void ConstraintSolverSystem::solveVelocityConstraintsIsland(uint32 islandIndex) {
+
+    const uint32 key = islandIndex * NB_JOINT_TYPES;
+    assert(key + NB_JOINT_TYPES < mIslandsJointsStartIndices.size());
+
+    for (uint32 j=mIslandsJointsStartIndices[key]; j < mIslandsJointsStartIndices[key + 1]; j++) {
+        mSolveBallAndSocketJointSystem.solveVelocityConstraint(mIslandsJoints[j]);
+    }
+    for (uint32 j=mIslandsJointsStartIndices[key + 1]; j < mIslandsJointsStartIndices[key + 2]; j++) {
+        mSolveFixedJointSystem.solveVelocityConstraint(mIslandsJoints[j]);
+    }
+    for (uint32 j=mIslandsJointsStartIndices[key + 2]; j < mIslandsJointsStartIndices[key + 3]; j++) {
+        mSolveHingeJointSystem.solveVelocityConstraint(mIslandsJoints[j]);
+    }
+    for (uint32 j=mIslandsJointsStartIndices[key + 3]; j < mIslandsJointsStartIndices[key + 4]; j++) {
+        mSolveSliderJointSystem.solveVelocityConstraint(mIslandsJoints[j]);
+    }
+}
+
+// Return the joint type of the joint at a given position in the array of joints of the islands
+/**
+ * @param islandIndex Index of the island of the joint
+ * @param islandJointIndex Index of the joint in the array of joints of the islands
+ * @return The joint type (0 for ball-and-socket, 1 for fixed, 2 for hinge and 3 for slider joints)
+ */
+uint32 ConstraintSolverSystem::getIslandJointType(uint32 islandIndex, uint32 islandJointIndex) const {
+
+    const uint32 key = islandIndex * NB_JOINT_TYPES;
+    assert(islandJointIndex >= mIslandsJointsStartIndices[key]);
+    assert(islandJointIndex < mIslandsJointsStartIndices[key + NB_JOINT_TYPES]);
+
+    uint32 jointType = 0;
+    while (islandJointIndex >= mIslandsJointsStartIndices[key + jointType + 1]) {
+        jointType++;
+    }
+
+    return jointType;
+}
+
+// Compute the colors of the joints of an island for the graph-colored solver
+/// The constraints added to the coloring are the indices of the joints in the array of joints of the islands.
+/**
+ * @param islandIndex Index of the island
+ */
+void ConstraintSolverSystem::computeIslandColors(uint32 islandIndex) {
+
+    RP3D_PROFILE("ConstraintSolverSystem::computeIslandColors()", mProfiler);
+
+    RigidBodyComponents& rigidBodyComponents = mConstraintSolverData.rigidBodyComponents;
+    const JointComponents& jointComponents = mConstraintSolverData.jointComponents;
+
+    mColoring.reset(rigidBodyComponents.getNbComponents());
+
+    const uint32 key = islandIndex * NB_JOINT_TYPES;
+    for (uint32 j=mIslandsJointsStartIndices[key]; j < mIslandsJointsStartIndices[key + NB_JOINT_TYPES]; j++) {
+
+        const Entity jointEntity = getJointEntity(getIslandJointType(islandIndex, j), mIslandsJoints[j]);
+        const Entity body1Entity = jointComponents.getBody1Entity(jointEntity);
+        const Entity body2Entity = jointComponents.getBody2Entity(jointEntity);
+
+        // The velocities of the static bodies are not modified by the solver
+        const uint32 body1Index = rigidBodyComponents.getBodyType(body1Entity) != BodyType::STATIC ?
+                                      rigidBodyComponents.getEntityIndex(body1Entity) : ConstraintGraphColoring::NO_BODY;
+        const uint32 body2Index = rigidBodyComponents.getBodyType(body2Entity) != BodyType::STATIC ?
+                                      rigidBodyComponents.getEntityIndex(body2Entity) : ConstraintGraphColoring::NO_BODY;
+
+        mColoring.addConstraint(j, body1Index, body2Index);
+    }
+
+    mColoring.computeColors();
+}
+
+// Initialize a range of the joints of an island (graph-colored solver)
+/**
+ * @param islandIndex Index of the island
+ * @param startIndex Index of the first joint of the range (in [0, getNbIslandJoints()))
+ * @param endIndex Index after the last joint of the range
+ */
+void ConstraintSolverSystem::initBeforeSolveIslandJoints(uint32 islandIndex, uint32 startIndex, uint32 endIndex) {
+
+    const uint32 islandJointsStartIndex = mIslandsJointsStartIndices[islandIndex * NB_JOINT_TYPES];
+
+    for (uint32 j=islandJointsStartIndex + startIndex; j < islandJointsStartIndex + endIndex; j++) {
+
+        switch (getIslandJointType(islandIndex, j)) {
+            case 0: mSolveBallAndSocketJointSystem.initBeforeSolve(mIslandsJoints[j]); break;
+            case 1: mSolveFixedJointSystem.initBeforeSolve(mIslandsJoints[j]); break;
+            case 2: mSolveHingeJointSystem.initBeforeSolve(mIslandsJoints[j]); break;
+            default: mSolveSliderJointSystem.initBeforeSolve(mIslandsJoints[j]); break;
+        }
+    }
+}
+
+// Warm start some joints of an island (of the same color)
+/**
+ * @param islandIndex Index of the island
+ * @param islandJointIndices Array with the indices of the joints in the array of joints of the islands
+ * @param nbJoints Number of joints in the array
+ */
+void ConstraintSolverSystem::warmstartIslandJoints(uint32 islandIndex, const uint32* islandJointIndices, uint32 nbJoints) {
+
+    if (!mIsWarmStartingActive) return;
+
+    for (uint32 i=0; i < nbJoints; i++) {
+
+        const uint32 j = islandJointIndices[i];
+        switch (getIslandJointType(islandIndex, j)) {
+            case 0: mSolveBallAndSocketJointSystem.warmstart(mIslandsJoints[j]); break;
+            case 1: mSolveFixedJointSystem.warmstart(mIslandsJoints[j]); break;
+            case 2: mSolveHingeJointSystem.warmstart(mIslandsJoints[j]); break;
+            default: mSolveSliderJointSystem.warmstart(mIslandsJoints[j]); break;
+        }
+    }
+}
+
+// Solve the velocity constraints of some joints of an island (of the same color)
+/**
+ * @param islandIndex Index of the island
+ * @param islandJointIndices Array with the indices of the joints in the array of joints of the islands
+ * @param nbJoints Number of joints in the array
+ */
+void ConstraintSolverSystem::solveVelocityConstraintsIslandJoints(uint32 islandIndex, const uint32* islandJointIndices, uint32 nbJoints) {
+
+    for (uint32 i=0; i < nbJoints; i++) {
+
+        const uint32 j = islandJointIndices[i];
+        switch (getIslandJointType(islandIndex, j)) {
+            case 0: mSolveBallAndSocketJointSystem.solveVelocityConstraint(mIslandsJoints[j]); break;
+            case 1: mSolveFixedJointSystem.solveVelocityConstraint(mIslandsJoints[j]); break;
+            case 2: mSolveHingeJointSystem.solveVelocityConstraint(mIslandsJoints[j]); break;
+            default: mSolveSliderJointSystem.solveVelocityConstraint(mIslandsJoints[j]); break;
+        }
+    }
+}
+
 // Solve the position constraints
 void ConstraintSolverSystem::solvePositionConstraints() {
 
@@ -35,6 +35,7 @@
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/collision/ContactManifold.h>
 #include <algorithm>
+#include <cstring>
 
 using namespace reactphysics3d;
 using namespace std;
@@ -50,7 +51,9 @@ ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWo
                                          ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold)
               :mMemoryManager(memoryManager), mWorld(world), mTimeStep(-1), mRestitutionVelocityThreshold(restitutionVelocityThreshold),
                mContactConstraints(nullptr), mContactPoints(nullptr),
-               mNbContactPoints(0), mNbContactManifolds(0),
+               mNbContactPoints(0), mNbContactManifolds(0), mContactPointsStartIndices(nullptr),
+               mColoring(memoryManager.getHeapAllocator()), mWideContactManifolds(nullptr), mNbWideContactManifolds(0),
+               mColorsWideStartIndices(nullptr),
                mIslands(islands), mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
                mBodyComponents(bodyComponents), mRigidBodyComponents(rigidBodyComponents),
                mColliderComponents(colliderComponents), mIsSplitImpulseActive(true) {
@@ -65,11 +68,35 @@ ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWo
 // Initialize the contact constraints
 void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep) {
 
+    RP3D_PROFILE("ContactSolver::init()", mProfiler);
+
+    allocate(contactManifolds, contactPoints, timeStep);
+
+    if (mNbContactManifolds == 0) return;
+
+    // For each island of the world
+    const uint32 nbIslands = mIslands.getNbIslands();
+    for (uint32 i = 0; i < nbIslands; i++) {
+
+        if (mIslands.nbContactManifolds[i] > 0) {
+            initializeForIsland(i);
+        }
+    }
+
+    // Warmstarting
+    warmStart();
+}
+
+// Allocate the memory for the contact constraints of all the islands
+/// The contact constraints of each island are stored in a separate range of the
+/// constraints arrays and the index of the first contact point of each contact manifold
+/// is computed here. Therefore, the islands (or the contact manifolds of an island) can
+/// then be initialized and solved in any order (or concurrently).
+void ContactSolverSystem::allocate(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep) {
+
     mAllContactManifolds = contactManifolds;
     mAllContactPoints = contactPoints;
 
-    RP3D_PROFILE("ContactSolver::init()", mProfiler);
-
     mTimeStep = timeStep;
 
     const uint32 nbContactManifolds = static_cast<uint32>(mAllContactManifolds->size());
@@ -80,6 +107,7 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
 
     mContactConstraints = nullptr;
     mContactPoints = nullptr;
+    mContactPointsStartIndices = nullptr;
 
     if (nbContactManifolds == 0 || nbContactPoints == 0) return;
 
@@ -91,17 +119,29 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
                                                                                       sizeof(ContactManifoldSolver) * nbContactManifolds));
     assert(mContactConstraints != nullptr);
 
-    // For each island of the world
+    mContactPointsStartIndices = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                              sizeof(uint32) * nbContactManifolds));
+    assert(mContactPointsStartIndices != nullptr);
+
+    // Compute the index of the first contact point constraint of each contact manifold constraint
     const uint32 nbIslands = mIslands.getNbIslands();
     for (uint32 i = 0; i < nbIslands; i++) {
 
-        if (mIslands.nbContactManifolds[i] > 0) {
-            initializeForIsland(i);
+        // The contact manifolds of the islands are stored contiguously in the order of the islands
+        assert(mIslands.contactManifoldsIndices[i] == mNbContactManifolds);
+
+        const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[i];
+        const uint32 nbIslandContactManifolds = mIslands.nbContactManifolds[i];
+        for (uint32 m=contactManifoldsIndex; m < contactManifoldsIndex + nbIslandContactManifolds; m++) {
+            mContactPointsStartIndices[m] = mNbContactPoints;
+            mNbContactPoints += (*mAllContactManifolds)[m].nbContactPoints;
         }
+
+        mNbContactManifolds += nbIslandContactManifolds;
     }
 
-    // Warmstarting
-    warmStart();
+    assert(mNbContactManifolds == nbContactManifolds);
+    assert(mNbContactPoints <= nbContactPoints);
 }
 
 // Release allocated memory
@@ -109,6 +149,7 @@ void ContactSolverSystem::reset() {
 
     if (mAllContactPoints->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactPoints, sizeof(ContactPointSolver) * mAllContactPoints->size());
     if (mAllContactManifolds->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactConstraints, sizeof(ContactManifoldSolver) * mAllContactManifolds->size());
+    if (mContactPointsStartIndices != nullptr) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactPointsStartIndices, sizeof(uint32) * mAllContactManifolds->size());
 }
 
 // Initialize the constraint solver for a given island
@@ -119,10 +160,22 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
     assert(mIslands.nbBodiesInIsland[islandIndex] > 0);
     assert(mIslands.nbContactManifolds[islandIndex] > 0);
 
-    // For each contact manifold of the island
-    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[islandIndex];
-    const uint32 nbContactManifolds = mIslands.nbContactManifolds[islandIndex];
-    for (uint32 m=contactManifoldsIndex; m < contactManifoldsIndex + nbContactManifolds; m++) {
+    initializeContactManifolds(mIslands.contactManifoldsIndices[islandIndex], mIslands.nbContactManifolds[islandIndex]);
+}
+
+// Initialize a range of contact manifold constraints
+/**
+ * @param manifoldStartIndex Index of the first contact manifold of the range
+ * @param nbManifolds Number of contact manifolds of the range
+ */
+void ContactSolverSystem::initializeContactManifolds(uint32 manifoldStartIndex, uint32 nbManifolds) {
+
+    // Index of the first contact manifold and contact point constraints of the range
+    uint32 manifoldIndex = manifoldStartIndex;
+    uint32 contactPointIndex = mContactPointsStartIndices[manifoldStartIndex];
+
+    // For each contact manifold of the range
+    for (uint32 m=manifoldStartIndex; m < manifoldStartIndex + nbManifolds; m++) {
 
         ContactManifold& externalManifold = (*mAllContactManifolds)[m];
 
@@ -139,23 +192,23 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
         const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[rigidBodyIndex2];
 
         // Initialize the internal contact manifold structure using the external contact manifold
-        new (mContactConstraints + mNbContactManifolds) ContactManifoldSolver();
-        mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody1 = rigidBodyIndex1;
-        mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody2 = rigidBodyIndex2;
-        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].massInverseBody1 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].massInverseBody2 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].linearLockAxisFactorBody1 = mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].linearLockAxisFactorBody2 = mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody1 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody2 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].nbContacts = externalManifold.nbContactPoints;
-        mContactConstraints[mNbContactManifolds].frictionCoefficient = computeMixedFrictionCoefficient(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
-        mContactConstraints[mNbContactManifolds].externalContactManifold = &externalManifold;
-        mContactConstraints[mNbContactManifolds].normal.setToZero();
-        mContactConstraints[mNbContactManifolds].frictionPointBody1.setToZero();
-        mContactConstraints[mNbContactManifolds].frictionPointBody2.setToZero();
+        new (mContactConstraints + manifoldIndex) ContactManifoldSolver();
+        mContactConstraints[manifoldIndex].rigidBodyComponentIndexBody1 = rigidBodyIndex1;
+        mContactConstraints[manifoldIndex].rigidBodyComponentIndexBody2 = rigidBodyIndex2;
+        mContactConstraints[manifoldIndex].inverseInertiaTensorBody1 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex1];
+        mContactConstraints[manifoldIndex].inverseInertiaTensorBody2 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex2];
+        mContactConstraints[manifoldIndex].massInverseBody1 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex1];
+        mContactConstraints[manifoldIndex].massInverseBody2 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex2];
+        mContactConstraints[manifoldIndex].linearLockAxisFactorBody1 = mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyIndex1];
+        mContactConstraints[manifoldIndex].linearLockAxisFactorBody2 = mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyIndex2];
+        mContactConstraints[manifoldIndex].angularLockAxisFactorBody1 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex1];
+        mContactConstraints[manifoldIndex].angularLockAxisFactorBody2 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex2];
+        mContactConstraints[manifoldIndex].nbContacts = externalManifold.nbContactPoints;
+        mContactConstraints[manifoldIndex].frictionCoefficient = computeMixedFrictionCoefficient(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
+        mContactConstraints[manifoldIndex].externalContactManifold = &externalManifold;
+        mContactConstraints[manifoldIndex].normal.setToZero();
+        mContactConstraints[manifoldIndex].frictionPointBody1.setToZero();
+        mContactConstraints[manifoldIndex].frictionPointBody2.setToZero();
 
         // Get the velocities of the bodies
         const Vector3& v1 = mRigidBodyComponents.mLinearVelocities[rigidBodyIndex1];
@@ -174,148 +227,148 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
 
             ContactPoint& externalContact = (*mAllContactPoints)[c];
 
-            new (mContactPoints + mNbContactPoints) ContactPointSolver();
-            mContactPoints[mNbContactPoints].externalContact = &externalContact;
-            mContactPoints[mNbContactPoints].normal = externalContact.getNormal();
+            new (mContactPoints + contactPointIndex) ContactPointSolver();
+            mContactPoints[contactPointIndex].externalContact = &externalContact;
+            mContactPoints[contactPointIndex].normal = externalContact.getNormal();
 
             // Get the contact point on the two bodies
             const Vector3 p1 = collider1LocalToWorldTransform * externalContact.getLocalPointOnShape1();
             const Vector3 p2 = collider2LocalToWorldTransform * externalContact.getLocalPointOnShape2();
 
-            mContactPoints[mNbContactPoints].r1.x = p1.x - x1.x;
-            mContactPoints[mNbContactPoints].r1.y = p1.y - x1.y;
-            mContactPoints[mNbContactPoints].r1.z = p1.z - x1.z;
-            mContactPoints[mNbContactPoints].r2.x = p2.x - x2.x;
-            mContactPoints[mNbContactPoints].r2.y = p2.y - x2.y;
-            mContactPoints[mNbContactPoints].r2.z = p2.z - x2.z;
-            mContactPoints[mNbContactPoints].penetrationDepth = externalContact.getPenetrationDepth();
-            mContactPoints[mNbContactPoints].isRestingContact = externalContact.getIsRestingContact();
+            mContactPoints[contactPointIndex].r1.x = p1.x - x1.x;
+            mContactPoints[contactPointIndex].r1.y = p1.y - x1.y;
+            mContactPoints[contactPointIndex].r1.z = p1.z - x1.z;
+            mContactPoints[contactPointIndex].r2.x = p2.x - x2.x;
+            mContactPoints[contactPointIndex].r2.y = p2.y - x2.y;
+            mContactPoints[contactPointIndex].r2.z = p2.z - x2.z;
+            mContactPoints[contactPointIndex].penetrationDepth = externalContact.getPenetrationDepth();
+            mContactPoints[contactPointIndex].isRestingContact = externalContact.getIsRestingContact();
             externalContact.setIsRestingContact(true);
-            mContactPoints[mNbContactPoints].penetrationImpulse = externalContact.getPenetrationImpulse();
-            mContactPoints[mNbContactPoints].penetrationSplitImpulse = 0.0;
+            mContactPoints[contactPointIndex].penetrationImpulse = externalContact.getPenetrationImpulse();
+            mContactPoints[contactPointIndex].penetrationSplitImpulse = 0.0;
 
-            mContactConstraints[mNbContactManifolds].frictionPointBody1.x += p1.x;
-            mContactConstraints[mNbContactManifolds].frictionPointBody1.y += p1.y;
-            mContactConstraints[mNbContactManifolds].frictionPointBody1.z += p1.z;
-            mContactConstraints[mNbContactManifolds].frictionPointBody2.x += p2.x;
-            mContactConstraints[mNbContactManifolds].frictionPointBody2.y += p2.y;
-            mContactConstraints[mNbContactManifolds].frictionPointBody2.z += p2.z;
+            mContactConstraints[manifoldIndex].frictionPointBody1.x += p1.x;
+            mContactConstraints[manifoldIndex].frictionPointBody1.y += p1.y;
+            mContactConstraints[manifoldIndex].frictionPointBody1.z += p1.z;
+            mContactConstraints[manifoldIndex].frictionPointBody2.x += p2.x;
+            mContactConstraints[manifoldIndex].frictionPointBody2.y += p2.y;
+            mContactConstraints[manifoldIndex].frictionPointBody2.z += p2.z;
 
             // Compute the velocity difference
-            // deltaV = v2 + w2.cross(mContactPoints[mNbContactPoints].r2) - v1 - w1.cross(mContactPoints[mNbContactPoints].r1);
-            Vector3 deltaV(v2.x + w2.y * mContactPoints[mNbContactPoints].r2.z - w2.z * mContactPoints[mNbContactPoints].r2.y
-                           - v1.x - w1.y * mContactPoints[mNbContactPoints].r1.z + w1.z * mContactPoints[mNbContactPoints].r1.y,
-                           v2.y + w2.z * mContactPoints[mNbContactPoints].r2.x - w2.x * mContactPoints[mNbContactPoints].r2.z
-                           - v1.y - w1.z * mContactPoints[mNbContactPoints].r1.x + w1.x * mContactPoints[mNbContactPoints].r1.z,
-                           v2.z + w2.x * mContactPoints[mNbContactPoints].r2.y - w2.y * mContactPoints[mNbContactPoints].r2.x
-                           - v1.z - w1.x * mContactPoints[mNbContactPoints].r1.y + w1.y * mContactPoints[mNbContactPoints].r1.x);
-
-            // r1CrossN = mContactPoints[mNbContactPoints].r1.cross(mContactPoints[mNbContactPoints].normal);
-            Vector3 r1CrossN(mContactPoints[mNbContactPoints].r1.y * mContactPoints[mNbContactPoints].normal.z -
-                             mContactPoints[mNbContactPoints].r1.z * mContactPoints[mNbContactPoints].normal.y,
-                             mContactPoints[mNbContactPoints].r1.z * mContactPoints[mNbContactPoints].normal.x -
-                             mContactPoints[mNbContactPoints].r1.x * mContactPoints[mNbContactPoints].normal.z,
-                             mContactPoints[mNbContactPoints].r1.x * mContactPoints[mNbContactPoints].normal.y -
-                             mContactPoints[mNbContactPoints].r1.y * mContactPoints[mNbContactPoints].normal.x);
-            // r2CrossN = mContactPoints[mNbContactPoints].r2.cross(mContactPoints[mNbContactPoints].normal);
-            Vector3 r2CrossN(mContactPoints[mNbContactPoints].r2.y * mContactPoints[mNbContactPoints].normal.z -
-                             mContactPoints[mNbContactPoints].r2.z * mContactPoints[mNbContactPoints].normal.y,
-                             mContactPoints[mNbContactPoints].r2.z * mContactPoints[mNbContactPoints].normal.x -
-                             mContactPoints[mNbContactPoints].r2.x * mContactPoints[mNbContactPoints].normal.z,
-                             mContactPoints[mNbContactPoints].r2.x * mContactPoints[mNbContactPoints].normal.y -
-                             mContactPoints[mNbContactPoints].r2.y * mContactPoints[mNbContactPoints].normal.x);
-
-            mContactPoints[mNbContactPoints].i1TimesR1CrossN = mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 * r1CrossN;
-            mContactPoints[mNbContactPoints].i2TimesR2CrossN = mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 * r2CrossN;
+            // deltaV = v2 + w2.cross(mContactPoints[contactPointIndex].r2) - v1 - w1.cross(mContactPoints[contactPointIndex].r1);
+            Vector3 deltaV(v2.x + w2.y * mContactPoints[contactPointIndex].r2.z - w2.z * mContactPoints[contactPointIndex].r2.y
+                           - v1.x - w1.y * mContactPoints[contactPointIndex].r1.z + w1.z * mContactPoints[contactPointIndex].r1.y,
+                           v2.y + w2.z * mContactPoints[contactPointIndex].r2.x - w2.x * mContactPoints[contactPointIndex].r2.z
+                           - v1.y - w1.z * mContactPoints[contactPointIndex].r1.x + w1.x * mContactPoints[contactPointIndex].r1.z,
+                           v2.z + w2.x * mContactPoints[contactPointIndex].r2.y - w2.y * mContactPoints[contactPointIndex].r2.x
+                           - v1.z - w1.x * mContactPoints[contactPointIndex].r1.y + w1.y * mContactPoints[contactPointIndex].r1.x);
+
+            // r1CrossN = mContactPoints[contactPointIndex].r1.cross(mContactPoints[contactPointIndex].normal);
+            Vector3 r1CrossN(mContactPoints[contactPointIndex].r1.y * mContactPoints[contactPointIndex].normal.z -
+                             mContactPoints[contactPointIndex].r1.z * mContactPoints[contactPointIndex].normal.y,
+                             mContactPoints[contactPointIndex].r1.z * mContactPoints[contactPointIndex].normal.x -
+                             mContactPoints[contactPointIndex].r1.x * mContactPoints[contactPointIndex].normal.z,
+                             mContactPoints[contactPointIndex].r1.x * mContactPoints[contactPointIndex].normal.y -
+                             mContactPoints[contactPointIndex].r1.y * mContactPoints[contactPointIndex].normal.x);
+            // r2CrossN = mContactPoints[contactPointIndex].r2.cross(mContactPoints[contactPointIndex].normal);
+            Vector3 r2CrossN(mContactPoints[contactPointIndex].r2.y * mContactPoints[contactPointIndex].normal.z -
+                             mContactPoints[contactPointIndex].r2.z * mContactPoints[contactPointIndex].normal.y,
+                             mContactPoints[contactPointIndex].r2.z * mContactPoints[contactPointIndex].normal.x -
+                             mContactPoints[contactPointIndex].r2.x * mContactPoints[contactPointIndex].normal.z,
+                             mContactPoints[contactPointIndex].r2.x * mContactPoints[contactPointIndex].normal.y -
+                             mContactPoints[contactPointIndex].r2.y * mContactPoints[contactPointIndex].normal.x);
+
+            mContactPoints[contactPointIndex].i1TimesR1CrossN = mContactConstraints[manifoldIndex].inverseInertiaTensorBody1 * r1CrossN;
+            mContactPoints[contactPointIndex].i2TimesR2CrossN = mContactConstraints[manifoldIndex].inverseInertiaTensorBody2 * r2CrossN;
 
             // Compute the inverse mass matrix K for the penetration constraint
-            decimal massPenetration = mContactConstraints[mNbContactManifolds].massInverseBody1 + mContactConstraints[mNbContactManifolds].massInverseBody2 +
-                    ((mContactPoints[mNbContactPoints].i1TimesR1CrossN).cross(mContactPoints[mNbContactPoints].r1)).dot(mContactPoints[mNbContactPoints].normal) +
-                    ((mContactPoints[mNbContactPoints].i2TimesR2CrossN).cross(mContactPoints[mNbContactPoints].r2)).dot(mContactPoints[mNbContactPoints].normal);
-            mContactPoints[mNbContactPoints].inversePenetrationMass = massPenetration > decimal(0.0) ? decimal(1.0) / massPenetration : decimal(0.0);
+            decimal massPenetration = mContactConstraints[manifoldIndex].massInverseBody1 + mContactConstraints[manifoldIndex].massInverseBody2 +
+                    ((mContactPoints[contactPointIndex].i1TimesR1CrossN).cross(mContactPoints[contactPointIndex].r1)).dot(mContactPoints[contactPointIndex].normal) +
+                    ((mContactPoints[contactPointIndex].i2TimesR2CrossN).cross(mContactPoints[contactPointIndex].r2)).dot(mContactPoints[contactPointIndex].normal);
+            mContactPoints[contactPointIndex].inversePenetrationMass = massPenetration > decimal(0.0) ? decimal(1.0) / massPenetration : decimal(0.0);
 
             // Compute the restitution velocity bias "b". We compute this here instead
             // of inside the solve() method because we need to use the velocity difference
             // at the beginning of the contact. Note that if it is a resting contact (normal
             // velocity bellow a given threshold), we do not add a restitution velocity bias
-            mContactPoints[mNbContactPoints].restitutionBias = 0.0;
-            // deltaVDotN = deltaV.dot(mContactPoints[mNbContactPoints].normal);
-            decimal deltaVDotN = deltaV.x * mContactPoints[mNbContactPoints].normal.x +
-                                 deltaV.y * mContactPoints[mNbContactPoints].normal.y +
-                                 deltaV.z * mContactPoints[mNbContactPoints].normal.z;
+            mContactPoints[contactPointIndex].restitutionBias = 0.0;
+            // deltaVDotN = deltaV.dot(mContactPoints[contactPointIndex].normal);
+            decimal deltaVDotN = deltaV.x * mContactPoints[contactPointIndex].normal.x +
+                                 deltaV.y * mContactPoints[contactPointIndex].normal.y +
+                                 deltaV.z * mContactPoints[contactPointIndex].normal.z;
             const decimal restitutionFactor = computeMixedRestitutionFactor(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
             if (deltaVDotN < -mRestitutionVelocityThreshold) {
-                mContactPoints[mNbContactPoints].restitutionBias = restitutionFactor * deltaVDotN;
+                mContactPoints[contactPointIndex].restitutionBias = restitutionFactor * deltaVDotN;
             }
 
-            mContactConstraints[mNbContactManifolds].normal.x += mContactPoints[mNbContactPoints].normal.x;
-            mContactConstraints[mNbContactManifolds].normal.y += mContactPoints[mNbContactPoints].normal.y;
-            mContactConstraints[mNbContactManifolds].normal.z += mContactPoints[mNbContactPoints].normal.z;
+            mContactConstraints[manifoldIndex].normal.x += mContactPoints[contactPointIndex].normal.x;
+            mContactConstraints[manifoldIndex].normal.y += mContactPoints[contactPointIndex].normal.y;
+            mContactConstraints[manifoldIndex].normal.z += mContactPoints[contactPointIndex].normal.z;
 
-            mNbContactPoints++;
+            contactPointIndex++;
         }
 
-        mContactConstraints[mNbContactManifolds].frictionPointBody1 /= static_cast<decimal>(mContactConstraints[mNbContactManifolds].nbContacts);
-        mContactConstraints[mNbContactManifolds].frictionPointBody2 /= static_cast<decimal>(mContactConstraints[mNbContactManifolds].nbContacts);
-        mContactConstraints[mNbContactManifolds].r1Friction.x = mContactConstraints[mNbContactManifolds].frictionPointBody1.x - x1.x;
-        mContactConstraints[mNbContactManifolds].r1Friction.y = mContactConstraints[mNbContactManifolds].frictionPointBody1.y - x1.y;
-        mContactConstraints[mNbContactManifolds].r1Friction.z = mContactConstraints[mNbContactManifolds].frictionPointBody1.z - x1.z;
-        mContactConstraints[mNbContactManifolds].r2Friction.x = mContactConstraints[mNbContactManifolds].frictionPointBody2.x - x2.x;
-        mContactConstraints[mNbContactManifolds].r2Friction.y = mContactConstraints[mNbContactManifolds].frictionPointBody2.y - x2.y;
-        mContactConstraints[mNbContactManifolds].r2Friction.z = mContactConstraints[mNbContactManifolds].frictionPointBody2.z - x2.z;
-        mContactConstraints[mNbContactManifolds].oldFrictionVector1 = externalManifold.frictionVector1;
-        mContactConstraints[mNbContactManifolds].oldFrictionVector2 = externalManifold.frictionVector2;
+        mContactConstraints[manifoldIndex].frictionPointBody1 /= static_cast<decimal>(mContactConstraints[manifoldIndex].nbContacts);
+        mContactConstraints[manifoldIndex].frictionPointBody2 /= static_cast<decimal>(mContactConstraints[manifoldIndex].nbContacts);
+        mContactConstraints[manifoldIndex].r1Friction.x = mContactConstraints[manifoldIndex].frictionPointBody1.x - x1.x;
+        mContactConstraints[manifoldIndex].r1Friction.y = mContactConstraints[manifoldIndex].frictionPointBody1.y - x1.y;
+        mContactConstraints[manifoldIndex].r1Friction.z = mContactConstraints[manifoldIndex].frictionPointBody1.z - x1.z;
+        mContactConstraints[manifoldIndex].r2Friction.x = mContactConstraints[manifoldIndex].frictionPointBody2.x - x2.x;
+        mContactConstraints[manifoldIndex].r2Friction.y = mContactConstraints[manifoldIndex].frictionPointBody2.y - x2.y;
+        mContactConstraints[manifoldIndex].r2Friction.z = mContactConstraints[manifoldIndex].frictionPointBody2.z - x2.z;
+        mContactConstraints[manifoldIndex].oldFrictionVector1 = externalManifold.frictionVector1;
+        mContactConstraints[manifoldIndex].oldFrictionVector2 = externalManifold.frictionVector2;
 
         // Initialize the accumulated impulses with the previous step accumulated impulses
-        mContactConstraints[mNbContactManifolds].friction1Impulse = externalManifold.frictionImpulse1;
-        mContactConstraints[mNbContactManifolds].friction2Impulse = externalManifold.frictionImpulse2;
-        mContactConstraints[mNbContactManifolds].frictionTwistImpulse = externalManifold.frictionTwistImpulse;
-
-        mContactConstraints[mNbContactManifolds].normal.normalize();
-
-        // deltaVFrictionPoint = v2 + w2.cross(mContactConstraints[mNbContactManifolds].r2Friction) -
-        //                              v1 - w1.cross(mContactConstraints[mNbContactManifolds].r1Friction);
-        Vector3 deltaVFrictionPoint(v2.x + w2.y * mContactConstraints[mNbContactManifolds].r2Friction.z -
-                                    w2.z * mContactConstraints[mNbContactManifolds].r2Friction.y -
-                                      v1.x - w1.y * mContactConstraints[mNbContactManifolds].r1Friction.z +
-                                      w1.z * mContactConstraints[mNbContactManifolds].r1Friction.y,
-                                   v2.y + w2.z * mContactConstraints[mNbContactManifolds].r2Friction.x -
-                                    w2.x * mContactConstraints[mNbContactManifolds].r2Friction.z -
-                                      v1.y - w1.z * mContactConstraints[mNbContactManifolds].r1Friction.x +
-                                      w1.x * mContactConstraints[mNbContactManifolds].r1Friction.z,
-                                   v2.z + w2.x * mContactConstraints[mNbContactManifolds].r2Friction.y -
-                                    w2.y * mContactConstraints[mNbContactManifolds].r2Friction.x -
-                                      v1.z - w1.x * mContactConstraints[mNbContactManifolds].r1Friction.y +
-                                      w1.y * mContactConstraints[mNbContactManifolds].r1Friction.x);
+        mContactConstraints[manifoldIndex].friction1Impulse = externalManifold.frictionImpulse1;
+        mContactConstraints[manifoldIndex].friction2Impulse = externalManifold.frictionImpulse2;
+        mContactConstraints[manifoldIndex].frictionTwistImpulse = externalManifold.frictionTwistImpulse;
+
+        mContactConstraints[manifoldIndex].normal.normalize();
+
+        // deltaVFrictionPoint = v2 + w2.cross(mContactConstraints[manifoldIndex].r2Friction) -
+        //                              v1 - w1.cross(mContactConstraints[manifoldIndex].r1Friction);
+        Vector3 deltaVFrictionPoint(v2.x + w2.y * mContactConstraints[manifoldIndex].r2Friction.z -
+                                    w2.z * mContactConstraints[manifoldIndex].r2Friction.y -
+                                      v1.x - w1.y * mContactConstraints[manifoldIndex].r1Friction.z +
+                                      w1.z * mContactConstraints[manifoldIndex].r1Friction.y,
+                                   v2.y + w2.z * mContactConstraints[manifoldIndex].r2Friction.x -
+                                    w2.x * mContactConstraints[manifoldIndex].r2Friction.z -
+                                      v1.y - w1.z * mContactConstraints[manifoldIndex].r1Friction.x +
+                                      w1.x * mContactConstraints[manifoldIndex].r1Friction.z,
+                                   v2.z + w2.x * mContactConstraints[manifoldIndex].r2Friction.y -
+                                    w2.y * mContactConstraints[manifoldIndex].r2Friction.x -
+                                      v1.z - w1.x * mContactConstraints[manifoldIndex].r1Friction.y +
+                                      w1.y * mContactConstraints[manifoldIndex].r1Friction.x);
 
         // Compute the friction vectors
-        computeFrictionVectors(deltaVFrictionPoint, mContactConstraints[mNbContactManifolds]);
+        computeFrictionVectors(deltaVFrictionPoint, mContactConstraints[manifoldIndex]);
 
         // Compute the inverse mass matrix K for the friction constraints at the center of
         // the contact manifold
-        mContactConstraints[mNbContactManifolds].r1CrossT1 = mContactConstraints[mNbContactManifolds].r1Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector1);
-        mContactConstraints[mNbContactManifolds].r1CrossT2 = mContactConstraints[mNbContactManifolds].r1Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector2);
-        mContactConstraints[mNbContactManifolds].r2CrossT1 = mContactConstraints[mNbContactManifolds].r2Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector1);
-        mContactConstraints[mNbContactManifolds].r2CrossT2 = mContactConstraints[mNbContactManifolds].r2Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector2);
-        decimal friction1Mass = mContactConstraints[mNbContactManifolds].massInverseBody1 + mContactConstraints[mNbContactManifolds].massInverseBody2 +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 * mContactConstraints[mNbContactManifolds].r1CrossT1).cross(mContactConstraints[mNbContactManifolds].r1Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector1) +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 * mContactConstraints[mNbContactManifolds].r2CrossT1).cross(mContactConstraints[mNbContactManifolds].r2Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector1);
-        decimal friction2Mass = mContactConstraints[mNbContactManifolds].massInverseBody1 + mContactConstraints[mNbContactManifolds].massInverseBody2 +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 * mContactConstraints[mNbContactManifolds].r1CrossT2).cross(mContactConstraints[mNbContactManifolds].r1Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector2) +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 * mContactConstraints[mNbContactManifolds].r2CrossT2).cross(mContactConstraints[mNbContactManifolds].r2Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector2);
-        decimal frictionTwistMass = mContactConstraints[mNbContactManifolds].normal.dot(mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 *
-                                       mContactConstraints[mNbContactManifolds].normal) +
-                                    mContactConstraints[mNbContactManifolds].normal.dot(mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 *
-                                       mContactConstraints[mNbContactManifolds].normal);
-        mContactConstraints[mNbContactManifolds].inverseFriction1Mass = friction1Mass > decimal(0.0) ? decimal(1.0) / friction1Mass : decimal(0.0);
-        mContactConstraints[mNbContactManifolds].inverseFriction2Mass = friction2Mass > decimal(0.0) ? decimal(1.0) / friction2Mass : decimal(0.0);
-        mContactConstraints[mNbContactManifolds].inverseTwistFrictionMass = frictionTwistMass > decimal(0.0) ? decimal(1.0) / frictionTwistMass : decimal(0.0);
-
-        mNbContactManifolds++;
+        mContactConstraints[manifoldIndex].r1CrossT1 = mContactConstraints[manifoldIndex].r1Friction.cross(mContactConstraints[manifoldIndex].frictionVector1);
+        mContactConstraints[manifoldIndex].r1CrossT2 = mContactConstraints[manifoldIndex].r1Friction.cross(mContactConstraints[manifoldIndex].frictionVector2);
+        mContactConstraints[manifoldIndex].r2CrossT1 = mContactConstraints[manifoldIndex].r2Friction.cross(mContactConstraints[manifoldIndex].frictionVector1);
+        mContactConstraints[manifoldIndex].r2CrossT2 = mContactConstraints[manifoldIndex].r2Friction.cross(mContactConstraints[manifoldIndex].frictionVector2);
+        decimal friction1Mass = mContactConstraints[manifoldIndex].massInverseBody1 + mContactConstraints[manifoldIndex].massInverseBody2 +
+                                ((mContactConstraints[manifoldIndex].inverseInertiaTensorBody1 * mContactConstraints[manifoldIndex].r1CrossT1).cross(mContactConstraints[manifoldIndex].r1Friction)).dot(
+                                mContactConstraints[manifoldIndex].frictionVector1) +
+                                ((mContactConstraints[manifoldIndex].inverseInertiaTensorBody2 * mContactConstraints[manifoldIndex].r2CrossT1).cross(mContactConstraints[manifoldIndex].r2Friction)).dot(
+                                mContactConstraints[manifoldIndex].frictionVector1);
+        decimal friction2Mass = mContactConstraints[manifoldIndex].massInverseBody1 + mContactConstraints[manifoldIndex].massInverseBody2 +
+                                ((mContactConstraints[manifoldIndex].inverseInertiaTensorBody1 * mContactConstraints[manifoldIndex].r1CrossT2).cross(mContactConstraints[manifoldIndex].r1Friction)).dot(
+                                mContactConstraints[manifoldIndex].frictionVector2) +
+                                ((mContactConstraints[manifoldIndex].inverseInertiaTensorBody2 * mContactConstraints[manifoldIndex].r2CrossT2).cross(mContactConstraints[manifoldIndex].r2Friction)).dot(
+                                mContactConstraints[manifoldIndex].frictionVector2);
+        decimal frictionTwistMass = mContactConstraints[manifoldIndex].normal.dot(mContactConstraints[manifoldIndex].inverseInertiaTensorBody1 *
+                                       mContactConstraints[manifoldIndex].normal) +
+                                    mContactConstraints[manifoldIndex].normal.dot(mContactConstraints[manifoldIndex].inverseInertiaTensorBody2 *
+                                       mContactConstraints[manifoldIndex].normal);
+        mContactConstraints[manifoldIndex].inverseFriction1Mass = friction1Mass > decimal(0.0) ? decimal(1.0) / friction1Mass : decimal(0.0);
+        mContactConstraints[manifoldIndex].inverseFriction2Mass = friction2Mass > decimal(0.0) ? decimal(1.0) / friction2Mass : decimal(0.0);
+        mContactConstraints[manifoldIndex].inverseTwistFrictionMass = frictionTwistMass > decimal(0.0) ? decimal(1.0) / frictionTwistMass : decimal(0.0);
+
+        manifoldIndex++;
     }
 }
 
@@ -327,21 +380,38 @@ void ContactSolverSystem::warmStart() {
 
     RP3D_PROFILE("ContactSolver::warmStart()", mProfiler);
 
-    uint32 contactPointIndex = 0;
+    warmStart(0, mNbContactManifolds, 0);
+}
+
+// Warm start a range of contact manifold constraints
+/**
+  * @param manifoldStartIndex Index of the first contact manifold constraint of the range
+  * @param nbManifolds Number of contact manifold constraints of the range
+  * @param contactPointStartIndex Index of the first contact point constraint of the range
+ */
+void ContactSolverSystem::warmStart(uint32 manifoldStartIndex, uint32 nbManifolds, uint32 contactPointStartIndex) {
+
+    uint32 contactPointIndex = contactPointStartIndex;
 
     // For each constraint
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
+    for (uint32 c=manifoldStartIndex; c < manifoldStartIndex + nbManifolds; c++) {
 
         bool atLeastOneRestingContactPoint = false;
 
+        const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
+        const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
+
+        // Get the constrained velocities
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index];
+
         for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
 
             // If it is not a new contact (this contact was already existing at last time step)
             if (mContactPoints[contactPointIndex].isRestingContact) {
 
-                const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
-                const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
-
                 atLeastOneRestingContactPoint = true;
 
                 // --------- Penetration --------- //
@@ -350,22 +420,22 @@ void ContactSolverSystem::warmStart() {
                 Vector3 impulsePenetration(mContactPoints[contactPointIndex].normal.x * mContactPoints[contactPointIndex].penetrationImpulse,
                                            mContactPoints[contactPointIndex].normal.y * mContactPoints[contactPointIndex].penetrationImpulse,
                                            mContactPoints[contactPointIndex].normal.z * mContactPoints[contactPointIndex].penetrationImpulse);
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+                v1.x -= mContactConstraints[c].massInverseBody1 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+                v1.y -= mContactConstraints[c].massInverseBody1 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+                v1.z -= mContactConstraints[c].massInverseBody1 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * mContactPoints[contactPointIndex].penetrationImpulse;
+                w1.x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * mContactPoints[contactPointIndex].penetrationImpulse;
+                w1.y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * mContactPoints[contactPointIndex].penetrationImpulse;
+                w1.z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * mContactPoints[contactPointIndex].penetrationImpulse;
 
                 // Update the velocities of the body 2 by applying the impulse P
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+                v2.x += mContactConstraints[c].massInverseBody2 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+                v2.y += mContactConstraints[c].massInverseBody2 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+                v2.z += mContactConstraints[c].massInverseBody2 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * mContactPoints[contactPointIndex].penetrationImpulse;
+                w2.x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * mContactPoints[contactPointIndex].penetrationImpulse;
+                w2.y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * mContactPoints[contactPointIndex].penetrationImpulse;
+                w2.z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * mContactPoints[contactPointIndex].penetrationImpulse;
             }
             else {  // If it is a new contact point
 
@@ -404,16 +474,13 @@ void ContactSolverSystem::warmStart() {
                                         mContactConstraints[c].r2CrossT1.y * mContactConstraints[c].friction1Impulse,
                                         mContactConstraints[c].r2CrossT1.z * mContactConstraints[c].friction1Impulse);
 
-            const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
-            const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
-
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index] -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody1;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
+            v1 -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody1;
+            w1 += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index] += mContactConstraints[c].massInverseBody2 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody2;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            v2 += mContactConstraints[c].massInverseBody2 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody2;
+            w2 += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
 
             // ------ Second friction constraint at the center of the contact manifold ----- //
 
@@ -429,18 +496,18 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * mContactConstraints[c].friction2Impulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+            v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+            v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+            v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
+            w1 += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+            v2.x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+            v2.y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+            v2.z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            w2 += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
 
             // ------ Twist friction constraint at the center of the contact manifold ------ //
 
@@ -454,16 +521,16 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2.z = mContactConstraints[c].normal.z * mContactConstraints[c].frictionTwistImpulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 *  angularImpulseBody1);
+            w1 += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 *  angularImpulseBody1);
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            w2 += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] -= mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
+            w1 -= mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            w2 += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
         }
         else {  // If it is a new contact manifold
 
@@ -472,6 +539,10 @@ void ContactSolverSystem::warmStart() {
             mContactConstraints[c].friction2Impulse = 0.0;
             mContactConstraints[c].frictionTwistImpulse = 0.0;
         }
+
+        // Update the velocities of the bodies
+        mRigidBodyComponents.updateConstrainedVelocities(rigidBody1Index, v1, w1);
+        mRigidBodyComponents.updateConstrainedVelocities(rigidBody2Index, v2, w2);
     }
 }
 
@@ -480,14 +551,25 @@ void ContactSolverSystem::solve() {
 
     RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
 
+    solve(0, mNbContactManifolds, 0);
+}
+
+// Solve a range of contact manifold constraints
+/**
+  * @param manifoldStartIndex Index of the first contact manifold constraint of the range
+  * @param nbManifolds Number of contact manifold constraints of the range
+  * @param contactPointStartIndex Index of the first contact point constraint of the range
+ */
+void ContactSolverSystem::solve(uint32 manifoldStartIndex, uint32 nbManifolds, uint32 contactPointStartIndex) {
+
     decimal deltaLambda;
     decimal lambdaTemp;
-    uint32 contactPointIndex = 0;
+    uint32 contactPointIndex = contactPointStartIndex;
 
     const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
 
     // For each contact manifold
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
+    for (uint32 c=manifoldStartIndex; c < manifoldStartIndex + nbManifolds; c++) {
 
         decimal sumPenetrationImpulse = 0.0;
 
@@ -495,10 +577,16 @@ void ContactSolverSystem::solve() {
         const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
 
         // Get the constrained velocities
-        const Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index];
-        const Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index];
-        const Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index];
-        const Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index];
+
+        // Get the split velocities
+        Vector3 v1Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index];
+        Vector3 w1Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index];
+        Vector3 v2Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index];
+        Vector3 w2Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index];
 
         for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
 
@@ -541,22 +629,22 @@ void ContactSolverSystem::solve() {
                                   mContactPoints[contactPointIndex].normal.z * deltaLambda);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+            v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+            v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+            v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambda;
+            w1.x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambda;
+            w1.y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambda;
+            w1.z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambda;
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+            v2.x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+            v2.y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+            v2.z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambda;
+            w2.x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambda;
+            w2.y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambda;
+            w2.z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambda;
 
             sumPenetrationImpulse += mContactPoints[contactPointIndex].penetrationImpulse;
 
@@ -564,11 +652,6 @@ void ContactSolverSystem::solve() {
             if (mIsSplitImpulseActive) {
 
                 // Split impulse (position correction)
-                const Vector3& v1Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index];
-                const Vector3& w1Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index];
-                const Vector3& v2Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index];
-                const Vector3& w2Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index];
-
                 //Vector3 deltaVSplit = v2Split + w2Split.cross(mContactPoints[contactPointIndex].r2) - v1Split - w1Split.cross(mContactPoints[contactPointIndex].r1);
                 Vector3 deltaVSplit(v2Split.x + w2Split.y * mContactPoints[contactPointIndex].r2.z - w2Split.z * mContactPoints[contactPointIndex].r2.y - v1Split.x -
                                     w1Split.y * mContactPoints[contactPointIndex].r1.z + w1Split.z * mContactPoints[contactPointIndex].r1.y,
@@ -592,22 +675,22 @@ void ContactSolverSystem::solve() {
                                       mContactPoints[contactPointIndex].normal.z * deltaLambdaSplit);
 
                 // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+                v1Split.x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+                v1Split.y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+                v1Split.z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambdaSplit;
+                w1Split.x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambdaSplit;
+                w1Split.y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambdaSplit;
+                w1Split.z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambdaSplit;
 
                 // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+                v2Split.x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+                v2Split.y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+                v2Split.z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambdaSplit;
+                w2Split.x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambdaSplit;
+                w2Split.y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambdaSplit;
+                w2Split.z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambdaSplit;
             }
 
             contactPointIndex++;
@@ -650,24 +733,24 @@ void ContactSolverSystem::solve() {
                                     mContactConstraints[c].r2CrossT1.z * deltaLambda);
 
         // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+        v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+        v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+        v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
         Vector3 angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x += angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y += angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z += angularVelocity1.z;
+        w1.x += angularVelocity1.x;
+        w1.y += angularVelocity1.y;
+        w1.z += angularVelocity1.z;
 
         // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+        v2.x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+        v2.y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+        v2.z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
         Vector3 angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
+        w2.x += angularVelocity2.x;
+        w2.y += angularVelocity2.y;
+        w2.z += angularVelocity2.z;
 
         // ------ Second friction constraint at the center of the contact manifold ----- //
 
@@ -705,24 +788,24 @@ void ContactSolverSystem::solve() {
         angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * deltaLambda;
 
         // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+        v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+        v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+        v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
         angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x += angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y += angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z += angularVelocity1.z;
+        w1.x += angularVelocity1.x;
+        w1.y += angularVelocity1.y;
+        w1.z += angularVelocity1.z;
 
         // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+        v2.x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+        v2.y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+        v2.z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
         angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
+        w2.x += angularVelocity2.x;
+        w2.y += angularVelocity2.y;
+        w2.z += angularVelocity2.z;
 
         // ------ Twist friction constraint at the center of the contact manifol ------ //
 
@@ -746,15 +829,23 @@ void ContactSolverSystem::solve() {
 
         // Update the velocities of the body 1 by applying the impulse P
         angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= angularVelocity1.z;
+        w1.x -= angularVelocity1.x;
+        w1.y -= angularVelocity1.y;
+        w1.z -= angularVelocity1.z;
 
         // Update the velocities of the body 1 by applying the impulse P
         angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
+        w2.x += angularVelocity2.x;
+        w2.y += angularVelocity2.y;
+        w2.z += angularVelocity2.z;
+
+        // Update the velocities of the bodies
+        mRigidBodyComponents.updateConstrainedVelocities(rigidBody1Index, v1, w1);
+        mRigidBodyComponents.updateConstrainedVelocities(rigidBody2Index, v2, w2);
+        if (mIsSplitImpulseActive) {
+            mRigidBodyComponents.updateSplitVelocities(rigidBody1Index, v1Split, w1Split);
+            mRigidBodyComponents.updateSplitVelocities(rigidBody2Index, v2Split, w2Split);
+        }
     }
 }
 
@@ -764,10 +855,21 @@ void ContactSolverSystem::storeImpulses() {
 
     RP3D_PROFILE("ContactSolver::storeImpulses()", mProfiler);
 
-    uint32 contactPointIndex = 0;
+    storeImpulses(0, mNbContactManifolds, 0);
+}
+
+// Store the computed impulses of a range of contact manifold constraints
+/**
+  * @param manifoldStartIndex Index of the first contact manifold constraint of the range
+  * @param nbManifolds Number of contact manifold constraints of the range
+  * @param contactPointStartIndex Index of the first contact point constraint of the range
+ */
+void ContactSolverSystem::storeImpulses(uint32 manifoldStartIndex, uint32 nbManifolds, uint32 contactPointStartIndex) {
+
+    uint32 contactPointIndex = contactPointStartIndex;
 
     // For each contact manifold
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
+    for (uint32 c=manifoldStartIndex; c < manifoldStartIndex + nbManifolds; c++) {
 
         for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
 
@@ -784,6 +886,517 @@ void ContactSolverSystem::storeImpulses() {
     }
 }
 
+// Warm start the contact constraints of a given island
+/**
+ * @param islandIndex Index of the island
+ */
+void ContactSolverSystem::warmStartIsland(uint32 islandIndex) {
+
+    assert(islandIndex < mIslands.getNbIslands());
+    assert(mIslands.nbContactManifolds[islandIndex] > 0);
+
+    const uint32 manifoldStartIndex = mIslands.contactManifoldsIndices[islandIndex];
+    warmStart(manifoldStartIndex, mIslands.nbContactManifolds[islandIndex], mContactPointsStartIndices[manifoldStartIndex]);
+}
+
+// Solve the contacts of a given island
+/**
+ * @param islandIndex Index of the island
+ */
+void ContactSolverSystem::solveIsland(uint32 islandIndex) {
+
+    assert(islandIndex < mIslands.getNbIslands());
+    assert(mIslands.nbContactManifolds[islandIndex] > 0);
+
+    const uint32 manifoldStartIndex = mIslands.contactManifoldsIndices[islandIndex];
+    solve(manifoldStartIndex, mIslands.nbContactManifolds[islandIndex], mContactPointsStartIndices[manifoldStartIndex]);
+}
+
+// Store the computed impulses of the contacts of a given island
+/**
+ * @param islandIndex Index of the island
+ */
+void ContactSolverSystem::storeImpulsesIsland(uint32 islandIndex) {
+
+    assert(islandIndex < mIslands.getNbIslands());
+    assert(mIslands.nbContactManifolds[islandIndex] > 0);
+
+    const uint32 manifoldStartIndex = mIslands.contactManifoldsIndices[islandIndex];
+    storeImpulses(manifoldStartIndex, mIslands.nbContactManifolds[islandIndex], mContactPointsStartIndices[manifoldStartIndex]);
+}
+
+// Compute the colors of the contact manifolds of an island for the graph-colored solver
+/**
+ * @param islandIndex Index of the island
+ */
+void ContactSolverSystem::computeIslandColors(uint32 islandIndex) {
+
+    RP3D_PROFILE("ContactSolver::computeIslandColors()", mProfiler);
+
+    mColoring.reset(mRigidBodyComponents.getNbComponents());
+
+    const uint32 manifoldStartIndex = mIslands.contactManifoldsIndices[islandIndex];
+    const uint32 nbManifolds = mIslands.nbContactManifolds[islandIndex];
+    for (uint32 c=manifoldStartIndex; c < manifoldStartIndex + nbManifolds; c++) {
+
+        const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
+        const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
+
+        // The velocities of the static bodies are not modified by the solver
+        mColoring.addConstraint(c, mRigidBodyComponents.mBodyTypes[rigidBody1Index] != BodyType::STATIC ? rigidBody1Index : ConstraintGraphColoring::NO_BODY,
+                                mRigidBodyComponents.mBodyTypes[rigidBody2Index] != BodyType::STATIC ? rigidBody2Index : ConstraintGraphColoring::NO_BODY);
+    }
+
+    mColoring.computeColors();
+}
+
+// Warm start some contact manifold constraints (of the same color)
+/**
+ * @param manifoldIndices Array with the indices of the contact manifold constraints
+ * @param nbManifolds Number of contact manifold constraints in the array
+ */
+void ContactSolverSystem::warmStartManifolds(const uint32* manifoldIndices, uint32 nbManifolds) {
+
+    for (uint32 i=0; i < nbManifolds; i++) {
+        warmStart(manifoldIndices[i], 1, mContactPointsStartIndices[manifoldIndices[i]]);
+    }
+}
+
+// Solve some contact manifold constraints (of the same color)
+/**
+ * @param manifoldIndices Array with the indices of the contact manifold constraints
+ * @param nbManifolds Number of contact manifold constraints in the array
+ */
+void ContactSolverSystem::solveManifolds(const uint32* manifoldIndices, uint32 nbManifolds) {
+
+    for (uint32 i=0; i < nbManifolds; i++) {
+        solve(manifoldIndices[i], 1, mContactPointsStartIndices[manifoldIndices[i]]);
+    }
+}
+
+// Store the computed impulses of a range of contact manifold constraints
+/**
+ * @param manifoldStartIndex Index of the first contact manifold constraint of the range
+ * @param nbManifolds Number of contact manifold constraints of the range
+ */
+void ContactSolverSystem::storeImpulsesManifolds(uint32 manifoldStartIndex, uint32 nbManifolds) {
+
+    storeImpulses(manifoldStartIndex, nbManifolds, mContactPointsStartIndices[manifoldStartIndex]);
+}
+
+// Pack the contact manifolds of each color computed by computeIslandColors() for the wide solver
+/// The contact manifolds of each color (except the overflow color whose manifolds can share
+/// bodies) are packed by groups of RP3D_SIMD_WIDTH manifolds. This method must be called after
+/// the warm starting because the wide constraints start with the current accumulated impulses.
+void ContactSolverSystem::packWideContactManifolds() {
+
+    RP3D_PROFILE("ContactSolver::packWideContactManifolds()", mProfiler);
+
+    const uint32 nbColors = mColoring.getNbColors();
+
+    // Compute the index of the first wide contact manifold constraint of each color
+    mColorsWideStartIndices = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                           sizeof(uint32) * (nbColors + 1)));
+    mNbWideContactManifolds = 0;
+    for (uint32 c=0; c < nbColors; c++) {
+        mColorsWideStartIndices[c] = mNbWideContactManifolds;
+        if (!mColoring.isOverflowColor(c)) {
+            mNbWideContactManifolds += (mColoring.getNbConstraintsInColor(c) + RP3D_SIMD_WIDTH - 1) / RP3D_SIMD_WIDTH;
+        }
+    }
+    mColorsWideStartIndices[nbColors] = mNbWideContactManifolds;
+
+    if (mNbWideContactManifolds == 0) return;
+
+    mWideContactManifolds = static_cast<WideContactManifoldSolver*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                     sizeof(WideContactManifoldSolver) * mNbWideContactManifolds));
+    assert(mWideContactManifolds != nullptr);
+
+    // The unused lanes must be zero
+    std::memset(static_cast<void*>(mWideContactManifolds), 0, sizeof(WideContactManifoldSolver) * mNbWideContactManifolds);
+
+    for (uint32 c=0; c < nbColors; c++) {
+
+        const uint32 nbManifolds = mColoring.getNbConstraintsInColor(c);
+        if (mColoring.isOverflowColor(c) || nbManifolds == 0) continue;
+
+        const uint32* manifoldIndices = mColoring.getColorConstraints(c);
+        for (uint32 i=0; i < nbManifolds; i++) {
+
+            WideContactManifoldSolver& wideManifold = mWideContactManifolds[mColorsWideStartIndices[c] + i / RP3D_SIMD_WIDTH];
+            packWideContactManifold(wideManifold, i % RP3D_SIMD_WIDTH, manifoldIndices[i]);
+            wideManifold.nbManifolds++;
+        }
+    }
+}
+
+// Pack a contact manifold constraint into a lane of a wide contact manifold constraint
+/**
+ * @param wideManifold The wide contact manifold constraint
+ * @param lane Index of the lane
+ * @param manifoldIndex Index of the contact manifold constraint
+ */
+void ContactSolverSystem::packWideContactManifold(WideContactManifoldSolver& wideManifold, uint32 lane, uint32 manifoldIndex) {
+
+    const ContactManifoldSolver& manifold = mContactConstraints[manifoldIndex];
+
+    assert(manifold.nbContacts <= static_cast<int8>(MAX_WIDE_CONTACT_POINTS));
+
+    wideManifold.manifoldIndices[lane] = manifoldIndex;
+    wideManifold.rigidBodyComponentIndexBody1[lane] = manifold.rigidBodyComponentIndexBody1;
+    wideManifold.rigidBodyComponentIndexBody2[lane] = manifold.rigidBodyComponentIndexBody2;
+    wideManifold.massInverseBody1[lane] = manifold.massInverseBody1;
+    wideManifold.massInverseBody2[lane] = manifold.massInverseBody2;
+    wideManifold.linearLockAxisFactorBody1.set(lane, manifold.linearLockAxisFactorBody1);
+    wideManifold.linearLockAxisFactorBody2.set(lane, manifold.linearLockAxisFactorBody2);
+    wideManifold.angularLockAxisFactorBody1.set(lane, manifold.angularLockAxisFactorBody1);
+    wideManifold.angularLockAxisFactorBody2.set(lane, manifold.angularLockAxisFactorBody2);
+    for (int r=0; r < 3; r++) {
+        wideManifold.inverseInertiaTensorBody1[r].set(lane, manifold.inverseInertiaTensorBody1[r]);
+        wideManifold.inverseInertiaTensorBody2[r].set(lane, manifold.inverseInertiaTensorBody2[r]);
+    }
+    wideManifold.frictionCoefficient[lane] = manifold.frictionCoefficient;
+    wideManifold.normal.set(lane, manifold.normal);
+    wideManifold.r1Friction.set(lane, manifold.r1Friction);
+    wideManifold.r2Friction.set(lane, manifold.r2Friction);
+    wideManifold.r1CrossT1.set(lane, manifold.r1CrossT1);
+    wideManifold.r1CrossT2.set(lane, manifold.r1CrossT2);
+    wideManifold.r2CrossT1.set(lane, manifold.r2CrossT1);
+    wideManifold.r2CrossT2.set(lane, manifold.r2CrossT2);
+    wideManifold.inverseFriction1Mass[lane] = manifold.inverseFriction1Mass;
+    wideManifold.inverseFriction2Mass[lane] = manifold.inverseFriction2Mass;
+    wideManifold.inverseTwistFrictionMass[lane] = manifold.inverseTwistFrictionMass;
+    wideManifold.frictionVector1.set(lane, manifold.frictionVector1);
+    wideManifold.frictionVector2.set(lane, manifold.frictionVector2);
+    wideManifold.friction1Impulse[lane] = manifold.friction1Impulse;
+    wideManifold.friction2Impulse[lane] = manifold.friction2Impulse;
+    wideManifold.frictionTwistImpulse[lane] = manifold.frictionTwistImpulse;
+
+    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+
+    const uint32 contactPointStartIndex = mContactPointsStartIndices[manifoldIndex];
+    for (int8 i=0; i < manifold.nbContacts; i++) {
+
+        const ContactPointSolver& contactPoint = mContactPoints[contactPointStartIndex + i];
+        WideContactPointSolver& wideContactPoint = wideManifold.contactPoints[i];
+
+        wideContactPoint.normal.set(lane, contactPoint.normal);
+        wideContactPoint.r1.set(lane, contactPoint.r1);
+        wideContactPoint.r2.set(lane, contactPoint.r2);
+
+        // Same bias as the one computed by the scalar solver
+        decimal biasPenetrationDepth = 0.0;
+        if (contactPoint.penetrationDepth > SLOP) {
+            biasPenetrationDepth = -(beta/mTimeStep) * std::max(0.0f, float(contactPoint.penetrationDepth - SLOP));
+        }
+        wideContactPoint.biasPenetrationDepth[lane] = biasPenetrationDepth;
+        wideContactPoint.restitutionBias[lane] = contactPoint.restitutionBias;
+        wideContactPoint.inversePenetrationMass[lane] = contactPoint.inversePenetrationMass;
+        wideContactPoint.i1TimesR1CrossN.set(lane, contactPoint.i1TimesR1CrossN);
+        wideContactPoint.i2TimesR2CrossN.set(lane, contactPoint.i2TimesR2CrossN);
+        wideContactPoint.penetrationImpulse[lane] = contactPoint.penetrationImpulse;
+        wideContactPoint.penetrationSplitImpulse[lane] = contactPoint.penetrationSplitImpulse;
+    }
+}
+
+// Return the product of the rows of an inverse inertia tensor with a vector
+static RP3D_FORCE_INLINE Vector3W multiplyInertia(const Vector3W rows[3], const Vector3W& vector) {
+    return Vector3W(rows[0].x * vector.x + rows[0].y * vector.y + rows[0].z * vector.z,
+                    rows[1].x * vector.x + rows[1].y * vector.y + rows[1].z * vector.z,
+                    rows[2].x * vector.x + rows[2].y * vector.y + rows[2].z * vector.z);
+}
+
+// Solve a range of the wide contact manifold constraints of a color
+/// Each lane gives the same result as the scalar solve() method for its contact manifold.
+/// The manifolds of a color do not share any non-static body and can be solved together.
+/**
+ * @param color Index of the color
+ * @param startIndex Index of the first wide contact manifold constraint in the color
+ * @param nbWideManifolds Number of wide contact manifold constraints to solve
+ */
+void ContactSolverSystem::solveWideContactManifolds(uint32 color, uint32 startIndex, uint32 nbWideManifolds) {
+
+    const DecimalW zero(decimal(0.0));
+
+    const uint32 firstIndex = mColorsWideStartIndices[color] + startIndex;
+    assert(firstIndex + nbWideManifolds <= mColorsWideStartIndices[color + 1]);
+
+    for (uint32 c=firstIndex; c < firstIndex + nbWideManifolds; c++) {
+
+        WideContactManifoldSolver& manifold = mWideContactManifolds[c];
+
+        // Gather the constrained and split velocities of the bodies (zero for the unused lanes)
+        Vector3Lanes velocities[8];
+        std::memset(static_cast<void*>(velocities), 0, sizeof(velocities));
+        for (uint32 l=0; l < manifold.nbManifolds; l++) {
+            const uint32 rigidBody1Index = manifold.rigidBodyComponentIndexBody1[l];
+            const uint32 rigidBody2Index = manifold.rigidBodyComponentIndexBody2[l];
+            velocities[0].set(l, mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index]);
+            velocities[1].set(l, mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index]);
+            velocities[2].set(l, mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index]);
+            velocities[3].set(l, mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index]);
+            velocities[4].set(l, mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index]);
+            velocities[5].set(l, mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index]);
+            velocities[6].set(l, mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index]);
+            velocities[7].set(l, mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index]);
+        }
+        Vector3W v1 = velocities[0].load();
+        Vector3W w1 = velocities[1].load();
+        Vector3W v2 = velocities[2].load();
+        Vector3W w2 = velocities[3].load();
+        Vector3W v1Split = velocities[4].load();
+        Vector3W w1Split = velocities[5].load();
+        Vector3W v2Split = velocities[6].load();
+        Vector3W w2Split = velocities[7].load();
+
+        const DecimalW massInverseBody1 = DecimalW::load(manifold.massInverseBody1);
+        const DecimalW massInverseBody2 = DecimalW::load(manifold.massInverseBody2);
+        const Vector3W linearLockAxisFactorBody1 = manifold.linearLockAxisFactorBody1.load();
+        const Vector3W linearLockAxisFactorBody2 = manifold.linearLockAxisFactorBody2.load();
+        const Vector3W angularLockAxisFactorBody1 = manifold.angularLockAxisFactorBody1.load();
+        const Vector3W angularLockAxisFactorBody2 = manifold.angularLockAxisFactorBody2.load();
+
+        DecimalW sumPenetrationImpulse = zero;
+
+        // For each contact point slot (the empty slots of a lane do not apply any impulse)
+        for (uint32 i=0; i < MAX_WIDE_CONTACT_POINTS; i++) {
+
+            WideContactPointSolver& contactPoint = manifold.contactPoints[i];
+
+            const Vector3W normal = contactPoint.normal.load();
+            const Vector3W r1 = contactPoint.r1.load();
+            const Vector3W r2 = contactPoint.r2.load();
+            const Vector3W i1TimesR1CrossN = contactPoint.i1TimesR1CrossN.load();
+            const Vector3W i2TimesR2CrossN = contactPoint.i2TimesR2CrossN.load();
+            const DecimalW inversePenetrationMass = DecimalW::load(contactPoint.inversePenetrationMass);
+            const DecimalW restitutionBias = DecimalW::load(contactPoint.restitutionBias);
+            const DecimalW biasPenetrationDepth = DecimalW::load(contactPoint.biasPenetrationDepth);
+
+            // --------- Penetration --------- //
+
+            // Compute J*v
+            Vector3W deltaV(v2.x + w2.y * r2.z - w2.z * r2.y - v1.x - w1.y * r1.z + w1.z * r1.y,
+                            v2.y + w2.z * r2.x - w2.x * r2.z - v1.y - w1.z * r1.x + w1.x * r1.z,
+                            v2.z + w2.x * r2.y - w2.y * r2.x - v1.z - w1.x * r1.y + w1.y * r1.x);
+            DecimalW Jv = deltaV.x * normal.x + deltaV.y * normal.y + deltaV.z * normal.z;
+
+            // Compute the Lagrange multiplier lambda
+            DecimalW deltaLambda = mIsSplitImpulseActive ? -(Jv + restitutionBias) * inversePenetrationMass :
+                                                           -(Jv + (biasPenetrationDepth + restitutionBias)) * inversePenetrationMass;
+            const DecimalW lambdaTemp = DecimalW::load(contactPoint.penetrationImpulse);
+            const DecimalW penetrationImpulse = max(lambdaTemp + deltaLambda, zero);
+            penetrationImpulse.store(contactPoint.penetrationImpulse);
+            deltaLambda = penetrationImpulse - lambdaTemp;
+
+            Vector3W linearImpulse(normal.x * deltaLambda, normal.y * deltaLambda, normal.z * deltaLambda);
+
+            // Update the velocities of the body 1 by applying the impulse P
+            v1.x = v1.x - massInverseBody1 * linearImpulse.x * linearLockAxisFactorBody1.x;
+            v1.y = v1.y - massInverseBody1 * linearImpulse.y * linearLockAxisFactorBody1.y;
+            v1.z = v1.z - massInverseBody1 * linearImpulse.z * linearLockAxisFactorBody1.z;
+
+            w1.x = w1.x - i1TimesR1CrossN.x * angularLockAxisFactorBody1.x * deltaLambda;
+            w1.y = w1.y - i1TimesR1CrossN.y * angularLockAxisFactorBody1.y * deltaLambda;
+            w1.z = w1.z - i1TimesR1CrossN.z * angularLockAxisFactorBody1.z * deltaLambda;
+
+            // Update the velocities of the body 2 by applying the impulse P
+            v2.x = v2.x + massInverseBody2 * linearImpulse.x * linearLockAxisFactorBody2.x;
+            v2.y = v2.y + massInverseBody2 * linearImpulse.y * linearLockAxisFactorBody2.y;
+            v2.z = v2.z + massInverseBody2 * linearImpulse.z * linearLockAxisFactorBody2.z;
+
+            w2.x = w2.x + i2TimesR2CrossN.x * angularLockAxisFactorBody2.x * deltaLambda;
+            w2.y = w2.y + i2TimesR2CrossN.y * angularLockAxisFactorBody2.y * deltaLambda;
+            w2.z = w2.z + i2TimesR2CrossN.z * angularLockAxisFactorBody2.z * deltaLambda;
+
+            sumPenetrationImpulse = sumPenetrationImpulse + penetrationImpulse;
+
+            // If the split impulse position correction is active
+            if (mIsSplitImpulseActive) {
+
+                // Split impulse (position correction)
+                Vector3W deltaVSplit(v2Split.x + w2Split.y * r2.z - w2Split.z * r2.y - v1Split.x - w1Split.y * r1.z + w1Split.z * r1.y,
+                                     v2Split.y + w2Split.z * r2.x - w2Split.x * r2.z - v1Split.y - w1Split.z * r1.x + w1Split.x * r1.z,
+                                     v2Split.z + w2Split.x * r2.y - w2Split.y * r2.x - v1Split.z - w1Split.x * r1.y + w1Split.y * r1.x);
+                DecimalW JvSplit = deltaVSplit.x * normal.x + deltaVSplit.y * normal.y + deltaVSplit.z * normal.z;
+                DecimalW deltaLambdaSplit = -(JvSplit + biasPenetrationDepth) * inversePenetrationMass;
+                const DecimalW lambdaTempSplit = DecimalW::load(contactPoint.penetrationSplitImpulse);
+                const DecimalW penetrationSplitImpulse = max(lambdaTempSplit + deltaLambdaSplit, zero);
+                penetrationSplitImpulse.store(contactPoint.penetrationSplitImpulse);
+                deltaLambdaSplit = penetrationSplitImpulse - lambdaTempSplit;
+
+                Vector3W linearImpulseSplit(normal.x * deltaLambdaSplit, normal.y * deltaLambdaSplit, normal.z * deltaLambdaSplit);
+
+                // Update the velocities of the body 1 by applying the impulse P
+                v1Split.x = v1Split.x - massInverseBody1 * linearImpulseSplit.x * linearLockAxisFactorBody1.x;
+                v1Split.y = v1Split.y - massInverseBody1 * linearImpulseSplit.y * linearLockAxisFactorBody1.y;
+                v1Split.z = v1Split.z - massInverseBody1 * linearImpulseSplit.z * linearLockAxisFactorBody1.z;
+
+                w1Split.x = w1Split.x - i1TimesR1CrossN.x * angularLockAxisFactorBody1.x * deltaLambdaSplit;
+                w1Split.y = w1Split.y - i1TimesR1CrossN.y * angularLockAxisFactorBody1.y * deltaLambdaSplit;
+                w1Split.z = w1Split.z - i1TimesR1CrossN.z * angularLockAxisFactorBody1.z * deltaLambdaSplit;
+
+                // Update the velocities of the body 2 by applying the impulse P
+                v2Split.x = v2Split.x + massInverseBody2 * linearImpulseSplit.x * linearLockAxisFactorBody2.x;
+                v2Split.y = v2Split.y + massInverseBody2 * linearImpulseSplit.y * linearLockAxisFactorBody2.y;
+                v2Split.z = v2Split.z + massInverseBody2 * linearImpulseSplit.z * linearLockAxisFactorBody2.z;
+
+                w2Split.x = w2Split.x + i2TimesR2CrossN.x * angularLockAxisFactorBody2.x * deltaLambdaSplit;
+                w2Split.y = w2Split.y + i2TimesR2CrossN.y * angularLockAxisFactorBody2.y * deltaLambdaSplit;
+                w2Split.z = w2Split.z + i2TimesR2CrossN.z * angularLockAxisFactorBody2.z * deltaLambdaSplit;
+            }
+        }
+
+        Vector3W inverseInertiaTensorBody1[3];
+        Vector3W inverseInertiaTensorBody2[3];
+        for (int r=0; r < 3; r++) {
+            inverseInertiaTensorBody1[r] = manifold.inverseInertiaTensorBody1[r].load();
+            inverseInertiaTensorBody2[r] = manifold.inverseInertiaTensorBody2[r].load();
+        }
+        const Vector3W r1Friction = manifold.r1Friction.load();
+        const Vector3W r2Friction = manifold.r2Friction.load();
+        const DecimalW frictionLimit = DecimalW::load(manifold.frictionCoefficient) * sumPenetrationImpulse;
+
+        // The two friction constraints at the center of the contact manifold only differ by their data
+        const Vector3Lanes* frictionVectors[2] = {&manifold.frictionVector1, &manifold.frictionVector2};
+        const Vector3Lanes* r1CrossTs[2] = {&manifold.r1CrossT1, &manifold.r1CrossT2};
+        const Vector3Lanes* r2CrossTs[2] = {&manifold.r2CrossT1, &manifold.r2CrossT2};
+        const decimal* inverseFrictionMasses[2] = {manifold.inverseFriction1Mass, manifold.inverseFriction2Mass};
+        decimal* frictionImpulses[2] = {manifold.friction1Impulse, manifold.friction2Impulse};
+
+        for (int f=0; f < 2; f++) {
+
+            // ------ Friction constraint at the center of the contact manifold ------ //
+
+            const Vector3W frictionVector = frictionVectors[f]->load();
+            const Vector3W r1CrossT = r1CrossTs[f]->load();
+            const Vector3W r2CrossT = r2CrossTs[f]->load();
+
+            // Compute J*v
+            Vector3W deltaV(v2.x + w2.y * r2Friction.z - w2.z * r2Friction.y - v1.x - w1.y * r1Friction.z + w1.z * r1Friction.y,
+                            v2.y + w2.z * r2Friction.x - w2.x * r2Friction.z - v1.y - w1.z * r1Friction.x + w1.x * r1Friction.z,
+                            v2.z + w2.x * r2Friction.y - w2.y * r2Friction.x - v1.z - w1.x * r1Friction.y + w1.y * r1Friction.x);
+            DecimalW Jv = deltaV.x * frictionVector.x + deltaV.y * frictionVector.y + deltaV.z * frictionVector.z;
+
+            // Compute the Lagrange multiplier lambda
+            DecimalW deltaLambda = -Jv * DecimalW::load(inverseFrictionMasses[f]);
+            const DecimalW lambdaTemp = DecimalW::load(frictionImpulses[f]);
+            const DecimalW frictionImpulse = max(-frictionLimit, min(lambdaTemp + deltaLambda, frictionLimit));
+            frictionImpulse.store(frictionImpulses[f]);
+            deltaLambda = frictionImpulse - lambdaTemp;
+
+            // Compute the impulse P=J^T * lambda
+            Vector3W angularImpulseBody1(-r1CrossT.x * deltaLambda, -r1CrossT.y * deltaLambda, -r1CrossT.z * deltaLambda);
+            Vector3W linearImpulseBody2(frictionVector.x * deltaLambda, frictionVector.y * deltaLambda, frictionVector.z * deltaLambda);
+            Vector3W angularImpulseBody2(r2CrossT.x * deltaLambda, r2CrossT.y * deltaLambda, r2CrossT.z * deltaLambda);
+
+            // Update the velocities of the body 1 by applying the impulse P
+            v1.x = v1.x - massInverseBody1 * linearImpulseBody2.x * linearLockAxisFactorBody1.x;
+            v1.y = v1.y - massInverseBody1 * linearImpulseBody2.y * linearLockAxisFactorBody1.y;
+            v1.z = v1.z - massInverseBody1 * linearImpulseBody2.z * linearLockAxisFactorBody1.z;
+
+            Vector3W angularVelocity1 = multiplyInertia(inverseInertiaTensorBody1, angularImpulseBody1);
+            w1.x = w1.x + angularLockAxisFactorBody1.x * angularVelocity1.x;
+            w1.y = w1.y + angularLockAxisFactorBody1.y * angularVelocity1.y;
+            w1.z = w1.z + angularLockAxisFactorBody1.z * angularVelocity1.z;
+
+            // Update the velocities of the body 2 by applying the impulse P
+            v2.x = v2.x + massInverseBody2 * linearImpulseBody2.x * linearLockAxisFactorBody2.x;
+            v2.y = v2.y + massInverseBody2 * linearImpulseBody2.y * linearLockAxisFactorBody2.y;
+            v2.z = v2.z + massInverseBody2 * linearImpulseBody2.z * linearLockAxisFactorBody2.z;
+
+            Vector3W angularVelocity2 = multiplyInertia(inverseInertiaTensorBody2, angularImpulseBody2);
+            w2.x = w2.x + angularLockAxisFactorBody2.x * angularVelocity2.x;
+            w2.y = w2.y + angularLockAxisFactorBody2.y * angularVelocity2.y;
+            w2.z = w2.z + angularLockAxisFactorBody2.z * angularVelocity2.z;
+        }
+
+        // ------ Twist friction constraint at the center of the contact manifold ------ //
+
+        const Vector3W normal = manifold.normal.load();
+
+        // Compute J*v
+        DecimalW Jv = (w2.x - w1.x) * normal.x + (w2.y - w1.y) * normal.y + (w2.z - w1.z) * normal.z;
+
+        DecimalW deltaLambda = -Jv * DecimalW::load(manifold.inverseTwistFrictionMass);
+        const DecimalW lambdaTemp = DecimalW::load(manifold.frictionTwistImpulse);
+        const DecimalW frictionTwistImpulse = max(-frictionLimit, min(lambdaTemp + deltaLambda, frictionLimit));
+        frictionTwistImpulse.store(manifold.frictionTwistImpulse);
+        deltaLambda = frictionTwistImpulse - lambdaTemp;
+
+        // Compute the impulse P=J^T * lambda
+        Vector3W angularImpulseBody2(normal.x * deltaLambda, normal.y * deltaLambda, normal.z * deltaLambda);
+
+        // Update the velocities of the body 1 by applying the impulse P
+        Vector3W angularVelocity1 = multiplyInertia(inverseInertiaTensorBody1, angularImpulseBody2);
+        w1.x = w1.x - angularLockAxisFactorBody1.x * angularVelocity1.x;
+        w1.y = w1.y - angularLockAxisFactorBody1.y * angularVelocity1.y;
+        w1.z = w1.z - angularLockAxisFactorBody1.z * angularVelocity1.z;
+
+        // Update the velocities of the body 2 by applying the impulse P
+        Vector3W angularVelocity2 = multiplyInertia(inverseInertiaTensorBody2, angularImpulseBody2);
+        w2.x = w2.x + angularLockAxisFactorBody2.x * angularVelocity2.x;
+        w2.y = w2.y + angularLockAxisFactorBody2.y * angularVelocity2.y;
+        w2.z = w2.z + angularLockAxisFactorBody2.z * angularVelocity2.z;
+
+        // Scatter the velocities of the bodies of the used lanes
+        velocities[0].store(v1);
+        velocities[1].store(w1);
+        velocities[2].store(v2);
+        velocities[3].store(w2);
+        velocities[4].store(v1Split);
+        velocities[5].store(w1Split);
+        velocities[6].store(v2Split);
+        velocities[7].store(w2Split);
+        for (uint32 l=0; l < manifold.nbManifolds; l++) {
+            const uint32 rigidBody1Index = manifold.rigidBodyComponentIndexBody1[l];
+            const uint32 rigidBody2Index = manifold.rigidBodyComponentIndexBody2[l];
+            mRigidBodyComponents.updateConstrainedVelocities(rigidBody1Index, velocities[0].get(l), velocities[1].get(l));
+            mRigidBodyComponents.updateConstrainedVelocities(rigidBody2Index, velocities[2].get(l), velocities[3].get(l));
+            if (mIsSplitImpulseActive) {
+                mRigidBodyComponents.updateSplitVelocities(rigidBody1Index, velocities[4].get(l), velocities[5].get(l));
+                mRigidBodyComponents.updateSplitVelocities(rigidBody2Index, velocities[6].get(l), velocities[7].get(l));
+            }
+        }
+    }
+}
+
+// Copy the impulses of the wide contact manifold constraints back to the contact manifold constraints
+/// This method must be called before storing the impulses of the contact manifolds.
+void ContactSolverSystem::unpackWideContactManifolds() {
+
+    RP3D_PROFILE("ContactSolver::unpackWideContactManifolds()", mProfiler);
+
+    for (uint32 c=0; c < mNbWideContactManifolds; c++) {
+
+        const WideContactManifoldSolver& wideManifold = mWideContactManifolds[c];
+
+        for (uint32 l=0; l < wideManifold.nbManifolds; l++) {
+
+            const uint32 manifoldIndex = wideManifold.manifoldIndices[l];
+            ContactManifoldSolver& manifold = mContactConstraints[manifoldIndex];
+
+            manifold.friction1Impulse = wideManifold.friction1Impulse[l];
+            manifold.friction2Impulse = wideManifold.friction2Impulse[l];
+            manifold.frictionTwistImpulse = wideManifold.frictionTwistImpulse[l];
+
+            const uint32 contactPointStartIndex = mContactPointsStartIndices[manifoldIndex];
+            for (int8 i=0; i < manifold.nbContacts; i++) {
+                mContactPoints[contactPointStartIndex + i].penetrationImpulse = wideManifold.contactPoints[i].penetrationImpulse[l];
+                mContactPoints[contactPointStartIndex + i].penetrationSplitImpulse = wideManifold.contactPoints[i].penetrationSplitImpulse[l];
+            }
+        }
+    }
+
+    // Release the wide contact manifold constraints
+    if (mNbWideContactManifolds > 0) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mWideContactManifolds, sizeof(WideContactManifoldSolver) * mNbWideContactManifolds);
+    }
+    mMemoryManager.release(MemoryManager::AllocationType::Frame, mColorsWideStartIndices, sizeof(uint32) * (mColoring.getNbColors() + 1));
+    mWideContactManifolds = nullptr;
+    mColorsWideStartIndices = nullptr;
+    mNbWideContactManifolds = 0;
+}
+
 // Compute the two unit orthogonal vectors "t1" and "t2" that span the tangential friction plane
 // for a contact manifold. The two vectors have to be such that : t1 x t2 = contactNormal.
 void ContactSolverSystem::computeFrictionVectors(const Vector3& deltaVelocity, ContactManifoldSolver& contact) const {
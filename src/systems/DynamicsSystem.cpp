@@ -38,6 +38,33 @@ DynamicsSystem::DynamicsSystem(PhysicsWorld& world, BodyComponents& bodyComponen
 
 }
 
+// Execute a stage on all the enabled components (on the threads of the task scheduler of the world if any)
+void DynamicsSystem::runStage(UpdateBodiesTask& task, uint32 nbComponents) {
+
+    if (nbComponents > 0) {
+        TaskScheduler::run(mWorld.getTaskScheduler(), task, nbComponents, MIN_BATCH_SIZE);
+    }
+}
+
+// Update the inverse world inertia tensors of the rigid bodies
+void DynamicsSystem::updateBodiesInverseWorldInertiaTensors() {
+
+    RP3D_PROFILE("DynamicsSystem::updateBodiesInverseWorldInertiaTensors()", mProfiler);
+
+    UpdateBodiesTask task(*this, UpdateBodiesTask::Stage::UpdateInertiaTensors);
+    runStage(task, mRigidBodyComponents.getNbEnabledComponents());
+}
+
+// Update the inverse world inertia tensors of a range of rigid bodies
+void DynamicsSystem::updateBodiesInverseWorldInertiaTensors(uint32 startIndex, uint32 endIndex) {
+
+    for (uint32 i=startIndex; i < endIndex; i++) {
+        const Matrix3x3 orientation = mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]).getOrientation().getMatrix();
+
+        RigidBody::computeWorldInertiaTensorInverse(orientation, mRigidBodyComponents.mInverseInertiaTensorsLocal[i], mRigidBodyComponents.mInverseInertiaTensorsWorld[i]);
+    }
+}
+
 // Integrate position and orientation of the rigid bodies.
 /// The positions and orientations of the bodies are integrated using
 /// the sympletic Euler time stepping scheme.
@@ -45,10 +72,16 @@ void DynamicsSystem::integrateRigidBodiesPositions(decimal timeStep, bool isSpli
 
     RP3D_PROFILE("DynamicsSystem::integrateRigidBodiesPositions()", mProfiler);
 
+    UpdateBodiesTask task(*this, UpdateBodiesTask::Stage::IntegratePositions, timeStep, isSplitImpulseActive);
+    runStage(task, mRigidBodyComponents.getNbEnabledComponents());
+}
+
+// Integrate the positions and orientations of a range of rigid bodies
+void DynamicsSystem::integrateRigidBodiesPositions(decimal timeStep, bool isSplitImpulseActive, uint32 startIndex, uint32 endIndex) {
+
     const decimal isSplitImpulseFactor = isSplitImpulseActive ? decimal(1.0) : decimal(0.0);
 
-    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         // Get the constrained velocity
         Vector3 newLinVelocity = mRigidBodyComponents.mConstrainedLinearVelocities[i];
@@ -75,8 +108,18 @@ void DynamicsSystem::updateBodiesState() {
 
     RP3D_PROFILE("DynamicsSystem::updateBodiesState()", mProfiler);
 
-    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+    UpdateBodiesTask bodiesTask(*this, UpdateBodiesTask::Stage::UpdateBodiesState);
+    runStage(bodiesTask, mRigidBodyComponents.getNbEnabledComponents());
+
+    // Update the local-to-world transform of the colliders (once the transforms of all the bodies are updated)
+    UpdateBodiesTask collidersTask(*this, UpdateBodiesTask::Stage::UpdateCollidersTransforms);
+    runStage(collidersTask, mColliderComponents.getNbEnabledComponents());
+}
+
+// Update the postion/orientation of a range of rigid bodies
+void DynamicsSystem::updateBodiesState(uint32 startIndex, uint32 endIndex) {
+
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         // Update the linear and angular velocity of the body
         mRigidBodyComponents.mLinearVelocities[i] = mRigidBodyComponents.mConstrainedLinearVelocities[i];
@@ -86,22 +129,21 @@ void DynamicsSystem::updateBodiesState() {
         mRigidBodyComponents.mCentersOfMassWorld[i] = mRigidBodyComponents.mConstrainedPositions[i];
 
         // Update the orientation of the body
+        Transform& transform = mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]);
         const Quaternion& constrainedOrientation = mRigidBodyComponents.mConstrainedOrientations[i];
-        mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]).setOrientation(constrainedOrientation.getUnit());
-    }
+        transform.setOrientation(constrainedOrientation.getUnit());
 
-    // Update the position of the body (using the new center of mass and new orientation)
-    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
-
-        Transform& transform = mTransformComponents.getTransform(mRigidBodyComponents.mBodiesEntities[i]);
+        // Update the position of the body (using the new center of mass and new orientation)
         const Vector3& centerOfMassWorld = mRigidBodyComponents.mCentersOfMassWorld[i];
         const Vector3& centerOfMassLocal = mRigidBodyComponents.mCentersOfMassLocal[i];
         transform.setPosition(centerOfMassWorld - transform.getOrientation() * centerOfMassLocal);
     }
+}
 
-    // Update the local-to-world transform of the colliders
-    const uint32 nbColliderComponents = mColliderComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbColliderComponents; i++) {
+// Update the local-to-world transform of a range of colliders
+void DynamicsSystem::updateCollidersTransforms(uint32 startIndex, uint32 endIndex) {
+
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         // Update the local-to-world transform of the collider
         mColliderComponents.mLocalToWorldTransforms[i] = mTransformComponents.getTransform(mColliderComponents.mBodiesEntities[i]) *
@@ -118,42 +160,14 @@ void DynamicsSystem::integrateRigidBodiesVelocities(decimal timeStep) {
 
     RP3D_PROFILE("DynamicsSystem::integrateRigidBodiesVelocities()", mProfiler);
 
-    // Reset the split velocities of the bodies
-    resetSplitVelocities();
-
-    // Integration component velocities using force/torque
-    const uint32 nbEnabledRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbEnabledRigidBodyComponents; i++) {
-
-        assert(mRigidBodyComponents.mSplitLinearVelocities[i] == Vector3(0, 0, 0));
-        assert(mRigidBodyComponents.mSplitAngularVelocities[i] == Vector3(0, 0, 0));
-
-        const Vector3& linearVelocity = mRigidBodyComponents.mLinearVelocities[i];
-        const Vector3& angularVelocity = mRigidBodyComponents.mAngularVelocities[i];
-
-        // Integrate the external force to get the new velocity of the body
-        mRigidBodyComponents.mConstrainedLinearVelocities[i] = linearVelocity + timeStep * mRigidBodyComponents.mInverseMasses[i] *
-                                                               mRigidBodyComponents.mLinearLockAxisFactors[i] * mRigidBodyComponents.mExternalForces[i];
-        mRigidBodyComponents.mConstrainedAngularVelocities[i] = angularVelocity + timeStep * mRigidBodyComponents.mAngularLockAxisFactors[i] *
-                                                                (mRigidBodyComponents.mInverseInertiaTensorsWorld[i] * mRigidBodyComponents.mExternalTorques[i]);
-    }
-
-    // Apply gravity force
-    if (mIsGravityEnabled) {
-
-        const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-        for (uint32 i=0; i < nbRigidBodyComponents; i++) {
-
-            // If the gravity has to be applied to this rigid body
-            if (mRigidBodyComponents.mIsGravityEnabled[i]) {
+    UpdateBodiesTask task(*this, UpdateBodiesTask::Stage::IntegrateVelocities, timeStep);
+    runStage(task, mRigidBodyComponents.getNbEnabledComponents());
+}
 
-                // Integrate the gravity force
-                mRigidBodyComponents.mConstrainedLinearVelocities[i] = mRigidBodyComponents.mConstrainedLinearVelocities[i] + timeStep *
-                                                                       mRigidBodyComponents.mInverseMasses[i] * mRigidBodyComponents.mLinearLockAxisFactors[i] *
-                                                                       mRigidBodyComponents.mMasses[i] * mGravity;
-            }
-        }
-    }
+// Integrate the velocities of a range of rigid bodies
+/// The split velocities of the bodies are reset, the external forces and the gravity
+/// are integrated and the velocity damping is applied to each body of the range.
+void DynamicsSystem::integrateRigidBodiesVelocities(decimal timeStep, uint32 startIndex, uint32 endIndex) {
 
     // Apply the velocity damping
     // Damping force : F_c = -c' * v (c=damping factor)
@@ -170,15 +184,56 @@ void DynamicsSystem::integrateRigidBodiesVelocities(decimal timeStep) {
     //                   e^x ~ 1 / (1 - x)
     //                      => e^(-c * dt) ~ 1 / (1 + c * dt)
     //                      => v2 = v1 * 1 / (1 + c * dt)
-    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
+
+        // Reset the split velocities of the body
+        mRigidBodyComponents.mSplitLinearVelocities[i].setToZero();
+        mRigidBodyComponents.mSplitAngularVelocities[i].setToZero();
 
+        const Vector3& linearVelocity = mRigidBodyComponents.mLinearVelocities[i];
+        const Vector3& angularVelocity = mRigidBodyComponents.mAngularVelocities[i];
+
+        // Integrate the external force to get the new velocity of the body
+        Vector3 newLinearVelocity = linearVelocity + timeStep * mRigidBodyComponents.mInverseMasses[i] *
+                                    mRigidBodyComponents.mLinearLockAxisFactors[i] * mRigidBodyComponents.mExternalForces[i];
+        Vector3 newAngularVelocity = angularVelocity + timeStep * mRigidBodyComponents.mAngularLockAxisFactors[i] *
+                                     (mRigidBodyComponents.mInverseInertiaTensorsWorld[i] * mRigidBodyComponents.mExternalTorques[i]);
+
+        // Integrate the gravity force (if the gravity has to be applied to this rigid body)
+        if (mIsGravityEnabled && mRigidBodyComponents.mIsGravityEnabled[i]) {
+            newLinearVelocity = newLinearVelocity + timeStep * mRigidBodyComponents.mInverseMasses[i] * mRigidBodyComponents.mLinearLockAxisFactors[i] *
+                                mRigidBodyComponents.mMasses[i] * mGravity;
+        }
+
+        // Apply the velocity damping
         const decimal linDampingFactor = mRigidBodyComponents.mLinearDampings[i];
         const decimal angDampingFactor = mRigidBodyComponents.mAngularDampings[i];
         const decimal linearDamping = decimal(1.0) / (decimal(1.0) + linDampingFactor * timeStep);
         const decimal angularDamping = decimal(1.0) / (decimal(1.0) + angDampingFactor * timeStep);
-        mRigidBodyComponents.mConstrainedLinearVelocities[i] = mRigidBodyComponents.mConstrainedLinearVelocities[i] * linearDamping;
-        mRigidBodyComponents.mConstrainedAngularVelocities[i] = mRigidBodyComponents.mConstrainedAngularVelocities[i] * angularDamping;
+        mRigidBodyComponents.mConstrainedLinearVelocities[i] = newLinearVelocity * linearDamping;
+        mRigidBodyComponents.mConstrainedAngularVelocities[i] = newAngularVelocity * angularDamping;
+    }
+}
+
+// Execute the stage on the components in the range [startIndex, endIndex)
+void DynamicsSystem::UpdateBodiesTask::execute(uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+    switch (mStage) {
+        case Stage::UpdateInertiaTensors:
+            mDynamicsSystem.updateBodiesInverseWorldInertiaTensors(startIndex, endIndex);
+            break;
+        case Stage::IntegrateVelocities:
+            mDynamicsSystem.integrateRigidBodiesVelocities(mTimeStep, startIndex, endIndex);
+            break;
+        case Stage::IntegratePositions:
+            mDynamicsSystem.integrateRigidBodiesPositions(mTimeStep, mIsSplitImpulseActive, startIndex, endIndex);
+            break;
+        case Stage::UpdateBodiesState:
+            mDynamicsSystem.updateBodiesState(startIndex, endIndex);
+            break;
+        case Stage::UpdateCollidersTransforms:
+            mDynamicsSystem.updateCollidersTransforms(startIndex, endIndex);
+            break;
     }
 }
 
@@ -193,13 +248,3 @@ void DynamicsSystem::resetBodiesForceAndTorque() {
     }
 }
 
-// Reset the split velocities of the bodies
-void DynamicsSystem::resetSplitVelocities() {
-
-    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
-    for(uint32 i=0; i < nbRigidBodyComponents; i++) {
-        mRigidBodyComponents.mSplitLinearVelocities[i].setToZero();
-        mRigidBodyComponents.mSplitAngularVelocities[i].setToZero();
-    }
-}
-
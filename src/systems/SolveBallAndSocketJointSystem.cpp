@@ -48,113 +48,121 @@ SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world
 // Initialize before solving the constraint
 void SolveBallAndSocketJointSystem::initBeforeSolve() {
 
-    const decimal biasFactor = (BETA / mTimeStep);
-
     // For each joint
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        initBeforeSolve(i);
+    }
+}
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Initialize a joint before solving the constraint
+/**
+ * @param i Index of the joint in the ball-and-socket joint components
+ */
+void SolveBallAndSocketJointSystem::initBeforeSolve(uint32 i) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const decimal biasFactor = (BETA / mTimeStep);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+
+    assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity) || !mRigidBodyComponents.getIsEntityDisabled(body2Entity));
+
+    // Get the inertia tensor of bodies
+    mBallAndSocketJointComponents.mI1[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody1];
+    mBallAndSocketJointComponents.mI2[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody2];
+
+    const Transform& transformBody1 = mTransformComponents.getTransform(body1Entity);
+    const Transform& transformBody2 = mTransformComponents.getTransform(body2Entity);
+    const Quaternion& orientationBody1 = transformBody1.getOrientation();
+    const Quaternion& orientationBody2 = transformBody2.getOrientation();
+
+    // Compute the vector from body center to the anchor point in world-space
+    mBallAndSocketJointComponents.mR1World[i] = orientationBody1 * (mBallAndSocketJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mBallAndSocketJointComponents.mR2World[i] = orientationBody2 * (mBallAndSocketJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+
+    // Compute the corresponding skew-symmetric matrices
+    const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
+    const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
+    Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
+    Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
+
+    // Compute the matrix K=JM^-1J^t (3x3 matrix)
+    const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    const decimal inverseMassBodies =  body1MassInverse + body2MassInverse;
+    const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
+    const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
+    Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                    0, inverseMassBodies, 0,
+                                    0, 0, inverseMassBodies) +
+                           skewSymmetricMatrixU1 * i1 * skewSymmetricMatrixU1.getTranspose() +
+                           skewSymmetricMatrixU2 * i2 * skewSymmetricMatrixU2.getTranspose();
+
+    // Compute the inverse mass matrix K^-1
+    mBallAndSocketJointComponents.mInverseMassMatrix[i].setToZero();
+    decimal massMatrixDeterminant = massMatrix.getDeterminant();
+    if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mBallAndSocketJointComponents.mInverseMassMatrix[i] = massMatrix.getInverse(massMatrixDeterminant);
+        }
+    }
 
-        assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity) || !mRigidBodyComponents.getIsEntityDisabled(body2Entity));
+    const Vector3& x1 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody1];
+    const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody2];
 
-        // Get the inertia tensor of bodies
-        mBallAndSocketJointComponents.mI1[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody1];
-        mBallAndSocketJointComponents.mI2[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody2];
+    // Compute the bias "b" of the constraint
+    mBallAndSocketJointComponents.mBiasVector[i].setToZero();
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+        mBallAndSocketJointComponents.mBiasVector[i] = biasFactor * (x2 + r2World - x1 - r1World);
+    }
 
-        const Transform& transformBody1 = mTransformComponents.getTransform(body1Entity);
-        const Transform& transformBody2 = mTransformComponents.getTransform(body2Entity);
-        const Quaternion& orientationBody1 = transformBody1.getOrientation();
-        const Quaternion& orientationBody2 = transformBody2.getOrientation();
+    const Vector3 r1WorldUnit = r1World.getUnit();
+    const Vector3 r2WorldUnit = r2World.getUnit();
+    mBallAndSocketJointComponents.mConeLimitACrossB[i] = r1WorldUnit.cross(-r2WorldUnit);
 
-        // Compute the vector from body center to the anchor point in world-space
-        mBallAndSocketJointComponents.mR1World[i] = orientationBody1 * (mBallAndSocketJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mBallAndSocketJointComponents.mR2World[i] = orientationBody2 * (mBallAndSocketJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+    // Compute the current angle around the hinge axis
+    decimal coneAngle = computeCurrentConeHalfAngle(r1WorldUnit, -r2WorldUnit);
 
-        // Compute the corresponding skew-symmetric matrices
-        const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
-        const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
-        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
-        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
+    // Check if the cone limit constraints is violated or not
+    decimal coneLimitError = mBallAndSocketJointComponents.mConeLimitHalfAngle[i] - coneAngle;
+    bool oldIsConeLimitViolated = mBallAndSocketJointComponents.mIsConeLimitViolated[i];
+    bool isConeLimitViolated = coneLimitError < 0;
+    mBallAndSocketJointComponents.mIsConeLimitViolated[i] = isConeLimitViolated;
+    if (!isConeLimitViolated || isConeLimitViolated != oldIsConeLimitViolated) {
+        mBallAndSocketJointComponents.mConeLimitImpulse[i] = decimal(0.0);
+    }
 
-        // Compute the matrix K=JM^-1J^t (3x3 matrix)
-        const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        const decimal inverseMassBodies =  body1MassInverse + body2MassInverse;
-        const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
-        const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * i1 * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * i2 * skewSymmetricMatrixU2.getTranspose();
+    // If the cone limit is enabled
+    if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
 
-        // Compute the inverse mass matrix K^-1
-        mBallAndSocketJointComponents.mInverseMassMatrix[i].setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mBallAndSocketJointComponents.mInverseMassMatrix[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
-        }
-
-        const Vector3& x1 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody1];
-        const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody2];
+        // Compute the inverse of the mass matrix K=JM^-1J^t for the cone limit
+        decimal inverseMassMatrixConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI1[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]) +
+                                             mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI2[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]);
+        inverseMassMatrixConeLimit = (inverseMassMatrixConeLimit > decimal(0.0)) ?
+                                  decimal(1.0) / inverseMassMatrixConeLimit : decimal(0.0);
+        mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] = inverseMassMatrixConeLimit;
 
-        // Compute the bias "b" of the constraint
-        mBallAndSocketJointComponents.mBiasVector[i].setToZero();
+        // Compute the bias "b" of the lower limit constraint
+        mBallAndSocketJointComponents.mBConeLimit[i] = decimal(0.0);
         if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-            mBallAndSocketJointComponents.mBiasVector[i] = biasFactor * (x2 + r2World - x1 - r1World);
-        }
-
-        const Vector3 r1WorldUnit = r1World.getUnit();
-        const Vector3 r2WorldUnit = r2World.getUnit();
-        mBallAndSocketJointComponents.mConeLimitACrossB[i] = r1WorldUnit.cross(-r2WorldUnit);
-
-        // Compute the current angle around the hinge axis
-        decimal coneAngle = computeCurrentConeHalfAngle(r1WorldUnit, -r2WorldUnit);
-
-        // Check if the cone limit constraints is violated or not
-        decimal coneLimitError = mBallAndSocketJointComponents.mConeLimitHalfAngle[i] - coneAngle;
-        bool oldIsConeLimitViolated = mBallAndSocketJointComponents.mIsConeLimitViolated[i];
-        bool isConeLimitViolated = coneLimitError < 0;
-        mBallAndSocketJointComponents.mIsConeLimitViolated[i] = isConeLimitViolated;
-        if (!isConeLimitViolated || isConeLimitViolated != oldIsConeLimitViolated) {
-            mBallAndSocketJointComponents.mConeLimitImpulse[i] = decimal(0.0);
-        }
-
-        // If the cone limit is enabled
-        if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
-
-            // Compute the inverse of the mass matrix K=JM^-1J^t for the cone limit
-            decimal inverseMassMatrixConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI1[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]) +
-                                                 mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI2[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]);
-            inverseMassMatrixConeLimit = (inverseMassMatrixConeLimit > decimal(0.0)) ?
-                                      decimal(1.0) / inverseMassMatrixConeLimit : decimal(0.0);
-            mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] = inverseMassMatrixConeLimit;
-
-            // Compute the bias "b" of the lower limit constraint
-            mBallAndSocketJointComponents.mBConeLimit[i] = decimal(0.0);
-            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-                mBallAndSocketJointComponents.mBConeLimit[i] = biasFactor * coneLimitError;
-            }
+            mBallAndSocketJointComponents.mBConeLimit[i] = biasFactor * coneLimitError;
         }
+    }
 
-        // If warm-starting is not enabled
-        if (!mIsWarmStartingActive) {
+    // If warm-starting is not enabled
+    if (!mIsWarmStartingActive) {
 
-            // Reset the accumulated impulse
-            mBallAndSocketJointComponents.mImpulse[i].setToZero();
-        }
+        // Reset the accumulated impulse
+        mBallAndSocketJointComponents.mImpulse[i].setToZero();
     }
 }
 
@@ -164,52 +172,64 @@ void SolveBallAndSocketJointSystem::warmstart() {
     // For each joint component
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        warmstart(i);
+    }
+}
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Warm start the constraint of a joint (apply the previous impulse at the beginning of the step)
+/**
+ * @param i Index of the joint in the ball-and-socket joint components
+ */
+void SolveBallAndSocketJointSystem::warmstart(uint32 i) {
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
-        const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
+    // Get the velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
-        const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
+    const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
+    const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
 
-        // Compute the impulse P=J^T * lambda for the body 1
-        Vector3 linearImpulseBody1 = -mBallAndSocketJointComponents.mImpulse[i];
-        Vector3 angularImpulseBody1 = mBallAndSocketJointComponents.mImpulse[i].cross(r1World);
+    const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
+    const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
-        const Vector3 coneLimitImpulse = mBallAndSocketJointComponents.mConeLimitImpulse[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+    // Compute the impulse P=J^T * lambda for the body 1
+    Vector3 linearImpulseBody1 = -mBallAndSocketJointComponents.mImpulse[i];
+    Vector3 angularImpulseBody1 = mBallAndSocketJointComponents.mImpulse[i].cross(r1World);
 
-        // Compute the impulse P=J^T * lambda for the cone limit constraint of body 1
-        angularImpulseBody1 += coneLimitImpulse;
+    // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
+    const Vector3 coneLimitImpulse = mBallAndSocketJointComponents.mConeLimitImpulse[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
-        // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for the cone limit constraint of body 1
+    angularImpulseBody1 += coneLimitImpulse;
 
-        // Compute the impulse P=J^T * lambda for the body 2
-        Vector3 angularImpulseBody2 = -mBallAndSocketJointComponents.mImpulse[i].cross(r2World);
+    // Apply the impulse to the body 1
+    v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the cone limit constraint of body 2
-        angularImpulseBody2 += -coneLimitImpulse;
+    // Compute the impulse P=J^T * lambda for the body 2
+    Vector3 angularImpulseBody2 = -mBallAndSocketJointComponents.mImpulse[i].cross(r2World);
 
-        // Apply the impulse to the body to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    // Compute the impulse P=J^T * lambda for the cone limit constraint of body 2
+    angularImpulseBody2 += -coneLimitImpulse;
+
+    // Apply the impulse to the body to the body 2
+    v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+    // Update the velocities of the bodies
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody1, v1, w1);
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody2, v2, w2);
 }
 
 // Solve the velocity constraint
@@ -218,80 +238,92 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
     // For each joint component
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraint(i);
+    }
+}
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Solve the velocity constraint of a joint
+/**
+ * @param i Index of the joint in the ball-and-socket joint components
+ */
+void SolveBallAndSocketJointSystem::solveVelocityConstraint(uint32 i) {
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
-        const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
+    // Get the velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // --------------- Limits Constraints --------------- //
+    const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
+    const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
 
-        if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
+    // --------------- Limits Constraints --------------- //
 
-            // If the cone limit is violated
-            if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
+    if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
 
-                // Compute J*v for the cone limit constraine
-                const decimal JvConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(w1 - w2);
+        // If the cone limit is violated
+        if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
 
-                // Compute the Lagrange multiplier lambda for the cone limit constraint
-                decimal deltaLambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-JvConeLimit -mBallAndSocketJointComponents.mBConeLimit[i]);
-                decimal lambdaTemp = mBallAndSocketJointComponents.mConeLimitImpulse[i];
-                mBallAndSocketJointComponents.mConeLimitImpulse[i] = std::max(mBallAndSocketJointComponents.mConeLimitImpulse[i] + deltaLambdaConeLimit, decimal(0.0));
-                deltaLambdaConeLimit = mBallAndSocketJointComponents.mConeLimitImpulse[i] - lambdaTemp;
+            // Compute J*v for the cone limit constraine
+            const decimal JvConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(w1 - w2);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+            // Compute the Lagrange multiplier lambda for the cone limit constraint
+            decimal deltaLambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-JvConeLimit -mBallAndSocketJointComponents.mBConeLimit[i]);
+            decimal lambdaTemp = mBallAndSocketJointComponents.mConeLimitImpulse[i];
+            mBallAndSocketJointComponents.mConeLimitImpulse[i] = std::max(mBallAndSocketJointComponents.mConeLimitImpulse[i] + deltaLambdaConeLimit, decimal(0.0));
+            deltaLambdaConeLimit = mBallAndSocketJointComponents.mConeLimitImpulse[i] - lambdaTemp;
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+            const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+            // Apply the impulse to the body 1
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+            const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+
+            // Apply the impulse to the body 2
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
-            }
         }
+    }
 
-        // --------------- Joint Constraints --------------- //
+    // --------------- Joint Constraints --------------- //
 
-        // Compute J*v
-        const Vector3 Jv = v2 + w2.cross(mBallAndSocketJointComponents.mR2World[i]) - v1 - w1.cross(mBallAndSocketJointComponents.mR1World[i]);
+    // Compute J*v
+    const Vector3 Jv = v2 + w2.cross(mBallAndSocketJointComponents.mR2World[i]) - v1 - w1.cross(mBallAndSocketJointComponents.mR1World[i]);
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-Jv - mBallAndSocketJointComponents.mBiasVector[i]);
-        mBallAndSocketJointComponents.mImpulse[i] += deltaLambda;
+    // Compute the Lagrange multiplier lambda
+    const Vector3 deltaLambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-Jv - mBallAndSocketJointComponents.mBiasVector[i]);
+    mBallAndSocketJointComponents.mImpulse[i] += deltaLambda;
 
-        // Compute the impulse P=J^T * lambda for the body 1
-        const Vector3 linearImpulseBody1 = -deltaLambda;
-        const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[i]);
+    // Compute the impulse P=J^T * lambda for the body 1
+    const Vector3 linearImpulseBody1 = -deltaLambda;
+    const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[i]);
 
-        // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Apply the impulse to the body 1
+    v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the body 2
-        const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[i]);
+    // Compute the impulse P=J^T * lambda for the body 2
+    const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[i]);
 
-        // Apply the impulse to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    // Apply the impulse to the body 2
+    v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+    // Update the velocities of the bodies
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody1, v1, w1);
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody2, v2, w2);
 }
 
 // Solve the position constraint (for position error correction)
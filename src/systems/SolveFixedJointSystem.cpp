@@ -47,97 +47,105 @@ SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, RigidBodyCompo
 // Initialize before solving the constraint
 void SolveFixedJointSystem::initBeforeSolve() {
 
-    const decimal biasFactor = BETA / mTimeStep;
-
     // For each joint
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        initBeforeSolve(i);
+    }
+}
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
-
-        assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity) || !mRigidBodyComponents.getIsEntityDisabled(body2Entity));
-
-        // Get the inertia tensor of bodies
-        mFixedJointComponents.mI1[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody1];
-        mFixedJointComponents.mI2[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody2];
-
-        const Quaternion& orientationBody1 = mTransformComponents.getTransform(body1Entity).getOrientation();
-        const Quaternion& orientationBody2 = mTransformComponents.getTransform(body2Entity).getOrientation();
-
-        // Compute the vector from body center to the anchor point in world-space
-        mFixedJointComponents.mR1World[i] = orientationBody1 * (mFixedJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mFixedJointComponents.mR2World[i] = orientationBody2 * (mFixedJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
-
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mFixedJointComponents.mR1World[i]);
-        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mFixedJointComponents.mR2World[i]);
+// Initialize a joint before solving the constraint
+/**
+ * @param i Index of the joint in the fixed joint components
+ */
+void SolveFixedJointSystem::initBeforeSolve(uint32 i) {
 
-        // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
-        const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        const decimal inverseMassBodies = body1MassInverse + body2MassInverse;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mFixedJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mFixedJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
+    const decimal biasFactor = BETA / mTimeStep;
 
-        // Compute the inverse mass matrix K^-1 for the 3 translation constraints
-        mFixedJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mFixedJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
+    const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+
+    assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity) || !mRigidBodyComponents.getIsEntityDisabled(body2Entity));
+
+    // Get the inertia tensor of bodies
+    mFixedJointComponents.mI1[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody1];
+    mFixedJointComponents.mI2[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody2];
+
+    const Quaternion& orientationBody1 = mTransformComponents.getTransform(body1Entity).getOrientation();
+    const Quaternion& orientationBody2 = mTransformComponents.getTransform(body2Entity).getOrientation();
+
+    // Compute the vector from body center to the anchor point in world-space
+    mFixedJointComponents.mR1World[i] = orientationBody1 * (mFixedJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mFixedJointComponents.mR2World[i] = orientationBody2 * (mFixedJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+
+    // Compute the corresponding skew-symmetric matrices
+    Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mFixedJointComponents.mR1World[i]);
+    Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mFixedJointComponents.mR2World[i]);
+
+    // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
+    const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    const decimal inverseMassBodies = body1MassInverse + body2MassInverse;
+    Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                    0, inverseMassBodies, 0,
+                                    0, 0, inverseMassBodies) +
+                           skewSymmetricMatrixU1 * mFixedJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
+                           skewSymmetricMatrixU2 * mFixedJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
+
+    // Compute the inverse mass matrix K^-1 for the 3 translation constraints
+    mFixedJointComponents.mInverseMassMatrixTranslation[i].setToZero();
+    decimal massMatrixDeterminant = massMatrix.getDeterminant();
+    if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mFixedJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
         }
+    }
 
-        // Get the bodies positions and orientations
-        const Vector3& x1 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody1];
-        const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody2];
+    // Get the bodies positions and orientations
+    const Vector3& x1 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody1];
+    const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody2];
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+    const Vector3& r1World = mFixedJointComponents.mR1World[i];
+    const Vector3& r2World = mFixedJointComponents.mR2World[i];
 
-        // Compute the bias "b" of the constraint for the 3 translation constraints
-        mFixedJointComponents.mBiasTranslation[i].setToZero();
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-            mFixedJointComponents.mBiasTranslation[i] = biasFactor * (x2 + r2World - x1 - r1World);
-        }
+    // Compute the bias "b" of the constraint for the 3 translation constraints
+    mFixedJointComponents.mBiasTranslation[i].setToZero();
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+        mFixedJointComponents.mBiasTranslation[i] = biasFactor * (x2 + r2World - x1 - r1World);
+    }
 
-        // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation contraints (3x3 matrix)
-        mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mI1[i] + mFixedJointComponents.mI2[i];
-        decimal massMatrixRotationDeterminant = mFixedJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
-        if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
-            }
+    // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation contraints (3x3 matrix)
+    mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mI1[i] + mFixedJointComponents.mI2[i];
+    decimal massMatrixRotationDeterminant = mFixedJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
+    if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
         }
+    }
 
-        // Compute the bias "b" for the 3 rotation constraints
-        mFixedJointComponents.mBiasRotation[i].setToZero();
+    // Compute the bias "b" for the 3 rotation constraints
+    mFixedJointComponents.mBiasRotation[i].setToZero();
 
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-            const Quaternion qError = orientationBody2 * mFixedJointComponents.mInitOrientationDifferenceInv[i] * orientationBody1.getInverse();
-            mFixedJointComponents.mBiasRotation[i] = biasFactor * decimal(2.0) * qError.getVectorV();
-        }
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+        const Quaternion qError = orientationBody2 * mFixedJointComponents.mInitOrientationDifferenceInv[i] * orientationBody1.getInverse();
+        mFixedJointComponents.mBiasRotation[i] = biasFactor * decimal(2.0) * qError.getVectorV();
+    }
 
-        // If warm-starting is not enabled
-        if (!mIsWarmStartingActive) {
+    // If warm-starting is not enabled
+    if (!mIsWarmStartingActive) {
 
-            // Reset the accumulated impulses
-            mFixedJointComponents.mImpulseTranslation[i].setToZero();
-            mFixedJointComponents.mImpulseRotation[i].setToZero();
-        }
+        // Reset the accumulated impulses
+        mFixedJointComponents.mImpulseTranslation[i].setToZero();
+        mFixedJointComponents.mImpulseRotation[i].setToZero();
     }
 }
 
@@ -147,58 +155,70 @@ void SolveFixedJointSystem::warmstart() {
     // For each joint
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        warmstart(i);
+    }
+}
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Warm start the constraint of a joint (apply the previous impulse at the beginning of the step)
+/**
+ * @param i Index of the joint in the fixed joint components
+ */
+void SolveFixedJointSystem::warmstart(uint32 i) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        // Get the inverse mass of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    // Get the velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Vector3& impulseTranslation = mFixedJointComponents.mImpulseTranslation[i];
-        const Vector3& impulseRotation = mFixedJointComponents.mImpulseRotation[i];
+    // Get the inverse mass of the bodies
+    const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+    const Vector3& impulseTranslation = mFixedJointComponents.mImpulseTranslation[i];
+    const Vector3& impulseRotation = mFixedJointComponents.mImpulseRotation[i];
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 1
-        Vector3 linearImpulseBody1 = -impulseTranslation;
-        Vector3 angularImpulseBody1 = impulseTranslation.cross(r1World);
+    const Vector3& r1World = mFixedJointComponents.mR1World[i];
+    const Vector3& r2World = mFixedJointComponents.mR2World[i];
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
-        angularImpulseBody1 += -impulseRotation;
+    // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 1
+    Vector3 linearImpulseBody1 = -impulseTranslation;
+    Vector3 angularImpulseBody1 = impulseTranslation.cross(r1World);
 
-        const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
+    // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
+    angularImpulseBody1 += -impulseRotation;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 2
-        Vector3 angularImpulseBody2 = -impulseTranslation.cross(r2World);
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 2
-        angularImpulseBody2 += impulseRotation;
+    // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 2
+    Vector3 angularImpulseBody2 = -impulseTranslation.cross(r2World);
 
-        const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
+    // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 2
+    angularImpulseBody2 += impulseRotation;
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
+
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+    // Update the velocities of the bodies
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody1, v1, w1);
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody2, v2, w2);
 }
 
 // Solve the velocity constraint
@@ -207,81 +227,93 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
     // For each joint
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraint(i);
+    }
+}
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Solve the velocity constraint of a joint
+/**
+ * @param i Index of the joint in the fixed joint components
+ */
+void SolveFixedJointSystem::solveVelocityConstraint(uint32 i) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        // Get the inverse mass of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    // Get the velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+    // Get the inverse mass of the bodies
+    decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        // --------------- Translation Constraints --------------- //
+    const Vector3& r1World = mFixedJointComponents.mR1World[i];
+    const Vector3& r2World = mFixedJointComponents.mR2World[i];
 
-        // Compute J*v for the 3 translation constraints
-        const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+    // --------------- Translation Constraints --------------- //
 
-        const Matrix3x3& inverseMassMatrixTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i];
+    // Compute J*v for the 3 translation constraints
+    const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambda = inverseMassMatrixTranslation * (-JvTranslation - mFixedJointComponents.mBiasTranslation[i]);
-        mFixedJointComponents.mImpulseTranslation[i] += deltaLambda;
+    const Matrix3x3& inverseMassMatrixTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i];
 
-        // Compute the impulse P=J^T * lambda for body 1
-        const Vector3 linearImpulseBody1 = -deltaLambda;
-        Vector3 angularImpulseBody1 = deltaLambda.cross(r1World);
+    // Compute the Lagrange multiplier lambda
+    const Vector3 deltaLambda = inverseMassMatrixTranslation * (-JvTranslation - mFixedJointComponents.mBiasTranslation[i]);
+    mFixedJointComponents.mImpulseTranslation[i] += deltaLambda;
 
-        const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
+    // Compute the impulse P=J^T * lambda for body 1
+    const Vector3 linearImpulseBody1 = -deltaLambda;
+    Vector3 angularImpulseBody1 = deltaLambda.cross(r1World);
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
 
-        // Compute the impulse P=J^T * lambda  for body 2
-        const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
+    // Compute the impulse P=J^T * lambda  for body 2
+    const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+    const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
 
-        // --------------- Rotation Constraints --------------- //
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
-        // Compute J*v for the 3 rotation constraints
-        const Vector3 JvRotation = w2 - w1;
+    // --------------- Rotation Constraints --------------- //
 
-        const Vector3& biasRotation = mFixedJointComponents.mBiasRotation[i];
-        const Matrix3x3& inverseMassMatrixRotation = mFixedJointComponents.mInverseMassMatrixRotation[i];
+    // Compute J*v for the 3 rotation constraints
+    const Vector3 JvRotation = w2 - w1;
 
-        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-        Vector3 deltaLambda2 = inverseMassMatrixRotation * (-JvRotation - biasRotation);
-        mFixedJointComponents.mImpulseRotation[i] += deltaLambda2;
+    const Vector3& biasRotation = mFixedJointComponents.mBiasRotation[i];
+    const Matrix3x3& inverseMassMatrixRotation = mFixedJointComponents.mInverseMassMatrixRotation[i];
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
-        angularImpulseBody1 = -deltaLambda2;
+    // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+    Vector3 deltaLambda2 = inverseMassMatrixRotation * (-JvRotation - biasRotation);
+    mFixedJointComponents.mImpulseRotation[i] += deltaLambda2;
 
-        // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
+    angularImpulseBody1 = -deltaLambda2;
 
-        // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
-    }
+    // Apply the impulse to the body 1
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+    // Apply the impulse to the body 2
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
+
+    // Update the velocities of the bodies
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody1, v1, w1);
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody2, v2, w2);
 }
 
 // Solve the position constraint (for position error correction)
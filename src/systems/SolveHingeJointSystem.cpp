@@ -47,166 +47,174 @@ SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, RigidBodyCompo
 // Initialize before solving the constraint
 void SolveHingeJointSystem::initBeforeSolve() {
 
-    const decimal biasFactor = (BETA / mTimeStep);
-
     // For each joint
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        initBeforeSolve(i);
+    }
+}
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Initialize a joint before solving the constraint
+/**
+ * @param i Index of the joint in the hinge joint components
+ */
+void SolveHingeJointSystem::initBeforeSolve(uint32 i) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const decimal biasFactor = (BETA / mTimeStep);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity) || !mRigidBodyComponents.getIsEntityDisabled(body2Entity));
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        // Get the inertia tensor of bodies
-        mHingeJointComponents.mI1[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody1];
-        mHingeJointComponents.mI2[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody2];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        const Quaternion& orientationBody1 = mTransformComponents.getTransform(body1Entity).getOrientation();
-        const Quaternion& orientationBody2 = mTransformComponents.getTransform(body2Entity).getOrientation();
+    assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity) || !mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
-        // Compute the vector from body center to the anchor point in world-space
-        mHingeJointComponents.mR1World[i] = orientationBody1 * (mHingeJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mHingeJointComponents.mR2World[i] = orientationBody2 * (mHingeJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+    // Get the inertia tensor of bodies
+    mHingeJointComponents.mI1[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody1];
+    mHingeJointComponents.mI2[i] = mRigidBodyComponents.mInverseInertiaTensorsWorld[componentIndexBody2];
 
-        // Compute vectors needed in the Jacobian
-        Vector3& a1 = mHingeJointComponents.mA1[i];
-        a1 = orientationBody1 * mHingeJointComponents.mHingeLocalAxisBody1[i];
-        Vector3 a2 = orientationBody2 * mHingeJointComponents.mHingeLocalAxisBody2[i];
+    const Quaternion& orientationBody1 = mTransformComponents.getTransform(body1Entity).getOrientation();
+    const Quaternion& orientationBody2 = mTransformComponents.getTransform(body2Entity).getOrientation();
 
-        a1.normalize();
-        a2.normalize();
-        const Vector3 b2 = a2.getOneUnitOrthogonalVector();
-        const Vector3 c2 = a2.cross(b2);
-        mHingeJointComponents.mB2CrossA1[i] = b2.cross(a1);
-        mHingeJointComponents.mC2CrossA1[i] = c2.cross(a1);
+    // Compute the vector from body center to the anchor point in world-space
+    mHingeJointComponents.mR1World[i] = orientationBody1 * (mHingeJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mHingeJointComponents.mR2World[i] = orientationBody2 * (mHingeJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        // Compute the bias "b" of the rotation constraints
-        mHingeJointComponents.mBiasRotation[i].setToZero();
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-            mHingeJointComponents.mBiasRotation[i] = biasFactor * Vector2(a1.dot(b2), a1.dot(c2));
-        }
+    // Compute vectors needed in the Jacobian
+    Vector3& a1 = mHingeJointComponents.mA1[i];
+    a1 = orientationBody1 * mHingeJointComponents.mHingeLocalAxisBody1[i];
+    Vector3 a2 = orientationBody2 * mHingeJointComponents.mHingeLocalAxisBody2[i];
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[i]);
-        Matrix3x3 skewSymmetricMatrixU2= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[i]);
+    a1.normalize();
+    a2.normalize();
+    const Vector3 b2 = a2.getOneUnitOrthogonalVector();
+    const Vector3 c2 = a2.cross(b2);
+    mHingeJointComponents.mB2CrossA1[i] = b2.cross(a1);
+    mHingeJointComponents.mC2CrossA1[i] = c2.cross(a1);
 
-        // Compute the inverse mass matrix K=JM^-1J^t for the 3 translation constraints (3x3 matrix)
-        decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        decimal inverseMassBodies = body1MassInverse + body2MassInverse;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mHingeJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mHingeJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        Matrix3x3& inverseMassMatrixTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i];
-        inverseMassMatrixTranslation.setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mHingeJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
+    // Compute the bias "b" of the rotation constraints
+    mHingeJointComponents.mBiasRotation[i].setToZero();
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+        mHingeJointComponents.mBiasRotation[i] = biasFactor * Vector2(a1.dot(b2), a1.dot(c2));
+    }
+
+    // Compute the corresponding skew-symmetric matrices
+    Matrix3x3 skewSymmetricMatrixU1= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[i]);
+    Matrix3x3 skewSymmetricMatrixU2= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[i]);
+
+    // Compute the inverse mass matrix K=JM^-1J^t for the 3 translation constraints (3x3 matrix)
+    decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    decimal inverseMassBodies = body1MassInverse + body2MassInverse;
+    Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                    0, inverseMassBodies, 0,
+                                    0, 0, inverseMassBodies) +
+                           skewSymmetricMatrixU1 * mHingeJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
+                           skewSymmetricMatrixU2 * mHingeJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
+    Matrix3x3& inverseMassMatrixTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i];
+    inverseMassMatrixTranslation.setToZero();
+    decimal massMatrixDeterminant = massMatrix.getDeterminant();
+    if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mHingeJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
         }
+    }
 
-        // Get the bodies positions and orientations
-        const Vector3& x1 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody1];
-        const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody2];
+    // Get the bodies positions and orientations
+    const Vector3& x1 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody1];
+    const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[componentIndexBody2];
+
+    // Compute the bias "b" of the translation constraints
+    mHingeJointComponents.mBiasTranslation[i].setToZero();
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+        mHingeJointComponents.mBiasTranslation[i] = biasFactor * (x2 + mHingeJointComponents.mR2World[i] - x1 - mHingeJointComponents.mR1World[i]);
+    }
 
-        // Compute the bias "b" of the translation constraints
-        mHingeJointComponents.mBiasTranslation[i].setToZero();
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-            mHingeJointComponents.mBiasTranslation[i] = biasFactor * (x2 + mHingeJointComponents.mR2World[i] - x1 - mHingeJointComponents.mR1World[i]);
+    const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
+    const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
+    const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+    const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+
+    // Compute the inverse mass matrix K=JM^-1J^t for the 2 rotation constraints (2x2 matrix)
+    Vector3 i1B2CrossA1 = i1 * b2CrossA1;
+    Vector3 i1C2CrossA1 = i1 * c2CrossA1;
+    Vector3 i2B2CrossA1 = i2 * b2CrossA1;
+    Vector3 i2C2CrossA1 = i2 * c2CrossA1;
+    const decimal el11 = b2CrossA1.dot(i1B2CrossA1) + b2CrossA1.dot(i2B2CrossA1);
+    const decimal el12 = b2CrossA1.dot(i1C2CrossA1) + b2CrossA1.dot(i2C2CrossA1);
+    const decimal el21 = c2CrossA1.dot(i1B2CrossA1) + c2CrossA1.dot(i2B2CrossA1);
+    const decimal el22 = c2CrossA1.dot(i1C2CrossA1) + c2CrossA1.dot(i2C2CrossA1);
+    const Matrix2x2 matrixKRotation(el11, el12, el21, el22);
+    mHingeJointComponents.mInverseMassMatrixRotation[i].setToZero();
+    decimal matrixKRotationDeterminant = matrixKRotation.getDeterminant();
+    if (std::abs(matrixKRotationDeterminant) > MACHINE_EPSILON) {
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mHingeJointComponents.mInverseMassMatrixRotation[i] = matrixKRotation.getInverse(matrixKRotationDeterminant);
         }
+    }
 
-        const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
-        const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
-        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+    // If warm-starting is not enabled
+    if (!mIsWarmStartingActive) {
 
-        // Compute the inverse mass matrix K=JM^-1J^t for the 2 rotation constraints (2x2 matrix)
-        Vector3 i1B2CrossA1 = i1 * b2CrossA1;
-        Vector3 i1C2CrossA1 = i1 * c2CrossA1;
-        Vector3 i2B2CrossA1 = i2 * b2CrossA1;
-        Vector3 i2C2CrossA1 = i2 * c2CrossA1;
-        const decimal el11 = b2CrossA1.dot(i1B2CrossA1) + b2CrossA1.dot(i2B2CrossA1);
-        const decimal el12 = b2CrossA1.dot(i1C2CrossA1) + b2CrossA1.dot(i2C2CrossA1);
-        const decimal el21 = c2CrossA1.dot(i1B2CrossA1) + c2CrossA1.dot(i2B2CrossA1);
-        const decimal el22 = c2CrossA1.dot(i1C2CrossA1) + c2CrossA1.dot(i2C2CrossA1);
-        const Matrix2x2 matrixKRotation(el11, el12, el21, el22);
-        mHingeJointComponents.mInverseMassMatrixRotation[i].setToZero();
-        decimal matrixKRotationDeterminant = matrixKRotation.getDeterminant();
-        if (std::abs(matrixKRotationDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mHingeJointComponents.mInverseMassMatrixRotation[i] = matrixKRotation.getInverse(matrixKRotationDeterminant);
-            }
-        }
+        // Reset all the accumulated impulses
+        mHingeJointComponents.mImpulseTranslation[i].setToZero();
+        mHingeJointComponents.mImpulseRotation[i].setToZero();
+        mHingeJointComponents.mImpulseLowerLimit[i] = decimal(0.0);
+        mHingeJointComponents.mImpulseUpperLimit[i] = decimal(0.0);
+        mHingeJointComponents.mImpulseMotor[i] = decimal(0.0);
+    }
 
-        // If warm-starting is not enabled
-        if (!mIsWarmStartingActive) {
+    // Compute the current angle around the hinge axis
+    decimal hingeAngle = computeCurrentHingeAngle(jointEntity, orientationBody1, orientationBody2);
+
+    // Check if the limit constraints are violated or not
+    decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[i];
+    decimal upperLimitError = mHingeJointComponents.mUpperLimit[i] - hingeAngle;
+    bool oldIsLowerLimitViolated = mHingeJointComponents.mIsLowerLimitViolated[i];
+    bool isLowerLimitViolated = lowerLimitError <= 0;
+    mHingeJointComponents.mIsLowerLimitViolated[i] = isLowerLimitViolated;
+    if (!isLowerLimitViolated || isLowerLimitViolated != oldIsLowerLimitViolated) {
+        mHingeJointComponents.mImpulseLowerLimit[i] = decimal(0.0);
+    }
+    bool oldIsUpperLimitViolated = mHingeJointComponents.mIsUpperLimitViolated[i];
+    bool isUpperLimitViolated = upperLimitError <= 0;
+    mHingeJointComponents.mIsUpperLimitViolated[i] = isUpperLimitViolated;
+    if (!isUpperLimitViolated || isUpperLimitViolated != oldIsUpperLimitViolated) {
+        mHingeJointComponents.mImpulseUpperLimit[i] = decimal(0.0);
+    }
 
-            // Reset all the accumulated impulses
-            mHingeJointComponents.mImpulseTranslation[i].setToZero();
-            mHingeJointComponents.mImpulseRotation[i].setToZero();
-            mHingeJointComponents.mImpulseLowerLimit[i] = decimal(0.0);
-            mHingeJointComponents.mImpulseUpperLimit[i] = decimal(0.0);
-            mHingeJointComponents.mImpulseMotor[i] = decimal(0.0);
-        }
+    // If the motor or limits are enabled
+    if (mHingeJointComponents.mIsMotorEnabled[i] ||
+        (mHingeJointComponents.mIsLimitEnabled[i] && (mHingeJointComponents.mIsLowerLimitViolated[i] ||
+                                                      mHingeJointComponents.mIsUpperLimitViolated[i]))) {
 
-        // Compute the current angle around the hinge axis
-        decimal hingeAngle = computeCurrentHingeAngle(jointEntity, orientationBody1, orientationBody2);
+        Vector3& a1 = mHingeJointComponents.mA1[i];
 
-        // Check if the limit constraints are violated or not
-        decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[i];
-        decimal upperLimitError = mHingeJointComponents.mUpperLimit[i] - hingeAngle;
-        bool oldIsLowerLimitViolated = mHingeJointComponents.mIsLowerLimitViolated[i];
-        bool isLowerLimitViolated = lowerLimitError <= 0;
-        mHingeJointComponents.mIsLowerLimitViolated[i] = isLowerLimitViolated;
-        if (!isLowerLimitViolated || isLowerLimitViolated != oldIsLowerLimitViolated) {
-            mHingeJointComponents.mImpulseLowerLimit[i] = decimal(0.0);
-        }
-        bool oldIsUpperLimitViolated = mHingeJointComponents.mIsUpperLimitViolated[i];
-        bool isUpperLimitViolated = upperLimitError <= 0;
-        mHingeJointComponents.mIsUpperLimitViolated[i] = isUpperLimitViolated;
-        if (!isUpperLimitViolated || isUpperLimitViolated != oldIsUpperLimitViolated) {
-            mHingeJointComponents.mImpulseUpperLimit[i] = decimal(0.0);
-        }
+        // Compute the inverse of the mass matrix K=JM^-1J^t for the limits and motor (1x1 matrix)
+        decimal inverseMassMatrixLimitMotor = a1.dot(mHingeJointComponents.mI1[i] * a1) + a1.dot(mHingeJointComponents.mI2[i] * a1);
+        inverseMassMatrixLimitMotor = (inverseMassMatrixLimitMotor > decimal(0.0)) ?
+                                  decimal(1.0) / inverseMassMatrixLimitMotor : decimal(0.0);
+        mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = inverseMassMatrixLimitMotor;
 
-        // If the motor or limits are enabled
-        if (mHingeJointComponents.mIsMotorEnabled[i] ||
-            (mHingeJointComponents.mIsLimitEnabled[i] && (mHingeJointComponents.mIsLowerLimitViolated[i] ||
-                                                          mHingeJointComponents.mIsUpperLimitViolated[i]))) {
+        if (mHingeJointComponents.mIsLimitEnabled[i]) {
 
-            Vector3& a1 = mHingeJointComponents.mA1[i];
+            // Compute the bias "b" of the lower limit constraint
+            mHingeJointComponents.mBLowerLimit[i] = decimal(0.0);
+            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+                mHingeJointComponents.mBLowerLimit[i] = biasFactor * lowerLimitError;
+            }
 
-            // Compute the inverse of the mass matrix K=JM^-1J^t for the limits and motor (1x1 matrix)
-            decimal inverseMassMatrixLimitMotor = a1.dot(mHingeJointComponents.mI1[i] * a1) + a1.dot(mHingeJointComponents.mI2[i] * a1);
-            inverseMassMatrixLimitMotor = (inverseMassMatrixLimitMotor > decimal(0.0)) ?
-                                      decimal(1.0) / inverseMassMatrixLimitMotor : decimal(0.0);
-            mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = inverseMassMatrixLimitMotor;
-
-            if (mHingeJointComponents.mIsLimitEnabled[i]) {
-
-                // Compute the bias "b" of the lower limit constraint
-                mHingeJointComponents.mBLowerLimit[i] = decimal(0.0);
-                if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-                    mHingeJointComponents.mBLowerLimit[i] = biasFactor * lowerLimitError;
-                }
-
-                // Compute the bias "b" of the upper limit constraint
-                mHingeJointComponents.mBUpperLimit[i] = decimal(0.0);
-                if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
-                    mHingeJointComponents.mBUpperLimit[i] = biasFactor * upperLimitError;
-                }
+            // Compute the bias "b" of the upper limit constraint
+            mHingeJointComponents.mBUpperLimit[i] = decimal(0.0);
+            if (mJointComponents.mPositionCorrectionTechniques[jointIndex] == JointsPositionCorrectionTechnique::BAUMGARTE_JOINTS) {
+                mHingeJointComponents.mBUpperLimit[i] = biasFactor * upperLimitError;
             }
         }
     }
@@ -218,78 +226,90 @@ void SolveHingeJointSystem::warmstart() {
     // For each joint component
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        warmstart(i);
+    }
+}
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Warm start the constraint of a joint (apply the previous impulse at the beginning of the step)
+/**
+ * @param i Index of the joint in the hinge joint components
+ */
+void SolveHingeJointSystem::warmstart(uint32 i) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    // Get the velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Vector3& impulseTranslation = mHingeJointComponents.mImpulseTranslation[i];
-        const Vector2& impulseRotation = mHingeJointComponents.mImpulseRotation[i];
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const decimal impulseLowerLimit = mHingeJointComponents.mImpulseLowerLimit[i];
-        const decimal impulseUpperLimit = mHingeJointComponents.mImpulseUpperLimit[i];
+    const Vector3& impulseTranslation = mHingeJointComponents.mImpulseTranslation[i];
+    const Vector2& impulseRotation = mHingeJointComponents.mImpulseRotation[i];
 
-        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        const Vector3& a1 = mHingeJointComponents.mA1[i];
+    const decimal impulseLowerLimit = mHingeJointComponents.mImpulseLowerLimit[i];
+    const decimal impulseUpperLimit = mHingeJointComponents.mImpulseUpperLimit[i];
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints
-        Vector3 rotationImpulse = -b2CrossA1 * impulseRotation.x - mHingeJointComponents.mC2CrossA1[i] * impulseRotation.y;
+    const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+    const Vector3& a1 = mHingeJointComponents.mA1[i];
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
-        const Vector3 limitsImpulse = (impulseUpperLimit - impulseLowerLimit) * a1;
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints
+    Vector3 rotationImpulse = -b2CrossA1 * impulseRotation.x - mHingeJointComponents.mC2CrossA1[i] * impulseRotation.y;
 
-        // Compute the impulse P=J^T * lambda for the motor constraint
-        const Vector3 motorImpulse = -mHingeJointComponents.mImpulseMotor[i] * a1;
+    // Compute the impulse P=J^T * lambda for the lower and upper limits constraints
+    const Vector3 limitsImpulse = (impulseUpperLimit - impulseLowerLimit) * a1;
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 1
-        Vector3 linearImpulseBody1 = -impulseTranslation;
-        Vector3 angularImpulseBody1 = impulseTranslation.cross(mHingeJointComponents.mR1World[i]);
+    // Compute the impulse P=J^T * lambda for the motor constraint
+    const Vector3 motorImpulse = -mHingeJointComponents.mImpulseMotor[i] * a1;
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
-        angularImpulseBody1 += rotationImpulse;
+    // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 1
+    Vector3 linearImpulseBody1 = -impulseTranslation;
+    Vector3 angularImpulseBody1 = impulseTranslation.cross(mHingeJointComponents.mR1World[i]);
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
-        angularImpulseBody1 += limitsImpulse;
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
+    angularImpulseBody1 += rotationImpulse;
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 1
-        angularImpulseBody1 += motorImpulse;
+    // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 1
+    angularImpulseBody1 += limitsImpulse;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for the motor constraint of body 1
+    angularImpulseBody1 += motorImpulse;
 
-        // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 2
-        Vector3 angularImpulseBody2 = -impulseTranslation.cross(mHingeJointComponents.mR2World[i]);
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
-        angularImpulseBody2 += -rotationImpulse;
+    // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 2
+    Vector3 angularImpulseBody2 = -impulseTranslation.cross(mHingeJointComponents.mR2World[i]);
 
-        // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 2
-        angularImpulseBody2 += -limitsImpulse;
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
+    angularImpulseBody2 += -rotationImpulse;
 
-        // Compute the impulse P=J^T * lambda for the motor constraint of body 2
-        angularImpulseBody2 += -motorImpulse;
+    // Compute the impulse P=J^T * lambda for the lower and upper limits constraints of body 2
+    angularImpulseBody2 += -limitsImpulse;
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
-    }
+    // Compute the impulse P=J^T * lambda for the motor constraint of body 2
+    angularImpulseBody2 += -motorImpulse;
+
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+
+    // Update the velocities of the bodies
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody1, v1, w1);
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody2, v2, w2);
 }
 
 // Solve the velocity constraint
@@ -298,171 +318,183 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
     // For each joint component
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraint(i);
+    }
+}
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+// Solve the velocity constraint of a joint
+/**
+ * @param i Index of the joint in the hinge joint components
+ */
+void SolveHingeJointSystem::solveVelocityConstraint(uint32 i) {
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
-
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
+    const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    // Get the bodies entities
+    const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
+    const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
 
-        const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
-        const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
+    const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
+    const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        const Vector3& r1World = mHingeJointComponents.mR1World[i];
-        const Vector3& r2World = mHingeJointComponents.mR2World[i];
+    // Get the velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        const Vector3& a1 = mHingeJointComponents.mA1[i];
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+    decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
 
-        const decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
+    const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
+    const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
 
-        // --------------- Limits Constraints --------------- //
+    const Vector3& r1World = mHingeJointComponents.mR1World[i];
+    const Vector3& r2World = mHingeJointComponents.mR2World[i];
 
-        if (mHingeJointComponents.mIsLimitEnabled[i]) {
+    const Vector3& a1 = mHingeJointComponents.mA1[i];
 
-            // If the lower limit is violated
-            if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
+    const decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
 
-                // Compute J*v for the lower limit constraint
-                const decimal JvLowerLimit = (w2 - w1).dot(a1);
+    // --------------- Limits Constraints --------------- //
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal deltaLambdaLower = inverseMassMatrixLimitMotor * (-JvLowerLimit -mHingeJointComponents.mBLowerLimit[i]);
-                decimal lambdaTemp = mHingeJointComponents.mImpulseLowerLimit[i];
-                mHingeJointComponents.mImpulseLowerLimit[i] = std::max(mHingeJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
-                deltaLambdaLower = mHingeJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
+    if (mHingeJointComponents.mIsLimitEnabled[i]) {
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
+        // If the lower limit is violated
+        if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Compute J*v for the lower limit constraint
+            const decimal JvLowerLimit = (w2 - w1).dot(a1);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
+            // Compute the Lagrange multiplier lambda for the lower limit constraint
+            decimal deltaLambdaLower = inverseMassMatrixLimitMotor * (-JvLowerLimit -mHingeJointComponents.mBLowerLimit[i]);
+            decimal lambdaTemp = mHingeJointComponents.mImpulseLowerLimit[i];
+            mHingeJointComponents.mImpulseLowerLimit[i] = std::max(mHingeJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
+            deltaLambdaLower = mHingeJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-            }
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+            const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
 
-            // If the upper limit is violated
-            if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
-
-                // Compute J*v for the upper limit constraint
-                const decimal JvUpperLimit = -(w2 - w1).dot(a1);
-
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal deltaLambdaUpper = inverseMassMatrixLimitMotor * (-JvUpperLimit -mHingeJointComponents.mBUpperLimit[i]);
-                decimal lambdaTemp = mHingeJointComponents.mImpulseUpperLimit[i];
-                mHingeJointComponents.mImpulseUpperLimit[i] = std::max(mHingeJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
-                deltaLambdaUpper = mHingeJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
-
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
-
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+            const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-            }
+            // Apply the impulse to the body 2
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
         }
 
-        // --------------- Motor --------------- //
-
-        // If the motor is enabled
-        if (mHingeJointComponents.mIsMotorEnabled[i]) {
+        // If the upper limit is violated
+        if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
 
-            // Compute J*v for the motor
-            const decimal JvMotor = a1.dot(w1 - w2);
+            // Compute J*v for the upper limit constraint
+            const decimal JvUpperLimit = -(w2 - w1).dot(a1);
 
-            // Compute the Lagrange multiplier lambda for the motor
-            const decimal maxMotorImpulse = mHingeJointComponents.mMaxMotorTorque[i] * mTimeStep;
-            decimal deltaLambdaMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i] * (-JvMotor - mHingeJointComponents.mMotorSpeed[i]);
-            decimal lambdaTemp = mHingeJointComponents.mImpulseMotor[i];
-            mHingeJointComponents.mImpulseMotor[i] = clamp(mHingeJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
-            deltaLambdaMotor = mHingeJointComponents.mImpulseMotor[i] - lambdaTemp;
+            // Compute the Lagrange multiplier lambda for the upper limit constraint
+            decimal deltaLambdaUpper = inverseMassMatrixLimitMotor * (-JvUpperLimit -mHingeJointComponents.mBUpperLimit[i]);
+            decimal lambdaTemp = mHingeJointComponents.mImpulseUpperLimit[i];
+            mHingeJointComponents.mImpulseUpperLimit[i] = std::max(mHingeJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
+            deltaLambdaUpper = mHingeJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
 
-            // Compute the impulse P=J^T * lambda for the motor of body 1
-            const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+            const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
 
             // Apply the impulse to the body 1
             w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-            // Compute the impulse P=J^T * lambda for the motor of body 2
-            const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+            const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
 
             // Apply the impulse to the body 2
             w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
         }
+    }
 
-        // --------------- Joint Rotation Constraints --------------- //
+    // --------------- Motor --------------- //
 
-        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+    // If the motor is enabled
+    if (mHingeJointComponents.mIsMotorEnabled[i]) {
 
-        // Compute J*v for the 2 rotation constraints
-        const Vector2 JvRotation(-b2CrossA1.dot(w1) + b2CrossA1.dot(w2),
-                                 -c2CrossA1.dot(w1) + c2CrossA1.dot(w2));
+        // Compute J*v for the motor
+        const decimal JvMotor = a1.dot(w1 - w2);
 
-        // Compute the Lagrange multiplier lambda for the 2 rotation constraints
-        Vector2 deltaLambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] *
-                                      (-JvRotation - mHingeJointComponents.mBiasRotation[i]);
-        mHingeJointComponents.mImpulseRotation[i] += deltaLambdaRotation;
+        // Compute the Lagrange multiplier lambda for the motor
+        const decimal maxMotorImpulse = mHingeJointComponents.mMaxMotorTorque[i] * mTimeStep;
+        decimal deltaLambdaMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i] * (-JvMotor - mHingeJointComponents.mMotorSpeed[i]);
+        decimal lambdaTemp = mHingeJointComponents.mImpulseMotor[i];
+        mHingeJointComponents.mImpulseMotor[i] = clamp(mHingeJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
+        deltaLambdaMotor = mHingeJointComponents.mImpulseMotor[i] - lambdaTemp;
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
-        Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
+        // Compute the impulse P=J^T * lambda for the motor of body 1
+        const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
 
         // Apply the impulse to the body 1
         w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
-        Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
+        // Compute the impulse P=J^T * lambda for the motor of body 2
+        const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
 
         // Apply the impulse to the body 2
         w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+    }
 
-        // --------------- Joint Translation Constraints --------------- //
+    // --------------- Joint Rotation Constraints --------------- //
 
-        // Compute J*v
-        const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+    const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+    const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] *
-                                               (-JvTranslation - mHingeJointComponents.mBiasTranslation[i]);
-        mHingeJointComponents.mImpulseTranslation[i] += deltaLambdaTranslation;
+    // Compute J*v for the 2 rotation constraints
+    const Vector2 JvRotation(-b2CrossA1.dot(w1) + b2CrossA1.dot(w2),
+                             -c2CrossA1.dot(w1) + c2CrossA1.dot(w2));
 
-        // Compute the impulse P=J^T * lambda of body 1
-        const Vector3 linearImpulseBody1 = -deltaLambdaTranslation;
-        angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
+    // Compute the Lagrange multiplier lambda for the 2 rotation constraints
+    Vector2 deltaLambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] *
+                                  (-JvRotation - mHingeJointComponents.mBiasRotation[i]);
+    mHingeJointComponents.mImpulseRotation[i] += deltaLambdaRotation;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
+    Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
 
-        // Compute the impulse P=J^T * lambda of body 2
-        angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
+    // Apply the impulse to the body 1
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
+    Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
+
+    // Apply the impulse to the body 2
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+    // --------------- Joint Translation Constraints --------------- //
+
+    // Compute J*v
+    const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+
+    // Compute the Lagrange multiplier lambda
+    const Vector3 deltaLambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] *
+                                           (-JvTranslation - mHingeJointComponents.mBiasTranslation[i]);
+    mHingeJointComponents.mImpulseTranslation[i] += deltaLambdaTranslation;
+
+    // Compute the impulse P=J^T * lambda of body 1
+    const Vector3 linearImpulseBody1 = -deltaLambdaTranslation;
+    angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
+
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+    // Compute the impulse P=J^T * lambda of body 2
+    angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
+
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+    // Update the velocities of the bodies
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody1, v1, w1);
+    mRigidBodyComponents.updateConstrainedVelocities(componentIndexBody2, v2, w2);
 }
 
 // Solve the position constraint (for position error correction)
@@ -163,6 +163,7 @@ Profiler::Profiler() :mRootNode("Root", nullptr) {
     mNbAllocatedDestinations = 0;
     mProfilingStartTime = clock::now();
 	mFrameCounter = 0;
+    mProfiledThreadId = std::this_thread::get_id();
 
     allocatedDestinations(1);
 }
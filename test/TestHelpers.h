@@ -0,0 +1,92 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2016 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+// Libraries
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/configuration.h>
+#include <cstdlib>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class DefaultTestTreeAllocator
+/**
+ * Memory allocator of the unit tests that simply uses malloc() and free()
+ */
+class DefaultTestTreeAllocator : public MemoryAllocator {
+
+    public:
+
+        /// Destructor
+        virtual ~DefaultTestTreeAllocator() override = default;
+
+        /// Assignment operator
+        DefaultTestTreeAllocator& operator=(DefaultTestTreeAllocator& allocator) = default;
+
+        /// Allocate memory of a given size (in bytes) and return a pointer to the
+        /// allocated memory.
+        virtual void* allocate(size_t size) override {
+
+            return malloc(size);
+        }
+
+        /// Release previously allocated memory.
+        virtual void release(void* pointer, size_t /*size*/) override {
+            free(pointer);
+        }
+};
+
+// Class TestRandomGenerator
+/**
+ * Linear congruential pseudo-random generator of the unit tests. The generated
+ * sequence only depends on the seed so that the tests are reproducible.
+ */
+class TestRandomGenerator {
+
+    private:
+
+        /// State of the generator
+        uint32 mState;
+
+    public:
+
+        /// Constructor
+        TestRandomGenerator(uint32 seed) : mState(seed) {
+
+        }
+
+        /// Return a pseudo-random number in [min, max]
+        decimal random(decimal min, decimal max) {
+            mState = mState * 1664525u + 1013904223u;
+            return min + (max - min) * decimal(mState >> 8) / decimal(1 << 24);
+        }
+};
+
+}
+
+#endif
@@ -35,8 +35,12 @@
 #include "tests/collision/TestPointInside.h"
 #include "tests/collision/TestRaycast.h"
 #include "tests/collision/TestWorldQueries.h"
+#include "tests/collision/TestNarrowPhase.h"
 #include "tests/collision/TestAABB.h"
 #include "tests/collision/TestDynamicAABBTree.h"
+#include "tests/collision/TestStaticAABBTree.h"
+#include "tests/collision/TestSweepAndPrune.h"
+#include "tests/collision/TestSpatialHashGrid.h"
 #include "tests/collision/TestHalfEdgeStructure.h"
 #include "tests/collision/TestTriangleVertexArray.h"
 #include "tests/collision/TestConvexMesh.h"
@@ -48,6 +52,7 @@
 #include "tests/containers/TestDeque.h"
 #include "tests/containers/TestStack.h"
 #include "tests/engine/TestRigidBody.h"
+#include "tests/engine/TestTaskScheduler.h"
 #include "tests/utils/TestQuickHull.h"
 
 using namespace reactphysics3d;
@@ -81,7 +86,11 @@ int main() {
     testSuite.addTest(new TestTriangleVertexArray("TriangleVertexArray"));
     testSuite.addTest(new TestRaycast("Raycasting"));
     testSuite.addTest(new TestWorldQueries("WorldQueries"));
+    testSuite.addTest(new TestNarrowPhase("NarrowPhase"));
     testSuite.addTest(new TestDynamicAABBTree("DynamicAABBTree"));
+    testSuite.addTest(new TestStaticAABBTree("StaticAABBTree"));
+    testSuite.addTest(new TestSweepAndPrune("SweepAndPrune"));
+    testSuite.addTest(new TestSpatialHashGrid("SpatialHashGrid"));
     testSuite.addTest(new TestHalfEdgeStructure("HalfEdgeStructure"));
     testSuite.addTest(new TestConvexMesh("ConvexMesh"));
     testSuite.addTest(new TestTriangleMesh("TriangleMesh"));
@@ -94,6 +103,7 @@ int main() {
     // ---------- Engine tests ---------- //
 
     testSuite.addTest(new TestRigidBody("RigidBody"));
+    testSuite.addTest(new TestTaskScheduler("TaskScheduler"));
 
     // Run the tests
     testSuite.run();
@@ -100,6 +100,7 @@ class TestConvexMesh : public Test {
         /// Run the tests
         void run() {
             test();
+            testSupportVertices();
         }
 
         void test() {
@@ -133,6 +134,65 @@ class TestConvexMesh : public Test {
             rp3d_test(Vector3::approxEqual(mConvexMesh->getBounds().getMin(), Vector3(-3, -3 ,-3)));
             rp3d_test(Vector3::approxEqual(mConvexMesh->getBounds().getMax(), Vector3(3, 3 ,3)));
         }
+
+        void testSupportVertices() {
+
+            // Cube
+            const Vector3 directions[4] = {Vector3(1, 2, 3), Vector3(-1, decimal(0.5), -2), Vector3(decimal(0.2), -3, decimal(-0.1)), Vector3(-4, -1, 1)};
+            const uint32 expectedVertices[4] = {5, 7, 2, 0};
+            for (uint32 d=0; d < 4; d++) {
+                rp3d_test(mConvexMesh->computeSupportVertexBruteForce(directions[d]) == expectedVertices[d]);
+                for (uint32 v=0; v < 8; v++) {
+                    rp3d_test(mConvexMesh->computeSupportVertexHillClimbing(directions[d], v) == expectedVertices[d]);
+                }
+            }
+
+            // Convex hull of points on a sphere
+            std::vector<Vector3> points;
+            const uint32 nbPoints = 100;
+            const decimal goldenAngle = PI_RP3D * (decimal(3.0) - std::sqrt(decimal(5.0)));
+            for (uint32 i=0; i < nbPoints; i++) {
+                const decimal y = decimal(1.0) - (decimal(i) + decimal(0.5)) * decimal(2.0) / decimal(nbPoints);
+                const decimal radius = std::sqrt(decimal(1.0) - y * y);
+                const decimal angle = goldenAngle * decimal(i);
+                points.push_back(Vector3(radius * std::cos(angle), y, radius * std::sin(angle)) * decimal(5.0));
+            }
+
+            VertexArray::DataType dataType = sizeof(decimal) == sizeof(float) ? VertexArray::DataType::VERTEX_FLOAT_TYPE : VertexArray::DataType::VERTEX_DOUBLE_TYPE;
+            VertexArray vertexArray(points.data(), sizeof(Vector3), static_cast<uint32>(points.size()), dataType);
+            std::vector<Message> messages;
+            ConvexMesh* sphereMesh = mPhysicsCommon.createConvexMesh(vertexArray, messages);
+            rp3d_test(sphereMesh != nullptr);
+            rp3d_test(sphereMesh->getNbVertices() == nbPoints);
+
+            // The hill-climbing and the brute force must find the vertex with the largest dot product
+            uint32 startVertex = 0;
+            for (uint32 d=0; d < 200; d++) {
+
+                const decimal angle1 = decimal(d) * decimal(0.37);
+                const decimal angle2 = decimal(d) * decimal(0.11);
+                const Vector3 direction(std::cos(angle1) * std::cos(angle2), std::sin(angle2), std::sin(angle1) * std::cos(angle2));
+
+                decimal maxDotProduct = DECIMAL_SMALLEST;
+                for (uint32 v=0; v < sphereMesh->getNbVertices(); v++) {
+                    maxDotProduct = std::max(maxDotProduct, direction.dot(sphereMesh->getVertex(v)));
+                }
+
+                const uint32 bruteForceVertex = sphereMesh->computeSupportVertexBruteForce(direction);
+                rp3d_test(approxEqual(direction.dot(sphereMesh->getVertex(bruteForceVertex)), maxDotProduct));
+
+                // Start from the previous support vertex and from an arbitrary vertex
+                startVertex = sphereMesh->computeSupportVertexHillClimbing(direction, startVertex);
+                rp3d_test(approxEqual(direction.dot(sphereMesh->getVertex(startVertex)), maxDotProduct));
+                const uint32 hillClimbingVertex = sphereMesh->computeSupportVertexHillClimbing(direction, (d * 7) % nbPoints);
+                rp3d_test(approxEqual(direction.dot(sphereMesh->getVertex(hillClimbingVertex)), maxDotProduct));
+            }
+
+            // An invalid start vertex is ignored
+            rp3d_test(mConvexMesh->computeSupportVertexHillClimbing(directions[0], 1000) == expectedVertices[0]);
+
+            mPhysicsCommon.destroyConvexMesh(sphereMesh);
+        }
  };
 
 }
@@ -28,6 +28,7 @@
 
 // Libraries
 #include "Test.h"
+#include "TestHelpers.h"
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/engine/PhysicsCommon.h>
@@ -58,26 +59,28 @@ class DynamicTreeRaycastCallback : public DynamicAABBTreeRaycastCallback {
         }
 };
 
-class DefaultTestTreeAllocator : public MemoryAllocator {
+class DynamicTreeClosestHitCallback : public DynamicAABBTreeRaycastCallback {
 
     public:
 
-        /// Destructor
-        virtual ~DefaultTestTreeAllocator() override = default;
+        const DynamicAABBTree& mTree;
+        int32 mClosestNodeId = -1;
+        uint32 mNbTestedNodes = 0;
 
-        /// Assignment operator
-        DefaultTestTreeAllocator& operator=(DefaultTestTreeAllocator& allocator) = default;
+        DynamicTreeClosestHitCallback(const DynamicAABBTree& tree) : mTree(tree) {}
 
-        /// Allocate memory of a given size (in bytes) and return a pointer to the
-        /// allocated memory.
-        virtual void* allocate(size_t size) override {
+        // Raycast the fat AABB of the leaf node and clip the ray at the hit point
+        virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override {
 
-            return malloc(size);
-        }
+            mNbTestedNodes++;
+
+            const Vector3 rayDirection = ray.point2 - ray.point1;
+            const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+            decimal hitFraction;
+            if (!mTree.getFatAABB(nodeId).testRayIntersect(ray.point1, rayDirectionInverse, ray.maxFraction, hitFraction)) return -1.0;
 
-        /// Release previously allocated memory.
-        virtual void release(void* pointer, size_t /*size*/) override {
-            free(pointer);
+            mClosestNodeId = nodeId;
+            return hitFraction;
         }
 };
 
@@ -136,6 +139,8 @@ class TestDynamicAABBTree : public Test {
             testBasicsMethods();
             testOverlapping();
             testRaycast();
+            testClosestHitRaycast();
+            testRebuildAndOptimize();
 
         }
 
@@ -560,6 +565,198 @@ class TestDynamicAABBTree : public Test {
             rp3d_test(mRaycastCallback.isHit(object4Id));
 
         }
+
+        void testClosestHitRaycast() {
+
+            // Dynamic AABB Tree with a row of boxes along the x axis
+            DynamicAABBTree tree(mAllocator);
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+            tree.setProfiler(mProfiler);
+#endif
+
+            const int nbBoxes = 200;
+            std::vector<int> objectsData(nbBoxes);
+            std::vector<int> objectsIds(nbBoxes);
+            for (int i=0; i < nbBoxes; i++) {
+                objectsData[i] = i;
+                objectsIds[i] = tree.addObject(AABB(Vector3(decimal(3 * i), -1, -1), Vector3(decimal(3 * i + 1), 1, 1)), &objectsData[i]);
+            }
+
+            // The nodes are visited from front to back and the farther nodes are skipped after the first hit
+            DynamicTreeClosestHitCallback callback(tree);
+            tree.raycast(Ray(Vector3(-10, 0, 0), Vector3(1000, 0, 0)), callback);
+            rp3d_test(callback.mClosestNodeId == objectsIds[0]);
+            rp3d_test(callback.mNbTestedNodes < 4);
+
+            // Same thing in the other direction
+            DynamicTreeClosestHitCallback reverseCallback(tree);
+            tree.raycast(Ray(Vector3(1000, 0, 0), Vector3(-10, 0, 0)), reverseCallback);
+            rp3d_test(reverseCallback.mClosestNodeId == objectsIds[nbBoxes - 1]);
+            rp3d_test(reverseCallback.mNbTestedNodes < 4);
+
+            // A callback that does not clip the ray still reports all the hit nodes
+            mRaycastCallback.reset();
+            tree.raycast(Ray(Vector3(-10, 0, 0), Vector3(1000, 0, 0)), mRaycastCallback);
+            rp3d_test(mRaycastCallback.mHitNodes.size() == nbBoxes);
+        }
+
+        /// Return true if the overlap queries of the tree report the same objects as a brute-force test
+        bool isTreeQueryValid(const DynamicAABBTree& tree, const std::vector<int>& objectsIds, const std::vector<AABB>& aabbs,
+                              const AABB& queryAABB) {
+
+            Array<int> overlappingNodes(mAllocator);
+            tree.reportAllShapesOverlappingWithAABB(queryAABB, overlappingNodes);
+
+            uint32 nbExpectedNodes = 0;
+            for (uint32 i=0; i < objectsIds.size(); i++) {
+
+                if (objectsIds[i] == -1) continue;
+
+                const bool isExpected = aabbs[i].testCollision(queryAABB);
+                if (isExpected) nbExpectedNodes++;
+                if (isExpected != isOverlapping(objectsIds[i], overlappingNodes)) return false;
+            }
+
+            return overlappingNodes.size() == nbExpectedNodes;
+        }
+
+        void testRebuildAndOptimize() {
+
+            DynamicAABBTree tree(mAllocator);
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+            tree.setProfiler(mProfiler);
+#endif
+
+            // Empty tree
+            tree.rebuild();
+            rp3d_test(tree.getHeight() == 0);
+            rp3d_test(tree.computeSAHCost() == decimal(0.0));
+            rp3d_test(tree.optimize(10) == 0);
+
+            // Tree with a single object
+            int singleObjectData = 5;
+            const int singleObjectId = tree.addObject(AABB(Vector3(1, 2, 3), Vector3(4, 5, 6)), &singleObjectData);
+            tree.rebuild();
+            rp3d_test(tree.getHeight() == 0);
+            rp3d_test(tree.getRootAABB().getMax() == Vector3(4, 5, 6));
+            rp3d_test(tree.getNodeDataPointer(singleObjectId) == &singleObjectData);
+            tree.removeObject(singleObjectId);
+
+            // Add objects sorted along an axis and move them many times to degrade the tree
+            TestRandomGenerator randomGenerator(1234);
+
+            const int nbObjects = 1000;
+            std::vector<int> objectsIds(nbObjects);
+            std::vector<AABB> aabbs(nbObjects);
+            for (int i=0; i < nbObjects; i++) {
+                const Vector3 center(decimal(i) * decimal(0.5), randomGenerator.random(-20, 20), randomGenerator.random(-20, 20));
+                aabbs[i] = AABB(center - Vector3(1, 1, 1), center + Vector3(1, 1, 1));
+                objectsIds[i] = tree.addObject(aabbs[i], static_cast<uint32>(i));
+            }
+            for (int step=0; step < 5000; step++) {
+                const int i = static_cast<int>(randomGenerator.random(0, nbObjects - 1));
+                const Vector3 center(randomGenerator.random(-100, 600), randomGenerator.random(-20, 20), randomGenerator.random(-20, 20));
+                aabbs[i] = AABB(center - Vector3(1, 1, 1), center + Vector3(1, 1, 1));
+                tree.updateObject(objectsIds[i], aabbs[i], true);
+            }
+            for (int i=0; i < nbObjects; i += 10) {
+                tree.removeObject(objectsIds[i]);
+                objectsIds[i] = -1;
+            }
+
+            const decimal costBeforeRebuild = tree.computeSAHCost();
+            const int heightBeforeRebuild = tree.getHeight();
+            rp3d_test(costBeforeRebuild > decimal(1.0));
+            rp3d_test(heightBeforeRebuild > 0);
+
+            // Rebuild the tree
+            tree.rebuild();
+            const decimal costAfterRebuild = tree.computeSAHCost();
+            rp3d_test(costAfterRebuild < costBeforeRebuild);
+            rp3d_test(tree.getHeight() <= heightBeforeRebuild);
+
+            // The objects keep their IDs and data
+            for (int i=0; i < nbObjects; i++) {
+                if (objectsIds[i] != -1) {
+                    rp3d_test(tree.getNodeDataInt(objectsIds[i]) == i);
+                    rp3d_test(tree.getFatAABB(objectsIds[i]).getMin() == aabbs[i].getMin());
+                }
+            }
+
+            for (int i=0; i < 50; i++) {
+                const Vector3 center(randomGenerator.random(-100, 600), randomGenerator.random(-20, 20), randomGenerator.random(-20, 20));
+                rp3d_test(isTreeQueryValid(tree, objectsIds, aabbs, AABB(center - Vector3(5, 5, 5), center + Vector3(5, 5, 5))));
+            }
+
+            // The objects can still be added, moved and removed
+            for (int i=0; i < nbObjects; i += 10) {
+                objectsIds[i] = tree.addObject(aabbs[i], static_cast<uint32>(i));
+            }
+            for (int i=1; i < nbObjects; i += 7) {
+                aabbs[i] = AABB(aabbs[i].getMin() + Vector3(3, 0, 0), aabbs[i].getMax() + Vector3(3, 0, 0));
+                tree.updateObject(objectsIds[i], aabbs[i], true);
+            }
+            tree.removeObject(objectsIds[2]);
+            objectsIds[2] = -1;
+
+            mRaycastCallback.reset();
+            tree.raycast(Ray(Vector3(-200, 0, 0), Vector3(800, 0, 0)), mRaycastCallback);
+            for (int i=0; i < nbObjects; i++) {
+                if (objectsIds[i] != -1) {
+                    rp3d_test(mRaycastCallback.isHit(objectsIds[i]) == (aabbs[i].getMin().y <= 0 && aabbs[i].getMax().y >= 0 &&
+                                                                        aabbs[i].getMin().z <= 0 && aabbs[i].getMax().z >= 0));
+                }
+            }
+
+            // Incrementally optimize the tree with a budget
+            rp3d_test(tree.optimize(100) == 100);
+            rp3d_test(tree.optimize(0) == 0);
+            for (int i=0; i < 20; i++) {
+                tree.optimize(100);
+            }
+            for (int i=0; i < 50; i++) {
+                const Vector3 center(randomGenerator.random(-100, 600), randomGenerator.random(-20, 20), randomGenerator.random(-20, 20));
+                rp3d_test(isTreeQueryValid(tree, objectsIds, aabbs, AABB(center - Vector3(5, 5, 5), center + Vector3(5, 5, 5))));
+            }
+            for (int i=0; i < nbObjects; i++) {
+                if (objectsIds[i] != -1) {
+                    rp3d_test(tree.getNodeDataInt(objectsIds[i]) == i);
+                }
+            }
+
+            // Rebuild and optimize the broad-phase of a world
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            for (int i=0; i < 200; i++) {
+                RigidBody* body = world->createRigidBody(Transform(Vector3(randomGenerator.random(-20, 20), randomGenerator.random(-20, 20), randomGenerator.random(-20, 20)), Quaternion::identity()));
+                body->setType(i % 4 == 0 ? BodyType::STATIC : BodyType::DYNAMIC);
+                body->addCollider(sphereShape, Transform::identity());
+            }
+            world->update(decimal(1.0) / decimal(60.0));
+            rp3d_test(world->getBroadPhaseSAHCost() > decimal(0.0));
+            rp3d_test(world->getBroadPhaseHeight() > 0);
+
+            std::vector<Ray> rays;
+            std::vector<RaycastInfo> raycastInfos(50);
+            for (int i=0; i < 50; i++) {
+                rays.push_back(Ray(Vector3(randomGenerator.random(-25, 25), randomGenerator.random(-25, 25), -30), Vector3(randomGenerator.random(-25, 25), randomGenerator.random(-25, 25), 30)));
+                world->raycast(rays[i], raycastInfos[i]);
+            }
+
+            world->rebuildBroadPhase();
+            rp3d_test(world->optimizeBroadPhase(1000) == 200);
+            for (int i=0; i < 50; i++) {
+                RaycastInfo raycastInfo;
+                world->raycast(rays[i], raycastInfo);
+                rp3d_test(raycastInfo.collider == raycastInfos[i].collider);
+            }
+            world->update(decimal(1.0) / decimal(60.0));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
  };
 
 }
@@ -0,0 +1,229 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2016 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_NARROW_PHASE_H
+#define TEST_NARROW_PHASE_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include "Test.h"
+#include "TestHelpers.h"
+#include "TestWorldQueries.h"
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestNarrowPhase
+/**
+ * Unit test for the narrow-phase collision detection algorithms
+ */
+class TestNarrowPhase : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        // Random generator for the transforms of the shapes
+        TestRandomGenerator mRandom;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestNarrowPhase(const std::string& name) : Test(name), mRandom(12345) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testBoxVsBoxAlgorithm();
+            testSATTemporalCoherence();
+        }
+
+        void testBoxVsBoxAlgorithm() {
+
+            // The box vs box algorithm must report the same contacts as the
+            // convex polyhedron vs convex polyhedron algorithm
+            PhysicsWorld* boxWorld = mPhysicsCommon.createPhysicsWorld();
+            PhysicsWorld* polyhedronWorld = mPhysicsCommon.createPhysicsWorld();
+            polyhedronWorld->getCollisionDispatch().setIsBoxVsBoxAlgorithmEnabled(false);
+            rp3d_test(boxWorld->getCollisionDispatch().isBoxVsBoxAlgorithmEnabled());
+            rp3d_test(!polyhedronWorld->getCollisionDispatch().isBoxVsBoxAlgorithmEnabled());
+
+            BoxShape* boxShape1 = mPhysicsCommon.createBoxShape(Vector3(1, decimal(0.5), decimal(0.8)));
+            BoxShape* boxShape2 = mPhysicsCommon.createBoxShape(Vector3(decimal(0.6), decimal(1.2), decimal(0.4)));
+
+            PhysicsWorld* worlds[2] = {boxWorld, polyhedronWorld};
+            RigidBody* bodies1[2];
+            RigidBody* bodies2[2];
+            for (uint32 w=0; w < 2; w++) {
+                bodies1[w] = worlds[w]->createRigidBody(Transform::identity());
+                bodies1[w]->addCollider(boxShape1, Transform::identity());
+                bodies2[w] = worlds[w]->createRigidBody(Transform::identity());
+                bodies2[w]->addCollider(boxShape2, Transform::identity());
+            }
+
+            uint32 nbCollisions = 0;
+            for (uint32 i=0; i < 200; i++) {
+
+                // Random (but reproducible) relative transforms of the two boxes
+                const Transform transform1(Vector3(mRandom.random(-1, 1), mRandom.random(-1, 1), mRandom.random(-1, 1)),
+                                           Quaternion::fromEulerAngles(mRandom.random(-3, 3), mRandom.random(-3, 3), mRandom.random(-3, 3)));
+                const Transform transform2(transform1.getPosition() + Vector3(mRandom.random(-2, 2), mRandom.random(-2, 2), mRandom.random(-2, 2)),
+                                           Quaternion::fromEulerAngles(mRandom.random(-3, 3), mRandom.random(-3, 3), mRandom.random(-3, 3)));
+
+                WorldCollisionCallback callbacks[2];
+                for (uint32 w=0; w < 2; w++) {
+                    bodies1[w]->setTransform(transform1);
+                    bodies2[w]->setTransform(transform2);
+                    worlds[w]->testCollision(bodies1[w], bodies2[w], callbacks[w]);
+                }
+
+                const CollisionData* boxCollisionData = callbacks[0].getCollisionData(bodies1[0]->getCollider(0), bodies2[0]->getCollider(0));
+                const CollisionData* polyhedronCollisionData = callbacks[1].getCollisionData(bodies1[1]->getCollider(0), bodies2[1]->getCollider(0));
+                rp3d_test((boxCollisionData != nullptr) == (polyhedronCollisionData != nullptr));
+                if (boxCollisionData == nullptr || polyhedronCollisionData == nullptr) continue;
+
+                nbCollisions++;
+
+                // Make sure the contact points are the same
+                rp3d_test(boxCollisionData->getTotalNbContactPoints() == polyhedronCollisionData->getTotalNbContactPoints());
+                for (const CollisionPointData& point : boxCollisionData->contactPairs[0].contactPoints) {
+                    rp3d_test(polyhedronCollisionData->hasContactPointSimilarTo(point.localPointBody1, point.localPointBody2,
+                                                                                 point.penetrationDepth, decimal(0.01)));
+                }
+            }
+
+            // Make sure that we have tested colliding boxes
+            rp3d_test(nbCollisions > 20);
+
+            mPhysicsCommon.destroyPhysicsWorld(boxWorld);
+            mPhysicsCommon.destroyPhysicsWorld(polyhedronWorld);
+            mPhysicsCommon.destroyBoxShape(boxShape1);
+            mPhysicsCommon.destroyBoxShape(boxShape2);
+        }
+
+        void testSATTemporalCoherence() {
+
+            // For a resting contact, the SAT algorithm reuses the contact features of the previous frames when the
+            // relative motion of the polyhedra is small. The contacts must be the same as the contacts computed
+            // without temporal coherence (testCollision() method)
+            float cubeVertices[8 * 3] = {-3, -3, 3,  3, -3, 3,  3, -3, -3,  -3, -3, -3,
+                                         -3, 3, 3,  3, 3, 3,  3, 3, -3,  -3, 3, -3};
+            int cubeIndices[24] = {0, 3, 2, 1,  4, 5, 6, 7,  0, 1, 5, 4,  1, 2, 6, 5,  2, 3, 7, 6,  0, 4, 7, 3};
+            PolygonVertexArray::PolygonFace cubeFaces[6];
+            for (uint32 f=0; f < 6; f++) {
+                cubeFaces[f].indexBase = f * 4;
+                cubeFaces[f].nbVertices = 4;
+            }
+            PolygonVertexArray polygonVertexArray(8, cubeVertices, 3 * sizeof(float), cubeIndices, sizeof(int), 6, cubeFaces,
+                                                  PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                  PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            std::vector<Message> errors;
+            ConvexMesh* convexMesh = mPhysicsCommon.createConvexMesh(polygonVertexArray, errors);
+            rp3d_test(convexMesh != nullptr);
+            ConvexMeshShape* convexMeshShape = mPhysicsCommon.createConvexMeshShape(convexMesh);
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            WorldEventListener eventListener;
+            world->setEventListener(&eventListener);
+
+            RigidBody* staticBody = world->createRigidBody(Transform::identity());
+            staticBody->setType(BodyType::STATIC);
+            Collider* staticCollider = staticBody->addCollider(convexMeshShape, Transform::identity());
+
+            RigidBody* restingBody = world->createRigidBody(Transform::identity());
+            restingBody->enableGravity(false);
+            Collider* restingCollider = restingBody->addCollider(convexMeshShape, Transform::identity());
+
+            // Small motions (that reuse the contact features) and large motions of the resting body
+            const Transform transforms[] = {
+                Transform(Vector3(0, decimal(5.98), 0), Quaternion::identity()),
+                Transform(Vector3(decimal(0.001), decimal(5.978), 0), Quaternion::identity()),
+                Transform(Vector3(decimal(0.002), decimal(5.978), decimal(0.001)), Quaternion::fromEulerAngles(0, 0, decimal(0.002))),
+                Transform(Vector3(decimal(0.002), decimal(5.979), decimal(0.001)), Quaternion::fromEulerAngles(decimal(0.001), 0, decimal(0.003))),
+                Transform(Vector3(decimal(1.5), decimal(5.97), decimal(-0.5)), Quaternion::fromEulerAngles(0, decimal(0.4), 0)),
+                Transform(Vector3(decimal(1.502), decimal(5.969), decimal(-0.5)), Quaternion::fromEulerAngles(0, decimal(0.402), 0)),
+            };
+
+            const bool isSmallMotion[] = {false, true, true, true, false, true};
+
+            // The same frames are also tested directly with the convex polyhedron vs convex polyhedron
+            // algorithm of the world to make sure that the contact features are reused for the small motions
+            NarrowPhaseTestBatch testBatch(*world);
+            ConvexPolyhedronVsConvexPolyhedronAlgorithm* algorithm = world->getCollisionDispatch().getConvexPolyhedronVsConvexPolyhedronAlgorithm();
+            LastFrameCollisionInfo lastFrameInfo;
+
+            for (uint32 i=0; i < 6; i++) {
+
+                const Transform& transform = transforms[i];
+
+                // The relative transform of the contact features is only updated when the features are computed again
+                const Transform previousFeaturesTransform = lastFrameInfo.satFeaturesRelativeTransform;
+                testBatch.addTest(convexMeshShape, convexMeshShape, transform, Transform::identity(), &lastFrameInfo);
+                testBatch.batch.allocateContactPoints();
+                algorithm->testCollision(testBatch.batch, 0, 1, true, testBatch.getAllocator());
+                rp3d_test(testBatch.batch.isColliding[0]);
+                rp3d_test((lastFrameInfo.satFeaturesRelativeTransform == previousFeaturesTransform) == isSmallMotion[i]);
+                testBatch.endFrame();
+
+                restingBody->setTransform(transform);
+                restingBody->setLinearVelocity(Vector3::zero());
+                restingBody->setAngularVelocity(Vector3::zero());
+
+                eventListener.collisionCallback.reset();
+                world->update(decimal(1.0) / decimal(60.0));
+
+                WorldCollisionCallback referenceCallback;
+                restingBody->setTransform(transform);
+                world->testCollision(restingBody, staticBody, referenceCallback);
+
+                const CollisionData* collisionData = eventListener.collisionCallback.getCollisionData(restingCollider, staticCollider);
+                const CollisionData* referenceCollisionData = referenceCallback.getCollisionData(restingCollider, staticCollider);
+                rp3d_test(collisionData != nullptr);
+                rp3d_test(referenceCollisionData != nullptr);
+                if (collisionData == nullptr || referenceCollisionData == nullptr) continue;
+
+                rp3d_test(collisionData->getTotalNbContactPoints() == referenceCollisionData->getTotalNbContactPoints());
+                for (const CollisionPointData& point : collisionData->contactPairs[0].contactPoints) {
+                    rp3d_test(referenceCollisionData->hasContactPointSimilarTo(point.localPointBody1, point.localPointBody2,
+                                                                               point.penetrationDepth, decimal(0.0001)));
+                }
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyConvexMeshShape(convexMeshShape);
+            mPhysicsCommon.destroyConvexMesh(convexMesh);
+        }
+ };
+
+}
+
+#endif
@@ -92,6 +92,30 @@ class WorldRaycastCallback : public RaycastCallback {
         }
 };
 
+/// Class ClosestRaycastCallback
+class ClosestRaycastCallback : public RaycastCallback {
+
+    public:
+
+        decimal hitFraction = decimal(1.0);
+        Body* body = nullptr;
+        Collider* collider = nullptr;
+        bool isHit = false;
+
+        virtual decimal notifyRaycastHit(const RaycastInfo& info) override {
+
+            if (!isHit || info.hitFraction < hitFraction) {
+                hitFraction = info.hitFraction;
+                body = info.body;
+                collider = info.collider;
+                isHit = true;
+            }
+
+            // Return the hit fraction to clip the ray
+            return info.hitFraction;
+        }
+};
+
 // Class TestPointInside
 /**
  * Unit test for the RigidBody::testPointInside() method.
@@ -335,6 +359,8 @@ class TestRaycast : public Test {
             testCompound();
             testConcaveMesh();
             testHeightField();
+            testClosestHit();
+            testRaycastBatch();
         }
 
         /// Test the Collider::raycast(), RigidBody::raycast() and
@@ -1750,6 +1776,141 @@ class TestRaycast : public Test {
             mWorld->raycast(Ray(ray14.point1, ray14.point2, decimal(0.82)), &mCallback);
             rp3d_test(mCallback.isHit);
         }
+
+        /// Test the PhysicsWorld::raycast() method that only computes the closest hit
+        void testClosestHit() {
+
+            // The closest hit must be the same as with a callback that clips the ray at each hit
+            const Ray rays[] = {Ray(mLocalShapeToWorld * Vector3(1, 2, 10), mLocalShapeToWorld * Vector3(1, 2, -20)),
+                                Ray(mLocalShapeToWorld * Vector3(-20, 1, 0), mLocalShapeToWorld * Vector3(20, 1, 0)),
+                                Ray(mLocalShapeToWorld * Vector3(0, 20, 1), mLocalShapeToWorld * Vector3(0, -20, -1)),
+                                Ray(mLocalShapeToWorld * Vector3(30, 30, 30), mLocalShapeToWorld * Vector3(40, 40, 40))};
+            for (const Ray& ray : rays) {
+
+                ClosestRaycastCallback callback;
+                mWorld->raycast(ray, &callback);
+
+                RaycastInfo raycastInfo;
+                const bool isHit = mWorld->raycast(ray, raycastInfo);
+                rp3d_test(isHit == callback.isHit);
+                if (isHit) {
+                    rp3d_test(approxEqual(raycastInfo.hitFraction, callback.hitFraction, epsilon));
+                    rp3d_test(raycastInfo.body != nullptr);
+                    rp3d_test(raycastInfo.collider != nullptr);
+                }
+            }
+
+            // Wrong category filter mask
+            RaycastInfo raycastInfo;
+            rp3d_test(!mWorld->raycast(rays[0], raycastInfo, 0x0004));
+
+            // World with a row of static and dynamic boxes
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            std::vector<RigidBody*> bodies;
+            for (int i=0; i < 40; i++) {
+                RigidBody* body = world->createRigidBody(Transform(Vector3(decimal(2 * i), 0, 0), Quaternion::identity()));
+                body->setType(i % 2 == 0 ? BodyType::STATIC : BodyType::DYNAMIC);
+                body->addCollider(boxShape, Transform::identity());
+                bodies.push_back(body);
+            }
+
+            RaycastInfo rowRaycastInfo;
+            rp3d_test(world->raycast(Ray(Vector3(-10, 0, 0), Vector3(100, 0, 0)), rowRaycastInfo));
+            rp3d_test(rowRaycastInfo.body == bodies[0]);
+            rp3d_test(approxEqual(rowRaycastInfo.hitFraction, decimal(9.5) / decimal(110.0), epsilon));
+            rp3d_test(approxEqual(rowRaycastInfo.worldPoint.x, decimal(-0.5), epsilon));
+
+            rp3d_test(world->raycast(Ray(Vector3(100, 0, 0), Vector3(-10, 0, 0)), rowRaycastInfo));
+            rp3d_test(rowRaycastInfo.body == bodies[39]);
+            rp3d_test(approxEqual(rowRaycastInfo.worldPoint.x, decimal(78.5), epsilon));
+
+            rp3d_test(!world->raycast(Ray(Vector3(-10, 5, 0), Vector3(100, 5, 0)), rowRaycastInfo));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+        }
+
+        /// Test the PhysicsWorld::raycastBatch() method
+        void testRaycastBatch() {
+
+            // The closest hit of each ray of the batch must be the same as with a single ray
+            std::vector<Ray> rays;
+            for (int x=-6; x <= 6; x++) {
+                for (int y=-6; y <= 6; y++) {
+                    const Vector3 origin(decimal(x) * decimal(0.9), decimal(y) * decimal(0.9), 20);
+                    const Vector3 target(decimal(x) * decimal(0.3), decimal(y) * decimal(0.7), -20);
+                    const decimal maxFraction = (x + y) % 5 == 0 ? decimal(0.5) : decimal(1.0);
+                    rays.push_back(Ray(mLocalShapeToWorld * origin, mLocalShapeToWorld * target, maxFraction));
+                }
+            }
+            const uint32 nbRays = static_cast<uint32>(rays.size());
+
+            std::vector<RaycastInfo> raycastInfos(nbRays);
+            const uint32 nbHits = mWorld->raycastBatch(rays.data(), nbRays, raycastInfos.data());
+
+            uint32 nbExpectedHits = 0;
+            for (uint32 i=0; i < nbRays; i++) {
+
+                RaycastInfo raycastInfo;
+                const bool isHit = mWorld->raycast(rays[i], raycastInfo);
+                rp3d_test(isHit == (raycastInfos[i].collider != nullptr));
+                if (isHit) {
+                    nbExpectedHits++;
+                    rp3d_test(approxEqual(raycastInfos[i].hitFraction, raycastInfo.hitFraction, epsilon));
+                    rp3d_test(approxEqual(raycastInfos[i].worldPoint.x, raycastInfo.worldPoint.x, epsilon));
+                    rp3d_test(approxEqual(raycastInfos[i].worldPoint.y, raycastInfo.worldPoint.y, epsilon));
+                    rp3d_test(approxEqual(raycastInfos[i].worldPoint.z, raycastInfo.worldPoint.z, epsilon));
+                    rp3d_test(raycastInfos[i].body != nullptr);
+                }
+            }
+            rp3d_test(nbHits == nbExpectedHits);
+            rp3d_test(nbHits > 0);
+
+            // Wrong category filter mask
+            rp3d_test(mWorld->raycastBatch(rays.data(), nbRays, raycastInfos.data(), 0x0004) == 0);
+
+            // World with a row of static and dynamic boxes and with the rays cast on multiple threads
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(4);
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            world->setTaskScheduler(scheduler);
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            for (int i=0; i < 40; i++) {
+                RigidBody* body = world->createRigidBody(Transform(Vector3(decimal(2 * i), 0, 0), Quaternion::identity()));
+                body->setType(i % 2 == 0 ? BodyType::STATIC : BodyType::DYNAMIC);
+                body->addCollider(boxShape, Transform::identity());
+            }
+
+            // Vertical rays above the row of boxes
+            std::vector<Ray> rowRays;
+            for (int i=0; i < 1000; i++) {
+                const decimal x = decimal(-1.0) + decimal(i) * decimal(0.08);
+                rowRays.push_back(Ray(Vector3(x, 5, decimal(0.1)), Vector3(x, -5, decimal(-0.1))));
+            }
+            const uint32 nbRowRays = static_cast<uint32>(rowRays.size());
+
+            std::vector<RaycastInfo> rowRaycastInfos(nbRowRays);
+            const uint32 nbRowHits = world->raycastBatch(rowRays.data(), nbRowRays, rowRaycastInfos.data(), 0xFFFF, true);
+
+            uint32 nbExpectedRowHits = 0;
+            for (uint32 i=0; i < nbRowRays; i++) {
+
+                RaycastInfo raycastInfo;
+                const bool isHit = world->raycast(rowRays[i], raycastInfo);
+                rp3d_test(isHit == (rowRaycastInfos[i].collider != nullptr));
+                if (isHit) {
+                    nbExpectedRowHits++;
+                    rp3d_test(rowRaycastInfos[i].body == raycastInfo.body);
+                    rp3d_test(approxEqual(rowRaycastInfos[i].hitFraction, raycastInfo.hitFraction, epsilon));
+                }
+            }
+            rp3d_test(nbRowHits == nbExpectedRowHits);
+            rp3d_test(nbRowHits > 0 && nbRowHits < nbRowRays);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
 };
 
 }
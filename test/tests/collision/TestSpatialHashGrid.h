@@ -0,0 +1,534 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_SPATIAL_HASH_GRID_H
+#define TEST_SPATIAL_HASH_GRID_H
+
+// Libraries
+#include "Test.h"
+#include "TestHelpers.h"
+#include <reactphysics3d/collision/broadphase/SpatialHashGrid.h>
+#include <reactphysics3d/engine/PhysicsCommon.h>
+#include <reactphysics3d/engine/PhysicsWorld.h>
+#include <vector>
+#include <algorithm>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class SpatialHashGridRaycastCallback
+/**
+ * Raycast callback that stores the IDs of the objects whose AABB is hit by the ray. If
+ * the ray must be clipped, the callback returns the fraction where the ray enters the AABB.
+ */
+class SpatialHashGridRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+    public:
+
+        const SpatialHashGrid& grid;
+
+        bool isClipping;
+
+        std::vector<int32> hitObjects;
+
+        decimal closestHitFraction;
+
+        SpatialHashGridRaycastCallback(const SpatialHashGrid& grid, bool isClipping)
+            : grid(grid), isClipping(isClipping), closestHitFraction(DECIMAL_LARGEST) {
+
+        }
+
+        virtual decimal raycastBroadPhaseShape(int32 objectId, const Ray& ray) override {
+
+            const Vector3 direction = ray.point2 - ray.point1;
+            const Vector3 directionInverse(decimal(1.0) / direction.x, decimal(1.0) / direction.y, decimal(1.0) / direction.z);
+
+            decimal entryFraction;
+            if (!grid.getAABB(objectId).testRayIntersect(ray.point1, directionInverse, ray.maxFraction, entryFraction)) {
+                return decimal(-1.0);
+            }
+
+            hitObjects.push_back(objectId);
+            closestHitFraction = std::min(closestHitFraction, entryFraction);
+
+            return isClipping ? entryFraction : decimal(-1.0);
+        }
+};
+
+// Class SpatialHashGridOverlapCallback
+/**
+ * Overlap callback that stores the pairs of entity IDs of the overlapping bodies
+ */
+class SpatialHashGridOverlapCallback : public OverlapCallback {
+
+    public:
+
+        std::vector<std::pair<uint32, uint32>> overlappingBodies;
+
+        virtual void onOverlap(CallbackData& callbackData) override {
+
+            for (uint32 i=0; i < callbackData.getNbOverlappingPairs(); i++) {
+
+                OverlapPair overlapPair = callbackData.getOverlappingPair(i);
+                const uint32 body1Id = overlapPair.getBody1()->getEntity().id;
+                const uint32 body2Id = overlapPair.getBody2()->getEntity().id;
+                overlappingBodies.push_back(std::make_pair(std::min(body1Id, body2Id), std::max(body1Id, body2Id)));
+            }
+            std::sort(overlappingBodies.begin(), overlappingBodies.end());
+        }
+};
+
+// Class SpatialHashGridAABBCallback
+/**
+ * AABB query callback that stores the sorted entity IDs of the bodies of the reported colliders
+ */
+class SpatialHashGridAABBCallback : public AABBQueryCallback {
+
+    public:
+
+        std::vector<uint32> bodies;
+
+        virtual void notifyOverlappingCollider(Collider* collider) override {
+            bodies.push_back(collider->getBody()->getEntity().id);
+            std::sort(bodies.begin(), bodies.end());
+        }
+};
+
+// Class TestSpatialHashGrid
+/**
+ * Unit test for the spatial hash grid broad-phase
+ */
+class TestSpatialHashGrid : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultTestTreeAllocator mAllocator;
+
+        PhysicsCommon mPhysicsCommon;
+
+        /// Pseudo-random generator
+        TestRandomGenerator mRandom;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestSpatialHashGrid(const std::string& name): Test(name), mRandom(8765) {
+
+        }
+
+        /// Return a random AABB (some objects are much larger than the cells)
+        AABB randomAABB(int32 objectId) {
+            const Vector3 center(mRandom.random(-20, 20), mRandom.random(-5, 5), mRandom.random(-20, 20));
+            const decimal maxHalfExtent = objectId % 25 == 0 ? decimal(12) : decimal(1.5);
+            const Vector3 halfExtent(mRandom.random(decimal(0.2), maxHalfExtent), mRandom.random(decimal(0.2), maxHalfExtent),
+                                     mRandom.random(decimal(0.2), maxHalfExtent));
+            return AABB(center - halfExtent, center + halfExtent);
+        }
+
+        /// Return the sorted pairs reported by the grid
+        std::vector<std::pair<int32, int32>> reportPairs(SpatialHashGrid& grid, const std::vector<bool>& isMoved) {
+
+            Array<int32> movedObjects(mAllocator);
+            for (uint32 i=0; i < isMoved.size(); i++) {
+                if (isMoved[i]) movedObjects.add(int32(i));
+            }
+
+            Array<Pair<int32, int32>> pairs(mAllocator);
+            grid.reportAllOverlappingPairs(movedObjects, pairs, mAllocator);
+
+            std::vector<std::pair<int32, int32>> sortedPairs;
+            for (uint32 i=0; i < pairs.size(); i++) {
+
+                // The moved object comes first
+                rp3d_test(isMoved[pairs[i].first]);
+
+                sortedPairs.push_back(std::make_pair(std::min(pairs[i].first, pairs[i].second), std::max(pairs[i].first, pairs[i].second)));
+            }
+            std::sort(sortedPairs.begin(), sortedPairs.end());
+
+            return sortedPairs;
+        }
+
+        /// Return the sorted pairs expected with a brute-force test of the objects
+        std::vector<std::pair<int32, int32>> computeExpectedPairs(const std::vector<AABB>& aabbs, const std::vector<bool>& isUsed,
+                                                                  const std::vector<bool>& isStatic, const std::vector<bool>& isMoved) {
+
+            std::vector<std::pair<int32, int32>> pairs;
+            for (int32 i=0; i < int32(aabbs.size()); i++) {
+                for (int32 j=i+1; j < int32(aabbs.size()); j++) {
+
+                    if (!isUsed[i] || !isUsed[j]) continue;
+                    if (!isMoved[i] && !isMoved[j]) continue;
+                    if (isStatic[i] && isStatic[j]) continue;
+
+                    if (aabbs[i].testCollision(aabbs[j])) {
+                        pairs.push_back(std::make_pair(i, j));
+                    }
+                }
+            }
+
+            return pairs;
+        }
+
+        /// Run the tests
+        void run() {
+
+            testOverlappingPairs();
+            testOverlappingAABB();
+            testRaycast();
+            testWorld();
+        }
+
+        void testOverlappingPairs() {
+
+            SpatialHashGrid grid(mAllocator, decimal(2.0));
+            rp3d_test(grid.getCellSize() == decimal(2.0));
+
+            const int32 nbObjects = 400;
+            std::vector<AABB> aabbs;
+            std::vector<bool> isUsed(nbObjects, true);
+            std::vector<bool> isStatic(nbObjects, false);
+            std::vector<bool> isMoved(nbObjects, true);
+
+            // No object
+            rp3d_test(reportPairs(grid, std::vector<bool>()).empty());
+
+            for (int32 i=0; i < nbObjects; i++) {
+                aabbs.push_back(randomAABB(i));
+                isStatic[i] = i % 4 == 0;
+                grid.addObject(i, aabbs[i], isStatic[i]);
+            }
+            rp3d_test(grid.getNbObjects() == uint32(nbObjects));
+
+            // The objects that overlap too many cells are stored in the tree
+            rp3d_test(!grid.isLargeObject(1));
+            grid.addObject(nbObjects, AABB(Vector3(-10, -1, -1), Vector3(10, 1, 1)), false);
+            rp3d_test(grid.isLargeObject(nbObjects));
+            grid.removeObject(nbObjects);
+            rp3d_test(!grid.hasObject(nbObjects));
+
+            // All the new objects are tested
+            std::vector<std::pair<int32, int32>> pairs = reportPairs(grid, isMoved);
+            rp3d_test(!pairs.empty());
+            rp3d_test(pairs == computeExpectedPairs(aabbs, isUsed, isStatic, isMoved));
+
+            // Nothing has moved
+            std::fill(isMoved.begin(), isMoved.end(), false);
+            rp3d_test(reportPairs(grid, isMoved).empty());
+
+            for (int step=0; step < 10; step++) {
+
+                // Move some objects (some of them become large or small)
+                std::fill(isMoved.begin(), isMoved.end(), false);
+                for (int32 i=0; i < nbObjects; i++) {
+
+                    if (isUsed[i] && i % 3 == step % 3) {
+
+                        if (i % 7 == step % 7) {
+                            aabbs[i] = randomAABB(i + step);
+                        }
+                        else {
+                            const Vector3 translation(mRandom.random(-1, 1), mRandom.random(-1, 1), mRandom.random(-1, 1));
+                            aabbs[i] = AABB(aabbs[i].getMin() + translation, aabbs[i].getMax() + translation);
+                        }
+                        grid.updateObject(i, aabbs[i]);
+                        rp3d_test(grid.getAABB(i).getMin() == aabbs[i].getMin());
+                        isMoved[i] = true;
+                    }
+                }
+
+                // Remove some objects and add them again (with the same ID) later
+                const int32 removedObject = (step * 37) % nbObjects;
+                if (isUsed[removedObject]) {
+                    grid.removeObject(removedObject);
+                    isUsed[removedObject] = false;
+                    isMoved[removedObject] = false;
+                    rp3d_test(!grid.hasObject(removedObject));
+                }
+                const int32 addedObject = ((step - 2) * 37) % nbObjects;
+                if (step >= 2 && !isUsed[addedObject]) {
+                    aabbs[addedObject] = randomAABB(addedObject);
+                    grid.addObject(addedObject, aabbs[addedObject], isStatic[addedObject]);
+                    isUsed[addedObject] = true;
+                    isMoved[addedObject] = true;
+                }
+
+                rp3d_test(reportPairs(grid, isMoved) == computeExpectedPairs(aabbs, isUsed, isStatic, isMoved));
+            }
+
+            // Objects with negative and very large coordinates
+            SpatialHashGrid farGrid(mAllocator, decimal(1.0));
+            farGrid.addObject(0, AABB(Vector3(-1000001, -2, -2), Vector3(-1000000, -1, -1)), false);
+            farGrid.addObject(1, AABB(Vector3(decimal(-1000000.5), decimal(-1.5), decimal(-1.5)), Vector3(-999999, 0, 0)), false);
+            farGrid.addObject(2, AABB(Vector3(-1, -1, -1), Vector3(0, 0, 0)), false);
+            pairs = reportPairs(farGrid, std::vector<bool>(3, true));
+            rp3d_test(pairs.size() == 1 && pairs[0] == std::make_pair(0, 1));
+        }
+
+        void testOverlappingAABB() {
+
+            SpatialHashGrid grid(mAllocator, decimal(2.0));
+
+            // Query without object
+            Array<int32> overlappingObjects(mAllocator);
+            grid.reportAllShapesOverlappingWithAABB(AABB(Vector3(-1, -1, -1), Vector3(1, 1, 1)), overlappingObjects, mAllocator);
+            rp3d_test(overlappingObjects.size() == 0);
+
+            const int32 nbObjects = 400;
+            std::vector<AABB> aabbs;
+            std::vector<int32> data(nbObjects);
+            for (int32 i=0; i < nbObjects; i++) {
+                aabbs.push_back(randomAABB(i));
+                grid.addObject(i, aabbs[i], i % 4 == 0, &data[i]);
+            }
+            rp3d_test(grid.getObjectData(5) == &data[5]);
+
+            for (int i=0; i < 100; i++) {
+
+                // Small and large queries (the objects of the cells are all tested for the largest ones)
+                const Vector3 center(mRandom.random(-25, 25), mRandom.random(-6, 6), mRandom.random(-25, 25));
+                const decimal halfSize = i % 10 == 0 ? mRandom.random(20, 40) : mRandom.random(decimal(0.1), 5);
+                const AABB aabb(center - Vector3(halfSize, halfSize, halfSize), center + Vector3(halfSize, halfSize, halfSize));
+
+                std::vector<int32> expectedObjects;
+                for (int32 j=0; j < nbObjects; j++) {
+                    if (aabb.testCollision(aabbs[j])) {
+                        expectedObjects.push_back(j);
+                    }
+                }
+
+                // Each overlapping object is reported once
+                overlappingObjects.clear();
+                grid.reportAllShapesOverlappingWithAABB(aabb, overlappingObjects, mAllocator);
+                std::vector<int32> reportedObjects(overlappingObjects.begin(), overlappingObjects.end());
+                std::sort(reportedObjects.begin(), reportedObjects.end());
+                rp3d_test(reportedObjects == expectedObjects);
+            }
+        }
+
+        void testRaycast() {
+
+            SpatialHashGrid grid(mAllocator, decimal(2.0));
+
+            // Raycast without object
+            SpatialHashGridRaycastCallback emptyCallback(grid, false);
+            grid.raycast(Ray(Vector3(-30, 0, 0), Vector3(30, 0, 0)), emptyCallback, mAllocator);
+            rp3d_test(emptyCallback.hitObjects.empty());
+
+            const int32 nbObjects = 400;
+            std::vector<AABB> aabbs;
+            for (int32 i=0; i < nbObjects; i++) {
+                aabbs.push_back(randomAABB(i));
+                grid.addObject(i, aabbs[i], false);
+            }
+
+            for (int i=0; i < 200; i++) {
+
+                // Random rays that start inside or outside of the objects (some of them are parallel to an axis)
+                Vector3 point1(mRandom.random(-30, 30), mRandom.random(-8, 8), mRandom.random(-30, 30));
+                Vector3 point2(mRandom.random(-30, 30), mRandom.random(-8, 8), mRandom.random(-30, 30));
+                if (i % 4 == 1) point2.y = point1.y;
+                if (i % 4 == 2) {
+                    point2.x = point1.x;
+                    point2.z = point1.z;
+                }
+                const Ray ray(point1, point2, i % 3 == 0 ? decimal(0.5) : decimal(1.0));
+
+                const Vector3 direction = ray.point2 - ray.point1;
+                const Vector3 directionInverse(decimal(1.0) / direction.x, decimal(1.0) / direction.y, decimal(1.0) / direction.z);
+
+                // Brute-force raycast
+                std::vector<int32> expectedHitObjects;
+                decimal expectedClosestHitFraction = DECIMAL_LARGEST;
+                for (int32 j=0; j < nbObjects; j++) {
+
+                    decimal entryFraction;
+                    if (aabbs[j].testRayIntersect(ray.point1, directionInverse, ray.maxFraction, entryFraction)) {
+                        expectedHitObjects.push_back(j);
+                        expectedClosestHitFraction = std::min(expectedClosestHitFraction, entryFraction);
+                    }
+                }
+
+                // Each object hit by the ray is reported once
+                SpatialHashGridRaycastCallback callback(grid, false);
+                grid.raycast(ray, callback, mAllocator);
+                std::sort(callback.hitObjects.begin(), callback.hitObjects.end());
+                rp3d_test(callback.hitObjects == expectedHitObjects);
+
+                // The closest hit is found when the ray is clipped by the hits
+                SpatialHashGridRaycastCallback clippingCallback(grid, true);
+                grid.raycast(ray, clippingCallback, mAllocator);
+                rp3d_test(clippingCallback.closestHitFraction == expectedClosestHitFraction);
+                rp3d_test(clippingCallback.hitObjects.size() <= callback.hitObjects.size());
+            }
+        }
+
+        /// Compare the overlapping bodies and the raycasts of two worlds that use the tree and the grid
+        void testWorld() {
+
+            PhysicsWorld::WorldSettings settings;
+            PhysicsWorld* treeWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            settings.broadPhaseAlgorithmType = BroadPhaseAlgorithmType::SPATIAL_HASH_GRID;
+            settings.broadPhaseGridCellSize = decimal(1.5);
+            PhysicsWorld* gridWorld = mPhysicsCommon.createPhysicsWorld(settings);
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.6));
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(50, 1, 50));
+
+            // A static ground (in the tree of the large objects), static boxes and dynamic bodies
+            std::vector<RigidBody*> treeBodies;
+            std::vector<RigidBody*> gridBodies;
+            for (PhysicsWorld* world : {treeWorld, gridWorld}) {
+
+                std::vector<RigidBody*>& bodies = world == treeWorld ? treeBodies : gridBodies;
+                RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+                ground->setType(BodyType::STATIC);
+                ground->addCollider(groundShape, Transform::identity());
+
+                for (int i=0; i < 200; i++) {
+
+                    RigidBody* body = world->createRigidBody(Transform::identity());
+                    body->setType(i % 5 == 0 ? BodyType::STATIC : BodyType::DYNAMIC);
+                    body->addCollider(i % 2 == 0 ? static_cast<CollisionShape*>(boxShape) : sphereShape, Transform::identity());
+                    bodies.push_back(body);
+                }
+            }
+
+            for (int step=0; step < 20; step++) {
+
+                // Move the bodies of both worlds to the same random positions
+                for (uint32 i=0; i < treeBodies.size(); i++) {
+
+                    if (treeBodies[i]->getType() == BodyType::STATIC && step > 0) continue;
+
+                    const Transform transform(Vector3(mRandom.random(-15, 15), mRandom.random(-1, 3), mRandom.random(-15, 15)), Quaternion::identity());
+                    treeBodies[i]->setTransform(transform);
+                    gridBodies[i]->setTransform(transform);
+                }
+
+                // Remove and add a collider of a body
+                if (step == 10) {
+                    for (std::vector<RigidBody*>* bodies : {&treeBodies, &gridBodies}) {
+                        (*bodies)[3]->removeCollider((*bodies)[3]->getCollider(0));
+                        (*bodies)[7]->addCollider(boxShape, Transform(Vector3(1, 0, 0), Quaternion::identity()));
+                    }
+                }
+
+                SpatialHashGridOverlapCallback treeCallback;
+                SpatialHashGridOverlapCallback gridCallback;
+                treeWorld->testOverlap(treeCallback);
+                gridWorld->testOverlap(gridCallback);
+                rp3d_test(!treeCallback.overlappingBodies.empty());
+                rp3d_test(treeCallback.overlappingBodies == gridCallback.overlappingBodies);
+
+                // The closest hit of a ray is the same in both worlds
+                for (int i=0; i < 10; i++) {
+
+                    const Ray ray(Vector3(mRandom.random(-20, 20), mRandom.random(-2, 5), mRandom.random(-20, 20)), Vector3(mRandom.random(-20, 20), mRandom.random(-2, 5), mRandom.random(-20, 20)));
+                    RaycastInfo treeRaycastInfo;
+                    RaycastInfo gridRaycastInfo;
+                    const bool isTreeHit = treeWorld->raycast(ray, treeRaycastInfo);
+                    const bool isGridHit = gridWorld->raycast(ray, gridRaycastInfo);
+                    rp3d_test(isTreeHit == isGridHit);
+                    if (isTreeHit && isGridHit) {
+                        rp3d_test(approxEqual(treeRaycastInfo.hitFraction, gridRaycastInfo.hitFraction));
+                    }
+                }
+
+                // The closest hits of a batch of rays are the same in both worlds
+                std::vector<Ray> rays;
+                for (int i=0; i < 16; i++) {
+                    rays.push_back(Ray(Vector3(mRandom.random(-20, 20), 6, mRandom.random(-20, 20)), Vector3(mRandom.random(-20, 20), -3, mRandom.random(-20, 20))));
+                }
+                RaycastInfo treeRaycastInfos[16];
+                RaycastInfo gridRaycastInfos[16];
+                const uint32 nbTreeHits = treeWorld->raycastBatch(rays.data(), 16, treeRaycastInfos);
+                const uint32 nbGridHits = gridWorld->raycastBatch(rays.data(), 16, gridRaycastInfos);
+                rp3d_test(nbTreeHits > 0);
+                rp3d_test(nbTreeHits == nbGridHits);
+                for (int i=0; i < 16; i++) {
+                    rp3d_test((treeRaycastInfos[i].collider == nullptr) == (gridRaycastInfos[i].collider == nullptr));
+                    rp3d_test(approxEqual(treeRaycastInfos[i].hitFraction, gridRaycastInfos[i].hitFraction));
+                }
+
+                // The AABB queries report the same colliders in both worlds
+                size_t nbReportedBodies = 0;
+                for (int i=0; i < 5; i++) {
+
+                    const Vector3 center(mRandom.random(-15, 15), mRandom.random(-1, 3), mRandom.random(-15, 15));
+                    const AABB aabb(center - Vector3(2, 2, 2), center + Vector3(2, 2, 2));
+                    SpatialHashGridAABBCallback treeAABBCallback;
+                    SpatialHashGridAABBCallback gridAABBCallback;
+                    treeWorld->testOverlap(aabb, treeAABBCallback);
+                    gridWorld->testOverlap(aabb, gridAABBCallback);
+                    rp3d_test(treeAABBCallback.bodies == gridAABBCallback.bodies);
+                    nbReportedBodies += treeAABBCallback.bodies.size();
+                }
+                rp3d_test(nbReportedBodies > 0);
+
+                // The static bodies overlap with the same bodies (including the other static bodies) in both worlds
+                for (uint32 i=0; i < treeBodies.size(); i += 5) {
+
+                    SpatialHashGridOverlapCallback treeBodyCallback;
+                    SpatialHashGridOverlapCallback gridBodyCallback;
+                    treeWorld->testOverlap(treeBodies[i], treeBodyCallback);
+                    gridWorld->testOverlap(gridBodies[i], gridBodyCallback);
+                    rp3d_test(treeBodyCallback.overlappingBodies == gridBodyCallback.overlappingBodies);
+
+                    // The queries of a snapshot of the world also use the grid
+                    SpatialHashGridOverlapCallback gridSnapshotCallback;
+                    gridWorld->beginQuerySnapshot();
+                    gridWorld->testOverlap(gridBodies[i], gridSnapshotCallback);
+                    gridWorld->endQuerySnapshot();
+                    rp3d_test(treeBodyCallback.overlappingBodies == gridSnapshotCallback.overlappingBodies);
+                }
+            }
+
+            // Simulate the world that uses the grid
+            for (int i=0; i < 30; i++) {
+                gridWorld->update(decimal(1.0) / decimal(60.0));
+            }
+            rp3d_test(gridBodies[1]->getTransform().getPosition().y > decimal(-1.0));
+
+            // The trees of the broad-phase are not used with the grid
+            rp3d_test(gridWorld->getBroadPhaseHeight() == 0);
+            rp3d_test(treeWorld->getBroadPhaseHeight() > 0);
+
+            mPhysicsCommon.destroyPhysicsWorld(treeWorld);
+            mPhysicsCommon.destroyPhysicsWorld(gridWorld);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+        }
+};
+
+}
+
+#endif
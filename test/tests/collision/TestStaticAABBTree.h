@@ -0,0 +1,375 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_STATIC_AABB_TREE_H
+#define TEST_STATIC_AABB_TREE_H
+
+// Libraries
+#include "Test.h"
+#include "TestHelpers.h"
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <vector>
+#include <algorithm>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+class StaticTreeRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+    public:
+
+        std::vector<int> mHitItems;
+
+        // Called when an item of a leaf node hit by a ray is found
+        virtual decimal raycastBroadPhaseShape(int32 itemData, const Ray& /*ray*/) override {
+            mHitItems.push_back(itemData);
+            return -1.0;
+        }
+
+        bool isHit(int itemData) const {
+            return std::find(mHitItems.begin(), mHitItems.end(), itemData) != mHitItems.end();
+        }
+};
+
+class StaticTreeClosestHitCallback : public DynamicAABBTreeRaycastCallback {
+
+    public:
+
+        const Array<AABB>& mAABBs;
+        int32 mClosestItem = -1;
+        decimal mClosestHitFraction = decimal(1.0);
+        uint32 mNbTestedItems = 0;
+
+        StaticTreeClosestHitCallback(const Array<AABB>& aabbs) : mAABBs(aabbs) {}
+
+        // Raycast the AABB of the item and clip the ray at the hit point
+        virtual decimal raycastBroadPhaseShape(int32 itemData, const Ray& ray) override {
+
+            mNbTestedItems++;
+
+            const Vector3 rayDirection = ray.point2 - ray.point1;
+            const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+            decimal hitFraction;
+            if (!mAABBs[itemData].testRayIntersect(ray.point1, rayDirectionInverse, ray.maxFraction, hitFraction)) return -1.0;
+
+            mClosestItem = itemData;
+            mClosestHitFraction = hitFraction;
+            return hitFraction;
+        }
+};
+
+// Class TestStaticAABBTree
+/**
+ * Unit test for the static AABB tree
+ */
+class TestStaticAABBTree : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultTestTreeAllocator mAllocator;
+
+        /// Pseudo-random generator
+        TestRandomGenerator mRandom;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestStaticAABBTree(const std::string& name): Test(name), mRandom(12345) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testEmptyAndSingleItem();
+            testOverlappingAndRaycast(false);
+            testOverlappingAndRaycast(true);
+            testQuantizedMemoryUsage();
+            testWideTreeHeight();
+            testSingleItemPerLeaf();
+            testClosestHitRaycast(false);
+            testClosestHitRaycast(true);
+        }
+
+        void testEmptyAndSingleItem() {
+
+            StaticAABBTree tree(mAllocator);
+
+            Array<AABB> aabbs(mAllocator);
+            Array<int32> data(mAllocator);
+            tree.build(aabbs, data);
+
+            rp3d_test(tree.getNbNodes() == 0);
+            rp3d_test(tree.getNbItems() == 0);
+            rp3d_test(tree.computeHeight() == 0);
+
+            Array<int32> overlapping(mAllocator);
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(-10, -10, -10), Vector3(10, 10, 10)), overlapping, mAllocator);
+            rp3d_test(overlapping.size() == 0);
+
+            aabbs.add(AABB(Vector3(-1, -1, -1), Vector3(1, 1, 1)));
+            data.add(7);
+            tree.build(aabbs, data);
+
+            rp3d_test(tree.getNbNodes() == 1);
+            rp3d_test(tree.getNbItems() == 1);
+            rp3d_test(tree.computeHeight() == 1);
+            rp3d_test(tree.getRootAABB().getMin() == Vector3(-1, -1, -1));
+
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(0, 0, 0), Vector3(2, 2, 2)), overlapping, mAllocator);
+            rp3d_test(overlapping.size() == 1);
+            rp3d_test(overlapping[0] == 7);
+
+            StaticTreeRaycastCallback callback;
+            tree.raycast(Ray(Vector3(-5, 0, 0), Vector3(5, 0, 0)), callback, mAllocator);
+            rp3d_test(callback.isHit(7));
+        }
+
+        void testOverlappingAndRaycast(bool isQuantized) {
+
+            const uint32 nbItems = 500;
+
+            // Create random AABBs
+            Array<AABB> aabbs(mAllocator, nbItems);
+            Array<int32> data(mAllocator, nbItems);
+            for (uint32 i=0; i < nbItems; i++) {
+                const Vector3 center(mRandom.random(-50, 50), mRandom.random(-50, 50), mRandom.random(-50, 50));
+                const Vector3 halfSize(mRandom.random(decimal(0.1), 2), mRandom.random(decimal(0.1), 2), mRandom.random(decimal(0.1), 2));
+                aabbs.add(AABB(center - halfSize, center + halfSize));
+                data.add(static_cast<int32>(i) * 2 + 1);
+            }
+
+            StaticAABBTree tree(mAllocator);
+            tree.build(aabbs, data, isQuantized);
+
+            rp3d_test(tree.getIsQuantized() == isQuantized);
+            rp3d_test(tree.getNbItems() == nbItems);
+            rp3d_test(tree.getNbNodes() < 2 * nbItems);
+            rp3d_test(tree.computeHeight() < 30);
+
+            // The root AABB must contain all the items
+            for (uint32 i=0; i < nbItems; i++) {
+                rp3d_test(tree.getRootAABB().contains(aabbs[i]));
+            }
+
+            // Overlapping queries must report every item overlapping with the AABB exactly once
+            for (uint32 q=0; q < 50; q++) {
+
+                const Vector3 center(mRandom.random(-50, 50), mRandom.random(-50, 50), mRandom.random(-50, 50));
+                const Vector3 halfSize(mRandom.random(1, 10), mRandom.random(1, 10), mRandom.random(1, 10));
+                const AABB queryAABB(center - halfSize, center + halfSize);
+
+                Array<int32> overlapping(mAllocator);
+                tree.reportAllShapesOverlappingWithAABB(queryAABB, overlapping, mAllocator);
+
+                std::vector<int32> sortedItems(overlapping.begin(), overlapping.end());
+                std::sort(sortedItems.begin(), sortedItems.end());
+                rp3d_test(std::adjacent_find(sortedItems.begin(), sortedItems.end()) == sortedItems.end());
+
+                for (uint32 i=0; i < nbItems; i++) {
+                    if (queryAABB.testCollision(aabbs[i])) {
+                        rp3d_test(std::binary_search(sortedItems.begin(), sortedItems.end(), data[i]));
+                    }
+                }
+            }
+
+            // Raycast queries must report every item hit by the ray
+            for (uint32 q=0; q < 50; q++) {
+
+                const Ray ray(Vector3(mRandom.random(-60, 60), mRandom.random(-60, 60), -60), Vector3(mRandom.random(-60, 60), mRandom.random(-60, 60), 60));
+                const Vector3 rayDirection = ray.point2 - ray.point1;
+                const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+
+                StaticTreeRaycastCallback callback;
+                tree.raycast(ray, callback, mAllocator);
+
+                for (uint32 i=0; i < nbItems; i++) {
+                    if (aabbs[i].testRayIntersect(ray.point1, rayDirectionInverse, ray.maxFraction)) {
+                        rp3d_test(callback.isHit(data[i]));
+                    }
+                }
+            }
+        }
+
+        /// Build a tree and a quantized tree with the same random items
+        void buildRandomTrees(StaticAABBTree& tree, StaticAABBTree& quantizedTree, uint32 nbItems) {
+
+            Array<AABB> aabbs(mAllocator, nbItems);
+            Array<int32> data(mAllocator, nbItems);
+            for (uint32 i=0; i < nbItems; i++) {
+                const Vector3 center(mRandom.random(-100, 100), mRandom.random(-100, 100), mRandom.random(-100, 100));
+                aabbs.add(AABB(center - Vector3(1, 1, 1), center + Vector3(1, 1, 1)));
+                data.add(static_cast<int32>(i));
+            }
+
+            tree.build(aabbs, data, false);
+            quantizedTree.build(aabbs, data, true);
+        }
+
+        void testQuantizedMemoryUsage() {
+
+            StaticAABBTree tree(mAllocator);
+            StaticAABBTree quantizedTree(mAllocator);
+            buildRandomTrees(tree, quantizedTree, 1000);
+
+            rp3d_test(quantizedTree.getNbItems() == tree.getNbItems());
+
+            // The quantized node has no padding and is half the size of an uncompressed binary node
+            rp3d_test(sizeof(StaticAABBTreeQuantizedNode) == 6 * sizeof(uint16) + sizeof(uint32));
+            rp3d_test(sizeof(StaticAABBTreeQuantizedNode) * 2 <= sizeof(StaticAABBTreeNode));
+
+            // The quantized nodes use less memory than the wide nodes of the unquantized tree
+            const size_t quantizedNodesSize = quantizedTree.getNbNodes() * sizeof(StaticAABBTreeQuantizedNode);
+            const size_t wideNodesSize = tree.getNbNodes() * sizeof(StaticAABBTreeWideNode);
+            rp3d_test(quantizedNodesSize < wideNodesSize);
+            rp3d_test(quantizedTree.getMemoryUsage() < tree.getMemoryUsage());
+        }
+
+        void testWideTreeHeight() {
+
+            StaticAABBTree tree(mAllocator);
+            StaticAABBTree quantizedTree(mAllocator);
+            buildRandomTrees(tree, quantizedTree, 1000);
+
+            // The wide tree has less levels than the binary tree of the quantized nodes
+            rp3d_test(tree.computeHeight() < quantizedTree.computeHeight());
+        }
+
+        void testSingleItemPerLeaf() {
+
+            const uint32 nbItems = 300;
+
+            Array<AABB> aabbs(mAllocator, nbItems);
+            Array<int32> data(mAllocator, nbItems);
+            for (uint32 i=0; i < nbItems; i++) {
+                const Vector3 center(mRandom.random(-30, 30), mRandom.random(-30, 30), mRandom.random(-30, 30));
+                aabbs.add(AABB(center - Vector3(1, 2, 1), center + Vector3(1, 2, 1)));
+                data.add(static_cast<int32>(i));
+            }
+
+            // With a single item per leaf, the queries report exactly the overlapping items
+            StaticAABBTree tree(mAllocator, 1);
+            tree.build(aabbs, data);
+
+            for (uint32 q=0; q < 50; q++) {
+
+                const Vector3 center(mRandom.random(-30, 30), mRandom.random(-30, 30), mRandom.random(-30, 30));
+                const AABB queryAABB(center - Vector3(3, 3, 3), center + Vector3(3, 3, 3));
+
+                Array<int32> overlapping(mAllocator);
+                tree.reportAllShapesOverlappingWithAABB(queryAABB, overlapping, mAllocator);
+
+                uint32 nbExpectedItems = 0;
+                for (uint32 i=0; i < nbItems; i++) {
+                    if (queryAABB.testCollision(aabbs[i])) nbExpectedItems++;
+                }
+
+                rp3d_test(overlapping.size() == nbExpectedItems);
+                for (uint32 i=0; i < overlapping.size(); i++) {
+                    rp3d_test(queryAABB.testCollision(aabbs[overlapping[i]]));
+                }
+            }
+        }
+
+        void testClosestHitRaycast(bool isQuantized) {
+
+            // ---------- Row of boxes along the ray ---------- //
+
+            const uint32 nbBoxes = 200;
+            Array<AABB> rowAABBs(mAllocator, nbBoxes);
+            Array<int32> rowData(mAllocator, nbBoxes);
+            for (uint32 i=0; i < nbBoxes; i++) {
+                rowAABBs.add(AABB(Vector3(decimal(2 * i), -1, -1), Vector3(decimal(2 * i + 1), 1, 1)));
+                rowData.add(static_cast<int32>(i));
+            }
+
+            StaticAABBTree rowTree(mAllocator);
+            rowTree.build(rowAABBs, rowData, isQuantized);
+
+            // The nodes are visited from front to back and therefore only the first leaves are tested
+            StaticTreeClosestHitCallback rowCallback(rowAABBs);
+            rowTree.raycast(Ray(Vector3(-10, 0, 0), Vector3(500, 0, 0)), rowCallback, mAllocator);
+            rp3d_test(rowCallback.mClosestItem == 0);
+            rp3d_test(rowCallback.mNbTestedItems < 8);
+
+            // Same thing in the other direction
+            StaticTreeClosestHitCallback reverseCallback(rowAABBs);
+            rowTree.raycast(Ray(Vector3(500, 0, 0), Vector3(-10, 0, 0)), reverseCallback, mAllocator);
+            rp3d_test(reverseCallback.mClosestItem == nbBoxes - 1);
+            rp3d_test(reverseCallback.mNbTestedItems < 8);
+
+            // ---------- Random boxes ---------- //
+
+            const uint32 nbItems = 500;
+            Array<AABB> aabbs(mAllocator, nbItems);
+            Array<int32> data(mAllocator, nbItems);
+            for (uint32 i=0; i < nbItems; i++) {
+                const Vector3 center(mRandom.random(-40, 40), mRandom.random(-40, 40), mRandom.random(-40, 40));
+                const Vector3 halfSize(mRandom.random(decimal(0.5), 3), mRandom.random(decimal(0.5), 3), mRandom.random(decimal(0.5), 3));
+                aabbs.add(AABB(center - halfSize, center + halfSize));
+                data.add(static_cast<int32>(i));
+            }
+
+            StaticAABBTree tree(mAllocator);
+            tree.build(aabbs, data, isQuantized);
+
+            // The closest hit must be the same as with a brute-force search
+            for (uint32 r=0; r < 50; r++) {
+
+                const Vector3 point1(mRandom.random(-100, 100), 100, mRandom.random(-100, 100));
+                const Vector3 point2(mRandom.random(-100, 100), -100, mRandom.random(-100, 100));
+                const Ray ray(point1, point2);
+
+                const Vector3 rayDirection = point2 - point1;
+                const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+                decimal expectedHitFraction = decimal(1.0);
+                int32 expectedItem = -1;
+                for (uint32 i=0; i < nbItems; i++) {
+                    decimal hitFraction;
+                    if (aabbs[i].testRayIntersect(point1, rayDirectionInverse, decimal(1.0), hitFraction) && hitFraction < expectedHitFraction) {
+                        expectedHitFraction = hitFraction;
+                        expectedItem = static_cast<int32>(i);
+                    }
+                }
+
+                StaticTreeClosestHitCallback callback(aabbs);
+                tree.raycast(ray, callback, mAllocator);
+
+                rp3d_test((callback.mClosestItem == -1) == (expectedItem == -1));
+                if (expectedItem != -1) {
+                    rp3d_test(callback.mClosestHitFraction == expectedHitFraction);
+                }
+            }
+        }
+ };
+
+}
+
+#endif
@@ -0,0 +1,308 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2024 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef TEST_SWEEP_AND_PRUNE_H
+#define TEST_SWEEP_AND_PRUNE_H
+
+// Libraries
+#include "Test.h"
+#include "TestHelpers.h"
+#include <reactphysics3d/collision/broadphase/SweepAndPrune.h>
+#include <reactphysics3d/engine/PhysicsCommon.h>
+#include <reactphysics3d/engine/PhysicsWorld.h>
+#include <vector>
+#include <algorithm>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class SweepAndPruneOverlapCallback
+/**
+ * Overlap callback that stores the pairs of entity IDs of the overlapping bodies
+ */
+class SweepAndPruneOverlapCallback : public OverlapCallback {
+
+    public:
+
+        std::vector<std::pair<uint32, uint32>> overlappingBodies;
+
+        virtual void onOverlap(CallbackData& callbackData) override {
+
+            for (uint32 i=0; i < callbackData.getNbOverlappingPairs(); i++) {
+
+                OverlapPair overlapPair = callbackData.getOverlappingPair(i);
+                const uint32 body1Id = overlapPair.getBody1()->getEntity().id;
+                const uint32 body2Id = overlapPair.getBody2()->getEntity().id;
+                overlappingBodies.push_back(std::make_pair(std::min(body1Id, body2Id), std::max(body1Id, body2Id)));
+            }
+            std::sort(overlappingBodies.begin(), overlappingBodies.end());
+        }
+};
+
+// Class TestSweepAndPrune
+/**
+ * Unit test for the sweep-and-prune broad-phase
+ */
+class TestSweepAndPrune : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultTestTreeAllocator mAllocator;
+
+        PhysicsCommon mPhysicsCommon;
+
+        /// Pseudo-random generator
+        TestRandomGenerator mRandom;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestSweepAndPrune(const std::string& name): Test(name), mRandom(4321) {
+
+        }
+
+        /// Return a random AABB (the objects are spread along the z axis)
+        AABB randomAABB() {
+            const Vector3 center(mRandom.random(-10, 10), mRandom.random(-10, 10), mRandom.random(-100, 100));
+            const Vector3 halfExtent(mRandom.random(decimal(0.5), 3), mRandom.random(decimal(0.5), 3), mRandom.random(decimal(0.5), 3));
+            return AABB(center - halfExtent, center + halfExtent);
+        }
+
+        /// Return the sorted pairs reported by the sweep-and-prune
+        std::vector<std::pair<int32, int32>> reportPairs(SweepAndPrune& sweepAndPrune) {
+
+            Array<Pair<int32, int32>> pairs(mAllocator);
+            sweepAndPrune.reportAllOverlappingPairs(pairs);
+
+            std::vector<std::pair<int32, int32>> sortedPairs;
+            for (uint32 i=0; i < pairs.size(); i++) {
+                sortedPairs.push_back(std::make_pair(std::min(pairs[i].first, pairs[i].second), std::max(pairs[i].first, pairs[i].second)));
+            }
+            std::sort(sortedPairs.begin(), sortedPairs.end());
+
+            return sortedPairs;
+        }
+
+        /// Return the sorted pairs expected with a brute-force test of the objects
+        std::vector<std::pair<int32, int32>> computeExpectedPairs(const std::vector<AABB>& aabbs, const std::vector<bool>& isUsed,
+                                                                  const std::vector<bool>& isStatic, const std::vector<bool>& isMoved) {
+
+            std::vector<std::pair<int32, int32>> pairs;
+            for (int32 i=0; i < int32(aabbs.size()); i++) {
+                for (int32 j=i+1; j < int32(aabbs.size()); j++) {
+
+                    if (!isUsed[i] || !isUsed[j]) continue;
+                    if (!isMoved[i] && !isMoved[j]) continue;
+                    if (isStatic[i] && isStatic[j]) continue;
+
+                    if (aabbs[i].testCollision(aabbs[j])) {
+                        pairs.push_back(std::make_pair(i, j));
+                    }
+                }
+            }
+
+            return pairs;
+        }
+
+        /// Run the tests
+        void run() {
+
+            testOverlappingPairs();
+            testWorld();
+        }
+
+        void testOverlappingPairs() {
+
+            SweepAndPrune sweepAndPrune(mAllocator);
+
+            // No object
+            rp3d_test(reportPairs(sweepAndPrune).empty());
+
+            const int32 nbObjects = 300;
+            std::vector<AABB> aabbs;
+            std::vector<bool> isUsed(nbObjects, true);
+            std::vector<bool> isStatic(nbObjects, false);
+            std::vector<bool> isMoved(nbObjects, true);
+            for (int32 i=0; i < nbObjects; i++) {
+                aabbs.push_back(randomAABB());
+                isStatic[i] = i % 4 == 0;
+                sweepAndPrune.addObject(i, aabbs[i], isStatic[i]);
+            }
+            rp3d_test(sweepAndPrune.getNbObjects() == uint32(nbObjects));
+
+            // All the new objects are tested
+            std::vector<std::pair<int32, int32>> pairs = reportPairs(sweepAndPrune);
+            rp3d_test(!pairs.empty());
+            rp3d_test(pairs == computeExpectedPairs(aabbs, isUsed, isStatic, isMoved));
+
+            // The objects are sorted along the axis where they are spread the most
+            rp3d_test(sweepAndPrune.getSweepAxis() == 2);
+
+            // Nothing has moved
+            rp3d_test(reportPairs(sweepAndPrune).empty());
+
+            for (int step=0; step < 10; step++) {
+
+                // Move some objects a little bit
+                std::fill(isMoved.begin(), isMoved.end(), false);
+                for (int32 i=0; i < nbObjects; i++) {
+
+                    if (isUsed[i] && i % 3 == step % 3) {
+                        const Vector3 translation(mRandom.random(-1, 1), mRandom.random(-1, 1), mRandom.random(-2, 2));
+                        aabbs[i] = AABB(aabbs[i].getMin() + translation, aabbs[i].getMax() + translation);
+                        sweepAndPrune.updateObject(i, aabbs[i]);
+                        sweepAndPrune.setIsObjectMoved(i);
+                        isMoved[i] = true;
+                    }
+                }
+
+                // Remove some objects and add them again (with the same ID) later
+                const int32 removedObject = (step * 37) % nbObjects;
+                if (isUsed[removedObject]) {
+                    sweepAndPrune.removeObject(removedObject);
+                    isUsed[removedObject] = false;
+                    isMoved[removedObject] = false;
+                    rp3d_test(!sweepAndPrune.hasObject(removedObject));
+                }
+                const int32 addedObject = ((step - 2) * 37) % nbObjects;
+                if (step >= 2 && !isUsed[addedObject]) {
+                    aabbs[addedObject] = randomAABB();
+                    sweepAndPrune.addObject(addedObject, aabbs[addedObject], isStatic[addedObject]);
+                    isUsed[addedObject] = true;
+                    isMoved[addedObject] = true;
+                }
+
+                rp3d_test(reportPairs(sweepAndPrune) == computeExpectedPairs(aabbs, isUsed, isStatic, isMoved));
+            }
+
+            // Object with a new ID larger than the previous ones
+            aabbs.push_back(AABB(Vector3(-50, -50, -150), Vector3(50, 50, 150)));
+            isUsed.push_back(true);
+            isStatic.push_back(false);
+            std::fill(isMoved.begin(), isMoved.end(), false);
+            isMoved.push_back(true);
+            sweepAndPrune.addObject(nbObjects, aabbs[nbObjects], false);
+            rp3d_test(sweepAndPrune.getAABB(nbObjects).getMax().z == decimal(150));
+            pairs = reportPairs(sweepAndPrune);
+            rp3d_test(pairs == computeExpectedPairs(aabbs, isUsed, isStatic, isMoved));
+            rp3d_test(pairs.size() == sweepAndPrune.getNbObjects() - 1);
+
+            // Spread the objects along the x axis
+            std::fill(isMoved.begin(), isMoved.end(), false);
+            for (int32 i=0; i < nbObjects; i++) {
+                if (isUsed[i]) {
+                    const Vector3 center = aabbs[i].getCenter();
+                    const Vector3 translation(center.z * 10 - center.x, 0, -center.z);
+                    aabbs[i] = AABB(aabbs[i].getMin() + translation, aabbs[i].getMax() + translation);
+                    sweepAndPrune.updateObject(i, aabbs[i]);
+                    sweepAndPrune.setIsObjectMoved(i);
+                    isMoved[i] = true;
+                }
+            }
+            rp3d_test(reportPairs(sweepAndPrune) == computeExpectedPairs(aabbs, isUsed, isStatic, isMoved));
+            rp3d_test(sweepAndPrune.getSweepAxis() == 0);
+        }
+
+        /// Compare the overlapping bodies of two worlds that use the two broad-phase algorithms
+        void testWorld() {
+
+            PhysicsWorld::WorldSettings settings;
+            PhysicsWorld* treeWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            settings.broadPhaseAlgorithmType = BroadPhaseAlgorithmType::SWEEP_AND_PRUNE;
+            PhysicsWorld* sweepAndPruneWorld = mPhysicsCommon.createPhysicsWorld(settings);
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.6));
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(50, 1, 50));
+
+            // A static ground, static boxes and dynamic bodies
+            std::vector<RigidBody*> treeBodies;
+            std::vector<RigidBody*> sweepAndPruneBodies;
+            for (PhysicsWorld* world : {treeWorld, sweepAndPruneWorld}) {
+
+                std::vector<RigidBody*>& bodies = world == treeWorld ? treeBodies : sweepAndPruneBodies;
+                RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+                ground->setType(BodyType::STATIC);
+                ground->addCollider(groundShape, Transform::identity());
+
+                for (int i=0; i < 200; i++) {
+
+                    RigidBody* body = world->createRigidBody(Transform::identity());
+                    body->setType(i % 5 == 0 ? BodyType::STATIC : BodyType::DYNAMIC);
+                    body->addCollider(i % 2 == 0 ? static_cast<CollisionShape*>(boxShape) : sphereShape, Transform::identity());
+                    bodies.push_back(body);
+                }
+            }
+
+            for (int step=0; step < 20; step++) {
+
+                // Move the bodies of both worlds to the same random positions
+                for (uint32 i=0; i < treeBodies.size(); i++) {
+
+                    if (treeBodies[i]->getType() == BodyType::STATIC && step > 0) continue;
+
+                    const Transform transform(Vector3(mRandom.random(-15, 15), mRandom.random(-1, 3), mRandom.random(-15, 15)), Quaternion::identity());
+                    treeBodies[i]->setTransform(transform);
+                    sweepAndPruneBodies[i]->setTransform(transform);
+                }
+
+                // Remove and add a collider of a body
+                if (step == 10) {
+                    for (std::vector<RigidBody*>* bodies : {&treeBodies, &sweepAndPruneBodies}) {
+                        (*bodies)[3]->removeCollider((*bodies)[3]->getCollider(0));
+                        (*bodies)[7]->addCollider(boxShape, Transform(Vector3(1, 0, 0), Quaternion::identity()));
+                    }
+                }
+
+                SweepAndPruneOverlapCallback treeCallback;
+                SweepAndPruneOverlapCallback sweepAndPruneCallback;
+                treeWorld->testOverlap(treeCallback);
+                sweepAndPruneWorld->testOverlap(sweepAndPruneCallback);
+                rp3d_test(!treeCallback.overlappingBodies.empty());
+                rp3d_test(treeCallback.overlappingBodies == sweepAndPruneCallback.overlappingBodies);
+            }
+
+            // Simulate the world that uses the sweep-and-prune
+            for (int i=0; i < 30; i++) {
+                sweepAndPruneWorld->update(decimal(1.0) / decimal(60.0));
+            }
+            rp3d_test(sweepAndPruneBodies[1]->getTransform().getPosition().y > decimal(-1.0));
+
+            mPhysicsCommon.destroyPhysicsWorld(treeWorld);
+            mPhysicsCommon.destroyPhysicsWorld(sweepAndPruneWorld);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+        }
+};
+
+}
+
+#endif
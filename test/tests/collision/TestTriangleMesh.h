@@ -45,6 +45,7 @@ class TestTriangleMesh : public Test {
 
         PhysicsCommon mPhysicsCommon;
         TriangleMesh* mTriangleMesh;
+        TriangleMesh* mQuantizedTriangleMesh;
 
     public :
 
@@ -90,6 +91,7 @@ class TestTriangleMesh : public Test {
             // Add the triangle vertex array of the subpart to the triangle mesh
             std::vector<rp3d::Message> messages;
             mTriangleMesh = mPhysicsCommon.createTriangleMesh(triangleVertexArray, messages);
+            mQuantizedTriangleMesh = mPhysicsCommon.createTriangleMesh(triangleVertexArray, messages, true);
         }
 
         /// Destructor
@@ -100,6 +102,7 @@ class TestTriangleMesh : public Test {
         /// Run the tests
         void run() {
             test();
+            testQuantizedAABBTree();
         }
 
         void test() {
@@ -139,6 +142,19 @@ class TestTriangleMesh : public Test {
             rp3d_test(Vector3::approxEqual(mTriangleMesh->getBounds().getMin(), Vector3(-2.5, 0 ,-2.5)));
             rp3d_test(Vector3::approxEqual(mTriangleMesh->getBounds().getMax(), Vector3(2.5, 0, 2.5)));
         }
+
+        void testQuantizedAABBTree() {
+
+            rp3d_test(!mTriangleMesh->getIsAABBTreeQuantized());
+            rp3d_test(mQuantizedTriangleMesh->getIsAABBTreeQuantized());
+
+            rp3d_test(mQuantizedTriangleMesh->getNbTriangles() == 50);
+            rp3d_test(Vector3::approxEqual(mQuantizedTriangleMesh->getBounds().getMin(), Vector3(-2.5, 0 ,-2.5)));
+            rp3d_test(Vector3::approxEqual(mQuantizedTriangleMesh->getBounds().getMax(), Vector3(2.5, 0, 2.5)));
+
+            // The quantized tree must use less memory than the non-quantized one
+            rp3d_test(mQuantizedTriangleMesh->getAABBTreeMemoryUsage() < mTriangleMesh->getAABBTreeMemoryUsage());
+        }
  };
 
 }
@@ -31,8 +31,12 @@
 #include "Test.h"
 #include <reactphysics3d/constraint/ContactPoint.h>
 #include <reactphysics3d/collision/ContactManifold.h>
+#include <reactphysics3d/collision/narrowphase/CollisionDispatch.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/engine/OverlappingPairs.h>
 #include <map>
 #include <vector>
+#include <atomic>
 
 /// Reactphysics3D namespace
 namespace reactphysics3d {
@@ -212,6 +216,66 @@ class WorldCollisionCallback : public CollisionCallback
         }
 };
 
+/// Event listener that stores the contacts of the world update
+class WorldEventListener : public EventListener {
+
+    public:
+
+        WorldCollisionCallback collisionCallback;
+
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+            collisionCallback.onContact(callbackData);
+        }
+};
+
+/// Narrow-phase batch used to run the narrow-phase algorithms of a world on given pairs of shapes
+class NarrowPhaseTestBatch {
+
+    private:
+
+        MemoryAllocator& mAllocator;
+        ColliderComponents mColliderComponents;
+        BodyComponents mBodyComponents;
+        RigidBodyComponents mRigidBodyComponents;
+        Set<bodypair> mNoCollisionPairs;
+        OverlappingPairs mOverlappingPairs;
+
+    public:
+
+        NarrowPhaseInfoBatch batch;
+
+        NarrowPhaseTestBatch(PhysicsWorld& world)
+            : mAllocator(world.getMemoryManager().getHeapAllocator()), mColliderComponents(mAllocator),
+              mBodyComponents(mAllocator), mRigidBodyComponents(mAllocator), mNoCollisionPairs(mAllocator),
+              mOverlappingPairs(world.getMemoryManager(), mColliderComponents, mBodyComponents, mRigidBodyComponents,
+                                mNoCollisionPairs, world.getCollisionDispatch()),
+              batch(mOverlappingPairs, mAllocator) {
+
+        }
+
+        MemoryAllocator& getAllocator() {
+            return mAllocator;
+        }
+
+        void addTest(CollisionShape* shape1, CollisionShape* shape2, const Transform& transform1, const Transform& transform2,
+                     LastFrameCollisionInfo* lastFrameInfo) {
+            batch.addNarrowPhaseInfo(batch.getNbObjects(), Entity(0, 0), Entity(0, 0), shape1, shape2, transform1, transform2,
+                                     true, lastFrameInfo, mAllocator);
+        }
+
+        // Update the last frame collision infos after the narrow-phase (as the collision detection does) and clear the batch
+        void endFrame() {
+
+            for (uint32 i=0; i < batch.getNbObjects(); i++) {
+                batch.lastFrameCollisionInfos[i]->wasColliding = batch.isColliding[i];
+                batch.lastFrameCollisionInfos[i]->isValid = true;
+                batch.resetContactPoints(i);
+            }
+
+            batch.clear();
+        }
+};
+
 /// Overlap callback
 class WorldOverlapCallback : public OverlapCallback {
 
@@ -254,6 +318,109 @@ class WorldOverlapCallback : public OverlapCallback {
 		}
 };
 
+// Class SnapshotOverlapCallback
+/**
+ * Overlap callback that counts the overlapping pairs reported by a query
+ */
+class SnapshotOverlapCallback : public OverlapCallback {
+
+    public:
+
+        uint32 nbOverlappingPairs = 0;
+
+        virtual void onOverlap(CallbackData& callbackData) override {
+            nbOverlappingPairs += callbackData.getNbOverlappingPairs();
+        }
+};
+
+// Class SnapshotAABBCallback
+/**
+ * AABB query callback that counts the reported colliders
+ */
+class SnapshotAABBCallback : public AABBQueryCallback {
+
+    public:
+
+        uint32 nbColliders = 0;
+
+        virtual void notifyOverlappingCollider(Collider* /*collider*/) override {
+            nbColliders++;
+        }
+};
+
+// Class SnapshotRaycastCallback
+/**
+ * Raycast callback that keeps the closest hit of a ray
+ */
+class SnapshotRaycastCallback : public RaycastCallback {
+
+    public:
+
+        decimal closestHitFraction = decimal(1.0);
+        uint32 nbHits = 0;
+
+        virtual decimal notifyRaycastHit(const RaycastInfo& raycastInfo) override {
+            nbHits++;
+            closestHitFraction = std::min(closestHitFraction, raycastInfo.hitFraction);
+            return raycastInfo.hitFraction;
+        }
+};
+
+// Class QuerySnapshotTask
+/**
+ * Task that runs the queries of a query snapshot of a world on the threads of a task
+ * scheduler and counts the results that are different from the expected ones
+ */
+class QuerySnapshotTask : public TaskScheduler::ParallelTask {
+
+    public:
+
+        PhysicsWorld& world;
+        const std::vector<RigidBody*>& bodies;
+        const std::vector<uint32>& expectedNbOverlappingPairs;
+        const Ray& ray;
+        decimal expectedHitFraction;
+        const AABB& aabb;
+        uint32 expectedNbAABBColliders;
+        std::atomic<uint32> nbErrors;
+
+        QuerySnapshotTask(PhysicsWorld& world, const std::vector<RigidBody*>& bodies, const std::vector<uint32>& expectedNbOverlappingPairs,
+                          const Ray& ray, decimal expectedHitFraction, const AABB& aabb, uint32 expectedNbAABBColliders)
+            : world(world), bodies(bodies), expectedNbOverlappingPairs(expectedNbOverlappingPairs), ray(ray),
+              expectedHitFraction(expectedHitFraction), aabb(aabb), expectedNbAABBColliders(expectedNbAABBColliders), nbErrors(0) {}
+
+        virtual void execute(uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) override {
+
+            for (uint32 i=startIndex; i < endIndex; i++) {
+
+                const uint32 bodyIndex = i % static_cast<uint32>(bodies.size());
+
+                switch (i % 3) {
+
+                    case 0: {
+                        SnapshotOverlapCallback callback;
+                        world.testOverlap(bodies[bodyIndex], callback);
+                        if (callback.nbOverlappingPairs != expectedNbOverlappingPairs[bodyIndex]) nbErrors++;
+                        if (world.testOverlap(bodies[bodyIndex], bodies[0]) != (bodyIndex == 0 ? false : bodyIndex == 1)) nbErrors++;
+                        break;
+                    }
+                    case 1: {
+                        SnapshotRaycastCallback callback;
+                        world.raycast(ray, &callback);
+                        if (callback.nbHits == 0 || std::abs(callback.closestHitFraction - expectedHitFraction) > decimal(0.0001)) nbErrors++;
+                        break;
+                    }
+                    default: {
+                        SnapshotAABBCallback callback;
+                        world.testOverlap(aabb, callback);
+                        if (callback.nbColliders != expectedNbAABBColliders) nbErrors++;
+                        break;
+                    }
+                }
+            }
+        }
+};
+
 // Class TestWorldQueries
 /**
  * Unit test for the world queries
@@ -524,6 +691,12 @@ class TestWorldQueries : public Test {
             testConvexMeshVsConvexMeshCollision();
             testConvexMeshVsCapsuleCollision();
             testConvexMeshVsConcaveMeshCollision();
+
+            testQuerySnapshot();
+            testQuerySnapshotWorldQueryColliders();
+            testStaticAndDynamicBroadPhaseTrees();
+            testConcaveTrianglesCache();
+            testSeparationNearMargin();
         }
 
 		void testNoCollisions() {
@@ -2964,6 +3137,306 @@ class TestWorldQueries : public Test {
             mCapsuleBody1->setTransform(initTransform1);
             mConcaveMeshBody->setTransform(initTransform2);
         }
+
+        void testQuerySnapshot() {
+
+            Transform initTransformBox1 = mBoxBody1->getTransform();
+            Transform initTransformSphere1 = mSphereBody1->getTransform();
+            Transform initTransformConcave = mConcaveMeshBody->getTransform();
+
+            // The first sphere is on the concave mesh and the first box overlaps with the second sphere
+            mBoxBody1->setTransform(Transform(Vector3(20, 20, 7), Quaternion::identity()));
+            mSphereBody1->setTransform(Transform(Vector3(10, 22.98f, 50), Quaternion::identity()));
+            mConcaveMeshBody->setTransform(Transform(Vector3(10, 20, 50), Quaternion::identity()));
+
+            std::vector<RigidBody*> bodies = {mSphereBody1, mConcaveMeshBody, mBoxBody1, mSphereBody2, mCapsuleBody1};
+            const Ray ray(Vector3(10, 40, 50), Vector3(10, 0, 50));
+            const AABB aabb(Vector3(5, 15, 45), Vector3(15, 30, 55));
+
+            // Compute the expected results with the queries outside of a snapshot
+            std::vector<uint32> expectedNbOverlappingPairs;
+            for (uint32 i=0; i < bodies.size(); i++) {
+                SnapshotOverlapCallback overlapCallback;
+                mWorld->testOverlap(bodies[i], overlapCallback);
+                expectedNbOverlappingPairs.push_back(overlapCallback.nbOverlappingPairs);
+            }
+            rp3d_test(expectedNbOverlappingPairs[0] == 1);
+            rp3d_test(expectedNbOverlappingPairs[1] == 1);
+            rp3d_test(expectedNbOverlappingPairs[2] == 1);
+            rp3d_test(expectedNbOverlappingPairs[3] == 1);
+            rp3d_test(expectedNbOverlappingPairs[4] == 0);
+
+            SnapshotRaycastCallback raycastCallback;
+            mWorld->raycast(ray, &raycastCallback);
+            rp3d_test(raycastCallback.nbHits > 0);
+            rp3d_test(approxEqual(raycastCallback.closestHitFraction, decimal(0.3505), decimal(0.001)));
+
+            SnapshotAABBCallback aabbCallback;
+            mWorld->testOverlap(aabb, aabbCallback);
+            rp3d_test(aabbCallback.nbColliders == 2);
+
+            // The collision detection must not be used during a snapshot (the queries must give the same results)
+            mWorld->beginQuerySnapshot();
+            rp3d_test(mWorld->isQuerySnapshotActive());
+
+            for (uint32 i=0; i < bodies.size(); i++) {
+                SnapshotOverlapCallback overlapCallback;
+                mWorld->testOverlap(bodies[i], overlapCallback);
+                rp3d_test(overlapCallback.nbOverlappingPairs == expectedNbOverlappingPairs[i]);
+            }
+            rp3d_test(mWorld->testOverlap(mSphereBody1, mConcaveMeshBody));
+            rp3d_test(mWorld->testOverlap(mSphereBody2, mBoxBody1));
+            rp3d_test(!mWorld->testOverlap(mSphereBody1, mBoxBody1));
+
+            // Run the queries concurrently on multiple threads
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(4);
+
+            QuerySnapshotTask task(*mWorld, bodies, expectedNbOverlappingPairs, ray, raycastCallback.closestHitFraction,
+                                   aabb, aabbCallback.nbColliders);
+            TaskScheduler::run(scheduler, task, 600, 4);
+            rp3d_test(task.nbErrors == 0);
+
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+
+            mWorld->endQuerySnapshot();
+            rp3d_test(!mWorld->isQuerySnapshotActive());
+
+            // Reset the init transforms
+            mBoxBody1->setTransform(initTransformBox1);
+            mSphereBody1->setTransform(initTransformSphere1);
+            mConcaveMeshBody->setTransform(initTransformConcave);
+        }
+
+        void testQuerySnapshotWorldQueryColliders() {
+
+            // The colliders that are not world query colliders must be skipped by the queries of a snapshot
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            RigidBody* body1 = world->createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+            body1->addCollider(mSphereShape1, Transform::identity());
+
+            RigidBody* body2 = world->createRigidBody(Transform(Vector3(2, 0, 0), Quaternion::identity()));
+            Collider* collider2 = body2->addCollider(mSphereShape1, Transform::identity());
+            collider2->setIsWorldQueryCollider(false);
+
+            RigidBody* body3 = world->createRigidBody(Transform(Vector3(-2, 0, 0), Quaternion::identity()));
+            body3->addCollider(mSphereShape1, Transform::identity());
+
+            const AABB aabb(Vector3(-1, -1, -1), Vector3(1, 1, 1));
+
+            for (int i=0; i < 2; i++) {
+
+                // The first queries are done outside of a snapshot and the second ones inside of a snapshot
+                if (i == 1) {
+                    world->beginQuerySnapshot();
+                }
+
+                SnapshotOverlapCallback overlapCallback1;
+                world->testOverlap(body1, overlapCallback1);
+                rp3d_test(overlapCallback1.nbOverlappingPairs == 1);
+
+                SnapshotOverlapCallback overlapCallback2;
+                world->testOverlap(body2, overlapCallback2);
+                rp3d_test(overlapCallback2.nbOverlappingPairs == 0);
+
+                rp3d_test(world->testOverlap(body1, body3));
+                rp3d_test(!world->testOverlap(body1, body2));
+
+                SnapshotAABBCallback aabbCallback;
+                world->testOverlap(aabb, aabbCallback);
+                rp3d_test(aabbCallback.nbColliders == 2);
+            }
+
+            world->endQuerySnapshot();
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testStaticAndDynamicBroadPhaseTrees() {
+
+            // The colliders of the static bodies are in a separate tree of the broad-phase
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            RigidBody* staticBody1 = world->createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+            staticBody1->setType(BodyType::STATIC);
+            staticBody1->addCollider(mBoxShape1, Transform::identity());
+
+            RigidBody* staticBody2 = world->createRigidBody(Transform(Vector3(5, 0, 0), Quaternion::identity()));
+            staticBody2->addCollider(mBoxShape1, Transform::identity());
+            staticBody2->setType(BodyType::STATIC);
+
+            RigidBody* dynamicBody = world->createRigidBody(Transform(Vector3(0, 5.5, 0), Quaternion::identity()));
+            dynamicBody->addCollider(mSphereShape1, Transform::identity());
+
+            world->update(decimal(1.0) / decimal(60.0));
+
+            // The pairs of static bodies are only computed for the world queries
+            rp3d_test(world->testOverlap(staticBody1, staticBody2));
+            rp3d_test(world->testOverlap(staticBody1, dynamicBody));
+            rp3d_test(!world->testOverlap(staticBody2, dynamicBody));
+
+            // The closest hit must be found among the colliders of the two trees (the sphere is above the static box)
+            const decimal expectedHitFraction = (decimal(20.0) - (dynamicBody->getTransform().getPosition().y + decimal(3.0))) / decimal(40.0);
+            SnapshotRaycastCallback raycastCallback;
+            world->raycast(Ray(Vector3(0, 20, 0), Vector3(0, -20, 0)), &raycastCallback);
+            rp3d_test(raycastCallback.nbHits > 0);
+            rp3d_test(approxEqual(raycastCallback.closestHitFraction, expectedHitFraction, decimal(0.001)));
+
+            // An AABB query reports the colliders of the two trees
+            SnapshotAABBCallback aabbCallback;
+            world->testOverlap(AABB(Vector3(-1, -1, -1), Vector3(1, 10, 1)), aabbCallback);
+            rp3d_test(aabbCallback.nbColliders == 2);
+
+            // The wide tree of the static colliders is only rebuilt after some updates without a change
+            // of the static colliders but the queries must give the same results before and after
+            for (uint32 i=0; i < 2; i++) {
+
+                SnapshotRaycastCallback staticRaycastCallback;
+                world->raycast(Ray(Vector3(5, 20, 0), Vector3(5, -20, 0)), &staticRaycastCallback);
+                rp3d_test(approxEqual(staticRaycastCallback.closestHitFraction, decimal(0.425), decimal(0.001)));
+
+                SnapshotAABBCallback staticAABBCallback;
+                world->testOverlap(AABB(Vector3(4, -1, -1), Vector3(6, 1, 1)), staticAABBCallback);
+                rp3d_test(staticAABBCallback.nbColliders == 1);
+
+                for (uint32 j=0; j < 10; j++) {
+                    world->update(decimal(1.0) / decimal(60.0));
+                }
+            }
+            rp3d_test(world->testOverlap(staticBody1, staticBody2));
+
+            // The colliders are moved to the other tree when the type of the body changes
+            staticBody2->setType(BodyType::DYNAMIC);
+            rp3d_test(world->testOverlap(staticBody1, staticBody2));
+            staticBody2->setType(BodyType::STATIC);
+            rp3d_test(world->testOverlap(staticBody1, staticBody2));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testConcaveTrianglesCache() {
+
+            // The triangles of the concave mesh overlapping with the sphere are cached
+            // in the overlapping pair and must follow the sphere and the concave mesh scale
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+
+            RigidBody* meshBody = world->createRigidBody(Transform::identity());
+            meshBody->setType(BodyType::STATIC);
+            meshBody->addCollider(mConcaveMeshShape, Transform::identity());
+
+            RigidBody* sphereBody = world->createRigidBody(Transform(Vector3(0, decimal(0.4), 0), Quaternion::identity()));
+            sphereBody->setType(BodyType::KINEMATIC);
+            sphereBody->addCollider(sphereShape, Transform::identity());
+
+            world->update(decimal(1.0) / decimal(60.0));
+            rp3d_test(world->testOverlap(sphereBody, meshBody));
+
+            // Small motion inside the cached region
+            sphereBody->setTransform(Transform(Vector3(decimal(0.3), decimal(0.4), decimal(0.3)), Quaternion::identity()));
+            rp3d_test(world->testOverlap(sphereBody, meshBody));
+            sphereBody->setTransform(Transform(Vector3(decimal(0.3), decimal(0.6), 0), Quaternion::identity()));
+            rp3d_test(!world->testOverlap(sphereBody, meshBody));
+
+            // Motion out of the cached region
+            sphereBody->setTransform(Transform(Vector3(0, 2, 0), Quaternion::identity()));
+            rp3d_test(!world->testOverlap(sphereBody, meshBody));
+            sphereBody->setTransform(Transform(Vector3(2, decimal(0.4), -2), Quaternion::identity()));
+            rp3d_test(world->testOverlap(sphereBody, meshBody));
+
+            // The cached triangles must be computed again when the scale of the concave mesh changes
+            sphereBody->setTransform(Transform(Vector3(1, decimal(0.4), 1), Quaternion::identity()));
+            rp3d_test(world->testOverlap(sphereBody, meshBody));
+            mConcaveMeshShape->setScale(Vector3(decimal(0.3), 1, decimal(0.3)));
+            rp3d_test(!world->testOverlap(sphereBody, meshBody));
+            mConcaveMeshShape->setScale(Vector3(1, 1, 1));
+            rp3d_test(world->testOverlap(sphereBody, meshBody));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
+
+        void testSeparationNearMargin() {
+
+            // The GJK algorithm first tests the separating axis of the previous frame for groups of
+            // pairs. The result must be the same as the exact distance between the shapes
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CapsuleShape* capsuleShape = mPhysicsCommon.createCapsuleShape(decimal(0.5), decimal(1.0));
+
+            const Quaternion boxOrientation = Quaternion::fromEulerAngles(decimal(0.3), decimal(-0.5), decimal(0.7));
+            RigidBody* boxBody = world->createRigidBody(Transform(Vector3::zero(), boxOrientation));
+            boxBody->setType(BodyType::STATIC);
+            boxBody->addCollider(boxShape, Transform::identity());
+
+            // Closest points of the box (face, edge and corner) and outward directions in local-space of the box
+            const Vector3 boxPoints[3] = {Vector3(1, 0, 0), Vector3(1, 1, 0), Vector3(1, -1, 1)};
+            const decimal distances[4] = {decimal(0.4), decimal(0.49), decimal(0.51), decimal(0.6)};
+
+            std::vector<RigidBody*> sphereBodies;
+            for (uint32 p=0; p < 3; p++) {
+                for (uint32 d=0; d < 4; d++) {
+                    const Vector3 center = boxPoints[p] + boxPoints[p].getUnit() * distances[d];
+                    RigidBody* sphereBody = world->createRigidBody(Transform(boxOrientation * center, Quaternion::identity()));
+                    sphereBody->setType(BodyType::KINEMATIC);
+                    sphereBody->addCollider(sphereShape, Transform::identity());
+                    sphereBodies.push_back(sphereBody);
+                }
+            }
+
+            // Capsules along the y axis of the box
+            RigidBody* capsuleBodyOverlap = world->createRigidBody(Transform(boxOrientation * Vector3(0, decimal(1.98), 0), boxOrientation));
+            capsuleBodyOverlap->setType(BodyType::KINEMATIC);
+            capsuleBodyOverlap->addCollider(capsuleShape, Transform::identity());
+            RigidBody* capsuleBodySeparated = world->createRigidBody(Transform(boxOrientation * Vector3(0, decimal(-2.02), 0), boxOrientation));
+            capsuleBodySeparated->setType(BodyType::KINEMATIC);
+            capsuleBodySeparated->addCollider(capsuleShape, Transform::identity());
+
+            world->update(decimal(1.0) / decimal(60.0));
+
+            // Test the pairs twice to also use the separating axes of the first test
+            for (uint32 i=0; i < 2; i++) {
+
+                for (uint32 p=0; p < 3; p++) {
+                    for (uint32 d=0; d < 4; d++) {
+                        rp3d_test(world->testOverlap(sphereBodies[p * 4 + d], boxBody) == (distances[d] < decimal(0.5)));
+                    }
+                }
+
+                rp3d_test(world->testOverlap(capsuleBodyOverlap, boxBody));
+                rp3d_test(!world->testOverlap(capsuleBodySeparated, boxBody));
+            }
+
+            // Run the sphere vs convex polyhedron algorithm of the world on the same pairs to make sure that
+            // the separated pairs exit with the SIMD test of their cached separating axis
+            NarrowPhaseTestBatch testBatch(*world);
+            SphereVsConvexPolyhedronAlgorithm* algorithm = world->getCollisionDispatch().getSphereVsConvexPolyhedronAlgorithm();
+            LastFrameCollisionInfo lastFrameInfos[12];
+            for (uint32 i=0; i < 2; i++) {
+
+                for (uint32 j=0; j < 12; j++) {
+                    testBatch.addTest(sphereShape, boxShape, sphereBodies[j]->getTransform(), boxBody->getTransform(), &lastFrameInfos[j]);
+                }
+                testBatch.batch.allocateContactPoints();
+                algorithm->testCollision(testBatch.batch, 0, 12, false, testBatch.getAllocator());
+
+                for (uint32 p=0; p < 3; p++) {
+                    for (uint32 d=0; d < 4; d++) {
+                        const bool isSeparated = distances[d] > decimal(0.5);
+                        rp3d_test(testBatch.batch.isColliding[p * 4 + d] == !isSeparated);
+                        rp3d_test(lastFrameInfos[p * 4 + d].gjkWasSeparatedAlongCachedAxis == isSeparated);
+                    }
+                }
+
+                testBatch.endFrame();
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyCapsuleShape(capsuleShape);
+        }
  };
 
 }
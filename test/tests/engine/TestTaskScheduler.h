@@ -0,0 +1,616 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2016 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_TASK_SCHEDULER_H
+#define TEST_TASK_SCHEDULER_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/memory/MemoryManager.h>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class CountItemsTask
+/**
+ * Task that counts how many times each item has been processed
+ */
+class CountItemsTask : public TaskScheduler::ParallelTask {
+
+    public:
+
+        std::atomic<uint32>* counters;
+        std::atomic<uint32> nbInvalidThreadIndices;
+        uint32 nbThreads;
+        TaskScheduler* nestedScheduler = nullptr;
+        std::atomic<uint32> nbNestedItems;
+
+        CountItemsTask(std::atomic<uint32>* counters, uint32 nbThreads)
+            : counters(counters), nbInvalidThreadIndices(0), nbThreads(nbThreads), nbNestedItems(0) {}
+
+        virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override {
+
+            if (threadIndex >= nbThreads) nbInvalidThreadIndices++;
+
+            for (uint32 i=startIndex; i < endIndex; i++) {
+                counters[i]++;
+            }
+
+            // Run a nested task (it must be executed serially by the same thread)
+            if (nestedScheduler != nullptr) {
+
+                CountItemsTask nestedTask(counters, nbThreads);
+                nestedScheduler->parallelFor(nestedTask, endIndex - startIndex, 1);
+                nbNestedItems += endIndex - startIndex;
+            }
+        }
+};
+
+// Class AllocateMemoryTask
+/**
+ * Task that allocates memory with the allocators of the threads of a memory manager
+ * and with the shared single frame allocator
+ */
+class AllocateMemoryTask : public TaskScheduler::ParallelTask {
+
+    public:
+
+        MemoryManager& memoryManager;
+        std::atomic<uint32> nbCorruptedItems;
+
+        AllocateMemoryTask(MemoryManager& memoryManager) : memoryManager(memoryManager), nbCorruptedItems(0) {}
+
+        virtual void execute(uint32 startIndex, uint32 endIndex, uint32 threadIndex) override {
+
+            MemoryAllocator& poolAllocator = memoryManager.getThreadPoolAllocator(threadIndex);
+            MemoryAllocator& threadFrameAllocator = memoryManager.getThreadFrameAllocator(threadIndex);
+            MemoryAllocator& frameAllocator = memoryManager.getSingleFrameAllocator();
+
+            for (uint32 i=startIndex; i < endIndex; i++) {
+
+                // Allocate memory units of different sizes and write the item index in them
+                const size_t size = sizeof(uint32) * (1 + i % 100);
+                uint32* poolMemory = static_cast<uint32*>(poolAllocator.allocate(size));
+                uint32* threadFrameMemory = static_cast<uint32*>(threadFrameAllocator.allocate(size));
+                uint32* frameMemory = static_cast<uint32*>(frameAllocator.allocate(size));
+                const size_t nbValues = size / sizeof(uint32);
+                for (size_t v=0; v < nbValues; v++) {
+                    poolMemory[v] = i;
+                    threadFrameMemory[v] = i;
+                    frameMemory[v] = i;
+                }
+
+                // Another thread must not have written in the same memory
+                for (size_t v=0; v < nbValues; v++) {
+                    if (poolMemory[v] != i || threadFrameMemory[v] != i || frameMemory[v] != i) nbCorruptedItems++;
+                }
+
+                poolAllocator.release(poolMemory, size);
+                threadFrameAllocator.release(threadFrameMemory, size);
+                frameAllocator.release(frameMemory, size);
+            }
+        }
+};
+
+// Class TestTaskScheduler
+/**
+ * Unit test for the TaskScheduler and DefaultTaskScheduler classes
+ */
+class TestTaskScheduler : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestTaskScheduler(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+            testParallelFor();
+            testSerialExecution();
+            testNestedParallelFor();
+            testThreadAllocators();
+            testWorldUpdate();
+            testParallelNarrowPhase();
+            testParallelBroadPhase();
+            testParallelIslandsSolver();
+            testGraphColoringSolver();
+            testWideContactSolver();
+        }
+
+        /// Create a pile of bodies with different shapes falling on a static floor
+        void createPile(PhysicsWorld* world, std::vector<RigidBody*>& bodies, int nbLayers = 4) {
+
+            RigidBody* floor = world->createRigidBody(Transform::identity());
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CapsuleShape* capsuleShape = mPhysicsCommon.createCapsuleShape(decimal(0.4), decimal(0.5));
+
+            for (int y=0; y < nbLayers; y++) {
+                for (int x=0; x < 5; x++) {
+                    for (int z=0; z < 5; z++) {
+
+                        const Vector3 position(decimal(x) * decimal(1.01), decimal(1.6) + decimal(y) * decimal(1.05), decimal(z) * decimal(1.01));
+                        RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+
+                        const int shapeIndex = (x + y + z) % 3;
+                        if (shapeIndex == 0) body->addCollider(boxShape, Transform::identity());
+                        else if (shapeIndex == 1) body->addCollider(sphereShape, Transform::identity());
+                        else body->addCollider(capsuleShape, Transform::identity());
+
+                        bodies.push_back(body);
+                    }
+                }
+            }
+        }
+
+        void createStacksAndJoints(PhysicsWorld* world, std::vector<RigidBody*>& bodies) {
+
+            RigidBody* floor = world->createRigidBody(Transform::identity());
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            // Separated stacks of boxes on the static floor (one island per stack)
+            for (int x=0; x < 6; x++) {
+                for (int z=0; z < 6; z++) {
+                    for (int y=0; y < 3; y++) {
+
+                        const Vector3 position(decimal(x * 3 - 20), decimal(1.6) + decimal(y) * decimal(1.05), decimal(z * 3 - 20));
+                        RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                        body->addCollider(boxShape, Transform::identity());
+                        bodies.push_back(body);
+                    }
+                }
+            }
+
+            // Chain of bodies attached to a static anchor with ball-and-socket joints
+            RigidBody* anchor = world->createRigidBody(Transform(Vector3(10, 20, 10), Quaternion::identity()));
+            anchor->setType(BodyType::STATIC);
+            RigidBody* previousBody = anchor;
+            for (int i=1; i <= 5; i++) {
+
+                RigidBody* body = world->createRigidBody(Transform(Vector3(decimal(10 + i), 20, 10), Quaternion::identity()));
+                body->addCollider(boxShape, Transform::identity());
+                BallAndSocketJointInfo jointInfo(previousBody, body, Vector3(decimal(10 + i) - decimal(0.5), 20, 10));
+                world->createJoint(jointInfo);
+                bodies.push_back(body);
+                previousBody = body;
+            }
+
+            // Pairs of bodies connected with the other joint types and falling on the floor
+            for (int i=0; i < 3; i++) {
+
+                const Vector3 position1(decimal(15), decimal(3 + i * 3), decimal(-10 + i * 5));
+                const Vector3 position2 = position1 + Vector3(decimal(1.1), decimal(0.5), 0);
+                RigidBody* body1 = world->createRigidBody(Transform(position1, Quaternion::identity()));
+                RigidBody* body2 = world->createRigidBody(Transform(position2, Quaternion::identity()));
+                body1->addCollider(boxShape, Transform::identity());
+                body2->addCollider(boxShape, Transform::identity());
+                bodies.push_back(body1);
+                bodies.push_back(body2);
+
+                const Vector3 anchorPoint = (position1 + position2) * decimal(0.5);
+                if (i == 0) {
+                    FixedJointInfo jointInfo(body1, body2, anchorPoint);
+                    world->createJoint(jointInfo);
+                }
+                else if (i == 1) {
+                    HingeJointInfo jointInfo(body1, body2, anchorPoint, Vector3(0, 0, 1));
+                    world->createJoint(jointInfo);
+                }
+                else {
+                    SliderJointInfo jointInfo(body1, body2, anchorPoint, Vector3(1, 0, 0));
+                    world->createJoint(jointInfo);
+                }
+            }
+        }
+
+        void testParallelFor() {
+
+            const uint32 nbThreads = 4;
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(nbThreads);
+            rp3d_test(scheduler->getNbThreads() == nbThreads);
+
+            const uint32 nbItems = 10007;
+            std::atomic<uint32>* counters = new std::atomic<uint32>[nbItems];
+
+            // Run the same scheduler multiple times with different batch sizes
+            const uint32 batchSizes[] = {1, 7, 64, 5000, 20000};
+            for (uint32 b=0; b < 5; b++) {
+
+                for (uint32 i=0; i < nbItems; i++) counters[i] = 0;
+
+                CountItemsTask task(counters, nbThreads);
+                scheduler->parallelFor(task, nbItems, batchSizes[b]);
+
+                bool isAllItemsProcessedOnce = true;
+                for (uint32 i=0; i < nbItems; i++) {
+                    if (counters[i] != 1) isAllItemsProcessedOnce = false;
+                }
+                rp3d_test(isAllItemsProcessedOnce);
+                rp3d_test(task.nbInvalidThreadIndices == 0);
+            }
+
+            delete[] counters;
+
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testSerialExecution() {
+
+            const uint32 nbItems = 100;
+            std::atomic<uint32> counters[nbItems];
+            for (uint32 i=0; i < nbItems; i++) counters[i] = 0;
+
+            // Without scheduler, the task is executed by the calling thread
+            CountItemsTask task(counters, 1);
+            TaskScheduler::run(nullptr, task, nbItems, 8);
+
+            bool isAllItemsProcessedOnce = true;
+            for (uint32 i=0; i < nbItems; i++) {
+                if (counters[i] != 1) isAllItemsProcessedOnce = false;
+            }
+            rp3d_test(isAllItemsProcessedOnce);
+            rp3d_test(task.nbInvalidThreadIndices == 0);
+
+            // A scheduler with a single thread does not create any worker
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(1);
+            rp3d_test(scheduler->getNbThreads() == 1);
+            CountItemsTask task2(counters, 1);
+            TaskScheduler::run(scheduler, task2, nbItems, 8);
+            rp3d_test(counters[0] == 2);
+            rp3d_test(counters[nbItems - 1] == 2);
+            rp3d_test(task2.nbInvalidThreadIndices == 0);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testNestedParallelFor() {
+
+            const uint32 nbThreads = 3;
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(nbThreads);
+
+            const uint32 nbItems = 1000;
+            std::atomic<uint32>* counters = new std::atomic<uint32>[nbItems];
+            for (uint32 i=0; i < nbItems; i++) counters[i] = 0;
+
+            CountItemsTask task(counters, nbThreads);
+            task.nestedScheduler = scheduler;
+            scheduler->parallelFor(task, nbItems, 10);
+
+            rp3d_test(task.nbNestedItems == nbItems);
+            rp3d_test(task.nbInvalidThreadIndices == 0);
+
+            delete[] counters;
+
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testThreadAllocators() {
+
+            const uint32 nbThreads = 4;
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(nbThreads);
+
+            // The memory manager checks (in debug mode) that all the memory units of the caches
+            // have been given back to the pool allocator when it is destroyed
+            MemoryManager memoryManager(nullptr);
+            memoryManager.createThreadAllocators(nbThreads);
+
+            // Run the task multiple times (the single frame allocators are full and grow between the frames)
+            for (uint32 frame=0; frame < 3; frame++) {
+
+                AllocateMemoryTask task(memoryManager);
+                scheduler->parallelFor(task, 20000, 16);
+                rp3d_test(task.nbCorruptedItems == 0);
+
+                memoryManager.resetFrameAllocator();
+            }
+
+            // The allocators of the threads can also be used outside of a task
+            PoolAllocatorCache& poolAllocator = memoryManager.getThreadPoolAllocator(0);
+            void* memory = poolAllocator.allocate(64);
+            rp3d_test(memory != nullptr);
+            poolAllocator.release(memory, 64);
+            poolAllocator.flush();
+
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testWorldUpdate() {
+
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(4);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+            rp3d_test(world->getTaskScheduler() == scheduler);
+
+            RigidBody* body = world->createRigidBody(Transform(Vector3(0, 10, 0), Quaternion::identity()));
+            body->addCollider(mPhysicsCommon.createSphereShape(1), Transform::identity());
+
+            for (uint32 i=0; i < 10; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+            rp3d_test(body->getTransform().getPosition().y < decimal(10.0));
+
+            world->setTaskScheduler(nullptr);
+            rp3d_test(world->getTaskScheduler() == nullptr);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testParallelNarrowPhase() {
+
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(4);
+
+            // Serial world
+            PhysicsWorld* serialWorld = mPhysicsCommon.createPhysicsWorld();
+            std::vector<RigidBody*> serialBodies;
+            createPile(serialWorld, serialBodies);
+
+            // World that uses the task scheduler
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            PhysicsWorld* parallelWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> parallelBodies;
+            createPile(parallelWorld, parallelBodies);
+
+            for (uint32 i=0; i < 120; i++) {
+                serialWorld->update(decimal(1.0) / decimal(60.0));
+                parallelWorld->update(decimal(1.0) / decimal(60.0));
+            }
+
+            // The parallel narrow-phase must give exactly the same results
+            bool isSameResult = true;
+            for (size_t i=0; i < serialBodies.size(); i++) {
+                const Transform& serialTransform = serialBodies[i]->getTransform();
+                const Transform& parallelTransform = parallelBodies[i]->getTransform();
+                isSameResult &= serialTransform.getPosition() == parallelTransform.getPosition();
+                isSameResult &= serialTransform.getOrientation() == parallelTransform.getOrientation();
+            }
+            rp3d_test(isSameResult);
+
+            // The bodies must have collided with the floor
+            rp3d_test(parallelBodies[0]->getTransform().getPosition().y > decimal(1.0));
+            rp3d_test(parallelBodies[0]->getTransform().getPosition().y < decimal(1.6));
+
+            mPhysicsCommon.destroyPhysicsWorld(serialWorld);
+            mPhysicsCommon.destroyPhysicsWorld(parallelWorld);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testParallelBroadPhase() {
+
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(4);
+
+            // Serial world
+            PhysicsWorld* serialWorld = mPhysicsCommon.createPhysicsWorld();
+            std::vector<RigidBody*> serialBodies;
+            createPile(serialWorld, serialBodies, 16);
+
+            // World that updates the colliders AABBs and tests the moved shapes on the threads of the task scheduler
+            // (the large islands of the pile are not solved with the graph-colored solver that changes the order
+            // of the constraints and therefore does not give exactly the same result as the serial solver)
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            settings.graphColoringNbConstraintsThreshold = std::numeric_limits<uint32>::max();
+            PhysicsWorld* parallelWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> parallelBodies;
+            createPile(parallelWorld, parallelBodies, 16);
+
+            for (uint32 i=0; i < 60; i++) {
+                serialWorld->update(decimal(1.0) / decimal(60.0));
+                parallelWorld->update(decimal(1.0) / decimal(60.0));
+            }
+
+            // The parallel broad-phase must create the same overlapping pairs in the same order
+            bool isSameResult = true;
+            for (size_t i=0; i < serialBodies.size(); i++) {
+                const Transform& serialTransform = serialBodies[i]->getTransform();
+                const Transform& parallelTransform = parallelBodies[i]->getTransform();
+                isSameResult &= serialTransform.getPosition() == parallelTransform.getPosition();
+                isSameResult &= serialTransform.getOrientation() == parallelTransform.getOrientation();
+            }
+            rp3d_test(isSameResult);
+
+            // The bodies of the bottom layer must have collided with the floor
+            rp3d_test(parallelBodies[0]->getTransform().getPosition().y < decimal(1.6));
+
+            mPhysicsCommon.destroyPhysicsWorld(serialWorld);
+            mPhysicsCommon.destroyPhysicsWorld(parallelWorld);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testParallelIslandsSolver() {
+
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(4);
+
+            // Serial world
+            PhysicsWorld* serialWorld = mPhysicsCommon.createPhysicsWorld();
+            std::vector<RigidBody*> serialBodies;
+            createStacksAndJoints(serialWorld, serialBodies);
+
+            // World that solves the islands on the threads of the task scheduler
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            PhysicsWorld* parallelWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> parallelBodies;
+            createStacksAndJoints(parallelWorld, parallelBodies);
+
+            for (uint32 i=0; i < 120; i++) {
+                serialWorld->update(decimal(1.0) / decimal(60.0));
+                parallelWorld->update(decimal(1.0) / decimal(60.0));
+            }
+
+            // The islands solved in parallel must give exactly the same results
+            bool isSameResult = true;
+            for (size_t i=0; i < serialBodies.size(); i++) {
+                const Transform& serialTransform = serialBodies[i]->getTransform();
+                const Transform& parallelTransform = parallelBodies[i]->getTransform();
+                isSameResult &= serialTransform.getPosition() == parallelTransform.getPosition();
+                isSameResult &= serialTransform.getOrientation() == parallelTransform.getOrientation();
+                isSameResult &= serialBodies[i]->getLinearVelocity() == parallelBodies[i]->getLinearVelocity();
+                isSameResult &= serialBodies[i]->getAngularVelocity() == parallelBodies[i]->getAngularVelocity();
+            }
+            rp3d_test(isSameResult);
+
+            // The bottom box of the first stack must rest on the floor
+            rp3d_test(parallelBodies[0]->getTransform().getPosition().y > decimal(1.4));
+            rp3d_test(parallelBodies[0]->getTransform().getPosition().y < decimal(1.6));
+
+            // The first body of the chain must still be attached to the static anchor
+            const Vector3 chainBodyPosition = parallelBodies[6 * 6 * 3]->getTransform().getPosition();
+            rp3d_test((chainBodyPosition - Vector3(10, 20, 10)).length() < decimal(1.5));
+
+            mPhysicsCommon.destroyPhysicsWorld(serialWorld);
+            mPhysicsCommon.destroyPhysicsWorld(parallelWorld);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+
+        void testGraphColoringSolver() {
+
+            DefaultTaskScheduler* scheduler2 = mPhysicsCommon.createDefaultTaskScheduler(2);
+            DefaultTaskScheduler* scheduler4 = mPhysicsCommon.createDefaultTaskScheduler(4);
+
+            // Worlds where (almost) all the islands are solved with the graph-colored solver
+            PhysicsWorld::WorldSettings settings;
+            settings.graphColoringNbConstraintsThreshold = 2;
+
+            settings.taskScheduler = scheduler2;
+            PhysicsWorld* world2 = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> bodies2;
+            createStacksAndJoints(world2, bodies2);
+
+            settings.taskScheduler = scheduler4;
+            PhysicsWorld* world4 = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> bodies4;
+            createStacksAndJoints(world4, bodies4);
+
+            for (uint32 i=0; i < 120; i++) {
+                world2->update(decimal(1.0) / decimal(60.0));
+                world4->update(decimal(1.0) / decimal(60.0));
+            }
+
+            // The result of the graph-colored solver does not depend on the number of threads
+            bool isSameResult = true;
+            for (size_t i=0; i < bodies2.size(); i++) {
+                const Transform& transform2 = bodies2[i]->getTransform();
+                const Transform& transform4 = bodies4[i]->getTransform();
+                isSameResult &= transform2.getPosition() == transform4.getPosition();
+                isSameResult &= transform2.getOrientation() == transform4.getOrientation();
+            }
+            rp3d_test(isSameResult);
+
+            // The stacks must be stable
+            bool isStacksStable = true;
+            for (size_t i=0; i < 6 * 6 * 3; i += 3) {
+                const Vector3 bottomPosition = bodies4[i]->getTransform().getPosition();
+                const Vector3 topPosition = bodies4[i + 2]->getTransform().getPosition();
+                isStacksStable &= bottomPosition.y > decimal(1.4) && bottomPosition.y < decimal(1.6);
+                isStacksStable &= topPosition.y > decimal(3.4) && topPosition.y < decimal(3.6);
+            }
+            rp3d_test(isStacksStable);
+
+            // The first body of the chain must still be attached to the static anchor
+            const Vector3 chainBodyPosition = bodies4[6 * 6 * 3]->getTransform().getPosition();
+            rp3d_test((chainBodyPosition - Vector3(10, 20, 10)).length() < decimal(1.5));
+
+            mPhysicsCommon.destroyPhysicsWorld(world2);
+            mPhysicsCommon.destroyPhysicsWorld(world4);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler2);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler4);
+        }
+
+        void testWideContactSolver() {
+
+            DefaultTaskScheduler* scheduler = mPhysicsCommon.createDefaultTaskScheduler(3);
+
+            // Worlds where the contacts of the large islands are solved with the scalar and the wide solvers
+            PhysicsWorld::WorldSettings settings;
+            settings.taskScheduler = scheduler;
+            settings.graphColoringNbConstraintsThreshold = 2;
+
+            settings.isWideContactSolverEnabled = false;
+            PhysicsWorld* scalarWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> scalarBodies;
+            createStacksAndJoints(scalarWorld, scalarBodies);
+
+            settings.isWideContactSolverEnabled = true;
+            PhysicsWorld* wideWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            std::vector<RigidBody*> wideBodies;
+            createStacksAndJoints(wideWorld, wideBodies);
+
+            for (uint32 i=0; i < 120; i++) {
+                scalarWorld->update(decimal(1.0) / decimal(60.0));
+                wideWorld->update(decimal(1.0) / decimal(60.0));
+            }
+
+            // Each lane of the wide solver must give the same result as the scalar solver
+            bool isSameResult = true;
+            for (size_t i=0; i < scalarBodies.size(); i++) {
+                const Transform& scalarTransform = scalarBodies[i]->getTransform();
+                const Transform& wideTransform = wideBodies[i]->getTransform();
+                isSameResult &= Vector3::approxEqual(scalarTransform.getPosition(), wideTransform.getPosition(), decimal(0.0001));
+                isSameResult &= Vector3::approxEqual(scalarBodies[i]->getLinearVelocity(), wideBodies[i]->getLinearVelocity(), decimal(0.0001));
+                isSameResult &= Vector3::approxEqual(scalarBodies[i]->getAngularVelocity(), wideBodies[i]->getAngularVelocity(), decimal(0.0001));
+            }
+            rp3d_test(isSameResult);
+
+            // The stacks must be stable
+            bool isStacksStable = true;
+            for (size_t i=0; i < 6 * 6 * 3; i += 3) {
+                const Vector3 bottomPosition = wideBodies[i]->getTransform().getPosition();
+                const Vector3 topPosition = wideBodies[i + 2]->getTransform().getPosition();
+                isStacksStable &= bottomPosition.y > decimal(1.4) && bottomPosition.y < decimal(1.6);
+                isStacksStable &= topPosition.y > decimal(3.4) && topPosition.y < decimal(3.6);
+            }
+            rp3d_test(isStacksStable);
+
+            mPhysicsCommon.destroyPhysicsWorld(scalarWorld);
+            mPhysicsCommon.destroyPhysicsWorld(wideWorld);
+            mPhysicsCommon.destroyDefaultTaskScheduler(scheduler);
+        }
+};
+
+}
+
+#endif